@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,420 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed by (dev, blockno) into NBUCKET chains, each
+// with its own spin lock protecting the chain and the refcnt of the
+// buffers on it, so that cache hits on different blocks do not
+// contend. A miss takes bcache.lock, which serializes everything that
+// moves buffers between chains: recycling the least recently
+// released idle buffer, growing the cache and shrinking it. Idle
+// buffers that are not dirty wait for recycling on an LRU list with
+// a lock of its own, bcache.lrulock, taken after a chain's lock.
+//
+// NBUF buffers are built into the kernel. Beyond those the cache
+// grows a page of buffer data at a time, up to a limit set at boot
+// from the amount of physical memory, but only with pages that are
+// free anyway. When kalloc() runs out of pages it calls bshrink() to
+// take back a page of idle buffers before resorting to swapping. The
+// headers of the buffers of a page are in a struct bufpage, carved
+// out of pages that are kept for good, so that a page of data holds
+// whole blocks whatever BSIZE is.
+//
+// bdwrite() is a delayed bwrite(): it marks the buffer B_DELWRI and
+// returns at once. The bflush kernel thread writes delayed buffers
+// back once they are MAXAGE ticks old, or all of them when more than
+// DIRTYPCT percent of the cache is waiting, merging consecutive
+// blocks into one disk request. B_DIRTY stays set until the write,
+// so the buffer cannot be recycled before then. bsync() is a write
+// barrier: it returns only when every delayed write issued before
+// it is on disk, which is how the log orders its writes.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
+extern char end[];  // first address after kernel loaded from ELF file
+
+#define NBUCKET 31
+#define FLUSHTICKS 50  // how often bflush runs
+#define MAXAGE 300     // ticks a delayed write may wait
+#define DIRTYPCT 50
+#define NFLUSH 32      // buffers written per batch
+#define BCACHEFRAC 8  // at most 1/BCACHEFRAC of memory for extra buffers
+
+// The buffers whose data is a page from kalloc().
+#define BPERPAGE (PGSIZE / BSIZE)
+struct bufpage {
+  struct bufpage *next;
+  char *mem;
+  struct buf buf[BPERPAGE];
+};
+
+struct bucket {
+  struct spinlock lock;
+  struct buf head;  // chain through prev/next
+};
+
 struct {
   struct spinlock lock;
+  struct bucket bucket[NBUCKET];
   struct buf buf[NBUF];
-
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  uchar data[NBUF][BSIZE];
+  struct buf *spare;       // Buffers on no chain, through next; prev is 0
+  struct bufpage *pages;   // Buffers beyond NBUF
+  struct bufpage *freepg;  // Unused bufpages
+  uint nbuf;               // Buffers in the cache
+  uint minbuf;             // bshrink() keeps at least this many
+  uint maxbuf;             // Limit on nbuf
+  struct spinlock lrulock;
+  struct buf lru;          // Idle buffers, least recently released first
+  uint ndelwri;            // Buffers with B_DELWRI set
 } bcache;
 
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev + blockno) % NBUCKET];
+}
+
+static void
+bunlink(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
+static void
+blink(struct bucket *bk, struct buf *b)
+{
+  b->next = bk->head.next;
+  b->prev = &bk->head;
+  bk->head.next->prev = b;
+  bk->head.next = b;
+}
+
+// Take b off the LRU list, if it is on it.
+// Caller must hold bcache.lrulock.
+static void
+lrudel(struct buf *b)
+{
+  if(b->lprev == 0)
+    return;
+  b->lnext->lprev = b->lprev;
+  b->lprev->lnext = b->lnext;
+  b->lprev = b->lnext = 0;
+}
+
+// Take a reference to b, which is on a chain.
+// Caller must hold the chain's lock.
+static void
+bhold(struct buf *b)
+{
+  if(b->refcnt++ == 0){
+    acquire(&bcache.lrulock);
+    lrudel(b);
+    release(&bcache.lrulock);
+  }
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.lrulock, "bcache.lru");
+  bcache.lru.lprev = bcache.lru.lnext = &bcache.lru;
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    initlock(&bk->lock, "bcache.bucket");
+    bk->head.prev = &bk->head;
+    bk->head.next = &bk->head;
+  }
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->data = bcache.data[b - bcache.buf];
+    b->next = bcache.spare;
+    bcache.spare = b;
+  }
+  bcache.nbuf = NBUF;
+  bcache.minbuf = NBUF;
+  bcache.maxbuf = NBUF +
+    (PHYSTOP - V2P(end)) / PGSIZE / BCACHEFRAC * BPERPAGE;
+}
+
+// Add a page of buffers to the spare list, if a page is free.
+// Caller must hold bcache.lock.
+static int
+bgrow(void)
+{
+  struct bufpage *pg;
+  struct buf *b;
+  char *mem;
+
+  if(bcache.nbuf + BPERPAGE > bcache.maxbuf)
+    return 0;
+  if(bcache.freepg == 0){
+    if((mem = trykalloc()) == 0)
+      return 0;
+    for(pg = (struct bufpage*)mem; pg+1 <= (struct bufpage*)(mem+PGSIZE); pg++){
+      pg->next = bcache.freepg;
+      bcache.freepg = pg;
+    }
+  }
+  if((mem = trykalloc()) == 0)
+    return 0;
+  pg = bcache.freepg;
+  bcache.freepg = pg->next;
+  pg->mem = mem;
+  for(b = pg->buf; b < pg->buf+BPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    b->data = (uchar*)mem + (b - pg->buf)*BSIZE;
+    b->flags = 0;
+    b->refcnt = 0;
+    b->prev = 0;
+    b->lprev = b->lnext = 0;
+    b->next = bcache.spare;
+    bcache.spare = b;
+  }
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.nbuf += BPERPAGE;
+  return 1;
+}
+
+// Take the least recently released idle buffer off its chain.
+// Caller must hold bcache.lock, which keeps chains from changing.
+static struct buf*
+bvictim(void)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  for(;;){
+    acquire(&bcache.lrulock);
+    b = bcache.lru.lnext;
+    release(&bcache.lrulock);
+    if(b == &bcache.lru)
+      return 0;
+    bk = bhash(b->dev, b->blockno);
+    acquire(&bk->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      acquire(&bcache.lrulock);
+      lrudel(b);
+      release(&bcache.lrulock);
+      bunlink(b);
+      release(&bk->lock);
+      return b;
+    }
+    if(b->refcnt == 0){
+      // Dirty; it goes back on the list once written.
+      acquire(&bcache.lrulock);
+      lrudel(b);
+      release(&bcache.lrulock);
+    }
+    release(&bk->lock);  // picked up again meanwhile; look again
   }
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For readahead (ahead set), return 0 instead if the block is
+// already cached or no buffer is free; a buffer that is returned
+// is new, so locking it does not sleep.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
+  struct bucket *bk = bhash(dev, blockno);
   struct buf *b;
 
-  acquire(&bcache.lock);
+  acquire(&bk->lock);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head.next; b != &bk->head; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
+      bhold(b);
+      release(&bk->lock);
       acquiresleep(&b->lock);
       return b;
     }
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+  // Not cached. Another miss on the same block may have
+  // brought it in while we waited for bcache.lock.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  for(b = bk->head.next; b != &bk->head; b = b->next){
+    if(b->dev == dev && b->blockno == blockno){
+      if(ahead){
+        release(&bk->lock);
+        release(&bcache.lock);
+        return 0;
+      }
+      bhold(b);
+      release(&bk->lock);
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
     }
   }
-  panic("bget: no buffers");
+  release(&bk->lock);
+
+  if(bcache.spare || bgrow()){
+    b = bcache.spare;
+    bcache.spare = b->next;
+  } else if((b = bvictim()) == 0){
+    release(&bcache.lock);
+    if(ahead)
+      return 0;
+    if(bcache.ndelwri == 0)
+      panic("bget: no buffers");
+    // Everything idle is waiting to be written back.
+    bsync();
+    return bget(dev, blockno, 0);
+  }
+
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->cnext = 0;
+  acquire(&bk->lock);
+  blink(bk, b);
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Keep n buffers beyond NBUF in the cache for good, growing it
+// now. The log pins up to n buffers until they commit.
+// Returns 0 if there is not enough memory.
+int
+breserve(int n)
+{
+  int ok;
+
+  acquire(&bcache.lock);
+  bcache.minbuf = NBUF + n;
+  if(bcache.maxbuf < bcache.minbuf + BPERPAGE)
+    bcache.maxbuf = bcache.minbuf + BPERPAGE;
+  ok = 1;
+  while(ok && bcache.nbuf < bcache.minbuf)
+    ok = bgrow();
+  release(&bcache.lock);
+  return ok;
+}
+
+// Give a page of idle buffers back to the page allocator.
+// Called by kalloc() when memory runs out; does not sleep.
+// Returns 1 if a page was freed.
+int
+bshrink(void)
+{
+  struct bufpage *pg, **pp;
+  struct bucket *bk;
+  struct buf *b, **bp;
+  int idle;
+
+  acquire(&bcache.lock);
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+    if(bcache.nbuf - BPERPAGE < bcache.minbuf)
+      break;
+    idle = 1;
+    for(b = pg->buf; b < pg->buf+BPERPAGE && idle; b++){
+      if(b->prev == 0)
+        continue;  // spare
+      bk = bhash(b->dev, b->blockno);
+      acquire(&bk->lock);
+      if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+        acquire(&bcache.lrulock);
+        lrudel(b);
+        release(&bcache.lrulock);
+        bunlink(b);
+        b->prev = 0;
+        b->flags = 0;
+        b->next = bcache.spare;
+        bcache.spare = b;
+      } else
+        idle = 0;
+      release(&bk->lock);
+    }
+    if(!idle)
+      continue;  // the buffers we unhashed stay spare
+    for(bp = &bcache.spare; *bp; ){
+      if(*bp >= pg->buf && *bp < pg->buf+BPERPAGE)
+        *bp = (*bp)->next;
+      else
+        bp = &(*bp)->next;
+    }
+    *pp = pg->next;
+    pg->next = bcache.freepg;
+    bcache.freepg = pg;
+    bcache.nbuf -= BPERPAGE;
+    release(&bcache.lock);
+    kfree(pg->mem);
+    return 1;
+  }
+  release(&bcache.lock);
+  return 0;
+}
+
+static void bput(struct buf*);
+
+// Start reading the n blocks blocks[] of dev that are not already
+// cached, and return without waiting for them. Runs of consecutive
+// block numbers are read with one disk request each. A later bread()
+// of one of the blocks waits for its read to finish.
+void
+breadahead(uint dev, uint *blocks, int n)
+{
+  struct buf *b, *head, *tail;
+  int i, len;
+
+  head = tail = 0;
+  len = 0;
+  for(i = 0; i < n; i++){
+    if((b = bget(dev, blocks[i], 1)) == 0)
+      continue;
+    b->flags |= B_ASYNC;
+    if(tail && tail->blockno + 1 == b->blockno && len < MAXCLUSTER){
+      tail->cnext = b;
+      tail = b;
+      len++;
+      continue;
+    }
+    if(head)
+      ideasync(head);
+    head = tail = b;
+    len = 1;
+  }
+  if(head)
+    ideasync(head);
+}
+
+// Release a buffer whose asynchronous read has finished.
+// Called from the disk interrupt handler on behalf of the
+// process that started the read.
+void
+bdone(struct buf *b)
+{
+  b->flags &= ~B_ASYNC;
+  bput(b);
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +439,25 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
   return b;
 }
 
+// Return a locked buf for a block that the caller is going
+// to overwrite whole, without reading it from disk.
+struct buf*
+bgetblk(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,29 +468,181 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write b back later. Must be locked.
+void
+bdwrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bdwrite");
+  if(!(b->flags & B_DELWRI)){
+    b->flags |= B_DELWRI;
+    b->dirtytime = ticks;
+    __sync_fetch_and_add(&bcache.ndelwri, 1);
+  }
+  b->flags |= B_DIRTY;
+}
+
+// Cancel b's delayed write, if any. Must be locked.
+// Returns 1 if there was one.
+int
+bundelay(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bundelay");
+  if(!(b->flags & B_DELWRI))
+    return 0;
+  b->flags &= ~B_DELWRI;
+  __sync_fetch_and_sub(&bcache.ndelwri, 1);
+  return 1;
+}
+
+// Take a reference to up to n buffers with delayed writes at least
+// age ticks old and store them in v, sorted by block number. If
+// inflight, also take write-backs already on their way to the disk.
+// Skips buffers the caller holds. Returns the number found.
+static int
+bcollect(struct buf **v, int n, uint age, int inflight)
+{
+  struct bucket *bk;
+  struct buf *b;
+  int i, k;
+
+  k = 0;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET && k < n; bk++){
+    acquire(&bk->lock);
+    for(b = bk->head.next; b != &bk->head && k < n; b = b->next){
+      if(b->flags & B_DELWRI){
+        if(ticks - b->dirtytime < age)
+          continue;
+      } else if(!inflight || (b->flags & (B_ASYNC|B_DIRTY)) != (B_ASYNC|B_DIRTY))
+        continue;
+      if(holdingsleep(&b->lock))
+        continue;
+      bhold(b);
+      for(i = k++; i > 0 && v[i-1]->blockno > b->blockno; i--)
+        v[i] = v[i-1];
+      v[i] = b;
+    }
+    release(&bk->lock);
+  }
+  return k;
+}
+
+// Write back the delayed buffers v[0..n) found by bcollect() and
+// drop the references to them. If wait, return once they are all on
+// disk; otherwise bdone() releases each when its write completes.
+static void
+bwritev(struct buf **v, int n, int wait)
+{
+  struct buf *b, *head, *tail;
+  int i, len;
+
+  head = tail = 0;
+  len = 0;
+  for(i = 0; i < n; i++){
+    b = v[i];
+    acquiresleep(&b->lock);
+    if(!(b->flags & B_DELWRI)){
+      // Written meanwhile, maybe by the write we waited for.
+      v[i] = 0;
+      bput(b);
+      continue;
+    }
+    b->flags &= ~B_DELWRI;
+    __sync_fetch_and_sub(&bcache.ndelwri, 1);
+    if(!wait)
+      b->flags |= B_ASYNC;
+    if(tail && tail->blockno + 1 == b->blockno && tail->dev == b->dev &&
+       len < MAXCLUSTER){
+      tail->cnext = b;
+      tail = b;
+      len++;
+      continue;
+    }
+    if(head)
+      ideasync(head);
+    head = tail = b;
+    len = 1;
+  }
+  if(head)
+    ideasync(head);
+  if(!wait)
+    return;
+  for(i = 0; i < n; i++){
+    if(v[i] == 0)
+      continue;
+    iderwait(v[i]);
+    bput(v[i]);
+  }
+}
+
+// Write barrier: write back all delayed buffers and wait for them.
+void
+bsync(void)
+{
+  struct buf *v[NFLUSH];
+  int n;
+
+  while((n = bcollect(v, NELEM(v), 0, 1)) > 0)
+    bwritev(v, n, 1);
+}
+
+// The bflush kernel thread.
+static void
+bflush(void)
+{
+  struct buf *v[NFLUSH];
+  uint age;
+  int n;
+
+  for(;;){
+    sleepticks(FLUSHTICKS);
+    age = MAXAGE;
+    if(bcache.ndelwri > bcache.nbuf * DIRTYPCT / 100)
+      age = 0;
+    while((n = bcollect(v, NELEM(v), age, 0)) > 0)
+      bwritev(v, n, 0);
+  }
+}
+
+void
+bflushinit(void)
+{
+  if(kthread("bflush", bflush) < 0)
+    panic("bflushinit");
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Once idle it becomes a candidate for recycling,
+// least recently released first.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bput(b);
+}
+
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
+  if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+    acquire(&bcache.lrulock);
+    b->lnext = &bcache.lru;
+    b->lprev = bcache.lru.lprev;
+    bcache.lru.lprev->lnext = b;
+    bcache.lru.lprev = b;
+    release(&bcache.lrulock);
+  }
+  release(&bk->lock);
 }
 //PAGEBREAK!
 // Blank page.
@@ -146,23 +651,53 @@ void
 write_page(char *pg, uint blk)
 {
   struct buf* buffer;
-  for(int i=0;i<8;i++){
-    buffer=bget(ROOTDEV,blk+i);
-    memmove(buffer->data,pg + i*512,512);  
-    bwrite(buffer);
+  for(int i=0;i<PGBLOCKS;i++){
+    buffer=bgetblk(ROOTDEV,blk+i);
+    memmove(buffer->data,pg + i*BSIZE,BSIZE);  
+    bdwrite(buffer);
     brelse(buffer);                               
   }
 }
 
 
+// The blocks of the page that are not cached are read with one
+// request per run, marked B_PRIO to go ahead of other disk I/O
+// since a faulting process is waiting for them. A cached block ends
+// a run; one still to be written out is taken from the cache too,
+// as a request reads or writes all its blocks.
 void
 read_page(char *pg, uint blk)
 {
-  struct buf* buffer;
-  for(int i=0;i<8;i++){
-    buffer=bread(ROOTDEV,blk+i);   
-    memmove(pg+i*512, buffer->data,512);  
-    brelse(buffer);            
+  struct buf *b[PGBLOCKS], *head, *tail;
+  int i;
+
+  head = tail = 0;
+  for(i=0;i<PGBLOCKS;i++){
+    b[i]=bget(ROOTDEV,blk+i,0);
+    if(b[i]->flags & (B_VALID|B_DIRTY)){
+      if(head)
+        ideasync(head);
+      head = tail = 0;
+      continue;
+    }
+    b[i]->flags |= B_PRIO;
+    b[i]->cnext = 0;
+    if(tail)
+      tail->cnext = b[i];
+    else
+      head = b[i];
+    tail = b[i];
+  }
+  if(head)
+    ideasync(head);
+
+  for(i=0;i<PGBLOCKS;i++){
+    if(b[i]->flags & B_PRIO){
+      iderwait(b[i]);
+      b[i]->flags &= ~B_PRIO;
+    }
+    memmove(pg+i*BSIZE, b[i]->data,BSIZE);
+    brelse(b[i]);
   }
 }
 
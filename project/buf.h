@@ -4,11 +4,30 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *lprev; // LRU list, while idle and not dirty
+  struct buf *lnext;
+  uint dirtytime;   // ticks when B_DELWRI was set
+  struct buf *prev; // hash chain
   struct buf *next;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  struct buf *cnext; // next block of a multi-block disk request
+  int ioclass;       // of the request, for iosched.c
+  uint deadline;     // ticks by which the request should start
+  uchar *data;       // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // no one waits for the I/O; bdone() releases the buffer
+#define B_DELWRI 0x10 // delayed write: bflush writes it back later
+#define B_PRIO 0x20   // swap-in read: a faulting process waits for it
+
+#define MAXCLUSTER 16  // most blocks in one disk request
+
+#define NIOCLASS 3
+
+// Disk requests waiting to start, for iosched.c.
+struct ioq {
+  struct buf *q[NIOCLASS];  // one queue per class, sorted by blockno
+  uint pos;                 // block after the last request started
+};
 
@@ -9,6 +9,11 @@ cat(int fd)
 {
   int n;
 
+  // A file goes to the output without passing through buf.
+  while((n = sendfile(1, fd, -1, 8*sizeof(buf))) > 0)
+    ;
+  if(n == 0)
+    return;
   while((n = read(fd, buf, sizeof(buf))) > 0) {
     if (write(1, buf, n) != n) {
       printf(1, "cat: write error\n");
@@ -2,7 +2,10 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct ioq;
+struct lockstat;
 struct pipe;
+struct pcidev;
 struct proc;
 struct rtcdate;
 struct spinlock;
@@ -13,8 +16,17 @@ struct superblock;
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bgetblk(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bdwrite(struct buf*);
+void            bsync(void);
+void            bflushinit(void);
+int             breserve(int);
+int             bundelay(struct buf*);
+void            breadahead(uint, uint*, int);
+void            bdone(struct buf*);
+int             bshrink(void);
 void            write_page(char *, uint);
 void            read_page(char *, uint);
 
@@ -26,6 +38,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execfault(struct proc*, uint);
 
 // file.c
 struct file*    filealloc(void);
@@ -33,21 +46,27 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filesend(struct file*, struct file*, int, int);
+int             filesplice(struct file*, struct file*, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+int             fsordered(void);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
-struct inode*   ialloc(uint, short);
+void            dirunlink(struct inode*, char*);
+struct inode*   ialloc(uint, short, uint);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
+void            initalloc(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
+char*           ipage(struct inode*, uint);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
@@ -55,10 +74,19 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
-// ide.c
+// ide.c or virtio.c
+extern int      diskirq;
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            ideasync(struct buf*);
+void            iderwait(struct buf*);
+
+// iosched.c
+void            ioqadd(struct ioq*, struct buf*);
+void            ioqcheck(struct buf*);
+int             ioqempty(struct ioq*);
+struct buf*     ioqnext(struct ioq*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -67,6 +95,7 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           trykalloc(void);
 uint            num_of_FreePages(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
@@ -79,21 +108,52 @@ void            kbdintr(void);
 void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
+extern uint     lapictick;
+uint            lapiccalibrate(void);
+uint            lapiccount(void);
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
+void            lapiconeshot(uint);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_free(uint);
+int             log_freed(uint);
 void            begin_op();
 void            end_op();
 
+// mmap.c
+uint            mmap(uint, int, int, struct file*, uint);
+int             munmap(struct proc*, uint, uint);
+void            munmapall(struct proc*);
+int             mmapfork(struct proc*, struct proc*);
+int             mmapfault(struct proc*, uint, int);
+int             mmapbusy(struct proc*, uint, uint);
+int             mmapdead(struct proc*, uint);
+int             mmapped(struct proc*, uint, uint, int);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pagecache.c
+void            pcinit(void);
+char*           pclookup(uint, uint, uint);
+char*           pcalloc(uint, uint, uint);
+int             pccached(uint, uint, uint);
+void            pcput(char*);
+void            pcinval(uint, uint);
+int             pcshrink(void);
+
+// pci.c
+int             pcifind(uint, uint, struct pcidev*);
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -106,9 +166,12 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void(*)(void*), void*, void*);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             futexwait(uint, int);
+int             futexwake(uint, int);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
@@ -127,6 +190,9 @@ void            print_rss(void);
 struct proc *   victim_proc(void);
 int             is_proc(int);
 struct proc*    get_proc(int);
+int             join(void**);
+int             kthread(char*, void(*)(void));
+int             vmshared(struct proc*);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -136,10 +202,20 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockstats(struct lockstat*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// rcu.c
+void            call_rcu(void (*)(void*), void*);
+void            rcuinit(void);
+void            rcu_poll(void);
+void            rcu_read_lock(void);
+void            rcu_read_unlock(void);
+void            rcu_quiescent(void);
+void            synchronize_rcu(void);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -158,13 +234,24 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argwptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
 
+// textcache.c
+void            tcinit(void);
+int             tcheld(pte_t*);
+int             tcmap(uint, uint, uint, uint, uint, pte_t*);
+void            tcadd(uint, uint, uint, uint, uint, char*);
+int             tcshrink(void);
+
 // timer.c
 void            timerinit(void);
+void            timerintr(void);
+int             sleepticks(uint);
+int             sleepus(uint);
 
 // trap.c
 void            idtinit(void);
@@ -185,6 +272,7 @@ char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
+void            freepgdir(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint, struct proc*);
@@ -193,22 +281,27 @@ void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
 pte_t*          walkpgdir(pde_t *pgdir, const void *va, int alloc);
+void            tlbintr(void);
+void            tlbshootdown(pde_t*);
 
 // pageswap.c
 void            init_rmap(void);
 void            share_add(uint, pte_t*);
 int             share_remove(uint, pte_t*);
-void            share_split(uint, pte_t*);
-void            add_swap(uint, uint, uint);
-void            remove_swap(uint, pte_t*);
+void            share_split(pte_t*);
+int             share_fork(pte_t*, pte_t*, int);
+int             swap_out(uint, pte_t*, uint);
+int             unmap_page(pte_t*);
 void            init_slot();
 pte_t*          victim_page();
 void            unset_access(pde_t*,int);
 void            allocate_page();
+int             share_count(uint);
 void            clean_swap(pde_t*);
-void            page_fault();
+int             page_fault(uint);
+struct sleeplock* lockfaults(struct proc*);
+void            unlockfaults(struct sleeplock*);
 void            page_fault_swap(pte_t*);
-void            recover_swap(uint, uint);
 void            change_rss(uint, int);
 
 
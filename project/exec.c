@@ -5,6 +5,10 @@
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 #include "elf.h"
 
 int
@@ -14,10 +18,16 @@ exec(char *path, char **argv)
   int i, off;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
-  struct inode *ip;
+  struct inode *ip, *exe, *oldexe;
   struct proghdr ph;
+  struct seg seg[NSEG];
   pde_t *pgdir, *oldpgdir;
   struct proc *curproc = myproc();
+  int nseg;
+
+  // Other threads would be left running in the old image.
+  if(vmshared(curproc))
+    return -1;
 
   begin_op();
 
@@ -28,6 +38,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  exe = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -38,26 +49,42 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Record the program's segments; execfault() reads their pages
+  // as they are first touched. Segments beyond NSEG are loaded now.
   sz = 0;
+  nseg = 0;
+  memset(seg, 0, sizeof(seg));
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
-    if(ph.type != ELF_PROG_LOAD)
+    if(ph.type != ELF_PROG_LOAD || ph.memsz == 0)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if(ph.vaddr + ph.memsz < ph.vaddr)
-      goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
-      goto bad;
+    if(nseg < NSEG){
+      seg[nseg].va = ph.vaddr;
+      seg[nseg].memsz = ph.memsz;
+      seg[nseg].filesz = ph.filesz;
+      seg[nseg].off = ph.off;
+      nseg++;
+    } else {
+      if(allocuvm(pgdir, ph.vaddr, ph.vaddr + ph.memsz) == 0)
+        goto bad;
+      if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+        goto bad;
+    }
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
-  iunlockput(ip);
+  iunlock(ip);
   end_op();
+  // Keep the reference for execfault(), which also maps the pages
+  // between segments, even if every segment was loaded now.
+  exe = ip;
   ip = 0;
 
   // Allocate two pages at the next page boundary.
@@ -94,13 +121,24 @@ exec(char *path, char **argv)
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
   // Commit to the user image.
+  munmapall(curproc);
   oldpgdir = curproc->pgdir;
+  oldexe = curproc->exe;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
+  curproc->exe = exe;
+  memmove(curproc->seg, seg, sizeof(seg));
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  // Lockless process table readers may hold oldpgdir.
+  deallocuvm(oldpgdir, KERNBASE, 0);
+  call_rcu((void(*)(void*))freepgdir, oldpgdir);
+  if(oldexe){
+    begin_op();
+    iput(oldexe);
+    end_op();
+  }
   return 0;
 
  bad:
@@ -110,5 +148,86 @@ exec(char *path, char **argv)
     iunlockput(ip);
     end_op();
   }
+  if(exe){
+    begin_op();
+    iput(exe);
+    end_op();
+  }
   return -1;
 }
+
+// Read the page at va, in a segment of p's program, from the
+// program file. Called by page_fault() with p's faults locked.
+// Returns -1 if there is no memory. Pages read this way are
+// marked PTE_E: until written, they can be dropped rather than
+// swapped out, and read again; see swap_out().
+int
+execfault(struct proc *p, uint va)
+{
+  struct proc *img = image(p);
+  struct inode *exe;
+  struct seg *s;
+  pte_t *pte;
+  char *mem;
+  uint off, n;
+  int locked, r;
+
+  if(img->exe == 0)
+    return -1;
+  for(s = img->seg; s < &img->seg[NSEG]; s++)
+    if(s->memsz && s->va <= va && va < s->va + s->memsz)
+      break;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(p->pgdir, (void*)va, 1)) == 0)
+    return -1;
+  if(*pte != 0){
+    // Another thread got here first; drop our stale translation.
+    lcr3(V2P(p->pgdir));
+    return 0;
+  }
+
+  // Between segments, exec() used to map zeroed pages.
+  if(s == &img->seg[NSEG] || (off = va - s->va) >= s->filesz){
+    // All zero; not worth sharing.
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_E;
+    share_add(V2P(mem), pte);
+    p->rss += PGSIZE;
+    return 0;
+  }
+
+  // Map the page read-only from the program page cache, reading
+  // it into the cache if need be. The fault may come from readi()
+  // on the program itself.
+  n = s->filesz - off;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  exe = img->exe;
+  locked = holdingsleep(&exe->lock);
+  if(!locked)
+    ilock(exe);
+  r = 0;
+  if(!tcmap(exe->dev, exe->inum, exe->gen, s->off + off, n, pte)){
+    if((mem = kalloc()) == 0)
+      r = -1;
+    else {
+      memset(mem, 0, PGSIZE);
+      if(readi(exe, mem, s->off + off, n) != n){
+        kfree(mem);
+        r = -1;
+      } else {
+        *pte = V2P(mem) | PTE_P | PTE_U | PTE_E;
+        share_add(V2P(mem), pte);
+        tcadd(exe->dev, exe->inum, exe->gen, s->off + off, n, mem);
+      }
+    }
+  }
+  if(!locked)
+    iunlock(exe);
+  if(r < 0)
+    return -1;
+  p->rss += PGSIZE;
+  return 0;
+}
@@ -5,6 +5,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -126,11 +128,17 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
+    // i-node, up to three indirect blocks, allocation blocks,
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-3-2) / 2) * BSIZE;
+    // In ordered mode the data is not logged, and a write of
+    // this size logs only the i-node, at most four indirect
+    // blocks and two allocation blocks. Chunk only to keep
+    // transactions short.
+    if(fsordered())
+      max = NINDIRECT * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -155,3 +163,123 @@ filewrite(struct file *f, char *addr, int n)
   panic("filewrite");
 }
 
+
+//PAGEBREAK!
+// Copy up to n bytes of file in, from offset off, to file out
+// without going through user memory: in's data goes to out straight
+// from the page cache. If off is negative, copy from in's offset and
+// advance it. Returns the number of bytes copied, which is less than
+// n only at the end of in.
+int
+filesend(struct file *out, struct file *in, int off, int n)
+{
+  struct inode *ip = in->ip;
+  char *pg, *src, *bounce;
+  uint o;
+  int m, r, tot;
+
+  if(in->type != FD_INODE || in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  bounce = 0;
+  r = 0;
+  for(tot = 0; tot < n; tot += m){
+    ilock(ip);
+    o = off < 0 ? in->off : off + tot;
+    if(ip->type == T_DEV){
+      r = -1;
+      iunlock(ip);
+      break;
+    }
+    if(o >= ip->size){
+      iunlock(ip);
+      break;
+    }
+    m = n - tot;
+    if(m > ip->size - o)
+      m = ip->size - o;
+    if(m > PGSIZE - o%PGSIZE)
+      m = PGSIZE - o%PGSIZE;
+    if((pg = ipage(ip, o/PGSIZE)) != 0)
+      src = pg + o%PGSIZE;
+    else {
+      // The page cache is full of mapped pages.
+      if(bounce == 0 && (bounce = kalloc()) == 0){
+        r = -1;
+        iunlock(ip);
+        break;
+      }
+      if(readi(ip, bounce, o, m) != m){
+        r = -1;
+        iunlock(ip);
+        break;
+      }
+      src = bounce;
+    }
+    // Take the bytes from in's offset in the same critical section
+    // that read it, as fileread() does, so that another sendfile()
+    // on in cannot send them too.
+    if(off < 0)
+      in->off += m;
+    iunlock(ip);
+
+    // The reference keeps the page while out, a pipe perhaps,
+    // sleeps; writes to in meanwhile update it in place.
+    r = filewrite(out, src, m);
+    if(pg)
+      pcput(pg);
+    if(r != m){
+      // Give back the bytes out did not take, unless a later
+      // read has moved the offset on past them.
+      if(off < 0){
+        ilock(ip);
+        if(in->off == o + m)
+          in->off = o;
+        iunlock(ip);
+      }
+      break;
+    }
+  }
+  if(bounce)
+    kfree(bounce);
+  if(r < 0 && tot == 0)
+    return -1;
+  return tot;
+}
+
+// Move up to n bytes from file in to file out, one of which must
+// be a pipe, using and advancing their offsets. Data from an inode
+// is sent as by filesend(); data from a pipe is copied once, through
+// a kernel page. Returns the number of bytes moved, which is less
+// than n only if in runs dry, at the end of a file or when a pipe
+// has no writers left.
+int
+filesplice(struct file *out, struct file *in, int n)
+{
+  char *buf;
+  int m, r, tot;
+
+  if(in->type != FD_PIPE && out->type != FD_PIPE)
+    return -1;
+  if(in->type == FD_INODE)
+    return filesend(out, in, -1, n);
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = 0;
+  for(tot = 0; tot < n; tot += r){
+    m = n - tot;
+    if(m > PGSIZE)
+      m = PGSIZE;
+    if((r = piperead(in->pipe, buf, m)) <= 0)
+      break;
+    if(filewrite(out, buf, r) != r){
+      r = -1;
+      break;
+    }
+  }
+  kfree(buf);
+  if(r < 0 && tot == 0)
+    return -1;
+  return tot;
+}
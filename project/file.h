@@ -14,6 +14,9 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext;  // hash chain
+  struct inode *lprev;  // LRU list, while ref is 0
+  struct inode *lnext;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +25,18 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
+
+  uint raoff;         // readi() offset that would continue the last read
+  uint raend;         // first block not yet read ahead
+  uint rawin;         // readahead window, in blocks; 0 if not sequential
+  uint lastbn;        // bmap() of block lastbn was lastaddr
+  uint lastaddr;      // 0 if none
+  uint dindbn;        // double-indirect entry dindbn is block dind
+  uint dind;          // 0 if none
+  uint rsvnext;       // blocks [rsvnext, rsvend) are reserved
+  uint rsvend;        //   for the next blocks of the file
+  uint gen;           // new whenever the data changes; see textcache.c
 };
 
 // table mapping major device number to
@@ -13,6 +13,7 @@
 #include "defs.h"
 #include "param.h"
 #include "stat.h"
+#include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
@@ -23,6 +24,8 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dinit(void);
+static void dpurge(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -40,43 +43,202 @@ readsb(int dev, struct superblock *sb)
   // init_rmap();
 }
 
-// Zero a block.
+// Do the data blocks of inode ip bypass the log?
+// Only in ordered mode; directories are metadata.
+static int
+inplace(struct inode *ip)
+{
+  return (sb.flags & SB_ORDERED) && ip && ip->type != T_DIR;
+}
+
+// Write block bp of inode ip, which may be 0 for metadata
+// blocks: in place if it is ordered-mode file data, or else
+// through the log.
 static void
-bzero(int dev, int bno)
+iwrite(struct inode *ip, struct buf *bp)
+{
+  if(inplace(ip))
+    bdwrite(bp);
+  else
+    log_write(bp);
+}
+
+// Is the file system in ordered mode?
+int
+fsordered(void)
+{
+  return (sb.flags & SB_ORDERED) != 0;
+}
+
+// Zero block bno of inode ip.
+static void
+bzero(struct inode *ip, int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
+  bp = bgetblk(dev, bno);
   memset(bp->data, 0, BSIZE);
-  log_write(bp);
+  iwrite(ip, bp);
   brelse(bp);
 }
 
 // Blocks.
+//
+// The free bitmap is copied into memory at mount, along with a
+// count of the free blocks in each allocation group of AGSIZE
+// blocks, so that balloc() searches memory rather than reading
+// bitmap blocks, and skips full groups without looking at them.
+// The on-disk bitmap is still updated through the log.
+//
+// balloc() starts looking at a goal block: the one after the
+// file's previous block, or else the start of the group of the
+// file's inode, so that a file's blocks end up together and
+// different files spread over the disk. When it allocates a data
+// block, it also reserves the NRESERVE free blocks after it for
+// the inode's next blocks, so that files written at the same time
+// do not interleave. Reservations live only in memory and other
+// allocations use reserved blocks only when nothing else is free.
+//
+// bstate.lock protects bstate, and ip->rsvnext and ip->rsvend
+// together with ip->lock.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+#define AGSIZE   1024  // blocks per allocation group
+#define NAG      (FSSIZE/AGSIZE + 1)
+#define NRESERVE 16    // blocks reserved ahead of a file's last block
+
+static struct {
+  struct spinlock lock;
+  uchar used[FSSIZE/8+1];  // copy of the on-disk bitmap
+  uchar rsv[FSSIZE/8+1];   // reserved for some inode's next blocks
+  int nfree[NAG];          // free blocks per group, reserved included
+  int ngroup;
+} bstate;
+
+#define BISSET(m, b) (((m)[(b)/8] >> ((b)%8)) & 1)
+
+// Build the in-memory copy of the free bitmap.
+static void
+initballoc(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b;
 
-  bp = 0;
+  initlock(&bstate.lock, "balloc");
+  if(sb.size > FSSIZE)
+    panic("initballoc: file system too big");
+  bstate.ngroup = (sb.size + AGSIZE - 1) / AGSIZE;
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+    memmove(bstate.used + b/8, bp->data, min(BSIZE, (sb.size - b + 7)/8));
+    brelse(bp);
+  }
+  for(b = 0; b < sb.size; b++)
+    if(!BISSET(bstate.used, b))
+      bstate.nfree[b/AGSIZE]++;
+}
+
+// Can block b go to inode ip (0 for metadata)? Reserved blocks
+// only if rsvok. Caller holds bstate.lock.
+static int
+bavail(struct inode *ip, uint b, int rsvok)
+{
+  if(BISSET(bstate.used, b))
+    return 0;
+  if(!rsvok && BISSET(bstate.rsv, b))
+    return 0;
+  if(inplace(ip) && log_freed(b))
+    return 0;  // old owner's until the free commits
+  return 1;
+}
+
+// Find a block for ip at or after goal, wrapping around to the
+// start of the disk. Returns 0 if there is none, since block 0
+// is never free.
+static uint
+bfind(struct inode *ip, uint goal, int rsvok)
+{
+  uint b, end;
+  int i, g;
+
+  g = goal / AGSIZE;
+  for(i = 0; i <= bstate.ngroup; i++, g = (g + 1) % bstate.ngroup){
+    if(bstate.nfree[g] == 0)
+      continue;
+    end = min((g + 1) * AGSIZE, sb.size);
+    for(b = (i == 0 ? goal : g * AGSIZE); b < end; b++){
+      if(b%8 == 0 && bstate.used[b/8] == 0xff){
+        b += 7;
+        continue;
       }
+      if(bavail(ip, b, rsvok))
+        return b;
     }
-    brelse(bp);
   }
-  panic("balloc: out of blocks");
+  return 0;
+}
+
+// Drop ip's reservation. Caller holds bstate.lock.
+static void
+rsvdrop(struct inode *ip)
+{
+  for(; ip->rsvnext < ip->rsvend; ip->rsvnext++)
+    bstate.rsv[ip->rsvnext/8] &= ~(1 << (ip->rsvnext%8));
+  ip->rsvnext = ip->rsvend = 0;
+}
+
+// Give up the blocks reserved for ip's next blocks.
+// Caller holds ip->lock.
+static void
+bunreserve(struct inode *ip)
+{
+  acquire(&bstate.lock);
+  rsvdrop(ip);
+  release(&bstate.lock);
+}
+
+// Allocate a zeroed disk block near goal for inode ip,
+// 0 for metadata.
+static uint
+balloc(uint dev, struct inode *ip, uint goal)
+{
+  struct buf *bp;
+  uint b;
+
+  if(goal >= sb.size)
+    goal = 0;
+
+  acquire(&bstate.lock);
+  b = 0;
+  if(ip && ip->rsvnext < ip->rsvend){
+    if(goal == ip->rsvnext && bavail(ip, goal, 1))
+      b = goal;
+    else
+      rsvdrop(ip);  // not sequential, or the block was taken
+  }
+  if(b == 0 && (b = bfind(ip, goal, 0)) == 0 && (b = bfind(ip, goal, 1)) == 0)
+    panic("balloc: out of blocks");
+  bstate.used[b/8] |= 1 << (b%8);
+  bstate.rsv[b/8] &= ~(1 << (b%8));
+  bstate.nfree[b/AGSIZE]--;
+  if(ip && b == ip->rsvnext && ip->rsvnext < ip->rsvend){
+    ip->rsvnext++;
+  } else if(ip){
+    // Reserve the free blocks that follow b.
+    ip->rsvnext = ip->rsvend = b + 1;
+    while(ip->rsvend < sb.size && ip->rsvend - b <= NRESERVE &&
+          bavail(ip, ip->rsvend, 0)){
+      bstate.rsv[ip->rsvend/8] |= 1 << (ip->rsvend%8);
+      ip->rsvend++;
+    }
+  }
+  release(&bstate.lock);
+
+  bp = bread(dev, BBLOCK(b, sb));
+  bp->data[(b%BPB)/8] |= 1 << (b%8);  // Mark block in use.
+  log_write(bp);
+  brelse(bp);
+  bzero(ip, dev, b);
+  return b;
 }
 
 // Free a disk block.
@@ -94,6 +256,14 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  if(sb.flags & SB_ORDERED)
+    log_free(b);
+
+  // Only now, so balloc() cannot set the bit on disk first.
+  acquire(&bstate.lock);
+  bstate.used[b/8] &= ~(1 << (b%8));
+  bstate.nfree[b/AGSIZE]++;
+  release(&bstate.lock);
 }
 
 // Inodes.
@@ -156,31 +326,124 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// Cache entries are found through a hash table on (dev, inum).
+// An entry whose ref has fallen to zero stays valid, on an LRU
+// list, so that using the inode again soon does not read it from
+// disk; iget() recycles the least recently used one when it needs
+// an entry. NINODE entries are built into the kernel; beyond those
+// the cache grows a page of entries at a time, up to a limit set
+// at boot from the amount of physical memory but only with pages
+// that are free anyway, and past that limit whenever every entry
+// is referenced, so there is no fixed limit on open inodes.
+//
+// The icache.lock spin-lock protects the hash chains, the LRU
+// list and the allocation of icache entries. Since ip->ref
+// indicates whether an entry is in use, and ip->dev and ip->inum
+// indicate which i-node an entry holds, one must hold icache.lock
+// while changing ip->dev and ip->inum, which happens only while
+// ip->ref is zero. ip->ref itself is changed with atomic
+// instructions, so that iget() can look up a cached inode without
+// icache.lock: it takes a reference only if ip->ref is already
+// non-zero, and then checks that the entry was not recycled for
+// another inode meanwhile. Only changes of ip->ref to or from zero
+// are made with icache.lock held, so an entry is on the LRU list
+// exactly when its ref is zero. Entries are never freed, so a
+// lockless lookup never reads freed memory; one that follows an
+// entry onto another hash chain just misses, and looks again with
+// the lock.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
-// dev, and inum.  One must hold ip->lock in order to
-// read or write that inode's ip->valid, ip->size, ip->type, &c.
+// dev, inum, hnext, lprev and lnext.  One must hold ip->lock in
+// order to read or write that inode's ip->valid, ip->size,
+// ip->type, &c.
+
+extern char end[];  // first address after kernel loaded from ELF file
+
+#define NIHASH 61
+#define ICACHEFRAC 64  // at most 1/ICACHEFRAC of memory for extra inodes
+
+// A page of inodes from kalloc().
+struct inodepage {
+  struct inodepage *next;
+  struct inode inode[];
+};
+#define IPERPAGE ((PGSIZE - sizeof(struct inodepage)) / sizeof(struct inode))
 
 struct {
   struct spinlock lock;
+  struct inode *hash[NIHASH];  // chains through hnext
+  struct inode lru;      // unreferenced, least recently used first
   struct inode inode[NINODE];
+  struct inodepage *pages;  // Inodes beyond NINODE
+  uint ninode;              // Entries in the cache
+  uint maxinode;            // Grow up to this many before recycling
 } icache;
 
+static struct inode**
+ihash(uint dev, uint inum)
+{
+  return &icache.hash[(dev + inum) % NIHASH];
+}
+
+static void
+lrudel(struct inode *ip)
+{
+  ip->lnext->lprev = ip->lprev;
+  ip->lprev->lnext = ip->lnext;
+}
+
+// Put ip on the LRU list, at the end to be recycled last if
+// it is still valid, or else at the front.
+static void
+lruadd(struct inode *ip)
+{
+  struct inode *at;
+
+  at = ip->valid ? &icache.lru : icache.lru.lnext;
+  ip->lnext = at;
+  ip->lprev = at->lprev;
+  at->lprev->lnext = ip;
+  at->lprev = ip;
+}
+
+// Add the entries in page pg to the cache, on the LRU list.
+// Caller must hold icache.lock.
+static void
+igrow(char *pg)
+{
+  struct inodepage *ipg;
+  struct inode *ip;
+
+  ipg = (struct inodepage*)pg;
+  memset(ipg, 0, PGSIZE);
+  for(ip = ipg->inode; ip < ipg->inode+IPERPAGE; ip++){
+    initsleeplock(&ip->lock, "inode");
+    lruadd(ip);
+  }
+  ipg->next = icache.pages;
+  icache.pages = ipg;
+  icache.ninode += IPERPAGE;
+}
+
 void
 iinit(int dev)
 {
   int i = 0;
   
   initlock(&icache.lock, "icache");
+  dinit();
+  icache.lru.lprev = icache.lru.lnext = &icache.lru;
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
+    lruadd(&icache.inode[i]);
   }
+  icache.ninode = NINODE;
+  icache.maxinode = NINODE +
+    (PHYSTOP - V2P(end)) / PGSIZE / ICACHEFRAC * IPERPAGE;
 
   readsb(dev, &sb);
+  if(sb.bsize != BSIZE)
+    panic("iinit: block size differs from BSIZE");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
@@ -189,30 +452,105 @@ iinit(int dev)
 
 static struct inode* iget(uint dev, uint inum);
 
+// Which inodes are free is kept in memory too, in a bitmap built
+// at mount, so that ialloc() need not read the inode blocks to
+// find one. A new file goes in or after the inode block of its
+// directory, so that a directory's inodes share blocks; a new
+// directory goes after the last inode allocated, so that
+// directories spread over the inode table.
+// istate.lock protects istate.
+
+static struct {
+  struct spinlock lock;
+  uchar *used;  // bit i set if inode i is allocated
+  uint next;    // where to look for the next directory's inode
+} istate;
+
+// Build the in-memory set of free inodes.
+static void
+initialloc(int dev)
+{
+  struct buf *bp;
+  struct dinode *dip;
+  uint inum;
+
+  initlock(&istate.lock, "ialloc");
+  if(sb.ninodes > PGSIZE*8 || (istate.used = (uchar*)kalloc()) == 0)
+    panic("initialloc");
+  memset(istate.used, 0, PGSIZE);
+  istate.used[0] = 1;  // inode 0 is never allocated
+  for(inum = 1; inum < sb.ninodes; inum++){
+    if(inum == 1 || inum%IPB == 0)
+      bp = bread(dev, IBLOCK(inum, sb));
+    dip = (struct dinode*)bp->data + inum%IPB;
+    if(dip->type != 0)
+      istate.used[inum/8] |= 1 << (inum%8);
+    if(inum == sb.ninodes-1 || (inum+1)%IPB == 0)
+      brelse(bp);
+  }
+  istate.next = 1;
+}
+
+// Build the in-memory free block and inode sets. Called after
+// log recovery, which may rewrite bitmap and inode blocks.
+void
+initalloc(int dev)
+{
+  initballoc(dev);
+  initialloc(dev);
+}
+
 //PAGEBREAK!
-// Allocate an inode on device dev.
+// Allocate an inode on device dev, near the inode of
+// its parent directory parent.
 // Mark it as allocated by  giving it type type.
 // Returns an unlocked but allocated and referenced inode.
 struct inode*
-ialloc(uint dev, short type)
+ialloc(uint dev, short type, uint parent)
 {
-  int inum;
+  uint inum, goal, i;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
-      brelse(bp);
-      return iget(dev, inum);
+  acquire(&istate.lock);
+  if(type == T_DIR)
+    goal = istate.next;
+  else
+    goal = parent - parent%IPB;
+  for(i = 0; i < sb.ninodes; i++){
+    inum = (goal + i) % sb.ninodes;
+    if(inum%8 == 0 && istate.used[inum/8] == 0xff){
+      i += 7;
+      continue;
     }
-    brelse(bp);
+    if((istate.used[inum/8] & (1 << (inum%8))) == 0)
+      break;
   }
-  panic("ialloc: no inodes");
+  if(i >= sb.ninodes)
+    panic("ialloc: no inodes");
+  istate.used[inum/8] |= 1 << (inum%8);
+  istate.next = inum + 1;
+  release(&istate.lock);
+
+  bp = bread(dev, IBLOCK(inum, sb));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  if(dip->type != 0)
+    panic("ialloc: inode in use");
+  memset(dip, 0, sizeof(*dip));
+  dip->type = type;
+  log_write(bp);   // mark it allocated on the disk
+  brelse(bp);
+  return iget(dev, inum);
+}
+
+// Return inode inum to the free set, after it has been
+// marked free on disk.
+static void
+ifree(uint inum)
+{
+  acquire(&istate.lock);
+  istate.used[inum/8] &= ~(1 << (inum%8));
+  release(&istate.lock);
 }
 
 // Copy a modified in-memory inode to disk.
@@ -237,37 +575,100 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Give ip a generation number no inode has had before, so that
+// program pages cached under the old one are never found again.
+static uint igen;
+
+static void
+inewgen(struct inode *ip)
+{
+  ip->gen = __sync_add_and_fetch(&igen, 1);
+}
+
+// Drop a reference to ip without locking it. The last one
+// makes the cache entry a candidate for recycling.
+static void
+idrop(struct inode *ip)
+{
+  int r;
+
+  while((r = ip->ref) > 1)
+    if(__sync_bool_compare_and_swap(&ip->ref, r, r-1))
+      return;
+  acquire(&icache.lock);
+  if(__sync_sub_and_fetch(&ip->ref, 1) == 0)
+    lruadd(ip);
+  release(&icache.lock);
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  char *pg;
+  int r;
 
+  // Is the inode already cached? Look without the lock first.
+  for(ip = *ihash(dev, inum); ip; ip = ip->hnext){
+    if(ip->dev != dev || ip->inum != inum)
+      continue;
+    while((r = ip->ref) > 0 && !__sync_bool_compare_and_swap(&ip->ref, r, r+1))
+      ;
+    if(r == 0)
+      break;
+    if(ip->dev == dev && ip->inum == inum)
+      return ip;
+    // Recycled before we got our reference. Not iput(): the
+    // caller may hold a directory's lock, and ip is unrelated.
+    idrop(ip);
+    break;
+  }
+
+again:
   acquire(&icache.lock);
 
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = *ihash(dev, inum); ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(__sync_fetch_and_add(&ip->ref, 1) == 0)
+        lrudel(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
-  ip = empty;
+  // Recycle an inode cache entry, growing the cache first
+  // if it is below its limit and there is a free page.
+  if(icache.ninode + IPERPAGE <= icache.maxinode && (pg = trykalloc()) != 0)
+    igrow(pg);
+  if((ip = icache.lru.lnext) == &icache.lru){
+    // Every entry is in use. Grow, swapping if need be.
+    release(&icache.lock);
+    if((pg = kalloc()) == 0)
+      panic("iget: no inodes");
+    acquire(&icache.lock);
+    igrow(pg);
+    release(&icache.lock);
+    goto again;
+  }
+  lrudel(ip);
+  if(ip->inum != 0){
+    for(pp = ihash(ip->dev, ip->inum); *pp != ip; pp = &(*pp)->hnext)
+      ;
+    *pp = ip->hnext;
+  }
   ip->dev = dev;
   ip->inum = inum;
-  ip->ref = 1;
   ip->valid = 0;
+  inewgen(ip);
+  pp = ihash(dev, inum);
+  ip->hnext = *pp;
+  __sync_synchronize();  // publish dev, inum and hnext before ip
+  *pp = ip;
+  __sync_synchronize();  // and before ref
+  ip->ref = 1;
   release(&icache.lock);
 
   return ip;
@@ -278,9 +679,7 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  __sync_fetch_and_add(&ip->ref, 1);
   return ip;
 }
 
@@ -307,6 +706,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->raoff = ip->raend = ip->rawin = 0;
+    ip->lastaddr = ip->dind = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -333,24 +734,26 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  int r;
+
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
+    r = ip->ref;
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
+      if(ip->type == T_DIR)
+        dpurge(ip);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
+      ifree(ip->inum);
     }
   }
+  if(ip->ref == 1)
+    bunreserve(ip);
   releasesleep(&ip->lock);
-
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  idrop(ip);
 }
 
 // Common idiom: unlock, then put.
@@ -367,38 +770,103 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. The next NDINDIRECT
+// blocks are listed in the NINDIRECT blocks listed in block
+// ip->addrs[NDIRECT+1].
+
+// Return entry i of indirect block addr of inode ip, allocating
+// a block near goal for it if there is none: a data block if data
+// is set, else another indirect block.
+static uint
+bindirect(struct inode *ip, uint addr, uint i, int data, uint goal)
+{
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[i]) == 0){
+    a[i] = addr = balloc(ip->dev, data ? ip : 0, goal);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
+
+// Where to look for a free block for block bn of inode ip: right
+// after block bn-1, or else in the inode's allocation group.
+static uint
+bgoal(struct inode *ip, uint bn)
+{
+  if(bn > 0 && bn <= NDIRECT && ip->addrs[bn-1])
+    return ip->addrs[bn-1] + 1;
+  if(bn > 0 && ip->lastaddr && ip->lastbn == bn-1)
+    return ip->lastaddr + 1;
+  return (ip->inum % bstate.ngroup) * AGSIZE;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
+// The last mapping, and the last second-level block of the
+// double-indirect tree, are cached in ip.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
-  struct buf *bp;
+  uint addr, lbn, goal;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, ip, bgoal(ip, bn));
     return addr;
   }
+  if(ip->lastaddr && ip->lastbn == bn)
+    return ip->lastaddr;
+  lbn = bn;
+  goal = bgoal(ip, bn);
   bn -= NDIRECT;
 
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, 0, goal);
+    addr = bindirect(ip, addr, bn, 1, goal);
+  } else if((bn -= NINDIRECT) < NDINDIRECT){
+    if(ip->dind == 0 || ip->dindbn != bn/NINDIRECT){
+      if((addr = ip->addrs[NDIRECT+1]) == 0)
+        ip->addrs[NDIRECT+1] = addr = balloc(ip->dev, 0, goal);
+      ip->dind = bindirect(ip, addr, bn/NINDIRECT, 0, goal);
+      ip->dindbn = bn/NINDIRECT;
     }
-    brelse(bp);
-    return addr;
-  }
+    addr = bindirect(ip, ip->dind, bn%NINDIRECT, 1, goal);
+  } else
+    panic("bmap: out of range");
 
-  panic("bmap: out of range");
+  ip->lastbn = lbn;
+  ip->lastaddr = addr;
+  return addr;
+}
+
+// Free indirect block addr and the blocks it lists, down
+// depth more levels of indirect blocks.
+static void
+bfreeind(uint dev, uint addr, int depth)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j] == 0)
+      continue;
+    if(depth > 0)
+      bfreeind(dev, a[j], depth-1);
+    else
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -409,9 +877,7 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -421,16 +887,17 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
+    bfreeind(ip->dev, ip->addrs[NDIRECT], 0);
     ip->addrs[NDIRECT] = 0;
   }
+  if(ip->addrs[NDIRECT+1]){
+    bfreeind(ip->dev, ip->addrs[NDIRECT+1], 1);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+  ip->lastaddr = ip->dind = 0;
+  bunreserve(ip);
+  pcinval(ip->dev, ip->inum);
+  inewgen(ip);
 
   ip->size = 0;
   iupdate(ip);
@@ -448,6 +915,81 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Readahead. A read that continues where the previous read of the
+// inode ended counts as sequential; once a sequential reader gets
+// within half a window of the blocks already read ahead, the next
+// window of blocks is read asynchronously, doubling the window each
+// time up to RAMAX. Other reads of several blocks are still issued
+// together, so that consecutive blocks go to the disk in one request.
+#define RAMIN 4
+#define RAMAX 32
+
+static void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint blocks[RAMAX+MAXCLUSTER];
+  uint first, last, start, end, i, k;
+
+  first = off/BSIZE;
+  last = (off + n - 1)/BSIZE;
+  start = end = 0;
+  if(off == ip->raoff){
+    if(last + ip->rawin/2 >= ip->raend){
+      ip->rawin = ip->rawin ? min(2*ip->rawin, RAMAX) : RAMIN;
+      start = first > ip->raend ? first : ip->raend;
+      end = last + 1 + ip->rawin;
+    }
+  } else {
+    ip->rawin = 0;
+    if(last > first){
+      start = first;
+      end = last + 1;
+    }
+  }
+  ip->raoff = off + n;
+  if(end > (ip->size + BSIZE - 1)/BSIZE)
+    end = (ip->size + BSIZE - 1)/BSIZE;
+  if(end > start + NELEM(blocks))
+    end = start + NELEM(blocks);
+  if(end <= start)
+    return;
+  ip->raend = end;
+  k = 0;
+  for(i = start; i < end; i++)
+    if(!pccached(ip->dev, ip->inum, i/PGBLOCKS))
+      blocks[k++] = bmap(ip, i);
+  breadahead(ip->dev, blocks, k);
+}
+
+// Return page pgno of the data of inode ip, from the page
+// cache, with a reference; pcput() drops it. Reads the page
+// if it is not cached. The part past the end of the file is
+// zero. Returns 0 if there is no memory for the page.
+// Caller must hold ip->lock.
+char*
+ipage(struct inode *ip, uint pgno)
+{
+  struct buf *bp;
+  char *pg;
+  uint i, bn;
+
+  if((pg = pclookup(ip->dev, ip->inum, pgno)) != 0)
+    return pg;
+  if((pg = pcalloc(ip->dev, ip->inum, pgno)) == 0)
+    return 0;
+  for(i = 0; i < PGBLOCKS; i++){
+    bn = pgno*PGBLOCKS + i;
+    if(bn*BSIZE >= ip->size){
+      memset(pg + i*BSIZE, 0, BSIZE);
+      continue;
+    }
+    bp = bread(ip->dev, bmap(ip, bn));
+    memmove(pg + i*BSIZE, bp->data, BSIZE);
+    brelse(bp);
+  }
+  return pg;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -456,6 +998,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  char *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -467,8 +1010,16 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  if(n > 0)
+    readahead(ip, off, n);
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    if((pg = ipage(ip, off/PGSIZE)) != 0){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      memmove(dst, pg + off%PGSIZE, m);
+      pcput(pg);
+      continue;
+    }
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
@@ -485,6 +1036,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  char *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -494,15 +1046,21 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
     return -1;
 
+  if(n > 0)
+    inewgen(ip);
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    iwrite(ip, bp);
     brelse(bp);
+    if((pg = pclookup(ip->dev, ip->inum, off/PGSIZE)) != 0){
+      memmove(pg + off%PGSIZE, src, m);
+      pcput(pg);
+    }
   }
 
   if(n > 0 && off > ip->size){
@@ -521,17 +1079,140 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// The name cache remembers the result of recent directory lookups,
+// keyed by directory and name, so that most path lookups do not
+// read directories. A negative entry (inum 0) records that a name
+// is not in a directory. Changes to a directory's entries are made
+// with the directory locked, and so are lookups, so dirlink(),
+// unlink and freeing a directory keep the cache up to date by
+// updating it while they hold that lock.
+//
+// The cache is NDHASH sets of NDWAY entries; a new entry replaces
+// the least recently used one of its set.
+// dcache.lock protects dcache.
+
+#define NDHASH 32
+#define NDWAY  4
+
+struct dentry {
+  uint dev;
+  uint dir;            // inode number of the directory; 0 if unused
+  char name[DIRSIZ];
+  uint inum;           // 0 if the name is not in the directory
+  uint off;            // of the directory entry, if inum
+  uint lastuse;
+};
+
+static struct {
+  struct spinlock lock;
+  struct dentry set[NDHASH][NDWAY];
+  uint stamp;
+} dcache;
+
+static void
+dinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+}
+
+static struct dentry*
+dset(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return dcache.set[h % NDHASH];
+}
+
+// Find the entry for name in directory dp in set s, or 0.
+// Caller holds dcache.lock.
+static struct dentry*
+dfind(struct dentry *s, struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  for(d = s; d < s+NDWAY; d++)
+    if(d->dir == dp->inum && d->dev == dp->dev && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Record that name refers to inum at offset off of directory dp,
+// or is not in dp if inum is 0. Caller holds dp->lock.
+static void
+denter(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *s, *d, *e;
+
+  acquire(&dcache.lock);
+  s = dset(dp->dev, dp->inum, name);
+  if((d = dfind(s, dp, name)) == 0){
+    // Recycle an unused entry, or else the least recently used.
+    d = s;
+    for(e = s+1; e < s+NDWAY && d->dir != 0; e++)
+      if(e->dir == 0 || (int)(e->lastuse - d->lastuse) < 0)
+        d = e;
+  }
+  d->dev = dp->dev;
+  d->dir = dp->inum;
+  strncpy(d->name, name, DIRSIZ);
+  d->inum = inum;
+  d->off = off;
+  d->lastuse = dcache.stamp++;
+  release(&dcache.lock);
+}
+
+// Forget the entries of directory dp, which is being freed.
+static void
+dpurge(struct inode *dp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = &dcache.set[0][0]; d < &dcache.set[0][0] + NDHASH*NDWAY; d++)
+    if(d->dir == dp->inum && d->dev == dp->dev)
+      d->dir = 0;
+  release(&dcache.lock);
+}
+
+// Record that name has been removed from directory dp.
+// Caller holds dp->lock.
+void
+dirunlink(struct inode *dp, char *name)
+{
+  denter(dp, name, 0, 0);
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
   uint off, inum;
   struct dirent de;
+  struct dentry *d;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  acquire(&dcache.lock);
+  if((d = dfind(dset(dp->dev, dp->inum, name), dp, name)) != 0){
+    d->lastuse = dcache.stamp++;
+    inum = d->inum;
+    off = d->off;
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  release(&dcache.lock);
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -542,10 +1223,12 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       if(poff)
         *poff = off;
       inum = de.inum;
+      denter(dp, name, inum, off);
       return iget(dp->dev, inum);
     }
   }
 
+  denter(dp, name, 0, 0);
   return 0;
 }
 
@@ -575,6 +1258,7 @@ dirlink(struct inode *dp, char *name, uint inum)
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  denter(dp, name, inum, off);
 
   return 0;
 }
@@ -3,7 +3,9 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#ifndef BSIZE
+#define BSIZE 512  // block size; make BSIZE=4096 for 4KB blocks
+#endif
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -21,11 +23,23 @@ struct superblock {
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
   uint swapstart;     // Block number of first free swap block
+  uint flags;        // SB_*
+  uint bsize;        // Block size; must be BSIZE
 };
 
-#define NDIRECT 12
+#define SB_ORDERED 0x1  // file data is written in place, not logged
+
+#define LOGMAX (BSIZE/sizeof(uint) - 1)  // most blocks a log header lists
+
+// The swap area has one slot of PGBLOCKS blocks per page, for
+// NSWAPSLOT pages. SWAPBLOCKS counts 512-byte sectors.
+#define PGBLOCKS (4096 / BSIZE)  // blocks per page
+#define NSWAPSLOT (SWAPBLOCKS / 8)
+
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -34,7 +48,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses
 };
 
 // Inodes per block.
@@ -63,4 +77,5 @@ struct swap_slot {
   pte_t* pl[64];  // List of page table entries pointing to this page
   int present[64];
   int num; // number of processes using this page
+  int busy;       // Being written out or read in; see allocate_page()
 };
@@ -0,0 +1,3 @@
+// Operations of the futex system call.
+#define FUTEX_WAIT  0   // Sleep if *addr == val
+#define FUTEX_WAKE  1   // Wake up to val threads sleeping on addr
@@ -1,4 +1,10 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.
+//
+// Uses bus-master DMA when the disk sits on a PCI IDE controller
+// that can do it, like the PIIX in qemu: the controller moves a whole
+// request to or from memory by itself, following a table of physical
+// region descriptors (PRDs), and interrupts once at the end. Otherwise,
+// or after a DMA error, every sector goes through programmed I/O.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +18,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +30,54 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_SETMUL 0xc6
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// Sectors per PIO data transfer, set with IDE_CMD_SETMUL when
+// a block is more than one sector.
+#define SECTPERBLK    (BSIZE/SECTOR_SIZE)
+#define MAXMULT       16
+
+// Bus master registers of the primary channel, at dmabase.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01
+#define BM_READ       0x08  // device to memory
+#define BM_ERR        0x02
+#define BM_INTR       0x04
+
+// A physical region descriptor.
+struct prd {
+  uint addr;
+  ushort count;  // in bytes
+  ushort flags;
+};
+#define PRD_EOT       0x8000
+#define NPRD          (2*MAXCLUSTER)  // a buf may cross a 64KB boundary
+
+// idequeue points to the request now being read/written to the disk.
+// A request is a buf, or a chain of bufs for consecutive blocks
+// linked through cnext, which the disk transfers with one command,
+// interrupting once per block (PIO) or once at the end (DMA);
+// idecur is the block it is on. The requests waiting for the disk
+// are in ideq, which decides the order (see iosched.c).
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *idecur;
+static struct ioq ideq;
+
+int diskirq = IRQ_IDE;
 
 static int havedisk1;
+static ushort dmabase;  // 0 if not using DMA
+static int idedma;      // idequeue is being done by DMA
+static struct prd prdt[NPRD] __attribute__((aligned(8*NPRD)));
 static void idestart(struct buf*);
+static void dmainit(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -65,33 +110,110 @@ ideinit(void)
     }
   }
 
+  // PIO transfers a block per interrupt.
+  if(havedisk1 && SECTPERBLK > 1){
+    outb(0x3f6, 2);  // no interrupt
+    outb(0x1f2, SECTPERBLK);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    if(idewait(1) < 0)
+      panic("ideinit: set multiple");
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  dmainit();
+}
+
+// Look for a PCI IDE controller that can do bus-master DMA on
+// the primary channel and turn bus mastering on.
+static void
+dmainit(void)
+{
+  struct pcidev d;
+
+  if(!pcifind(PCI_ANY, 0x0101, &d))
+    return;
+  if(!(pciread(&d, PCI_CLASS) & 0x8000))
+    return;  // no bus mastering in the prog IF
+  if(!(d.bar[4] & 1))
+    return;
+  pciwrite(&d, PCI_CMD, pciread(&d, PCI_CMD) | PCI_CMD_IO | PCI_CMD_MASTER);
+  dmabase = d.bar[4] & 0xfffc;
+  outb(dmabase + BM_CMD, 0);
+  outb(dmabase + BM_STATUS, BM_ERR | BM_INTR);
+}
+
+// Fill the PRD table with the data of the bufs of request b and
+// program the bus master with it. Caller must hold idelock.
+static void
+dmasetup(struct buf *b)
+{
+  struct buf *c;
+  uint pa, n;
+  int i;
+
+  i = 0;
+  for(c = b; c; c = c->cnext){
+    pa = V2P(c->data);
+    n = BSIZE;
+    if((pa & 0xffff) + n > 0x10000){
+      // A region must not cross a 64KB boundary.
+      prdt[i].addr = pa;
+      prdt[i].count = 0x10000 - (pa & 0xffff);
+      prdt[i].flags = 0;
+      pa += prdt[i].count;
+      n -= prdt[i].count;
+      i++;
+    }
+    prdt[i].addr = pa;
+    prdt[i].count = n;
+    prdt[i].flags = 0;
+    i++;
+  }
+  prdt[i-1].flags = PRD_EOT;
+
+  outl(dmabase + BM_PRDT, V2P(prdt));
+  outb(dmabase + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+  outb(dmabase + BM_STATUS, BM_ERR | BM_INTR);
 }
 
 // Start the request for b.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *c;
+  int nblock;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  nblock = 0;
+  for(c = b; c; c = c->cnext)
+    nblock++;
+  if(nblock > MAXCLUSTER || b->blockno + nblock > FSSIZE)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector_per_block =  SECTPERBLK;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (sector_per_block > MAXMULT) panic("idestart");
 
+  idecur = b;
+  idedma = (dmabase != 0);
+  if(idedma)
+    dmasetup(b);
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nblock * sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idedma){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(dmabase + BM_CMD, inb(dmabase + BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -99,34 +221,136 @@ idestart(struct buf *b)
   }
 }
 
-// Interrupt handler.
-void
-ideintr(void)
+// Mark b done and wake its waiter. Async bufs are put on the
+// list *async instead, to be released once idelock is.
+static void
+idedone(struct buf *b, struct buf **async)
 {
-  struct buf *b;
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC){
+    b->cnext = *async;
+    *async = b;
+  } else {
+    b->cnext = 0;
+    wakeup(b);
+  }
+}
 
-  // First queued buffer is the active request.
-  acquire(&idelock);
+// A DMA request has ended: finish all of its bufs.
+// Caller must hold idelock.
+static void
+dmaintr(struct buf **async)
+{
+  struct buf *b, *next;
+  int st;
 
-  if((b = idequeue) == 0){
-    release(&idelock);
+  st = inb(dmabase + BM_STATUS);
+  if(!(st & BM_INTR))
+    return;  // not ours
+  outb(dmabase + BM_CMD, 0);
+  outb(dmabase + BM_STATUS, BM_ERR | BM_INTR);
+  if((st & BM_ERR) || idewait(1) < 0){
+    // Redo the request with PIO, and stay with PIO.
+    cprintf("ide: dma error, falling back to pio\n");
+    dmabase = 0;
+    idestart(idequeue);
     return;
   }
-  idequeue = b->qnext;
+
+  for(b = idecur; b; b = next){
+    next = b->cnext;
+    idedone(b, async);
+  }
+  idecur = 0;
+  if((idequeue = ioqnext(&ideq)) != 0)
+    idestart(idequeue);
+}
+
+// The disk has finished block idecur of a PIO request: move on
+// to the next block of the request, or the next request.
+// Caller must hold idelock.
+static void
+piointr(struct buf **async)
+{
+  struct buf *b;
+
+  b = idecur;
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
     insl(0x1f0, b->data, BSIZE/4);
 
+  idecur = b->cnext;
+  b->cnext = 0;
+  if(idecur == 0)
+    idequeue = ioqnext(&ideq);
+  else if(idecur->flags & B_DIRTY){
+    idewait(0);
+    outsl(0x1f0, idecur->data, BSIZE/4);
+  }
+
   // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  idedone(b, async);
 
   // Start disk on next buf in queue.
-  if(idequeue != 0)
+  if(idecur == 0 && idequeue != 0)
     idestart(idequeue);
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b, *async;
+
+  acquire(&idelock);
+
+  if(idecur == 0){
+    release(&idelock);
+    return;
+  }
+
+  async = 0;
+  if(idedma)
+    dmaintr(&async);
+  else
+    piointr(&async);
+
+  release(&idelock);
+
+  while((b = async) != 0){
+    async = b->cnext;
+    b->cnext = 0;
+    bdone(b);
+  }
+}
+
+// Start the request starting at b if the disk is idle,
+// or queue it. Caller must hold idelock.
+static void
+idequeue_add(struct buf *b)
+{
+  ioqcheck(b);
+  if(idequeue == 0){
+    b->qnext = 0;
+    idequeue = b;
+    idestart(b);
+  } else
+    ioqadd(&ideq, b);
+}
 
+// Queue the request starting at b and return without waiting.
+// The bufs must be locked. Those with B_ASYNC set are released
+// with bdone() when done; wait for the others with iderwait().
+void
+ideasync(struct buf *b)
+{
+  if(b->dev != 0 && !havedisk1)
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);
+  idequeue_add(b);
   release(&idelock);
 }
 
@@ -137,8 +361,6 @@ ideintr(void)
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -149,14 +371,8 @@ iderw(struct buf *b)
   acquire(&idelock);  //DOC:acquire-lock
 
   // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
-
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  b->cnext = 0;
+  idequeue_add(b);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
@@ -166,3 +382,13 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Wait for a request queued with ideasync() to finish with b.
+void
+iderwait(struct buf *b)
+{
+  acquire(&idelock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &idelock);
+  release(&idelock);
+}
@@ -0,0 +1,176 @@
+// I/O scheduler for disk drivers.
+//
+// Requests waiting for the disk are kept in one queue per class,
+// sorted by block number. The classes, most urgent first, are:
+// swap-in reads that a faulting process waits for (B_PRIO), other
+// requests that someone waits for, and asynchronous ones (readahead
+// and write-back, B_ASYNC). The next request is the first one at or
+// after the disk head in the most urgent non-empty class, wrapping
+// around to the lowest block (C-SCAN). So that no class starves, a
+// request that has waited past its class's deadline goes first.
+//
+// A new request for blocks adjacent to a queued one, in the same
+// direction, is merged into it to make one request of up to
+// MAXCLUSTER blocks, which takes the more urgent class and the
+// earlier deadline of the two.
+//
+// The driver serializes calls with its own lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+// Ticks each class may wait before its requests go first.
+static uint expire[NIOCLASS] = { 2, 20, 200 };
+
+static int
+ioclass(struct buf *b)
+{
+  if(b->flags & B_PRIO)
+    return 0;
+  if(b->flags & B_ASYNC)
+    return 2;
+  return 1;
+}
+
+// Number of blocks in request b; *tail is set to the last.
+static int
+reqlen(struct buf *b, struct buf **tail)
+{
+  int n;
+
+  for(n = 1; b->cnext; n++)
+    b = b->cnext;
+  if(tail)
+    *tail = b;
+  return n;
+}
+
+static void
+insert(struct ioq *q, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &q->q[b->ioclass]; *pp; pp = &(*pp)->qnext)
+    if((*pp)->blockno > b->blockno)
+      break;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+static void
+unlink(struct ioq *q, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &q->q[b->ioclass]; *pp != b; pp = &(*pp)->qnext)
+    if(*pp == 0)
+      panic("iosched unlink");
+  *pp = b->qnext;
+  b->qnext = 0;
+}
+
+// Merge request b of n blocks, ending at tail, into a queued
+// request if one is adjacent. Returns 1 if it was.
+static int
+merge(struct ioq *q, struct buf *b, int n, struct buf *tail)
+{
+  struct buf *r, *rtail, *m;
+  int c;
+
+  for(c = 0; c < NIOCLASS; c++){
+    for(r = q->q[c]; r; r = r->qnext){
+      if(r->dev != b->dev || (r->flags & B_DIRTY) != (b->flags & B_DIRTY))
+        continue;
+      if(r->blockno + reqlen(r, &rtail) == b->blockno &&
+         reqlen(r, 0) + n <= MAXCLUSTER){
+        unlink(q, r);
+        rtail->cnext = b;
+        m = r;
+      } else if(b->blockno + n == r->blockno && reqlen(r, 0) + n <= MAXCLUSTER){
+        unlink(q, r);
+        tail->cnext = r;
+        m = b;
+      } else
+        continue;
+      m->ioclass = b->ioclass < r->ioclass ? b->ioclass : r->ioclass;
+      m->deadline = (int)(b->deadline - r->deadline) < 0 ?
+        b->deadline : r->deadline;
+      insert(q, m);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Panic unless every buf of request b goes the same way: the
+// drivers, and merge(), take the direction from the first.
+void
+ioqcheck(struct buf *b)
+{
+  struct buf *c;
+
+  for(c = b->cnext; c; c = c->cnext)
+    if((c->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      panic("iosched: mixed request");
+}
+
+// Add request b, a buf or a chain of bufs through cnext.
+void
+ioqadd(struct ioq *q, struct buf *b)
+{
+  struct buf *tail;
+  int n;
+
+  b->ioclass = ioclass(b);
+  b->deadline = ticks + expire[b->ioclass];
+  b->qnext = 0;
+  n = reqlen(b, &tail);
+  if(!merge(q, b, n, tail))
+    insert(q, b);
+}
+
+int
+ioqempty(struct ioq *q)
+{
+  int c;
+
+  for(c = 0; c < NIOCLASS; c++)
+    if(q->q[c])
+      return 0;
+  return 1;
+}
+
+// Remove and return the request to start next, or 0 if none.
+struct buf*
+ioqnext(struct ioq *q)
+{
+  struct buf *b, *r;
+  int c;
+
+  // The most overdue request, if any.
+  b = 0;
+  for(c = 0; c < NIOCLASS; c++)
+    for(r = q->q[c]; r; r = r->qnext)
+      if((int)(ticks - r->deadline) >= 0 &&
+         (b == 0 || (int)(r->deadline - b->deadline) < 0))
+        b = r;
+
+  // Otherwise C-SCAN in the most urgent class.
+  for(c = 0; b == 0 && c < NIOCLASS; c++){
+    for(r = q->q[c]; r; r = r->qnext)
+      if(r->blockno >= q->pos)
+        break;
+    b = r ? r : q->q[c];
+  }
+
+  if(b == 0)
+    return 0;
+  unlink(q, b);
+  q->pos = b->blockno + reqlen(b, 0);
+  return b;
+}
@@ -105,10 +105,32 @@ kalloc(void)
   if(r){
     return (char*)r;
   }
-  allocate_page();
+  // Out of memory: shrink the buffer cache, the page cache or
+  // the program page cache, else swap a page out.
+  if(!bshrink() && !pcshrink() && !tcshrink())
+    allocate_page();
   return kalloc();
 }
 
+// Allocate a page only if one is free, without
+// swapping; never sleeps. Returns 0 if none is free.
+char*
+trykalloc(void)
+{
+  struct run *r;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+  if(r){
+    kmem.freelist = r->next;
+    kmem.num_free_pages-=1;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+
 uint 
 num_of_FreePages(void)
 {
@@ -42,6 +42,7 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+uint lapictick = 10000000;  // LAPIC timer counts per clock tick
 
 //PAGEBREAK!
 static void
@@ -66,7 +67,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, lapictick);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +114,74 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Fire a single timer interrupt after count LAPIC timer counts.
+// Used by cpu 0, which drives ticks and usleep (see timer.c).
+void
+lapiconeshot(uint count)
+{
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, count);
+}
+
+// Counts left before the LAPIC timer fires.
+uint
+lapiccount(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TCCR];
+}
+
+// Send interrupt vector to the cpu with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | DEASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+#define PIT_CH2      0x42  // 8253 PIT channel 2 data port
+#define PIT_MODE     0x43  // 8253 PIT mode/command port
+#define PIT_GATE     0x61  // NMI status/control: channel 2 gate and output
+#define PIT_HZ       1193182
+#define CALIBRATE_US 10000
+
+// Measure how many LAPIC timer counts elapse per microsecond,
+// using channel 2 of the 8253 PIT as the reference clock.
+uint
+lapiccalibrate(void)
+{
+  uint latch, n, gate;
+
+  if(!lapic)
+    return 1;
+
+  latch = PIT_HZ / (1000000 / CALIBRATE_US);
+
+  // Channel 2 as a hardware-triggered one-shot, speaker off.
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  outb(PIT_MODE, 0xB2);
+  outb(PIT_CH2, latch & 0xff);
+  outb(PIT_CH2, latch >> 8);
+
+  // Trigger the PIT on a rising gate edge and start the LAPIC timer.
+  gate = inb(PIT_GATE) & ~0x01;
+  outb(PIT_GATE, gate);
+  outb(PIT_GATE, gate | 0x01);
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xffffffff);
+
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  n = 0xffffffff - lapic[TCCR];
+  lapicw(TICR, 0);
+
+  n /= CALIBRATE_US;
+  return n ? n : 1;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,1413 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid;
+
+  if(argc < 2){
+   f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 2){
+  15:	7e 56                	jle    6d <main+0x6d>
+    print();
+    exit();
+  }
+
+  lockstat(0, 0);
+  17:	51                   	push   %ecx
+  18:	51                   	push   %ecx
+  19:	6a 00                	push   $0x0
+  1b:	6a 00                	push   $0x0
+  1d:	e8 e9 04 00 00       	call   50b <lockstat>
+  if(strcmp(argv[1], "-r") == 0)
+  22:	58                   	pop    %eax
+  23:	5a                   	pop    %edx
+  24:	68 3a 09 00 00       	push   $0x93a
+  29:	ff 73 04             	push   0x4(%ebx)
+  2c:	e8 0f 02 00 00       	call   240 <strcmp>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	85 c0                	test   %eax,%eax
+  36:	74 3a                	je     72 <main+0x72>
+    exit();
+
+  pid = fork();
+  38:	e8 0e 04 00 00       	call   44b <fork>
+  if(pid < 0){
+  3d:	85 c0                	test   %eax,%eax
+  3f:	78 36                	js     77 <main+0x77>
+    printf(2, "lockstat: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  41:	75 25                	jne    68 <main+0x68>
+    exec(argv[1], argv+1);
+  43:	50                   	push   %eax
+  44:	50                   	push   %eax
+  45:	8d 43 04             	lea    0x4(%ebx),%eax
+  48:	50                   	push   %eax
+  49:	ff 73 04             	push   0x4(%ebx)
+  4c:	e8 3a 04 00 00       	call   48b <exec>
+    printf(2, "lockstat: exec %s failed\n", argv[1]);
+  51:	83 c4 0c             	add    $0xc,%esp
+  54:	ff 73 04             	push   0x4(%ebx)
+  57:	68 54 09 00 00       	push   $0x954
+  5c:	6a 02                	push   $0x2
+  5e:	e8 8d 05 00 00       	call   5f0 <printf>
+    exit();
+  63:	e8 eb 03 00 00       	call   453 <exit>
+  }
+  wait();
+  68:	e8 ee 03 00 00       	call   45b <wait>
+  print();
+  6d:	e8 de 00 00 00       	call   150 <print>
+  exit();
+  72:	e8 dc 03 00 00       	call   453 <exit>
+    printf(2, "lockstat: fork failed\n");
+  77:	52                   	push   %edx
+  78:	52                   	push   %edx
+  79:	68 3d 09 00 00       	push   $0x93d
+  7e:	6a 02                	push   $0x2
+  80:	e8 6b 05 00 00       	call   5f0 <printf>
+    exit();
+  85:	e8 c9 03 00 00       	call   453 <exit>
+  8a:	66 90                	xchg   %ax,%ax
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <printu64>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	56                   	push   %esi
+  95:	53                   	push   %ebx
+  96:	83 ec 3c             	sub    $0x3c,%esp
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  a2:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  n = 0;
+  a5:	31 d2                	xor    %edx,%edx
+  a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ae:	66 90                	xchg   %ax,%ax
+    q = 0;
+  b0:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    for(i = 63; i >= 0; i--){
+  b3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+    r = 0;
+  b8:	31 db                	xor    %ebx,%ebx
+    q = 0;
+  ba:	31 f6                	xor    %esi,%esi
+  bc:	31 ff                	xor    %edi,%edi
+  be:	66 90                	xchg   %ax,%ax
+      r = (r << 1) | ((v >> i) & 1);
+  c0:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  c3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  c6:	01 db                	add    %ebx,%ebx
+  c8:	0f ad d0             	shrd   %cl,%edx,%eax
+  cb:	d3 ea                	shr    %cl,%edx
+  cd:	f6 c1 20             	test   $0x20,%cl
+  d0:	74 02                	je     d4 <printu64+0x44>
+  d2:	89 d0                	mov    %edx,%eax
+  d4:	83 e0 01             	and    $0x1,%eax
+      q <<= 1;
+  d7:	0f a4 f7 01          	shld   $0x1,%esi,%edi
+  db:	01 f6                	add    %esi,%esi
+      r = (r << 1) | ((v >> i) & 1);
+  dd:	09 c3                	or     %eax,%ebx
+      if(r >= 10){
+  df:	83 fb 09             	cmp    $0x9,%ebx
+  e2:	76 06                	jbe    ea <printu64+0x5a>
+        r -= 10;
+  e4:	83 eb 0a             	sub    $0xa,%ebx
+        q |= 1;
+  e7:	83 ce 01             	or     $0x1,%esi
+    for(i = 63; i >= 0; i--){
+  ea:	83 e9 01             	sub    $0x1,%ecx
+  ed:	73 d1                	jae    c0 <printu64+0x30>
+    buf[n++] = '0' + r;
+  ef:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  } while(v);
+  f2:	89 f9                	mov    %edi,%ecx
+    buf[n++] = '0' + r;
+  f4:	83 c3 30             	add    $0x30,%ebx
+  } while(v);
+  f7:	09 f1                	or     %esi,%ecx
+    buf[n++] = '0' + r;
+  f9:	8d 42 01             	lea    0x1(%edx),%eax
+  fc:	88 5c 05 d2          	mov    %bl,-0x2e(%ebp,%eax,1)
+  } while(v);
+ 100:	74 0a                	je     10c <printu64+0x7c>
+ 102:	89 75 c0             	mov    %esi,-0x40(%ebp)
+    buf[n++] = '0' + r;
+ 105:	89 c2                	mov    %eax,%edx
+  } while(v);
+ 107:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+ 10a:	eb a4                	jmp    b0 <printu64+0x20>
+  while(n > 0)
+ 10c:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ 10f:	8d 1c 10             	lea    (%eax,%edx,1),%ebx
+ 112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "%c", buf[--n]);
+ 118:	0f be 03             	movsbl (%ebx),%eax
+ 11b:	83 ec 04             	sub    $0x4,%esp
+  while(n > 0)
+ 11e:	8d 7d d3             	lea    -0x2d(%ebp),%edi
+    printf(1, "%c", buf[--n]);
+ 121:	50                   	push   %eax
+ 122:	68 18 09 00 00       	push   $0x918
+ 127:	6a 01                	push   $0x1
+ 129:	e8 c2 04 00 00       	call   5f0 <printf>
+  while(n > 0)
+ 12e:	89 d8                	mov    %ebx,%eax
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	83 eb 01             	sub    $0x1,%ebx
+ 136:	39 c7                	cmp    %eax,%edi
+ 138:	75 de                	jne    118 <printu64+0x88>
+}
+ 13a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13d:	5b                   	pop    %ebx
+ 13e:	5e                   	pop    %esi
+ 13f:	5f                   	pop    %edi
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+ 142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <print>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+ 155:	53                   	push   %ebx
+ 156:	83 ec 14             	sub    $0x14,%esp
+  n = lockstat(st, NSTAT);
+ 159:	6a 20                	push   $0x20
+ 15b:	68 20 0d 00 00       	push   $0xd20
+ 160:	e8 a6 03 00 00       	call   50b <lockstat>
+  if(n < 0){
+ 165:	83 c4 10             	add    $0x10,%esp
+ 168:	85 c0                	test   %eax,%eax
+ 16a:	0f 88 8a 00 00 00    	js     1fa <print+0xaa>
+  printf(1, "name locks acquired contended spin-cycles max-hold-cycles\n");
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	89 c7                	mov    %eax,%edi
+ 175:	68 70 09 00 00       	push   $0x970
+ 17a:	6a 01                	push   $0x1
+ 17c:	e8 6f 04 00 00       	call   5f0 <printf>
+  for(i = 0; i < n; i++){
+ 181:	83 c4 10             	add    $0x10,%esp
+ 184:	85 ff                	test   %edi,%edi
+ 186:	74 6a                	je     1f2 <print+0xa2>
+ 188:	bb 20 0d 00 00       	mov    $0xd20,%ebx
+ 18d:	31 f6                	xor    %esi,%esi
+ 18f:	90                   	nop
+    if(st[i].nacquire == 0)
+ 190:	8b 43 14             	mov    0x14(%ebx),%eax
+ 193:	85 c0                	test   %eax,%eax
+ 195:	74 51                	je     1e8 <print+0x98>
+    printf(1, "%s %d %d %d ", st[i].name, st[i].nlocks,
+ 197:	83 ec 08             	sub    $0x8,%esp
+ 19a:	ff 73 18             	push   0x18(%ebx)
+ 19d:	50                   	push   %eax
+ 19e:	ff 73 10             	push   0x10(%ebx)
+ 1a1:	53                   	push   %ebx
+ 1a2:	68 2d 09 00 00       	push   $0x92d
+ 1a7:	6a 01                	push   $0x1
+ 1a9:	e8 42 04 00 00       	call   5f0 <printf>
+    printu64(st[i].spincycles);
+ 1ae:	83 c4 18             	add    $0x18,%esp
+ 1b1:	ff 73 20             	push   0x20(%ebx)
+ 1b4:	ff 73 1c             	push   0x1c(%ebx)
+ 1b7:	e8 d4 fe ff ff       	call   90 <printu64>
+    printf(1, " ");
+ 1bc:	58                   	pop    %eax
+ 1bd:	5a                   	pop    %edx
+ 1be:	68 38 09 00 00       	push   $0x938
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 26 04 00 00       	call   5f0 <printf>
+    printu64(st[i].maxhold);
+ 1ca:	59                   	pop    %ecx
+ 1cb:	58                   	pop    %eax
+ 1cc:	ff 73 28             	push   0x28(%ebx)
+ 1cf:	ff 73 24             	push   0x24(%ebx)
+ 1d2:	e8 b9 fe ff ff       	call   90 <printu64>
+    printf(1, "\n");
+ 1d7:	58                   	pop    %eax
+ 1d8:	5a                   	pop    %edx
+ 1d9:	68 2b 09 00 00       	push   $0x92b
+ 1de:	6a 01                	push   $0x1
+ 1e0:	e8 0b 04 00 00       	call   5f0 <printf>
+ 1e5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 1e8:	83 c6 01             	add    $0x1,%esi
+ 1eb:	83 c3 2c             	add    $0x2c,%ebx
+ 1ee:	39 f7                	cmp    %esi,%edi
+ 1f0:	75 9e                	jne    190 <print+0x40>
+}
+ 1f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f5:	5b                   	pop    %ebx
+ 1f6:	5e                   	pop    %esi
+ 1f7:	5f                   	pop    %edi
+ 1f8:	5d                   	pop    %ebp
+ 1f9:	c3                   	ret
+    printf(2, "lockstat: failed\n");
+ 1fa:	51                   	push   %ecx
+ 1fb:	51                   	push   %ecx
+ 1fc:	68 1b 09 00 00       	push   $0x91b
+ 201:	6a 02                	push   $0x2
+ 203:	e8 e8 03 00 00       	call   5f0 <printf>
+    exit();
+ 208:	e8 46 02 00 00       	call   453 <exit>
+ 20d:	66 90                	xchg   %ax,%ax
+ 20f:	90                   	nop
+
+00000210 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 211:	31 c0                	xor    %eax,%eax
+{
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	53                   	push   %ebx
+ 216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 227:	83 c0 01             	add    $0x1,%eax
+ 22a:	84 d2                	test   %dl,%dl
+ 22c:	75 f2                	jne    220 <strcpy+0x10>
+    ;
+  return os;
+}
+ 22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 231:	89 c8                	mov    %ecx,%eax
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+ 235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+ 247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 24a:	0f b6 02             	movzbl (%edx),%eax
+ 24d:	84 c0                	test   %al,%al
+ 24f:	75 17                	jne    268 <strcmp+0x28>
+ 251:	eb 3a                	jmp    28d <strcmp+0x4d>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 25c:	83 c2 01             	add    $0x1,%edx
+ 25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 262:	84 c0                	test   %al,%al
+ 264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+ 266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 268:	0f b6 19             	movzbl (%ecx),%ebx
+ 26b:	38 c3                	cmp    %al,%bl
+ 26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 26f:	29 d8                	sub    %ebx,%eax
+}
+ 271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 274:	c9                   	leave
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 284:	31 c0                	xor    %eax,%eax
+ 286:	29 d8                	sub    %ebx,%eax
+}
+ 288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 28b:	c9                   	leave
+ 28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 28d:	0f b6 19             	movzbl (%ecx),%ebx
+ 290:	31 c0                	xor    %eax,%eax
+ 292:	eb db                	jmp    26f <strcmp+0x2f>
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2a9:	74 15                	je     2c0 <strlen+0x20>
+ 2ab:	31 c0                	xor    %eax,%eax
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 2b0:	83 c0 01             	add    $0x1,%eax
+ 2b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2b7:	89 c1                	mov    %eax,%ecx
+ 2b9:	75 f5                	jne    2b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2bb:	89 c8                	mov    %ecx,%eax
+ 2bd:	5d                   	pop    %ebp
+ 2be:	c3                   	ret
+ 2bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2c0:	31 c9                	xor    %ecx,%ecx
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	89 c8                	mov    %ecx,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2dd:	89 d7                	mov    %edx,%edi
+ 2df:	fc                   	cld
+ 2e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2e5:	89 d0                	mov    %edx,%eax
+ 2e7:	c9                   	leave
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2fa:	0f b6 10             	movzbl (%eax),%edx
+ 2fd:	84 d2                	test   %dl,%dl
+ 2ff:	75 12                	jne    313 <strchr+0x23>
+ 301:	eb 1d                	jmp    320 <strchr+0x30>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 30c:	83 c0 01             	add    $0x1,%eax
+ 30f:	84 d2                	test   %dl,%dl
+ 311:	74 0d                	je     320 <strchr+0x30>
+    if(*s == c)
+ 313:	38 d1                	cmp    %dl,%cl
+ 315:	75 f1                	jne    308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 317:	5d                   	pop    %ebp
+ 318:	c3                   	ret
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 320:	31 c0                	xor    %eax,%eax
+}
+ 322:	5d                   	pop    %ebp
+ 323:	c3                   	ret
+ 324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 339:	31 db                	xor    %ebx,%ebx
+{
+ 33b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 33e:	eb 27                	jmp    367 <gets+0x37>
+    cc = read(0, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	6a 01                	push   $0x1
+ 345:	56                   	push   %esi
+ 346:	6a 00                	push   $0x0
+ 348:	e8 1e 01 00 00       	call   46b <read>
+    if(cc < 1)
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	85 c0                	test   %eax,%eax
+ 352:	7e 1d                	jle    371 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 35f:	3c 0a                	cmp    $0xa,%al
+ 361:	74 10                	je     373 <gets+0x43>
+ 363:	3c 0d                	cmp    $0xd,%al
+ 365:	74 0c                	je     373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 367:	89 df                	mov    %ebx,%edi
+ 369:	83 c3 01             	add    $0x1,%ebx
+ 36c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 36f:	7c cf                	jl     340 <gets+0x10>
+ 371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 37a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37d:	5b                   	pop    %ebx
+ 37e:	5e                   	pop    %esi
+ 37f:	5f                   	pop    %edi
+ 380:	5d                   	pop    %ebp
+ 381:	c3                   	ret
+ 382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	56                   	push   %esi
+ 394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 395:	83 ec 08             	sub    $0x8,%esp
+ 398:	6a 00                	push   $0x0
+ 39a:	ff 75 08             	push   0x8(%ebp)
+ 39d:	e8 f1 00 00 00       	call   493 <open>
+  if(fd < 0)
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	78 27                	js     3d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3a9:	83 ec 08             	sub    $0x8,%esp
+ 3ac:	ff 75 0c             	push   0xc(%ebp)
+ 3af:	89 c3                	mov    %eax,%ebx
+ 3b1:	50                   	push   %eax
+ 3b2:	e8 f4 00 00 00       	call   4ab <fstat>
+  close(fd);
+ 3b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3bc:	e8 ba 00 00 00       	call   47b <close>
+  return r;
+ 3c1:	83 c4 10             	add    $0x10,%esp
+}
+ 3c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3c7:	89 f0                	mov    %esi,%eax
+ 3c9:	5b                   	pop    %ebx
+ 3ca:	5e                   	pop    %esi
+ 3cb:	5d                   	pop    %ebp
+ 3cc:	c3                   	ret
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3d5:	eb ed                	jmp    3c4 <stat+0x34>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3e7:	0f be 02             	movsbl (%edx),%eax
+ 3ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3f5:	77 1e                	ja     415 <atoi+0x35>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 400:	83 c2 01             	add    $0x1,%edx
+ 403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 40a:	0f be 02             	movsbl (%edx),%eax
+ 40d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 410:	80 fb 09             	cmp    $0x9,%bl
+ 413:	76 eb                	jbe    400 <atoi+0x20>
+  return n;
+}
+ 415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 418:	89 c8                	mov    %ecx,%eax
+ 41a:	c9                   	leave
+ 41b:	c3                   	ret
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	8b 45 10             	mov    0x10(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 42e:	85 c0                	test   %eax,%eax
+ 430:	7e 13                	jle    445 <memmove+0x25>
+ 432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 434:	89 d7                	mov    %edx,%edi
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 441:	39 f8                	cmp    %edi,%eax
+ 443:	75 fb                	jne    440 <memmove+0x20>
+  return vdst;
+}
+ 445:	5e                   	pop    %esi
+ 446:	89 d0                	mov    %edx,%eax
+ 448:	5f                   	pop    %edi
+ 449:	5d                   	pop    %ebp
+ 44a:	c3                   	ret
+
+0000044b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 44b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <exit>:
+SYSCALL(exit)
+ 453:	b8 02 00 00 00       	mov    $0x2,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <wait>:
+SYSCALL(wait)
+ 45b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <pipe>:
+SYSCALL(pipe)
+ 463:	b8 04 00 00 00       	mov    $0x4,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <read>:
+SYSCALL(read)
+ 46b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <write>:
+SYSCALL(write)
+ 473:	b8 10 00 00 00       	mov    $0x10,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <close>:
+SYSCALL(close)
+ 47b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <kill>:
+SYSCALL(kill)
+ 483:	b8 06 00 00 00       	mov    $0x6,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <exec>:
+SYSCALL(exec)
+ 48b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <open>:
+SYSCALL(open)
+ 493:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mknod>:
+SYSCALL(mknod)
+ 49b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <unlink>:
+SYSCALL(unlink)
+ 4a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <fstat>:
+SYSCALL(fstat)
+ 4ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <link>:
+SYSCALL(link)
+ 4b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mkdir>:
+SYSCALL(mkdir)
+ 4bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <chdir>:
+SYSCALL(chdir)
+ 4c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <dup>:
+SYSCALL(dup)
+ 4cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getpid>:
+SYSCALL(getpid)
+ 4d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <sbrk>:
+SYSCALL(sbrk)
+ 4db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <sleep>:
+SYSCALL(sleep)
+ 4e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <uptime>:
+SYSCALL(uptime)
+ 4eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getrss>:
+SYSCALL(getrss)
+ 4f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 4fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <usleep>:
+SYSCALL(usleep)
+ 503:	b8 18 00 00 00       	mov    $0x18,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <lockstat>:
+SYSCALL(lockstat)
+ 50b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <clone>:
+SYSCALL(clone)
+ 513:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <join>:
+SYSCALL(join)
+ 51b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <futex>:
+SYSCALL(futex)
+ 523:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mmap>:
+SYSCALL(mmap)
+ 52b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <munmap>:
+SYSCALL(munmap)
+ 533:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sendfile>:
+SYSCALL(sendfile)
+ 53b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <splice>:
+SYSCALL(splice)
+ 543:	b8 20 00 00 00       	mov    $0x20,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 0c 0a 00 00 	movzbl 0xa0c(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 a6 fe ff ff       	call   473 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 3c fe ff ff       	call   473 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 b4 09 00 00 	jmp    *0x9b4(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 dd fd ff ff       	call   473 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 cb fd ff ff       	call   473 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 51 fd ff ff       	call   473 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 01 fd ff ff       	call   473 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb ab 09 00 00       	mov    $0x9ab,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	a1 a0 12 00 00       	mov    0x12a0,%eax
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bc:	39 ca                	cmp    %ecx,%edx
+ 7be:	73 30                	jae    7f0 <free+0x50>
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 04                	jb     7c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c4:	39 c2                	cmp    %eax,%edx
+ 7c6:	72 f0                	jb     7b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ce:	39 f8                	cmp    %edi,%eax
+ 7d0:	74 2e                	je     800 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7db:	39 f1                	cmp    %esi,%ecx
+ 7dd:	74 38                	je     817 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e1:	5b                   	pop    %ebx
+  freep = p;
+ 7e2:	89 15 a0 12 00 00    	mov    %edx,0x12a0
+}
+ 7e8:	5e                   	pop    %esi
+ 7e9:	5f                   	pop    %edi
+ 7ea:	5d                   	pop    %ebp
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 d0                	jb     7c4 <free+0x24>
+ 7f4:	eb c2                	jmp    7b8 <free+0x18>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 70 04             	add    0x4(%eax),%esi
+ 803:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 80d:	8b 42 04             	mov    0x4(%edx),%eax
+ 810:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 813:	39 f1                	cmp    %esi,%ecx
+ 815:	75 c8                	jne    7df <free+0x3f>
+    p->s.size += bp->s.size;
+ 817:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 81a:	89 15 a0 12 00 00    	mov    %edx,0x12a0
+    p->s.size += bp->s.size;
+ 820:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 823:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 826:	89 0a                	mov    %ecx,(%edx)
+}
+ 828:	5b                   	pop    %ebx
+ 829:	5e                   	pop    %esi
+ 82a:	5f                   	pop    %edi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 83c:	8b 15 a0 12 00 00    	mov    0x12a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8d 78 07             	lea    0x7(%eax),%edi
+ 845:	c1 ef 03             	shr    $0x3,%edi
+ 848:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 84b:	85 d2                	test   %edx,%edx
+ 84d:	0f 84 8d 00 00 00    	je     8e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 f9                	cmp    %edi,%ecx
+ 85a:	73 64                	jae    8c0 <malloc+0x90>
+  if(nu < 4096)
+ 85c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 861:	39 df                	cmp    %ebx,%edi
+ 863:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 866:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 86d:	eb 0a                	jmp    879 <malloc+0x49>
+ 86f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 870:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 872:	8b 48 04             	mov    0x4(%eax),%ecx
+ 875:	39 f9                	cmp    %edi,%ecx
+ 877:	73 47                	jae    8c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 879:	89 c2                	mov    %eax,%edx
+ 87b:	39 05 a0 12 00 00    	cmp    %eax,0x12a0
+ 881:	75 ed                	jne    870 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	56                   	push   %esi
+ 887:	e8 4f fc ff ff       	call   4db <sbrk>
+  if(p == (char*)-1)
+ 88c:	83 c4 10             	add    $0x10,%esp
+ 88f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 892:	74 1c                	je     8b0 <malloc+0x80>
+  hp->s.size = nu;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 897:	83 ec 0c             	sub    $0xc,%esp
+ 89a:	83 c0 08             	add    $0x8,%eax
+ 89d:	50                   	push   %eax
+ 89e:	e8 fd fe ff ff       	call   7a0 <free>
+  return freep;
+ 8a3:	8b 15 a0 12 00 00    	mov    0x12a0,%edx
+      if((p = morecore(nunits)) == 0)
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	75 c0                	jne    870 <malloc+0x40>
+        return 0;
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8b3:	31 c0                	xor    %eax,%eax
+}
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8c0:	39 cf                	cmp    %ecx,%edi
+ 8c2:	74 4c                	je     910 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8c4:	29 f9                	sub    %edi,%ecx
+ 8c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8cf:	89 15 a0 12 00 00    	mov    %edx,0x12a0
+}
+ 8d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8d8:	83 c0 08             	add    $0x8,%eax
+}
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5f                   	pop    %edi
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8e0:	c7 05 a0 12 00 00 a4 	movl   $0x12a4,0x12a0
+ 8e7:	12 00 00 
+    base.s.size = 0;
+ 8ea:	b8 a4 12 00 00       	mov    $0x12a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ef:	c7 05 a4 12 00 00 a4 	movl   $0x12a4,0x12a4
+ 8f6:	12 00 00 
+    base.s.size = 0;
+ 8f9:	c7 05 a8 12 00 00 00 	movl   $0x0,0x12a8
+ 900:	00 00 00 
+    if(p->s.size >= nunits){
+ 903:	e9 54 ff ff ff       	jmp    85c <malloc+0x2c>
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 910:	8b 08                	mov    (%eax),%ecx
+ 912:	89 0a                	mov    %ecx,(%edx)
+ 914:	eb b9                	jmp    8cf <malloc+0x9f>
@@ -0,0 +1,95 @@
+// Print spin lock contention statistics.
+//
+//   lockstat            print statistics since boot or last reset
+//   lockstat -r         reset them
+//   lockstat cmd args   reset, run cmd, print statistics for the run
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NSTAT 32
+
+struct lockstat st[NSTAT];
+
+// printf has no 64-bit conversions and user programs are not
+// linked with libgcc, so divide by 10 one bit at a time.
+void
+printu64(uint64 v)
+{
+  char buf[21];
+  uint64 q;
+  uint r;
+  int i, n;
+
+  n = 0;
+  do {
+    q = 0;
+    r = 0;
+    for(i = 63; i >= 0; i--){
+      r = (r << 1) | ((v >> i) & 1);
+      q <<= 1;
+      if(r >= 10){
+        r -= 10;
+        q |= 1;
+      }
+    }
+    buf[n++] = '0' + r;
+    v = q;
+  } while(v);
+  while(n > 0)
+    printf(1, "%c", buf[--n]);
+}
+
+void
+print(void)
+{
+  int i, n;
+
+  n = lockstat(st, NSTAT);
+  if(n < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  printf(1, "name locks acquired contended spin-cycles max-hold-cycles\n");
+  for(i = 0; i < n; i++){
+    if(st[i].nacquire == 0)
+      continue;
+    printf(1, "%s %d %d %d ", st[i].name, st[i].nlocks,
+           st[i].nacquire, st[i].ncontended);
+    printu64(st[i].spincycles);
+    printf(1, " ");
+    printu64(st[i].maxhold);
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid;
+
+  if(argc < 2){
+    print();
+    exit();
+  }
+
+  lockstat(0, 0);
+  if(strcmp(argv[1], "-r") == 0)
+    exit();
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "lockstat: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[1], argv+1);
+    printf(2, "lockstat: exec %s failed\n", argv[1]);
+    exit();
+  }
+  wait();
+  print();
+  exit();
+}
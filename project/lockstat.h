@@ -0,0 +1,10 @@
+// Contention statistics for all statically allocated spin locks
+// that share a name, as returned by the lockstat system call.
+struct lockstat {
+  char name[16];      // Name of the locks
+  uint nlocks;        // Number of locks with this name
+  uint nacquire;      // Number of acquisitions
+  uint ncontended;    // Acquisitions that had to wait
+  uint64 spincycles;  // rdtsc cycles spent waiting
+  uint64 maxhold;     // Longest hold of any of the locks, in cycles
+};
@@ -18,7 +18,16 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// commits the running transaction first.
+//
+// Commits are grouped: end_op() does not commit. The logd kernel
+// thread commits every GROUPTICKS ticks, so one commit covers all
+// the operations of that interval. To commit, it stops new
+// operations from starting, waits for the outstanding ones to end,
+// and copies the blocks of the transaction to their log slots. The
+// next transaction then starts at once and runs while the committing
+// one goes to disk. A block the next transaction changes meanwhile
+// keeps its committed version in the log.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,86 +36,208 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// sb.nlog sets its size. Log appends are synchronous.
+//
+// Installs are not: commit() queues the writes to home locations
+// with bdwrite() and returns, leaving the header on disk. Replaying
+// an installed transaction is harmless, so the header is erased only
+// by the next commit, after a bsync() barrier has put the installs
+// on disk. A block the next transaction changes before its install
+// reaches the disk is written home from its log slot instead.
+//
+// In ordered mode (SB_ORDERED) the file system writes file data in
+// place with bdwrite() rather than logging it; the bsync() before the
+// header write puts it on disk before the commit record. Blocks freed
+// by a transaction must not be reused for such data before it
+// commits, since on disk they still belong to their old owner;
+// log_free() and log_freed() keep track of them.
+
+#define GROUPTICKS 3
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  int block[LOGMAX];
+};
+
+// A transaction in memory.
+struct trans {
+  struct logheader lh;
+  char stale[LOGMAX];       // lh.block[i] had an install pending
+  int nfreed;
+  uchar freed[FSSIZE/8+1];  // Bitmap of blocks it freed
 };
 
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int size;        // Most blocks in a transaction
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // in group_commit(), please wait.
+  int frozen;      // commit waits for outstanding ops; begin_op waits
   int dev;
-  struct logheader lh;
+  struct trans trans[2];
+  struct trans *run;     // The running transaction
+  struct trans *com;     // The committing one, or 0
+  struct logheader inst; // Committed, installs may be pending
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void write_head(struct logheader*);
+static void group_commit(int);
+
+static void
+logd(void)
+{
+  for(;;){
+    sleepticks(GROUPTICKS);
+    group_commit(1);
+  }
+}
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  if (sizeof(struct logheader) > BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog - 1;
+  if (log.size > LOGMAX)
+    log.size = LOGMAX;
+  if (log.size < MAXOPBLOCKS)
+    panic("initlog: log too small");
+  // Logged blocks stay in the cache until they commit.
+  if (!breserve(log.size))
+    panic("initlog: no buffers for the log");
   log.dev = dev;
+  log.run = &log.trans[0];
   recover_from_log();
+  if (kthread("logd", logd) < 0)
+    panic("initlog: logd");
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// The writes are delayed; bsync() waits for them.
 static void
-install_trans(void)
+install_trans(struct logheader *lh)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
+  for (tail = 0; tail < lh->n; tail++) {
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+    struct buf *dbuf = bread(log.dev, lh->block[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+    bdwrite(dbuf);  // write dst to disk later
+    brelse(lbuf);
+    brelse(dbuf);
+  }
+}
+
+// Index of block b in transaction t, or -1.
+// Caller must hold log.lock.
+static int
+logged(struct trans *t, uint b)
+{
+  int i;
+
+  for (i = 0; i < t->lh.n; i++)
+    if (t->lh.block[i] == b)
+      return i;
+  return -1;
+}
+
+// Queue writes of the blocks of committed transaction t to their
+// home locations. The cache still holds them, pinned by B_DIRTY.
+// A block the running transaction has changed since is marked
+// stale there, for retire() to write home from the log.
+static void
+install(struct trans *t)
+{
+  struct buf *b;
+  int i, j;
+
+  for (i = 0; i < t->lh.n; i++) {
+    b = bread(log.dev, t->lh.block[i]);
+    acquire(&log.lock);
+    if ((j = logged(log.run, b->blockno)) >= 0)
+      log.run->stale[j] = 1;
+    release(&log.lock);
+    if (j < 0)
+      bdwrite(b);
+    brelse(b);
+  }
+}
+
+// Finish installing the last committed transaction and erase it
+// from the log, so that the log can be reused by transaction t.
+static void
+retire(struct trans *t)
+{
+  static uchar save[BSIZE];
+  struct logheader empty;
+  struct buf *lbuf, *dbuf;
+  int i, tail;
+
+  if (log.inst.n == 0)
+    return;
+  for (i = 0; i < t->lh.n; i++) {
+    if (!t->stale[i])
+      continue;
+    // Changed by t: write home the committed
+    // version, which is still in the log.
+    for (tail = 0; tail < log.inst.n; tail++)
+      if (log.inst.block[tail] == t->lh.block[i])
+        break;
+    if (tail == log.inst.n)
+      panic("retire");
+    lbuf = bread(log.dev, log.start+tail+1);
+    dbuf = bread(log.dev, t->lh.block[i]);
+    memmove(save, dbuf->data, BSIZE);
+    memmove(dbuf->data, lbuf->data, BSIZE);
+    bwrite(dbuf);
+    memmove(dbuf->data, save, BSIZE);
+    dbuf->flags |= B_DIRTY; // still logged
     brelse(lbuf);
     brelse(dbuf);
   }
+  bsync();
+  empty.n = 0;
+  write_head(&empty);
+  log.inst.n = 0;
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header from disk into lh
 static void
-read_head(void)
+read_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
+  struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  lh->n = hb->n;
+  for (i = 0; i < lh->n; i++) {
+    lh->block[i] = hb->block[i];
   }
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write log header lh to disk.
 // This is the true point at which the
 // current transaction commits.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = bgetblk(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
@@ -115,10 +246,21 @@ write_head(void)
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct logheader *lh = &log.run->lh;
+
+  read_head(lh);
+  install_trans(lh); // if committed, copy from log to disk
+  bsync();
+  lh->n = 0;
+  write_head(lh); // clear the log
+}
+
+// Does the running transaction leave room for another op?
+// Caller must hold log.lock.
+static int
+logfull(void)
+{
+  return log.run->lh.n + (log.outstanding+1)*MAXOPBLOCKS > log.size;
 }
 
 // called at the start of each FS system call.
@@ -127,11 +269,18 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
-      sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    if(log.frozen){
       sleep(&log, &log.lock);
+    } else if(logfull()){
+      // this op might exhaust log space.
+      if(log.run->lh.n == 0){
+        // all of it is reserved by outstanding ops.
+        sleep(&log, &log.lock);
+      } else {
+        release(&log.lock);
+        group_commit(0);
+        acquire(&log.lock);
+      }
     } else {
       log.outstanding += 1;
       release(&log.lock);
@@ -141,64 +290,94 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
-  }
+  // begin_op() may be waiting for log space, and a commit
+  // for the last outstanding op to end.
+  wakeup(&log);
   release(&log.lock);
-
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
-  }
 }
 
-// Copy modified blocks from cache to log.
+// Copy the blocks of t from cache to log. The log
+// writes are delayed until the bsync() in commit().
 static void
-write_log(void)
+write_log(struct trans *t)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < t->lh.n; tail++) {
+    struct buf *to = bgetblk(log.dev, log.start+tail+1); // log block
+    struct buf *from = bread(log.dev, t->lh.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    bdwrite(to);  // write the log
     brelse(from);
     brelse(to);
   }
 }
 
+// Commit the running transaction. log.frozen is set and
+// no ops are outstanding, so nothing changes its blocks
+// until they are copied to the log.
 static void
-commit()
-{
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+commit(void)
+{
+  struct trans *t = log.run;
+
+  retire(t);        // Free the log of the last transaction
+  write_log(t);     // Copy modified blocks from cache to log
+
+  // Let the next transaction run.
+  acquire(&log.lock);
+  log.com = t;
+  log.run = (t == &log.trans[0]) ? &log.trans[1] : &log.trans[0];
+  log.run->lh.n = 0;
+  log.frozen = 0;
+  wakeup(&log);
+  release(&log.lock);
+
+  bsync();          // Write log (and ordered data) to disk
+  write_head(&t->lh); // Write header to disk -- the real commit
+  acquire(&log.lock);
+  log.inst = t->lh;
+  release(&log.lock);
+  install(t);       // Now queue writes to home locations
+
+  acquire(&log.lock);
+  log.com = 0;
+  if (t->nfreed > 0) {
+    memset(t->freed, 0, sizeof(t->freed));
+    t->nfreed = 0;
+  }
+  release(&log.lock);
+}
+
+// Commit the running transaction if it is not empty, or with
+// all==0 only if it has no room for another op.
+static void
+group_commit(int all)
+{
+  acquire(&log.lock);
+  while (log.committing)
+    sleep(&log, &log.lock);
+  if (log.run->lh.n == 0 || (!all && !logfull())) {
+    release(&log.lock);
+    return;
   }
+  log.committing = 1;
+  log.frozen = 1;
+  while (log.outstanding > 0)
+    sleep(&log, &log.lock);
+  release(&log.lock);
+
+  commit();
+
+  acquire(&log.lock);
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
 }
 
 // Caller has modified b->data and is done with the buffer.
@@ -213,22 +392,60 @@ commit()
 void
 log_write(struct buf *b)
 {
-  int i;
+  struct trans *t;
+  int i, j, stale;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.run->lh.n >= log.size)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
+  // A pending write must not put this transaction's changes
+  // home before it commits. If it was an install, retire()
+  // writes the committed version home instead; otherwise it was
+  // ordered-mode data of a block freed by this transaction.
+  stale = bundelay(b);
+
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
+  t = log.run;
+  for (i = 0; i < t->lh.n; i++) {
+    if (t->lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
+  t->lh.block[i] = b->blockno;
+  if (i == t->lh.n) {
+    t->stale[i] = 0;
+    t->lh.n++;
+  }
+  for (j = 0; stale && j < log.inst.n; j++)
+    if (log.inst.block[j] == b->blockno)
+      t->stale[i] = 1;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
 
+// Record that the running transaction freed block b.
+void
+log_free(uint b)
+{
+  if (b >= FSSIZE)
+    panic("log_free");
+  acquire(&log.lock);
+  log.run->freed[b/8] |= 1 << (b%8);
+  log.run->nfreed++;
+  release(&log.lock);
+}
+
+// Has a transaction that is not yet committed freed block b?
+int
+log_freed(uint b)
+{
+  int r;
+
+  acquire(&log.lock);
+  r = (log.run->freed[b/8] >> (b%8)) & 1;
+  if (log.com)
+    r |= (log.com->freed[b/8] >> (b%8)) & 1;
+  release(&log.lock);
+  return r;
+}
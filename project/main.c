@@ -27,13 +27,18 @@ main(void)
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  rcuinit();       // deferred frees
   tvinit();        // trap vectors
+  timerinit();     // clock and timer wheel
   binit();         // buffer cache
+  pcinit();        // page cache
+  tcinit();        // program page cache
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();      // first user process
+  bflushinit();    // buffer cache write-back thread
   mpmain();        // finish this processor's setup
 }
 
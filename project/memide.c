@@ -15,6 +15,8 @@
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
+int diskirq = -1;
+
 static int disksize;
 static uchar *memdisk;
 
@@ -58,3 +60,33 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk has no latency to hide:
+// do the whole request at once.
+void
+ideasync(struct buf *b)
+{
+  struct buf *next;
+  uchar *p;
+
+  for(; b; b = next){
+    next = b->cnext;
+    if(b->blockno >= disksize)
+      panic("iderw: block out of range");
+    b->cnext = 0;
+    p = memdisk + b->blockno*BSIZE;
+    if(b->flags & B_DIRTY){
+      b->flags &= ~B_DIRTY;
+      memmove(p, b->data, BSIZE);
+    } else
+      memmove(b->data, p, BSIZE);
+    b->flags |= B_VALID;
+    if(b->flags & B_ASYNC)
+      bdone(b);
+  }
+}
+
+void
+iderwait(struct buf *b)
+{
+}
@@ -0,0 +1,1342 @@
+
+_memtest2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+	exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+	// printf(1, "Memtest starting\n");
+	mem();
+   6:	e8 05 00 00 00       	call   10 <mem>
+   b:	66 90                	xchg   %ax,%ax
+   d:	66 90                	xchg   %ax,%ax
+   f:	90                   	nop
+
+00000010 <mem>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	57                   	push   %edi
+  14:	56                   	push   %esi
+  15:	53                   	push   %ebx
+  16:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  1b:	83 ec 0c             	sub    $0xc,%esp
+  1e:	66 90                	xchg   %ax,%ax
+		char *memory = (char*) malloc(size); //4kb;
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	68 00 10 00 00       	push   $0x1000
+  28:	e8 c3 07 00 00       	call   7f0 <malloc>
+	for(int j=0;j<200;++j){
+  2d:	83 c4 10             	add    $0x10,%esp
+		memory[0] = (char) (65);
+  30:	c6 00 41             	movb   $0x41,(%eax)
+	for(int j=0;j<200;++j){
+  33:	83 eb 01             	sub    $0x1,%ebx
+  36:	75 e8                	jne    20 <mem+0x10>
+	pid = fork();
+  38:	e8 ce 03 00 00       	call   40b <fork>
+	if(pid > 0) {
+  3d:	85 c0                	test   %eax,%eax
+  3f:	0f 8e 8c 00 00 00    	jle    d1 <mem+0xc1>
+  45:	be 64 00 00 00       	mov    $0x64,%esi
+				memory[k] = (char)(65+(k%26));
+  4a:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+			char *memory = (char*) malloc(size); //4kb;
+  4f:	83 ec 0c             	sub    $0xc,%esp
+  52:	68 00 10 00 00       	push   $0x1000
+  57:	e8 94 07 00 00       	call   7f0 <malloc>
+			if (memory == 0) goto failed;
+  5c:	83 c4 10             	add    $0x10,%esp
+			char *memory = (char*) malloc(size); //4kb;
+  5f:	89 c3                	mov    %eax,%ebx
+			if (memory == 0) goto failed;
+  61:	85 c0                	test   %eax,%eax
+  63:	74 58                	je     bd <mem+0xad>
+			for(int k=0;k<size;++k){
+  65:	31 c9                	xor    %ecx,%ecx
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+				memory[k] = (char)(65+(k%26));
+  70:	89 c8                	mov    %ecx,%eax
+  72:	f7 e7                	mul    %edi
+  74:	89 c8                	mov    %ecx,%eax
+  76:	c1 ea 03             	shr    $0x3,%edx
+  79:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  7c:	29 d0                	sub    %edx,%eax
+  7e:	83 c0 41             	add    $0x41,%eax
+  81:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+			for(int k=0;k<size;++k){
+  84:	83 c1 01             	add    $0x1,%ecx
+  87:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8d:	75 e1                	jne    70 <mem+0x60>
+			for(int k=0;k<size;++k){
+  8f:	31 c9                	xor    %ecx,%ecx
+  91:	eb 14                	jmp    a7 <mem+0x97>
+  93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  97:	90                   	nop
+  98:	83 c1 01             	add    $0x1,%ecx
+  9b:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  a1:	0f 84 c7 00 00 00    	je     16e <mem+0x15e>
+				if(memory[k] != (char)(65+(k%26))) goto failed;
+  a7:	89 c8                	mov    %ecx,%eax
+  a9:	f7 e7                	mul    %edi
+  ab:	89 c8                	mov    %ecx,%eax
+  ad:	c1 ea 03             	shr    $0x3,%edx
+  b0:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  b3:	29 d0                	sub    %edx,%eax
+  b5:	83 c0 41             	add    $0x41,%eax
+  b8:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+  bb:	74 db                	je     98 <mem+0x88>
+	printf(1, "Memtest2 Failed!\n");
+  bd:	83 ec 08             	sub    $0x8,%esp
+  c0:	68 19 09 00 00       	push   $0x919
+  c5:	6a 01                	push   $0x1
+  c7:	e8 e4 04 00 00       	call   5b0 <printf>
+	exit();
+  cc:	e8 42 03 00 00       	call   413 <exit>
+	else if(pid < 0){ 
+  d1:	74 16                	je     e9 <mem+0xd9>
+		printf(1, "Fork Failed\n");
+  d3:	53                   	push   %ebx
+  d4:	53                   	push   %ebx
+  d5:	68 ea 08 00 00       	push   $0x8ea
+  da:	6a 01                	push   $0x1
+  dc:	e8 cf 04 00 00       	call   5b0 <printf>
+  e1:	83 c4 10             	add    $0x10,%esp
+	exit();
+  e4:	e8 2a 03 00 00       	call   413 <exit>
+		sleep(100);
+  e9:	83 ec 0c             	sub    $0xc,%esp
+  ec:	be 34 01 00 00       	mov    $0x134,%esi
+				memory[k] = (char)(65+(k%26));
+  f1:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+		sleep(100);
+  f6:	6a 64                	push   $0x64
+  f8:	e8 a6 03 00 00       	call   4a3 <sleep>
+  fd:	83 c4 10             	add    $0x10,%esp
+			char *memory = (char*) malloc(size); //4kb;
+ 100:	83 ec 0c             	sub    $0xc,%esp
+ 103:	68 00 10 00 00       	push   $0x1000
+ 108:	e8 e3 06 00 00       	call   7f0 <malloc>
+			if (memory == 0) goto failed;
+ 10d:	83 c4 10             	add    $0x10,%esp
+			char *memory = (char*) malloc(size); //4kb;
+ 110:	89 c3                	mov    %eax,%ebx
+			if (memory == 0) goto failed;
+ 112:	85 c0                	test   %eax,%eax
+ 114:	74 a7                	je     bd <mem+0xad>
+			for(int k=0;k<size;++k){
+ 116:	31 c9                	xor    %ecx,%ecx
+ 118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+				memory[k] = (char)(65+(k%26));
+ 120:	89 c8                	mov    %ecx,%eax
+ 122:	f7 e7                	mul    %edi
+ 124:	89 c8                	mov    %ecx,%eax
+ 126:	c1 ea 03             	shr    $0x3,%edx
+ 129:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 12c:	29 d0                	sub    %edx,%eax
+ 12e:	83 c0 41             	add    $0x41,%eax
+ 131:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+			for(int k=0;k<size;++k){
+ 134:	83 c1 01             	add    $0x1,%ecx
+ 137:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+ 13d:	75 e1                	jne    120 <mem+0x110>
+			for(int k=0;k<size;++k){
+ 13f:	31 c9                	xor    %ecx,%ecx
+ 141:	eb 10                	jmp    153 <mem+0x143>
+ 143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 147:	90                   	nop
+ 148:	83 c1 01             	add    $0x1,%ecx
+ 14b:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+ 151:	74 44                	je     197 <mem+0x187>
+				if(memory[k] != (char)(65+(k%26))) goto failed;
+ 153:	89 c8                	mov    %ecx,%eax
+ 155:	f7 e7                	mul    %edi
+ 157:	89 c8                	mov    %ecx,%eax
+ 159:	c1 ea 03             	shr    $0x3,%edx
+ 15c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 15f:	29 d0                	sub    %edx,%eax
+ 161:	83 c0 41             	add    $0x41,%eax
+ 164:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+ 167:	74 df                	je     148 <mem+0x138>
+ 169:	e9 4f ff ff ff       	jmp    bd <mem+0xad>
+		for(int j=0;j<100;++j){
+ 16e:	83 ee 01             	sub    $0x1,%esi
+ 171:	0f 85 d8 fe ff ff    	jne    4f <mem+0x3f>
+		printf(1,"Parent alloc-ed:\n");
+ 177:	56                   	push   %esi
+ 178:	56                   	push   %esi
+ 179:	68 d8 08 00 00       	push   $0x8d8
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 2b 04 00 00       	call   5b0 <printf>
+		getrss();
+ 185:	e8 29 03 00 00       	call   4b3 <getrss>
+		wait();
+ 18a:	e8 8c 02 00 00       	call   41b <wait>
+ 18f:	83 c4 10             	add    $0x10,%esp
+ 192:	e9 4d ff ff ff       	jmp    e4 <mem+0xd4>
+		for(int j=0;j<308;++j){
+ 197:	83 ee 01             	sub    $0x1,%esi
+ 19a:	0f 85 60 ff ff ff    	jne    100 <mem+0xf0>
+		printf(1,"Child alloc-ed\n");
+ 1a0:	50                   	push   %eax
+ 1a1:	50                   	push   %eax
+ 1a2:	68 f7 08 00 00       	push   $0x8f7
+ 1a7:	6a 01                	push   $0x1
+ 1a9:	e8 02 04 00 00       	call   5b0 <printf>
+		getrss();
+ 1ae:	e8 00 03 00 00       	call   4b3 <getrss>
+		printf(1, "Memtest2 Passed!\n");
+ 1b3:	5a                   	pop    %edx
+ 1b4:	59                   	pop    %ecx
+ 1b5:	68 07 09 00 00       	push   $0x907
+ 1ba:	6a 01                	push   $0x1
+ 1bc:	e8 ef 03 00 00       	call   5b0 <printf>
+ 1c1:	83 c4 10             	add    $0x10,%esp
+ 1c4:	e9 1b ff ff ff       	jmp    e4 <mem+0xd4>
+ 1c9:	66 90                	xchg   %ax,%ax
+ 1cb:	66 90                	xchg   %ax,%ax
+ 1cd:	66 90                	xchg   %ax,%ax
+ 1cf:	90                   	nop
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 1e 01 00 00       	call   42b <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <exit>:
+SYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <exec>:
+SYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getrss>:
+SYSCALL(getrss)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <usleep>:
+SYSCALL(usleep)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <lockstat>:
+SYSCALL(lockstat)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <clone>:
+SYSCALL(clone)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <join>:
+SYSCALL(join)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <futex>:
+SYSCALL(futex)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mmap>:
+SYSCALL(mmap)
+ 4eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <munmap>:
+SYSCALL(munmap)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sendfile>:
+SYSCALL(sendfile)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <splice>:
+SYSCALL(splice)
+ 503:	b8 20 00 00 00       	mov    $0x20,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+ 50b:	66 90                	xchg   %ax,%ax
+ 50d:	66 90                	xchg   %ax,%ax
+ 50f:	90                   	nop
+
+00000510 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 518:	89 d1                	mov    %edx,%ecx
+{
+ 51a:	83 ec 3c             	sub    $0x3c,%esp
+ 51d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 520:	85 d2                	test   %edx,%edx
+ 522:	0f 89 80 00 00 00    	jns    5a8 <printint+0x98>
+ 528:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 52c:	74 7a                	je     5a8 <printint+0x98>
+    x = -xx;
+ 52e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 530:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 535:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 538:	31 f6                	xor    %esi,%esi
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 540:	89 c8                	mov    %ecx,%eax
+ 542:	31 d2                	xor    %edx,%edx
+ 544:	89 f7                	mov    %esi,%edi
+ 546:	f7 f3                	div    %ebx
+ 548:	8d 76 01             	lea    0x1(%esi),%esi
+ 54b:	0f b6 92 a0 09 00 00 	movzbl 0x9a0(%edx),%edx
+ 552:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 556:	89 ca                	mov    %ecx,%edx
+ 558:	89 c1                	mov    %eax,%ecx
+ 55a:	39 da                	cmp    %ebx,%edx
+ 55c:	73 e2                	jae    540 <printint+0x30>
+  if(neg)
+ 55e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 561:	85 c0                	test   %eax,%eax
+ 563:	74 07                	je     56c <printint+0x5c>
+    buf[i++] = '-';
+ 565:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 56a:	89 f7                	mov    %esi,%edi
+ 56c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 56f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 572:	01 df                	add    %ebx,%edi
+ 574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 578:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 57b:	83 ec 04             	sub    $0x4,%esp
+ 57e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 581:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 584:	6a 01                	push   $0x1
+ 586:	50                   	push   %eax
+ 587:	56                   	push   %esi
+ 588:	e8 a6 fe ff ff       	call   433 <write>
+  while(--i >= 0)
+ 58d:	89 f8                	mov    %edi,%eax
+ 58f:	83 c4 10             	add    $0x10,%esp
+ 592:	83 ef 01             	sub    $0x1,%edi
+ 595:	39 d8                	cmp    %ebx,%eax
+ 597:	75 df                	jne    578 <printint+0x68>
+}
+ 599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 59c:	5b                   	pop    %ebx
+ 59d:	5e                   	pop    %esi
+ 59e:	5f                   	pop    %edi
+ 59f:	5d                   	pop    %ebp
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5a8:	31 c0                	xor    %eax,%eax
+ 5aa:	eb 89                	jmp    535 <printint+0x25>
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c2:	83 c6 01             	add    $0x1,%esi
+ 5c5:	84 db                	test   %bl,%bl
+ 5c7:	74 67                	je     630 <printf+0x80>
+ 5c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5cc:	31 d2                	xor    %edx,%edx
+ 5ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5d1:	eb 34                	jmp    607 <printf+0x57>
+ 5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5d7:	90                   	nop
+ 5d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5e0:	83 f8 25             	cmp    $0x25,%eax
+ 5e3:	74 18                	je     5fd <printf+0x4d>
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	50                   	push   %eax
+ 5f1:	57                   	push   %edi
+ 5f2:	e8 3c fe ff ff       	call   433 <write>
+ 5f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 600:	83 c6 01             	add    $0x1,%esi
+ 603:	84 db                	test   %bl,%bl
+ 605:	74 29                	je     630 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 607:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 60a:	85 d2                	test   %edx,%edx
+ 60c:	74 ca                	je     5d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 60e:	83 fa 25             	cmp    $0x25,%edx
+ 611:	75 ea                	jne    5fd <printf+0x4d>
+      if(c == 'd'){
+ 613:	83 f8 25             	cmp    $0x25,%eax
+ 616:	0f 84 24 01 00 00    	je     740 <printf+0x190>
+ 61c:	83 e8 63             	sub    $0x63,%eax
+ 61f:	83 f8 15             	cmp    $0x15,%eax
+ 622:	77 1c                	ja     640 <printf+0x90>
+ 624:	ff 24 85 48 09 00 00 	jmp    *0x948(,%eax,4)
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5f                   	pop    %edi
+ 636:	5d                   	pop    %ebp
+ 637:	c3                   	ret
+ 638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 646:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 64a:	6a 01                	push   $0x1
+ 64c:	52                   	push   %edx
+ 64d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 650:	57                   	push   %edi
+ 651:	e8 dd fd ff ff       	call   433 <write>
+ 656:	83 c4 0c             	add    $0xc,%esp
+ 659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65c:	6a 01                	push   $0x1
+ 65e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 661:	52                   	push   %edx
+ 662:	57                   	push   %edi
+ 663:	e8 cb fd ff ff       	call   433 <write>
+        putc(fd, c);
+ 668:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66b:	31 d2                	xor    %edx,%edx
+ 66d:	eb 8e                	jmp    5fd <printf+0x4d>
+ 66f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 673:	83 ec 0c             	sub    $0xc,%esp
+ 676:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 67b:	8b 13                	mov    (%ebx),%edx
+ 67d:	6a 00                	push   $0x0
+ 67f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 681:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 684:	e8 87 fe ff ff       	call   510 <printint>
+        ap++;
+ 689:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 68c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 67 ff ff ff       	jmp    5fd <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6a5:	83 c0 04             	add    $0x4,%eax
+ 6a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6ab:	85 db                	test   %ebx,%ebx
+ 6ad:	0f 84 9d 00 00 00    	je     750 <printf+0x1a0>
+        while(*s != 0){
+ 6b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	0f 84 3d ff ff ff    	je     5fd <printf+0x4d>
+ 6c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6c6:	89 de                	mov    %ebx,%esi
+ 6c8:	89 d3                	mov    %edx,%ebx
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	53                   	push   %ebx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 51 fd ff ff       	call   433 <write>
+        while(*s != 0){
+ 6e2:	0f b6 06             	movzbl (%esi),%eax
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 e4                	jne    6d0 <printf+0x120>
+      state = 0;
+ 6ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 07 ff ff ff       	jmp    5fd <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 01                	push   $0x1
+ 70f:	e9 6b ff ff ff       	jmp    67f <printf+0xcf>
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 718:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 721:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 723:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 726:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	52                   	push   %edx
+ 72c:	57                   	push   %edi
+ 72d:	e8 01 fd ff ff       	call   433 <write>
+        ap++;
+ 732:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 735:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 738:	31 d2                	xor    %edx,%edx
+ 73a:	e9 be fe ff ff       	jmp    5fd <printf+0x4d>
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 746:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 749:	6a 01                	push   $0x1
+ 74b:	e9 11 ff ff ff       	jmp    661 <printf+0xb1>
+ 750:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 755:	bb 41 09 00 00       	mov    $0x941,%ebx
+ 75a:	e9 61 ff ff ff       	jmp    6c0 <printf+0x110>
+ 75f:	90                   	nop
+
+00000760 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 760:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 761:	a1 a0 2c 00 00       	mov    0x2ca0,%eax
+{
+ 766:	89 e5                	mov    %esp,%ebp
+ 768:	57                   	push   %edi
+ 769:	56                   	push   %esi
+ 76a:	53                   	push   %ebx
+ 76b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 76e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 778:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 77a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 77c:	39 ca                	cmp    %ecx,%edx
+ 77e:	73 30                	jae    7b0 <free+0x50>
+ 780:	39 c1                	cmp    %eax,%ecx
+ 782:	72 04                	jb     788 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 784:	39 c2                	cmp    %eax,%edx
+ 786:	72 f0                	jb     778 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 788:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 78b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 78e:	39 f8                	cmp    %edi,%eax
+ 790:	74 2e                	je     7c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 792:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 795:	8b 42 04             	mov    0x4(%edx),%eax
+ 798:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 79b:	39 f1                	cmp    %esi,%ecx
+ 79d:	74 38                	je     7d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 79f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7a1:	5b                   	pop    %ebx
+  freep = p;
+ 7a2:	89 15 a0 2c 00 00    	mov    %edx,0x2ca0
+}
+ 7a8:	5e                   	pop    %esi
+ 7a9:	5f                   	pop    %edi
+ 7aa:	5d                   	pop    %ebp
+ 7ab:	c3                   	ret
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b0:	39 c1                	cmp    %eax,%ecx
+ 7b2:	72 d0                	jb     784 <free+0x24>
+ 7b4:	eb c2                	jmp    778 <free+0x18>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7c0:	03 70 04             	add    0x4(%eax),%esi
+ 7c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7c6:	8b 02                	mov    (%edx),%eax
+ 7c8:	8b 00                	mov    (%eax),%eax
+ 7ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7d3:	39 f1                	cmp    %esi,%ecx
+ 7d5:	75 c8                	jne    79f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7da:	89 15 a0 2c 00 00    	mov    %edx,0x2ca0
+    p->s.size += bp->s.size;
+ 7e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7e8:	5b                   	pop    %ebx
+ 7e9:	5e                   	pop    %esi
+ 7ea:	5f                   	pop    %edi
+ 7eb:	5d                   	pop    %ebp
+ 7ec:	c3                   	ret
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7fc:	8b 15 a0 2c 00 00    	mov    0x2ca0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 802:	8d 78 07             	lea    0x7(%eax),%edi
+ 805:	c1 ef 03             	shr    $0x3,%edi
+ 808:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 80b:	85 d2                	test   %edx,%edx
+ 80d:	0f 84 8d 00 00 00    	je     8a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 813:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 815:	8b 48 04             	mov    0x4(%eax),%ecx
+ 818:	39 f9                	cmp    %edi,%ecx
+ 81a:	73 64                	jae    880 <malloc+0x90>
+  if(nu < 4096)
+ 81c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 821:	39 df                	cmp    %ebx,%edi
+ 823:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 826:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 82d:	eb 0a                	jmp    839 <malloc+0x49>
+ 82f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 830:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 832:	8b 48 04             	mov    0x4(%eax),%ecx
+ 835:	39 f9                	cmp    %edi,%ecx
+ 837:	73 47                	jae    880 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 839:	89 c2                	mov    %eax,%edx
+ 83b:	39 05 a0 2c 00 00    	cmp    %eax,0x2ca0
+ 841:	75 ed                	jne    830 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	56                   	push   %esi
+ 847:	e8 4f fc ff ff       	call   49b <sbrk>
+  if(p == (char*)-1)
+ 84c:	83 c4 10             	add    $0x10,%esp
+ 84f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 852:	74 1c                	je     870 <malloc+0x80>
+  hp->s.size = nu;
+ 854:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 857:	83 ec 0c             	sub    $0xc,%esp
+ 85a:	83 c0 08             	add    $0x8,%eax
+ 85d:	50                   	push   %eax
+ 85e:	e8 fd fe ff ff       	call   760 <free>
+  return freep;
+ 863:	8b 15 a0 2c 00 00    	mov    0x2ca0,%edx
+      if((p = morecore(nunits)) == 0)
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	85 d2                	test   %edx,%edx
+ 86e:	75 c0                	jne    830 <malloc+0x40>
+        return 0;
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 873:	31 c0                	xor    %eax,%eax
+}
+ 875:	5b                   	pop    %ebx
+ 876:	5e                   	pop    %esi
+ 877:	5f                   	pop    %edi
+ 878:	5d                   	pop    %ebp
+ 879:	c3                   	ret
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 880:	39 cf                	cmp    %ecx,%edi
+ 882:	74 4c                	je     8d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 884:	29 f9                	sub    %edi,%ecx
+ 886:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 889:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 88c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 88f:	89 15 a0 2c 00 00    	mov    %edx,0x2ca0
+}
+ 895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 898:	83 c0 08             	add    $0x8,%eax
+}
+ 89b:	5b                   	pop    %ebx
+ 89c:	5e                   	pop    %esi
+ 89d:	5f                   	pop    %edi
+ 89e:	5d                   	pop    %ebp
+ 89f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8a0:	c7 05 a0 2c 00 00 a4 	movl   $0x2ca4,0x2ca0
+ 8a7:	2c 00 00 
+    base.s.size = 0;
+ 8aa:	b8 a4 2c 00 00       	mov    $0x2ca4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8af:	c7 05 a4 2c 00 00 a4 	movl   $0x2ca4,0x2ca4
+ 8b6:	2c 00 00 
+    base.s.size = 0;
+ 8b9:	c7 05 a8 2c 00 00 00 	movl   $0x0,0x2ca8
+ 8c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8c3:	e9 54 ff ff ff       	jmp    81c <malloc+0x2c>
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8d0:	8b 08                	mov    (%eax),%ecx
+ 8d2:	89 0a                	mov    %ecx,(%edx)
+ 8d4:	eb b9                	jmp    88f <malloc+0x9f>
@@ -22,7 +22,8 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = 64;  // header and up to 63 blocks per transaction
+int nswap;    // Number of swap blocks
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +41,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+uint ientry(uint *addr, uint i);
 
 // convert to intel byte order
 ushort
@@ -67,7 +69,7 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
+  int i, cc, fd, ordered;
   uint rootino, inum, off;
   struct dirent de;
   char buf[BSIZE];
@@ -76,8 +78,16 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  // -o: ordered mode, file data does not go through the log.
+  ordered = 0;
+  if(argc > 1 && strcmp(argv[1], "-o") == 0){
+    ordered = 1;
+    argc--;
+    argv++;
+  }
+
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-o] fs.img files...\n");
     exit(1);
   }
 
@@ -90,19 +100,21 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
-  nmeta = 2 + nlog + ninodeblocks + nbitmap + SWAPBLOCKS;
+  nswap = NSWAPSLOT * PGBLOCKS;
+  nmeta = 2 + nlog + ninodeblocks + nbitmap + nswap;
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
-  sb.nswap = xint(SWAPBLOCKS);
+  sb.flags = xint(ordered ? SB_ORDERED : 0);
+  sb.bsize = xint(BSIZE);
+  sb.nswap = xint(nswap);
   sb.swapstart = xint(2);
-  sb.logstart = xint(2+SWAPBLOCKS);
-  sb.inodestart = xint(2+nlog+SWAPBLOCKS);
-  sb.bmapstart = xint(2+nlog+ninodeblocks+SWAPBLOCKS);
+  sb.logstart = xint(2+nswap);
+  sb.inodestart = xint(2+nlog+nswap);
+  sb.bmapstart = xint(2+nlog+ninodeblocks+nswap);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
@@ -240,20 +252,40 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  assert(used < nbitmap*BSIZE*8);
+  for(b = 0; b*BSIZE*8 < used; b++){
+    bzero(buf, BSIZE);
+    for(i = b*BSIZE*8; i < used && i < (b+1)*BSIZE*8; i++){
+      buf[(i%(BSIZE*8))/8] |= 0x1 << (i%8);
+    }
+    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart+b);
+    wsect(sb.bmapstart+b, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return entry i of the indirect block at *addr, allocating
+// the indirect block and the entry if necessary.
+uint
+ientry(uint *addr, uint i)
+{
+  uint indirect[NINDIRECT];
+
+  if(xint(*addr) == 0){
+    *addr = xint(freeblock++);
+  }
+  rsect(xint(*addr), (char*)indirect);
+  if(indirect[i] == 0){
+    indirect[i] = xint(freeblock++);
+    wsect(xint(*addr), (char*)indirect);
+  }
+  return indirect[i];
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -261,7 +293,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -275,16 +306,12 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
+    } else if(fbn < NDIRECT + NINDIRECT){
+      x = xint(ientry(&din.addrs[NDIRECT], fbn - NDIRECT));
     } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = fbn - NDIRECT - NINDIRECT;
+      x = ientry(&din.addrs[NDIRECT+1], x / NINDIRECT);
+      x = xint(ientry(&x, (fbn - NDIRECT - NINDIRECT) % NINDIRECT));
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
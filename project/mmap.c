@@ -0,0 +1,516 @@
+// Memory mappings.
+//
+// mmap() maps a file, or anonymous memory, into the part of the
+// address space above the heap (p->sz) and below KERNBASE. Regions
+// are placed top-down from KERNBASE, and growproc() will not grow
+// the heap into one. A process has at most NVMA regions; threads
+// use their leader's.
+//
+// Pages are faulted in on first touch: page_fault() hands faults
+// above p->sz to mmapfault(). A file page comes from the page cache
+// (see ipage()) and keeps a page cache reference while it is mapped;
+// its PTE is marked PTE_F. A shared mapping maps the cached page
+// itself, writable if the mapping is, so stores are seen at once by
+// read() and by every process mapping the file. munmap() and exit()
+// write the pages the hardware marked dirty back to the file. A
+// private mapping maps the cached page read-only and copies it on
+// the first store.
+//
+// Anonymous memory, and private copies of file pages, are ordinary
+// pages tracked by the rmap in pageswap.c. fork() shares them with
+// the child, copy-on-write for a private mapping as copyuvm() does
+// below p->sz. Anonymous memory is zero-filled on demand; fork()
+// makes the untouched pages of a shared anonymous region first, so
+// that parent and child share every page of it. victim_page() may
+// swap these pages out like any other; page_fault() reads them back
+// in before consulting the mappings.
+//
+// Every PTE of a mapping is marked PTE_M, which keeps share_remove()
+// from making the page writable when its other users go away: a
+// mapping's protection is its own. Page cache pages are never
+// swapped; the page cache gives them back itself.
+//
+// The regions and their PTEs change only under lockfaults(), so the
+// threads of a process fault on them one at a time. Faults read file
+// pages with lockfaults() held, but munmap() never takes an inode
+// lock with it held, because a thread may fault while holding one,
+// for example in read().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "stat.h"
+#include "mman.h"
+
+static struct vma*
+vmafind(struct vma *vma, uint va)
+{
+  struct vma *v;
+
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->start && v->start <= va && va < v->end)
+      return v;
+  return 0;
+}
+
+// Does [a, a+n) overlap a mapping of p?
+int
+mmapbusy(struct proc *p, uint a, uint n)
+{
+  struct vma *v, *vma = vmatable(p);
+
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->start && a < v->end && v->start < a + n)
+      return 1;
+  return 0;
+}
+
+// Does one mapping of p hold all of [a, a+n), writable if write
+// is set, and for a file mapping, within the file's last page?
+// Used to check system call arguments, which the kernel must be
+// able to fault in.
+int
+mmapped(struct proc *p, uint a, uint n, int write)
+{
+  struct vma *v;
+  struct inode *ip;
+  int ok;
+
+  if((v = vmafind(vmatable(p), a)) == 0)
+    return 0;
+  if(a + n < a || a + n > v->end)
+    return 0;
+  if(write && !(v->prot & PROT_WRITE))
+    return 0;
+  if((ip = v->ip) == 0 || n == 0)
+    return 1;
+  ilock(ip);
+  ok = PGROUNDDOWN(v->off + (a + n - 1 - v->start)) < ip->size;
+  iunlock(ip);
+  return ok;
+}
+
+// PTE permissions for a page of mapping v.
+static uint
+mapperm(struct vma *v)
+{
+  if(v->prot & PROT_WRITE)
+    return PTE_P | PTE_U | PTE_M | PTE_W;
+  return PTE_P | PTE_U | PTE_M;
+}
+
+// Map a fresh page or a private copy of pg at pte.
+static int
+mapcopy(pte_t *pte, char *pg, uint perm)
+{
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  if(pg)
+    memmove(mem, pg, PGSIZE);
+  else
+    memset(mem, 0, PGSIZE);
+  *pte = V2P(mem) | perm;
+  share_add(V2P(mem), pte);
+  return 0;
+}
+
+// Fault in the page at va, which lies in a mapping of p, for a
+// store if write is set. Called by page_fault() with p's faults
+// locked. Returns -1 if va is not mapped, or not for this access.
+int
+mmapfault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  struct inode *ip;
+  pte_t *pte;
+  uint pa, pgno, perm;
+  char *pg, *mem;
+  int locked;
+
+  if((v = vmafind(vmatable(p), va)) == 0)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(p->pgdir, (void*)va, 1)) == 0)
+    return -1;
+  perm = mapperm(v);
+
+  if(*pte & PTE_S)
+    return 0;  // swapped out meanwhile; page_fault() reads it in
+  if(*pte & PTE_P){
+    if(!write || (*pte & PTE_W)){
+      // Another thread got here first; drop our stale translation.
+      lcr3(V2P(p->pgdir));
+      return 0;
+    }
+    // First store to a private page.
+    pa = PTE_ADDR(*pte);
+    if(*pte & PTE_F){
+      if(mapcopy(pte, P2V(pa), perm) < 0)
+        return -1;
+      pcput(P2V(pa));
+    } else
+      share_split(pte);
+    tlbshootdown(p->pgdir);
+    return 0;
+  }
+
+  if((ip = v->ip) == 0)
+    return mapcopy(pte, 0, perm);
+
+  // Take the page from the page cache. The inode may be locked
+  // already if the fault came from readi() or writei().
+  pgno = (v->off + (va - v->start)) / PGSIZE;
+  locked = holdingsleep(&ip->lock);
+  if(!locked)
+    ilock(ip);
+  pg = 0;
+  if(pgno*PGSIZE < ip->size && (pg = ipage(ip, pgno)) == 0){
+    // Make room, swapping if need be, and try again.
+    if((mem = kalloc()) != 0){
+      kfree(mem);
+      pg = ipage(ip, pgno);
+    }
+  }
+  if(!locked)
+    iunlock(ip);
+  if(pg == 0)
+    return -1;  // past the end of the file, or out of memory
+
+  if(v->flags & MAP_PRIVATE){
+    if(write){
+      if(mapcopy(pte, pg, perm) < 0){
+        pcput(pg);
+        return -1;
+      }
+      pcput(pg);
+      return 0;
+    }
+    perm &= ~PTE_W;
+  }
+  *pte = V2P(pg) | perm | PTE_F;
+  return 0;
+}
+
+// Map len bytes of file f from offset off, or anonymous memory
+// if flags has MAP_ANON, into the current process.
+// Returns the address of the mapping, or 0.
+uint
+mmap(uint len, int prot, int flags, struct file *f, uint off)
+{
+  struct proc *p = myproc();
+  struct vma *v, *w, *vma = vmatable(p);
+  struct sleeplock *lk;
+  uint a;
+  int i;
+
+  if(len == 0 || len > KERNBASE || !(prot & PROT_READ) || off % PGSIZE)
+    return 0;
+  if(((flags & MAP_SHARED) != 0) == ((flags & MAP_PRIVATE) != 0))
+    return 0;
+  if(!(flags & MAP_ANON)){
+    if(f == 0 || f->type != FD_INODE || f->ip->type != T_FILE || !f->readable)
+      return 0;
+    if((flags & MAP_SHARED) && (prot & PROT_WRITE) && !f->writable)
+      return 0;
+  }
+  len = PGROUNDUP(len);
+
+  lk = lockfaults(p);
+  for(v = vma; v < &vma[NVMA] && v->start; v++)
+    ;
+  if(v == &vma[NVMA])
+    goto bad;
+
+  // Highest gap of len bytes below KERNBASE.
+  a = KERNBASE - len;
+  for(i = 0; i < NVMA; i++){
+    w = &vma[i];
+    if(w->start && a < w->end && w->start < a + len){
+      if(w->start < len)
+        goto bad;
+      a = w->start - len;
+      i = -1;  // look again at every mapping
+    }
+  }
+  if(a < PGROUNDUP(p->sz))
+    goto bad;
+
+  v->start = a;
+  v->end = a + len;
+  v->prot = prot;
+  v->flags = flags;
+  v->ip = (flags & MAP_ANON) ? 0 : idup(f->ip);
+  v->off = off;
+  unlockfaults(lk);
+  return a;
+
+bad:
+  unlockfaults(lk);
+  return 0;
+}
+
+// Write the pages of shared file mapping v in [a, b) that have
+// been stored to back to the file. The PTEs are only a hint of
+// which pages to write; the pages themselves are found in the page
+// cache, so they cannot go away meanwhile.
+static void
+msync(struct proc *p, struct vma *v, uint a, uint b)
+{
+  struct inode *ip = v->ip;
+  pte_t *pte;
+  uint va, off, i, n;
+  char *pg;
+  int max;
+
+  // Blocks inside the file are never allocated here; chunk
+  // as filewrite() does to keep transactions small.
+  max = ((MAXOPBLOCKS-1-3-2) / 2) * BSIZE;
+  for(va = a; va < b; va += PGSIZE){
+    pte = walkpgdir(p->pgdir, (void*)va, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_F|PTE_D)) != (PTE_P|PTE_F|PTE_D))
+      continue;
+    off = v->off + (va - v->start);
+    if((pg = pclookup(ip->dev, ip->inum, off/PGSIZE)) == 0)
+      continue;  // truncated away
+    for(i = 0; i < PGSIZE; i += n){
+      n = PGSIZE - i;
+      if(n > max)
+        n = max;
+      begin_op();
+      ilock(ip);
+      if(off + i < ip->size){
+        if(n > ip->size - (off + i))
+          n = ip->size - (off + i);
+        writei(ip, pg + i, off + i, n);
+      } else
+        n = PGSIZE - i;
+      iunlock(ip);
+      end_op();
+    }
+    pcput(pg);
+  }
+}
+
+// Unmap the pages of p in [a, b), all in one mapping. The PTEs are
+// first made not present, then the pages are let go once no cpu
+// can still be using them. swap_out() may still turn a PTE into a
+// swap entry meanwhile, so P is cleared atomically, and
+// unmap_page() lets go of whichever the PTE holds at the end.
+static void
+unmappages(struct proc *p, uint a, uint b)
+{
+  pte_t *pte;
+  uint va;
+
+  for(va = a; va < b; va += PGSIZE)
+    if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0)
+      __sync_fetch_and_and(pte, ~PTE_P);
+  tlbshootdown(p->pgdir);
+  for(va = a; va < b; va += PGSIZE){
+    if((pte = walkpgdir(p->pgdir, (void*)va, 0)) == 0 || *pte == 0)
+      continue;
+    if(*pte & PTE_F){
+      pcput(P2V(PTE_ADDR(*pte)));
+      *pte = 0;
+    } else
+      unmap_page(pte);
+  }
+}
+
+// The kernel faulted at va, above p->sz, in a system call whose
+// arguments were checked, and mmapfault() could not help: another
+// thread has since unmapped the page, or the file has shrunk. Kill
+// p, and map a zeroed page there, for the kernel only, so that the
+// system call can finish. Called with p's faults locked.
+int
+mmapdead(struct proc *p, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  p->killed = 1;
+  va = PGROUNDDOWN(va);
+  unmappages(p, va, va + PGSIZE);
+  if((pte = walkpgdir(p->pgdir, (void*)va, 1)) == 0)
+    return -1;
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  *pte = V2P(mem) | PTE_P | PTE_W;
+  share_add(V2P(mem), pte);
+  return 0;
+}
+
+// Can the mappings in vma be cut at [a, b)? Cutting a hole in
+// the middle of one takes a free entry for the second half.
+static int
+cancut(struct vma *vma, uint a, uint b)
+{
+  struct vma *v;
+
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->start && v->start < a && b < v->end)
+      break;
+  if(v == &vma[NVMA])
+    return 1;
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->start == 0)
+      return 1;
+  return 0;
+}
+
+// Remove the mappings of p in [a, a+len), writing stores to shared
+// file mappings back to their files. Returns -1 if the range is
+// bad, or would split a mapping and there is no room for the
+// second half.
+int
+munmap(struct proc *p, uint a, uint len)
+{
+  struct vma *v, *w, *vma = vmatable(p);
+  struct vma sync[NVMA];
+  struct inode *put[2*NVMA];
+  struct sleeplock *lk;
+  uint b, s, e;
+  int i, r, nsync, nput;
+
+  len = PGROUNDUP(len);
+  b = a + len;
+  if(a % PGSIZE || len == 0 || b < a || b > KERNBASE)
+    return -1;
+
+  // Write back first, from copies of the shared file mappings,
+  // because inode locks cannot be taken with faults locked.
+  lk = lockfaults(p);
+  if(!cancut(vma, a, b)){
+    unlockfaults(lk);
+    return -1;
+  }
+  nsync = 0;
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->start && a < v->end && v->start < b && v->ip && (v->flags & MAP_SHARED)){
+      sync[nsync] = *v;
+      idup(v->ip);
+      nsync++;
+    }
+  }
+  unlockfaults(lk);
+  for(i = 0; i < nsync; i++){
+    s = a > sync[i].start ? a : sync[i].start;
+    e = b < sync[i].end ? b : sync[i].end;
+    msync(p, &sync[i], s, e);
+  }
+
+  nput = 0;
+  for(i = 0; i < nsync; i++)
+    put[nput++] = sync[i].ip;
+  r = 0;
+  lk = lockfaults(p);
+  if(!cancut(vma, a, b)){
+    r = -1;  // another thread took the free entry
+    goto out;
+  }
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->start == 0 || v->end <= a || b <= v->start)
+      continue;
+    s = a > v->start ? a : v->start;
+    e = b < v->end ? b : v->end;
+    unmappages(p, s, e);
+    if(s == v->start && e == v->end){
+      if(v->ip)
+        put[nput++] = v->ip;
+      v->start = 0;
+    } else if(s == v->start){
+      v->off += e - v->start;
+      v->start = e;
+    } else if(e == v->end){
+      v->end = s;
+    } else {
+      // Split in two, into the entry found free above.
+      for(w = vma; w->start; w++)
+        ;
+      *w = *v;
+      w->off += e - v->start;
+      w->start = e;
+      if(w->ip)
+        idup(w->ip);
+      v->end = s;
+    }
+  }
+
+out:
+  unlockfaults(lk);
+  if(nput > 0){
+    begin_op();
+    for(i = 0; i < nput; i++)
+      iput(put[i]);
+    end_op();
+  }
+  return r;
+}
+
+// Remove every mapping of p, as it exits or execs.
+void
+munmapall(struct proc *p)
+{
+  struct vma *v, *vma = vmatable(p);
+
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->start)
+      munmap(p, v->start, v->end - v->start);
+}
+
+// Give the new child np of p the mappings of p. Returns -1 if
+// out of memory; the caller then removes them with munmapall().
+int
+mmapfork(struct proc *p, struct proc *np)
+{
+  struct vma *v, *w, *vma = vmatable(p);
+  struct sleeplock *lk;
+  pte_t *pte, *cpte;
+  uint va;
+  int r, shanon;
+
+  r = 0;
+  lk = lockfaults(p);
+  for(v = vma; v < &vma[NVMA] && r == 0; v++){
+    if(v->start == 0)
+      continue;
+    w = &np->vma[v - vma];
+    *w = *v;
+    if(w->ip)
+      idup(w->ip);
+    shanon = (v->flags & (MAP_SHARED|MAP_ANON)) == (MAP_SHARED|MAP_ANON);
+    for(va = v->start; va < v->end; va += PGSIZE){
+      // Page cache pages are faulted in again by the child. The
+      // untouched pages of a shared anonymous region are made now,
+      // so that parent and child share them.
+      pte = walkpgdir(p->pgdir, (void*)va, shanon);
+      if(shanon && (pte == 0 || (*pte == 0 && mapcopy(pte, 0, mapperm(v)) < 0))){
+        r = -1;
+        break;
+      }
+      if(pte == 0 || *pte == 0 || (*pte & PTE_F))
+        continue;
+      if((cpte = walkpgdir(np->pgdir, (void*)va, 1)) == 0){
+        r = -1;
+        break;
+      }
+      share_fork(pte, cpte, v->flags & MAP_PRIVATE);
+    }
+  }
+  tlbshootdown(p->pgdir);  // private pages are now read-only
+  unlockfaults(lk);
+  return r;
+}
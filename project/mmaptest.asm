@@ -0,0 +1,1995 @@
+
+_mmaptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "unmapped ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  private();
+  11:	e8 9a 01 00 00       	call   1b0 <private>
+  shared();
+  16:	e8 a5 02 00 00       	call   2c0 <shared>
+  anon();
+  1b:	e8 20 04 00 00       	call   440 <anon>
+  swapped();
+  20:	e8 7b 05 00 00       	call   5a0 <swapped>
+  args();
+  25:	e8 26 06 00 00       	call   650 <args>
+  unmapped();
+  2a:	e8 61 07 00 00       	call   790 <unmapped>
+  unlink(name);
+  2f:	83 ec 0c             	sub    $0xc,%esp
+  32:	ff 35 4c 16 00 00    	push   0x164c
+  38:	e8 e6 0a 00 00       	call   b23 <unlink>
+  printf(1, "Mmaptest Passed!\n");
+  3d:	58                   	pop    %eax
+  3e:	5a                   	pop    %edx
+  3f:	68 a2 11 00 00       	push   $0x11a2
+  44:	6a 01                	push   $0x1
+  46:	e8 25 0c 00 00       	call   c70 <printf>
+  exit();
+  4b:	e8 83 0a 00 00       	call   ad3 <exit>
+
+00000050 <failed>:
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "Mmaptest failed: %s\n", why);
+  56:	ff 75 08             	push   0x8(%ebp)
+  59:	68 98 0f 00 00       	push   $0xf98
+  5e:	6a 01                	push   $0x1
+  60:	e8 0b 0c 00 00       	call   c70 <printf>
+  unlink(name);
+  65:	58                   	pop    %eax
+  66:	ff 35 4c 16 00 00    	push   0x164c
+  6c:	e8 b2 0a 00 00       	call   b23 <unlink>
+  exit();
+  71:	e8 5d 0a 00 00       	call   ad3 <exit>
+  76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000080 <makefile>:
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	56                   	push   %esi
+  84:	53                   	push   %ebx
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+  85:	83 ec 08             	sub    $0x8,%esp
+  88:	68 02 02 00 00       	push   $0x202
+  8d:	ff 35 4c 16 00 00    	push   0x164c
+  93:	e8 7b 0a 00 00       	call   b13 <open>
+  98:	83 c4 10             	add    $0x10,%esp
+  9b:	85 c0                	test   %eax,%eax
+  9d:	0f 88 90 00 00 00    	js     133 <makefile+0xb3>
+  a3:	89 c6                	mov    %eax,%esi
+  a5:	bb 61 00 00 00       	mov    $0x61,%ebx
+    memset(buf, 'a' + i, PGSIZE);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	68 00 10 00 00       	push   $0x1000
+  b2:	53                   	push   %ebx
+  b3:	68 60 16 00 00       	push   $0x1660
+  b8:	e8 93 08 00 00       	call   950 <memset>
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+  bd:	83 c4 0c             	add    $0xc,%esp
+  c0:	68 00 10 00 00       	push   $0x1000
+  c5:	68 60 16 00 00       	push   $0x1660
+  ca:	56                   	push   %esi
+  cb:	e8 23 0a 00 00       	call   af3 <write>
+  d0:	83 c4 10             	add    $0x10,%esp
+  d3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  d8:	75 4c                	jne    126 <makefile+0xa6>
+  for(i = 0; i < NPAGE; i++){
+  da:	83 c3 01             	add    $0x1,%ebx
+  dd:	83 fb 65             	cmp    $0x65,%ebx
+  e0:	75 c8                	jne    aa <makefile+0x2a>
+  memset(buf, 'z', PGSIZE/2);
+  e2:	83 ec 04             	sub    $0x4,%esp
+  e5:	68 00 08 00 00       	push   $0x800
+  ea:	6a 7a                	push   $0x7a
+  ec:	68 60 16 00 00       	push   $0x1660
+  f1:	e8 5a 08 00 00       	call   950 <memset>
+  if(write(fd, buf, PGSIZE/2) != PGSIZE/2)
+  f6:	83 c4 0c             	add    $0xc,%esp
+  f9:	68 00 08 00 00       	push   $0x800
+  fe:	68 60 16 00 00       	push   $0x1660
+ 103:	56                   	push   %esi
+ 104:	e8 ea 09 00 00       	call   af3 <write>
+ 109:	83 c4 10             	add    $0x10,%esp
+ 10c:	3d 00 08 00 00       	cmp    $0x800,%eax
+ 111:	75 13                	jne    126 <makefile+0xa6>
+  close(fd);
+ 113:	83 ec 0c             	sub    $0xc,%esp
+ 116:	56                   	push   %esi
+ 117:	e8 df 09 00 00       	call   afb <close>
+}
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 122:	5b                   	pop    %ebx
+ 123:	5e                   	pop    %esi
+ 124:	5d                   	pop    %ebp
+ 125:	c3                   	ret
+      failed("write");
+ 126:	83 ec 0c             	sub    $0xc,%esp
+ 129:	68 b4 0f 00 00       	push   $0xfb4
+ 12e:	e8 1d ff ff ff       	call   50 <failed>
+    failed("create");
+ 133:	83 ec 0c             	sub    $0xc,%esp
+ 136:	68 ad 0f 00 00       	push   $0xfad
+ 13b:	e8 10 ff ff ff       	call   50 <failed>
+
+00000140 <mapfile>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	56                   	push   %esi
+ 144:	53                   	push   %ebx
+  if((fd = open(name, omode)) < 0)
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 08             	push   0x8(%ebp)
+ 14b:	ff 35 4c 16 00 00    	push   0x164c
+ 151:	e8 bd 09 00 00       	call   b13 <open>
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	85 c0                	test   %eax,%eax
+ 15b:	78 36                	js     193 <mapfile+0x53>
+  p = mmap(0, (NPAGE+1)*PGSIZE, prot, flags, fd, 0);
+ 15d:	83 ec 08             	sub    $0x8,%esp
+ 160:	89 c3                	mov    %eax,%ebx
+ 162:	6a 00                	push   $0x0
+ 164:	50                   	push   %eax
+ 165:	ff 75 10             	push   0x10(%ebp)
+ 168:	ff 75 0c             	push   0xc(%ebp)
+ 16b:	68 00 50 00 00       	push   $0x5000
+ 170:	6a 00                	push   $0x0
+ 172:	e8 34 0a 00 00       	call   bab <mmap>
+  close(fd);  // the mapping holds the file
+ 177:	83 c4 14             	add    $0x14,%esp
+ 17a:	53                   	push   %ebx
+  p = mmap(0, (NPAGE+1)*PGSIZE, prot, flags, fd, 0);
+ 17b:	89 c6                	mov    %eax,%esi
+  close(fd);  // the mapping holds the file
+ 17d:	e8 79 09 00 00       	call   afb <close>
+  if(p == MAP_FAILED)
+ 182:	83 c4 10             	add    $0x10,%esp
+ 185:	83 fe ff             	cmp    $0xffffffff,%esi
+ 188:	74 16                	je     1a0 <mapfile+0x60>
+}
+ 18a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 18d:	89 f0                	mov    %esi,%eax
+ 18f:	5b                   	pop    %ebx
+ 190:	5e                   	pop    %esi
+ 191:	5d                   	pop    %ebp
+ 192:	c3                   	ret
+    failed("open");
+ 193:	83 ec 0c             	sub    $0xc,%esp
+ 196:	68 ba 0f 00 00       	push   $0xfba
+ 19b:	e8 b0 fe ff ff       	call   50 <failed>
+    failed("mmap");
+ 1a0:	83 ec 0c             	sub    $0xc,%esp
+ 1a3:	68 bf 0f 00 00       	push   $0xfbf
+ 1a8:	e8 a3 fe ff ff       	call   50 <failed>
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <private>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	83 ec 04             	sub    $0x4,%esp
+  makefile();
+ 1b7:	e8 c4 fe ff ff       	call   80 <makefile>
+  p = mapfile(O_RDONLY, PROT_READ|PROT_WRITE, MAP_PRIVATE);
+ 1bc:	83 ec 04             	sub    $0x4,%esp
+ 1bf:	6a 02                	push   $0x2
+ 1c1:	6a 03                	push   $0x3
+ 1c3:	6a 00                	push   $0x0
+ 1c5:	e8 76 ff ff ff       	call   140 <mapfile>
+  for(i = 0; i < NPAGE; i++)
+ 1ca:	83 c4 10             	add    $0x10,%esp
+  p = mapfile(O_RDONLY, PROT_READ|PROT_WRITE, MAP_PRIVATE);
+ 1cd:	ba 61 00 00 00       	mov    $0x61,%edx
+ 1d2:	89 c1                	mov    %eax,%ecx
+    if(p[i*PGSIZE] != 'a' + i || p[i*PGSIZE + PGSIZE-1] != 'a' + i)
+ 1d4:	0f be 19             	movsbl (%ecx),%ebx
+ 1d7:	39 d3                	cmp    %edx,%ebx
+ 1d9:	0f 85 ac 00 00 00    	jne    28b <private+0xdb>
+ 1df:	0f be 99 ff 0f 00 00 	movsbl 0xfff(%ecx),%ebx
+ 1e6:	39 d3                	cmp    %edx,%ebx
+ 1e8:	0f 85 9d 00 00 00    	jne    28b <private+0xdb>
+  for(i = 0; i < NPAGE; i++)
+ 1ee:	83 c2 01             	add    $0x1,%edx
+ 1f1:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+ 1f7:	83 fa 65             	cmp    $0x65,%edx
+ 1fa:	75 d8                	jne    1d4 <private+0x24>
+  if(p[NPAGE*PGSIZE] != 'z' || p[NPAGE*PGSIZE + PGSIZE/2] != 0)
+ 1fc:	80 b8 00 40 00 00 7a 	cmpb   $0x7a,0x4000(%eax)
+ 203:	0f 85 9c 00 00 00    	jne    2a5 <private+0xf5>
+ 209:	80 b8 00 48 00 00 00 	cmpb   $0x0,0x4800(%eax)
+ 210:	0f 85 8f 00 00 00    	jne    2a5 <private+0xf5>
+  if(munmap(p, (NPAGE+1)*PGSIZE) < 0)
+ 216:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'X';
+ 219:	c6 00 58             	movb   $0x58,(%eax)
+  if(munmap(p, (NPAGE+1)*PGSIZE) < 0)
+ 21c:	68 00 50 00 00       	push   $0x5000
+ 221:	50                   	push   %eax
+ 222:	e8 8c 09 00 00       	call   bb3 <munmap>
+ 227:	83 c4 10             	add    $0x10,%esp
+ 22a:	85 c0                	test   %eax,%eax
+ 22c:	0f 88 80 00 00 00    	js     2b2 <private+0x102>
+  if((fd = open(name, O_RDONLY)) < 0 || read(fd, buf, 1) != 1 || buf[0] != 'a')
+ 232:	83 ec 08             	sub    $0x8,%esp
+ 235:	6a 00                	push   $0x0
+ 237:	ff 35 4c 16 00 00    	push   0x164c
+ 23d:	e8 d1 08 00 00       	call   b13 <open>
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	89 c3                	mov    %eax,%ebx
+ 247:	85 c0                	test   %eax,%eax
+ 249:	78 4d                	js     298 <private+0xe8>
+ 24b:	83 ec 04             	sub    $0x4,%esp
+ 24e:	6a 01                	push   $0x1
+ 250:	68 60 16 00 00       	push   $0x1660
+ 255:	50                   	push   %eax
+ 256:	e8 90 08 00 00       	call   aeb <read>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	83 f8 01             	cmp    $0x1,%eax
+ 261:	75 35                	jne    298 <private+0xe8>
+ 263:	80 3d 60 16 00 00 61 	cmpb   $0x61,0x1660
+ 26a:	75 2c                	jne    298 <private+0xe8>
+  close(fd);
+ 26c:	83 ec 0c             	sub    $0xc,%esp
+ 26f:	53                   	push   %ebx
+ 270:	e8 86 08 00 00       	call   afb <close>
+  printf(1, "private ok\n");
+ 275:	58                   	pop    %eax
+ 276:	5a                   	pop    %edx
+ 277:	68 dd 0f 00 00       	push   $0xfdd
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 ed 09 00 00       	call   c70 <printf>
+}
+ 283:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 286:	83 c4 10             	add    $0x10,%esp
+ 289:	c9                   	leave
+ 28a:	c3                   	ret
+      failed("private contents");
+ 28b:	83 ec 0c             	sub    $0xc,%esp
+ 28e:	68 65 10 00 00       	push   $0x1065
+ 293:	e8 b8 fd ff ff       	call   50 <failed>
+    failed("private store reached the file");
+ 298:	83 ec 0c             	sub    $0xc,%esp
+ 29b:	68 c4 11 00 00       	push   $0x11c4
+ 2a0:	e8 ab fd ff ff       	call   50 <failed>
+    failed("partial last page");
+ 2a5:	83 ec 0c             	sub    $0xc,%esp
+ 2a8:	68 c4 0f 00 00       	push   $0xfc4
+ 2ad:	e8 9e fd ff ff       	call   50 <failed>
+    failed("munmap");
+ 2b2:	83 ec 0c             	sub    $0xc,%esp
+ 2b5:	68 d6 0f 00 00       	push   $0xfd6
+ 2ba:	e8 91 fd ff ff       	call   50 <failed>
+ 2bf:	90                   	nop
+
+000002c0 <shared>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  p = mapfile(O_RDWR, PROT_READ|PROT_WRITE, MAP_SHARED);
+ 2c5:	83 ec 04             	sub    $0x4,%esp
+ 2c8:	6a 01                	push   $0x1
+ 2ca:	6a 03                	push   $0x3
+ 2cc:	6a 02                	push   $0x2
+ 2ce:	e8 6d fe ff ff       	call   140 <mapfile>
+  p[1] = 'Y';
+ 2d3:	c6 40 01 59          	movb   $0x59,0x1(%eax)
+  p = mapfile(O_RDWR, PROT_READ|PROT_WRITE, MAP_SHARED);
+ 2d7:	89 c3                	mov    %eax,%ebx
+  p[2*PGSIZE] = 'Z';
+ 2d9:	c6 80 00 20 00 00 5a 	movb   $0x5a,0x2000(%eax)
+  if((fd = open(name, O_RDONLY)) < 0)
+ 2e0:	58                   	pop    %eax
+ 2e1:	5a                   	pop    %edx
+ 2e2:	6a 00                	push   $0x0
+ 2e4:	ff 35 4c 16 00 00    	push   0x164c
+ 2ea:	e8 24 08 00 00       	call   b13 <open>
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	85 c0                	test   %eax,%eax
+ 2f4:	0f 88 2f 01 00 00    	js     429 <shared+0x169>
+  if(read(fd, buf, 2) != 2 || buf[1] != 'Y')
+ 2fa:	83 ec 04             	sub    $0x4,%esp
+ 2fd:	89 c6                	mov    %eax,%esi
+ 2ff:	6a 02                	push   $0x2
+ 301:	68 60 16 00 00       	push   $0x1660
+ 306:	50                   	push   %eax
+ 307:	e8 df 07 00 00       	call   aeb <read>
+ 30c:	83 c4 10             	add    $0x10,%esp
+ 30f:	83 f8 02             	cmp    $0x2,%eax
+ 312:	0f 85 d0 00 00 00    	jne    3e8 <shared+0x128>
+ 318:	80 3d 61 16 00 00 59 	cmpb   $0x59,0x1661
+ 31f:	0f 85 c3 00 00 00    	jne    3e8 <shared+0x128>
+  close(fd);
+ 325:	83 ec 0c             	sub    $0xc,%esp
+ 328:	56                   	push   %esi
+ 329:	e8 cd 07 00 00       	call   afb <close>
+  if(munmap(p, (NPAGE+1)*PGSIZE) < 0)
+ 32e:	5e                   	pop    %esi
+ 32f:	58                   	pop    %eax
+ 330:	68 00 50 00 00       	push   $0x5000
+ 335:	53                   	push   %ebx
+ 336:	e8 78 08 00 00       	call   bb3 <munmap>
+ 33b:	83 c4 10             	add    $0x10,%esp
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	0f 88 bc 00 00 00    	js     402 <shared+0x142>
+  p = mapfile(O_RDONLY, PROT_READ, MAP_SHARED);
+ 346:	83 ec 04             	sub    $0x4,%esp
+ 349:	6a 01                	push   $0x1
+ 34b:	6a 01                	push   $0x1
+ 34d:	6a 00                	push   $0x0
+ 34f:	e8 ec fd ff ff       	call   140 <mapfile>
+  if(p[1] != 'Y' || p[2*PGSIZE] != 'Z')
+ 354:	83 c4 10             	add    $0x10,%esp
+ 357:	80 78 01 59          	cmpb   $0x59,0x1(%eax)
+  p = mapfile(O_RDONLY, PROT_READ, MAP_SHARED);
+ 35b:	89 c3                	mov    %eax,%ebx
+  if(p[1] != 'Y' || p[2*PGSIZE] != 'Z')
+ 35d:	0f 85 92 00 00 00    	jne    3f5 <shared+0x135>
+ 363:	80 b8 00 20 00 00 5a 	cmpb   $0x5a,0x2000(%eax)
+ 36a:	0f 85 85 00 00 00    	jne    3f5 <shared+0x135>
+  if((fd = open("mmaptest.out", O_CREATE|O_RDWR)) < 0)
+ 370:	83 ec 08             	sub    $0x8,%esp
+ 373:	68 02 02 00 00       	push   $0x202
+ 378:	68 1c 10 00 00       	push   $0x101c
+ 37d:	e8 91 07 00 00       	call   b13 <open>
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	89 c6                	mov    %eax,%esi
+ 387:	85 c0                	test   %eax,%eax
+ 389:	0f 88 80 00 00 00    	js     40f <shared+0x14f>
+  if(write(fd, p + PGSIZE, PGSIZE) != PGSIZE)
+ 38f:	83 ec 04             	sub    $0x4,%esp
+ 392:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+ 398:	68 00 10 00 00       	push   $0x1000
+ 39d:	50                   	push   %eax
+ 39e:	56                   	push   %esi
+ 39f:	e8 4f 07 00 00       	call   af3 <write>
+ 3a4:	83 c4 10             	add    $0x10,%esp
+ 3a7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+ 3ac:	75 6e                	jne    41c <shared+0x15c>
+  close(fd);
+ 3ae:	83 ec 0c             	sub    $0xc,%esp
+ 3b1:	56                   	push   %esi
+ 3b2:	e8 44 07 00 00       	call   afb <close>
+  unlink("mmaptest.out");
+ 3b7:	c7 04 24 1c 10 00 00 	movl   $0x101c,(%esp)
+ 3be:	e8 60 07 00 00       	call   b23 <unlink>
+  munmap(p, (NPAGE+1)*PGSIZE);
+ 3c3:	58                   	pop    %eax
+ 3c4:	5a                   	pop    %edx
+ 3c5:	68 00 50 00 00       	push   $0x5000
+ 3ca:	53                   	push   %ebx
+ 3cb:	e8 e3 07 00 00       	call   bb3 <munmap>
+  printf(1, "shared ok\n");
+ 3d0:	59                   	pop    %ecx
+ 3d1:	5b                   	pop    %ebx
+ 3d2:	68 3c 10 00 00       	push   $0x103c
+ 3d7:	6a 01                	push   $0x1
+ 3d9:	e8 92 08 00 00       	call   c70 <printf>
+}
+ 3de:	83 c4 10             	add    $0x10,%esp
+ 3e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e4:	5b                   	pop    %ebx
+ 3e5:	5e                   	pop    %esi
+ 3e6:	5d                   	pop    %ebp
+ 3e7:	c3                   	ret
+    failed("read does not see the store");
+ 3e8:	83 ec 0c             	sub    $0xc,%esp
+ 3eb:	68 e9 0f 00 00       	push   $0xfe9
+ 3f0:	e8 5b fc ff ff       	call   50 <failed>
+    failed("store not written back");
+ 3f5:	83 ec 0c             	sub    $0xc,%esp
+ 3f8:	68 05 10 00 00       	push   $0x1005
+ 3fd:	e8 4e fc ff ff       	call   50 <failed>
+    failed("munmap");
+ 402:	83 ec 0c             	sub    $0xc,%esp
+ 405:	68 d6 0f 00 00       	push   $0xfd6
+ 40a:	e8 41 fc ff ff       	call   50 <failed>
+    failed("create");
+ 40f:	83 ec 0c             	sub    $0xc,%esp
+ 412:	68 ad 0f 00 00       	push   $0xfad
+ 417:	e8 34 fc ff ff       	call   50 <failed>
+    failed("write from mapping");
+ 41c:	83 ec 0c             	sub    $0xc,%esp
+ 41f:	68 29 10 00 00       	push   $0x1029
+ 424:	e8 27 fc ff ff       	call   50 <failed>
+    failed("open");
+ 429:	83 ec 0c             	sub    $0xc,%esp
+ 42c:	68 ba 0f 00 00       	push   $0xfba
+ 431:	e8 1a fc ff ff       	call   50 <failed>
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <anon>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  sh = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	6a ff                	push   $0xffffffff
+ 44c:	6a 21                	push   $0x21
+ 44e:	6a 03                	push   $0x3
+ 450:	68 00 20 00 00       	push   $0x2000
+ 455:	6a 00                	push   $0x0
+ 457:	e8 4f 07 00 00       	call   bab <mmap>
+  pv = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ 45c:	83 c4 18             	add    $0x18,%esp
+ 45f:	6a 00                	push   $0x0
+  sh = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+ 461:	89 c6                	mov    %eax,%esi
+  pv = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ 463:	6a ff                	push   $0xffffffff
+ 465:	6a 22                	push   $0x22
+ 467:	6a 03                	push   $0x3
+ 469:	68 00 20 00 00       	push   $0x2000
+ 46e:	6a 00                	push   $0x0
+ 470:	e8 36 07 00 00       	call   bab <mmap>
+  if(sh == MAP_FAILED || pv == MAP_FAILED)
+ 475:	83 c4 20             	add    $0x20,%esp
+ 478:	83 fe ff             	cmp    $0xffffffff,%esi
+ 47b:	0f 84 d2 00 00 00    	je     553 <anon+0x113>
+ 481:	89 c3                	mov    %eax,%ebx
+ 483:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 486:	0f 84 c7 00 00 00    	je     553 <anon+0x113>
+  if(sh[0] != 0 || pv[PGSIZE/sizeof(int)] != 0)
+ 48c:	8b 16                	mov    (%esi),%edx
+ 48e:	85 d2                	test   %edx,%edx
+ 490:	0f 85 b0 00 00 00    	jne    546 <anon+0x106>
+ 496:	8b 80 00 10 00 00    	mov    0x1000(%eax),%eax
+ 49c:	85 c0                	test   %eax,%eax
+ 49e:	0f 85 a2 00 00 00    	jne    546 <anon+0x106>
+  pv[0] = 1;
+ 4a4:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  pid = fork();
+ 4aa:	e8 1c 06 00 00       	call   acb <fork>
+  if(pid < 0)
+ 4af:	85 c0                	test   %eax,%eax
+ 4b1:	0f 88 a9 00 00 00    	js     560 <anon+0x120>
+  if(pid == 0){
+ 4b7:	75 2f                	jne    4e8 <anon+0xa8>
+    sh[PGSIZE/sizeof(int)] = 42;
+ 4b9:	c7 86 00 10 00 00 2a 	movl   $0x2a,0x1000(%esi)
+ 4c0:	00 00 00 
+    if(pv[0] != 1)
+ 4c3:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 4c6:	74 10                	je     4d8 <anon+0x98>
+      failed("child private contents");
+ 4c8:	83 ec 0c             	sub    $0xc,%esp
+ 4cb:	68 5f 10 00 00       	push   $0x105f
+ 4d0:	e8 7b fb ff ff       	call   50 <failed>
+ 4d5:	8d 76 00             	lea    0x0(%esi),%esi
+    pv[0] = 2;
+ 4d8:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+    exit();
+ 4de:	e8 f0 05 00 00       	call   ad3 <exit>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+  wait();
+ 4e8:	e8 ee 05 00 00       	call   adb <wait>
+  if(sh[PGSIZE/sizeof(int)] != 42)
+ 4ed:	83 be 00 10 00 00 2a 	cmpl   $0x2a,0x1000(%esi)
+ 4f4:	0f 85 80 00 00 00    	jne    57a <anon+0x13a>
+  if(pv[0] != 1)
+ 4fa:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 4fd:	0f 85 84 00 00 00    	jne    587 <anon+0x147>
+  if(munmap(sh, 2*PGSIZE) < 0 || munmap(pv, 2*PGSIZE) < 0)
+ 503:	83 ec 08             	sub    $0x8,%esp
+ 506:	68 00 20 00 00       	push   $0x2000
+ 50b:	56                   	push   %esi
+ 50c:	e8 a2 06 00 00       	call   bb3 <munmap>
+ 511:	83 c4 10             	add    $0x10,%esp
+ 514:	85 c0                	test   %eax,%eax
+ 516:	78 55                	js     56d <anon+0x12d>
+ 518:	83 ec 08             	sub    $0x8,%esp
+ 51b:	68 00 20 00 00       	push   $0x2000
+ 520:	53                   	push   %ebx
+ 521:	e8 8d 06 00 00       	call   bb3 <munmap>
+ 526:	83 c4 10             	add    $0x10,%esp
+ 529:	85 c0                	test   %eax,%eax
+ 52b:	78 40                	js     56d <anon+0x12d>
+  printf(1, "anon ok\n");
+ 52d:	83 ec 08             	sub    $0x8,%esp
+ 530:	68 ab 10 00 00       	push   $0x10ab
+ 535:	6a 01                	push   $0x1
+ 537:	e8 34 07 00 00       	call   c70 <printf>
+}
+ 53c:	83 c4 10             	add    $0x10,%esp
+ 53f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 542:	5b                   	pop    %ebx
+ 543:	5e                   	pop    %esi
+ 544:	5d                   	pop    %ebp
+ 545:	c3                   	ret
+    failed("not zero");
+ 546:	83 ec 0c             	sub    $0xc,%esp
+ 549:	68 51 10 00 00       	push   $0x1051
+ 54e:	e8 fd fa ff ff       	call   50 <failed>
+    failed("mmap anon");
+ 553:	83 ec 0c             	sub    $0xc,%esp
+ 556:	68 47 10 00 00       	push   $0x1047
+ 55b:	e8 f0 fa ff ff       	call   50 <failed>
+    failed("fork");
+ 560:	83 ec 0c             	sub    $0xc,%esp
+ 563:	68 5a 10 00 00       	push   $0x105a
+ 568:	e8 e3 fa ff ff       	call   50 <failed>
+    failed("munmap anon");
+ 56d:	83 ec 0c             	sub    $0xc,%esp
+ 570:	68 9f 10 00 00       	push   $0x109f
+ 575:	e8 d6 fa ff ff       	call   50 <failed>
+    failed("shared store not seen");
+ 57a:	83 ec 0c             	sub    $0xc,%esp
+ 57d:	68 76 10 00 00       	push   $0x1076
+ 582:	e8 c9 fa ff ff       	call   50 <failed>
+    failed("private store seen");
+ 587:	83 ec 0c             	sub    $0xc,%esp
+ 58a:	68 8c 10 00 00       	push   $0x108c
+ 58f:	e8 bc fa ff ff       	call   50 <failed>
+ 594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <swapped>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	83 ec 10             	sub    $0x10,%esp
+  p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ 5a6:	6a 00                	push   $0x0
+ 5a8:	6a ff                	push   $0xffffffff
+ 5aa:	6a 22                	push   $0x22
+ 5ac:	6a 03                	push   $0x3
+ 5ae:	68 00 00 40 00       	push   $0x400000
+ 5b3:	6a 00                	push   $0x0
+ 5b5:	e8 f1 05 00 00       	call   bab <mmap>
+  if(p == MAP_FAILED)
+ 5ba:	83 c4 20             	add    $0x20,%esp
+ 5bd:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 5c0:	74 69                	je     62b <swapped+0x8b>
+  for(i = 0; i < n; i++)
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i*(PGSIZE/sizeof(int))] = i;
+ 5c8:	89 d1                	mov    %edx,%ecx
+ 5ca:	c1 e1 0c             	shl    $0xc,%ecx
+ 5cd:	89 14 08             	mov    %edx,(%eax,%ecx,1)
+  for(i = 0; i < n; i++)
+ 5d0:	83 c2 01             	add    $0x1,%edx
+ 5d3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+ 5d9:	75 ed                	jne    5c8 <swapped+0x28>
+  for(i = 0; i < n; i++)
+ 5db:	31 d2                	xor    %edx,%edx
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p[i*(PGSIZE/sizeof(int))] != i)
+ 5e0:	89 d1                	mov    %edx,%ecx
+ 5e2:	c1 e1 0c             	shl    $0xc,%ecx
+ 5e5:	39 14 08             	cmp    %edx,(%eax,%ecx,1)
+ 5e8:	75 34                	jne    61e <swapped+0x7e>
+  for(i = 0; i < n; i++)
+ 5ea:	83 c2 01             	add    $0x1,%edx
+ 5ed:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+ 5f3:	75 eb                	jne    5e0 <swapped+0x40>
+  if(munmap(p, n*PGSIZE) < 0)
+ 5f5:	83 ec 08             	sub    $0x8,%esp
+ 5f8:	68 00 00 40 00       	push   $0x400000
+ 5fd:	50                   	push   %eax
+ 5fe:	e8 b0 05 00 00       	call   bb3 <munmap>
+ 603:	83 c4 10             	add    $0x10,%esp
+ 606:	85 c0                	test   %eax,%eax
+ 608:	78 2e                	js     638 <swapped+0x98>
+  printf(1, "swapped ok\n");
+ 60a:	83 ec 08             	sub    $0x8,%esp
+ 60d:	68 d9 10 00 00       	push   $0x10d9
+ 612:	6a 01                	push   $0x1
+ 614:	e8 57 06 00 00       	call   c70 <printf>
+}
+ 619:	83 c4 10             	add    $0x10,%esp
+ 61c:	c9                   	leave
+ 61d:	c3                   	ret
+      failed("swapped contents");
+ 61e:	83 ec 0c             	sub    $0xc,%esp
+ 621:	68 bd 10 00 00       	push   $0x10bd
+ 626:	e8 25 fa ff ff       	call   50 <failed>
+    failed("mmap big");
+ 62b:	83 ec 0c             	sub    $0xc,%esp
+ 62e:	68 b4 10 00 00       	push   $0x10b4
+ 633:	e8 18 fa ff ff       	call   50 <failed>
+    failed("munmap big");
+ 638:	83 ec 0c             	sub    $0xc,%esp
+ 63b:	68 ce 10 00 00       	push   $0x10ce
+ 640:	e8 0b fa ff ff       	call   50 <failed>
+ 645:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <args>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	56                   	push   %esi
+ 654:	53                   	push   %ebx
+ 655:	83 ec 18             	sub    $0x18,%esp
+  if((fd = open(name, O_RDONLY)) < 0)
+ 658:	6a 00                	push   $0x0
+ 65a:	ff 35 4c 16 00 00    	push   0x164c
+ 660:	e8 ae 04 00 00       	call   b13 <open>
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	85 c0                	test   %eax,%eax
+ 66a:	0f 88 ce 00 00 00    	js     73e <args+0xee>
+  p = mmap(0, (NPAGE+2)*PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 670:	83 ec 08             	sub    $0x8,%esp
+ 673:	89 c6                	mov    %eax,%esi
+ 675:	6a 00                	push   $0x0
+ 677:	50                   	push   %eax
+ 678:	6a 02                	push   $0x2
+ 67a:	6a 01                	push   $0x1
+ 67c:	68 00 60 00 00       	push   $0x6000
+ 681:	6a 00                	push   $0x0
+ 683:	e8 23 05 00 00       	call   bab <mmap>
+  if(p == MAP_FAILED)
+ 688:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, (NPAGE+2)*PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 68b:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED)
+ 68d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 690:	0f 84 e9 00 00 00    	je     77f <args+0x12f>
+  if(pipe(pfd) < 0)
+ 696:	83 ec 0c             	sub    $0xc,%esp
+ 699:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 69c:	50                   	push   %eax
+ 69d:	e8 41 04 00 00       	call   ae3 <pipe>
+ 6a2:	83 c4 10             	add    $0x10,%esp
+ 6a5:	85 c0                	test   %eax,%eax
+ 6a7:	0f 88 c5 00 00 00    	js     772 <args+0x122>
+  if(read(fd, p, 10) != -1)
+ 6ad:	83 ec 04             	sub    $0x4,%esp
+ 6b0:	6a 0a                	push   $0xa
+ 6b2:	53                   	push   %ebx
+ 6b3:	56                   	push   %esi
+ 6b4:	e8 32 04 00 00       	call   aeb <read>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+ 6bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6bf:	0f 85 a0 00 00 00    	jne    765 <args+0x115>
+  if(write(pfd[1], p + NPAGE*PGSIZE, 1) != 1)
+ 6c5:	83 ec 04             	sub    $0x4,%esp
+ 6c8:	8d 83 00 40 00 00    	lea    0x4000(%ebx),%eax
+ 6ce:	6a 01                	push   $0x1
+ 6d0:	50                   	push   %eax
+ 6d1:	ff 75 f4             	push   -0xc(%ebp)
+ 6d4:	e8 1a 04 00 00       	call   af3 <write>
+ 6d9:	83 c4 10             	add    $0x10,%esp
+ 6dc:	83 f8 01             	cmp    $0x1,%eax
+ 6df:	75 77                	jne    758 <args+0x108>
+  if(write(pfd[1], p + (NPAGE+1)*PGSIZE, 1) != -1)
+ 6e1:	83 ec 04             	sub    $0x4,%esp
+ 6e4:	8d 83 00 50 00 00    	lea    0x5000(%ebx),%eax
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	50                   	push   %eax
+ 6ed:	ff 75 f4             	push   -0xc(%ebp)
+ 6f0:	e8 fe 03 00 00       	call   af3 <write>
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6fb:	75 4e                	jne    74b <args+0xfb>
+  close(pfd[0]);
+ 6fd:	83 ec 0c             	sub    $0xc,%esp
+ 700:	ff 75 f0             	push   -0x10(%ebp)
+ 703:	e8 f3 03 00 00       	call   afb <close>
+  close(pfd[1]);
+ 708:	58                   	pop    %eax
+ 709:	ff 75 f4             	push   -0xc(%ebp)
+ 70c:	e8 ea 03 00 00       	call   afb <close>
+  close(fd);
+ 711:	89 34 24             	mov    %esi,(%esp)
+ 714:	e8 e2 03 00 00       	call   afb <close>
+  munmap(p, (NPAGE+2)*PGSIZE);
+ 719:	5a                   	pop    %edx
+ 71a:	59                   	pop    %ecx
+ 71b:	68 00 60 00 00       	push   $0x6000
+ 720:	53                   	push   %ebx
+ 721:	e8 8d 04 00 00       	call   bb3 <munmap>
+  printf(1, "args ok\n");
+ 726:	5b                   	pop    %ebx
+ 727:	5e                   	pop    %esi
+ 728:	68 3f 11 00 00       	push   $0x113f
+ 72d:	6a 01                	push   $0x1
+ 72f:	e8 3c 05 00 00       	call   c70 <printf>
+}
+ 734:	83 c4 10             	add    $0x10,%esp
+ 737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 73a:	5b                   	pop    %ebx
+ 73b:	5e                   	pop    %esi
+ 73c:	5d                   	pop    %ebp
+ 73d:	c3                   	ret
+    failed("open");
+ 73e:	83 ec 0c             	sub    $0xc,%esp
+ 741:	68 ba 0f 00 00       	push   $0xfba
+ 746:	e8 05 f9 ff ff       	call   50 <failed>
+    failed("write from past end of file");
+ 74b:	83 ec 0c             	sub    $0xc,%esp
+ 74e:	68 23 11 00 00       	push   $0x1123
+ 753:	e8 f8 f8 ff ff       	call   50 <failed>
+    failed("write from last page of file");
+ 758:	83 ec 0c             	sub    $0xc,%esp
+ 75b:	68 06 11 00 00       	push   $0x1106
+ 760:	e8 eb f8 ff ff       	call   50 <failed>
+    failed("read into read-only mapping");
+ 765:	83 ec 0c             	sub    $0xc,%esp
+ 768:	68 ea 10 00 00       	push   $0x10ea
+ 76d:	e8 de f8 ff ff       	call   50 <failed>
+    failed("pipe");
+ 772:	83 ec 0c             	sub    $0xc,%esp
+ 775:	68 e5 10 00 00       	push   $0x10e5
+ 77a:	e8 d1 f8 ff ff       	call   50 <failed>
+    failed("mmap");
+ 77f:	83 ec 0c             	sub    $0xc,%esp
+ 782:	68 bf 0f 00 00       	push   $0xfbf
+ 787:	e8 c4 f8 ff ff       	call   50 <failed>
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <unmapped>:
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	53                   	push   %ebx
+ 794:	83 ec 08             	sub    $0x8,%esp
+  p = mapfile(O_RDONLY, PROT_READ, MAP_PRIVATE);
+ 797:	6a 02                	push   $0x2
+ 799:	6a 01                	push   $0x1
+ 79b:	6a 00                	push   $0x0
+ 79d:	e8 9e f9 ff ff       	call   140 <mapfile>
+  if(munmap(p + PGSIZE, PGSIZE) < 0)
+ 7a2:	5a                   	pop    %edx
+ 7a3:	59                   	pop    %ecx
+ 7a4:	68 00 10 00 00       	push   $0x1000
+  p = mapfile(O_RDONLY, PROT_READ, MAP_PRIVATE);
+ 7a9:	89 c3                	mov    %eax,%ebx
+  if(munmap(p + PGSIZE, PGSIZE) < 0)
+ 7ab:	05 00 10 00 00       	add    $0x1000,%eax
+ 7b0:	50                   	push   %eax
+ 7b1:	e8 fd 03 00 00       	call   bb3 <munmap>
+ 7b6:	83 c4 10             	add    $0x10,%esp
+ 7b9:	85 c0                	test   %eax,%eax
+ 7bb:	0f 88 8d 00 00 00    	js     84e <unmapped+0xbe>
+  if(p[0] != 'a' || p[2*PGSIZE] != 'Z')
+ 7c1:	80 3b 61             	cmpb   $0x61,(%ebx)
+ 7c4:	75 60                	jne    826 <unmapped+0x96>
+ 7c6:	80 bb 00 20 00 00 5a 	cmpb   $0x5a,0x2000(%ebx)
+ 7cd:	75 57                	jne    826 <unmapped+0x96>
+  pid = fork();
+ 7cf:	e8 f7 02 00 00       	call   acb <fork>
+  if(pid < 0)
+ 7d4:	85 c0                	test   %eax,%eax
+ 7d6:	78 5b                	js     833 <unmapped+0xa3>
+  if(pid == 0){
+ 7d8:	74 66                	je     840 <unmapped+0xb0>
+  wait();
+ 7da:	e8 fc 02 00 00       	call   adb <wait>
+  pid = fork();
+ 7df:	e8 e7 02 00 00       	call   acb <fork>
+  if(pid < 0)
+ 7e4:	85 c0                	test   %eax,%eax
+ 7e6:	78 4b                	js     833 <unmapped+0xa3>
+  if(pid == 0){
+ 7e8:	74 71                	je     85b <unmapped+0xcb>
+  wait();
+ 7ea:	e8 ec 02 00 00       	call   adb <wait>
+  munmap(p, PGSIZE);
+ 7ef:	83 ec 08             	sub    $0x8,%esp
+ 7f2:	68 00 10 00 00       	push   $0x1000
+ 7f7:	53                   	push   %ebx
+  munmap(p + 2*PGSIZE, (NPAGE-1)*PGSIZE);
+ 7f8:	81 c3 00 20 00 00    	add    $0x2000,%ebx
+  munmap(p, PGSIZE);
+ 7fe:	e8 b0 03 00 00       	call   bb3 <munmap>
+  munmap(p + 2*PGSIZE, (NPAGE-1)*PGSIZE);
+ 803:	58                   	pop    %eax
+ 804:	5a                   	pop    %edx
+ 805:	68 00 30 00 00       	push   $0x3000
+ 80a:	53                   	push   %ebx
+ 80b:	e8 a3 03 00 00       	call   bb3 <munmap>
+  printf(1, "unmapped ok\n");
+ 810:	59                   	pop    %ecx
+ 811:	5b                   	pop    %ebx
+ 812:	68 95 11 00 00       	push   $0x1195
+ 817:	6a 01                	push   $0x1
+ 819:	e8 52 04 00 00       	call   c70 <printf>
+}
+ 81e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 821:	83 c4 10             	add    $0x10,%esp
+ 824:	c9                   	leave
+ 825:	c3                   	ret
+    failed("contents around hole");
+ 826:	83 ec 0c             	sub    $0xc,%esp
+ 829:	68 54 11 00 00       	push   $0x1154
+ 82e:	e8 1d f8 ff ff       	call   50 <failed>
+    failed("fork");
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	68 5a 10 00 00       	push   $0x105a
+ 83b:	e8 10 f8 ff ff       	call   50 <failed>
+    if(p[PGSIZE] == 'b')
+ 840:	80 bb 00 10 00 00 62 	cmpb   $0x62,0x1000(%ebx)
+ 847:	74 28                	je     871 <unmapped+0xe1>
+    exit();
+ 849:	e8 85 02 00 00       	call   ad3 <exit>
+    failed("munmap hole");
+ 84e:	83 ec 0c             	sub    $0xc,%esp
+ 851:	68 48 11 00 00       	push   $0x1148
+ 856:	e8 f5 f7 ff ff       	call   50 <failed>
+    p[0] = 'X';  // read-only
+ 85b:	c6 03 58             	movb   $0x58,(%ebx)
+    printf(1, "store to read-only mapping\n");
+ 85e:	50                   	push   %eax
+ 85f:	50                   	push   %eax
+ 860:	68 79 11 00 00       	push   $0x1179
+ 865:	6a 01                	push   $0x1
+ 867:	e8 04 04 00 00       	call   c70 <printf>
+    exit();
+ 86c:	e8 62 02 00 00       	call   ad3 <exit>
+      printf(1, "read from hole\n");
+ 871:	50                   	push   %eax
+ 872:	50                   	push   %eax
+ 873:	68 69 11 00 00       	push   $0x1169
+ 878:	6a 01                	push   $0x1
+ 87a:	e8 f1 03 00 00       	call   c70 <printf>
+ 87f:	83 c4 10             	add    $0x10,%esp
+ 882:	eb c5                	jmp    849 <unmapped+0xb9>
+ 884:	66 90                	xchg   %ax,%ax
+ 886:	66 90                	xchg   %ax,%ax
+ 888:	66 90                	xchg   %ax,%ax
+ 88a:	66 90                	xchg   %ax,%ax
+ 88c:	66 90                	xchg   %ax,%ax
+ 88e:	66 90                	xchg   %ax,%ax
+
+00000890 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 890:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 891:	31 c0                	xor    %eax,%eax
+{
+ 893:	89 e5                	mov    %esp,%ebp
+ 895:	53                   	push   %ebx
+ 896:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 899:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 8a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 8a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 8a7:	83 c0 01             	add    $0x1,%eax
+ 8aa:	84 d2                	test   %dl,%dl
+ 8ac:	75 f2                	jne    8a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 8ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8b1:	89 c8                	mov    %ecx,%eax
+ 8b3:	c9                   	leave
+ 8b4:	c3                   	ret
+ 8b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	53                   	push   %ebx
+ 8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 8ca:	0f b6 02             	movzbl (%edx),%eax
+ 8cd:	84 c0                	test   %al,%al
+ 8cf:	75 17                	jne    8e8 <strcmp+0x28>
+ 8d1:	eb 3a                	jmp    90d <strcmp+0x4d>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 8dc:	83 c2 01             	add    $0x1,%edx
+ 8df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 8e2:	84 c0                	test   %al,%al
+ 8e4:	74 1a                	je     900 <strcmp+0x40>
+    p++, q++;
+ 8e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 8e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 8eb:	38 c3                	cmp    %al,%bl
+ 8ed:	74 e9                	je     8d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 8ef:	29 d8                	sub    %ebx,%eax
+}
+ 8f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8f4:	c9                   	leave
+ 8f5:	c3                   	ret
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 900:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 904:	31 c0                	xor    %eax,%eax
+ 906:	29 d8                	sub    %ebx,%eax
+}
+ 908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 90b:	c9                   	leave
+ 90c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 90d:	0f b6 19             	movzbl (%ecx),%ebx
+ 910:	31 c0                	xor    %eax,%eax
+ 912:	eb db                	jmp    8ef <strcmp+0x2f>
+ 914:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+
+00000920 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 926:	80 3a 00             	cmpb   $0x0,(%edx)
+ 929:	74 15                	je     940 <strlen+0x20>
+ 92b:	31 c0                	xor    %eax,%eax
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+ 930:	83 c0 01             	add    $0x1,%eax
+ 933:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 937:	89 c1                	mov    %eax,%ecx
+ 939:	75 f5                	jne    930 <strlen+0x10>
+    ;
+  return n;
+}
+ 93b:	89 c8                	mov    %ecx,%eax
+ 93d:	5d                   	pop    %ebp
+ 93e:	c3                   	ret
+ 93f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 940:	31 c9                	xor    %ecx,%ecx
+}
+ 942:	5d                   	pop    %ebp
+ 943:	89 c8                	mov    %ecx,%eax
+ 945:	c3                   	ret
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 957:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 95a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 95d:	89 d7                	mov    %edx,%edi
+ 95f:	fc                   	cld
+ 960:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 962:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 965:	89 d0                	mov    %edx,%eax
+ 967:	c9                   	leave
+ 968:	c3                   	ret
+ 969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	8b 45 08             	mov    0x8(%ebp),%eax
+ 976:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 97a:	0f b6 10             	movzbl (%eax),%edx
+ 97d:	84 d2                	test   %dl,%dl
+ 97f:	75 12                	jne    993 <strchr+0x23>
+ 981:	eb 1d                	jmp    9a0 <strchr+0x30>
+ 983:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 987:	90                   	nop
+ 988:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 98c:	83 c0 01             	add    $0x1,%eax
+ 98f:	84 d2                	test   %dl,%dl
+ 991:	74 0d                	je     9a0 <strchr+0x30>
+    if(*s == c)
+ 993:	38 d1                	cmp    %dl,%cl
+ 995:	75 f1                	jne    988 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 997:	5d                   	pop    %ebp
+ 998:	c3                   	ret
+ 999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 9a0:	31 c0                	xor    %eax,%eax
+}
+ 9a2:	5d                   	pop    %ebp
+ 9a3:	c3                   	ret
+ 9a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+
+000009b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 9b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 9b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 9b9:	31 db                	xor    %ebx,%ebx
+{
+ 9bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 9be:	eb 27                	jmp    9e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	6a 01                	push   $0x1
+ 9c5:	56                   	push   %esi
+ 9c6:	6a 00                	push   $0x0
+ 9c8:	e8 1e 01 00 00       	call   aeb <read>
+    if(cc < 1)
+ 9cd:	83 c4 10             	add    $0x10,%esp
+ 9d0:	85 c0                	test   %eax,%eax
+ 9d2:	7e 1d                	jle    9f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 9d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 9d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 9df:	3c 0a                	cmp    $0xa,%al
+ 9e1:	74 10                	je     9f3 <gets+0x43>
+ 9e3:	3c 0d                	cmp    $0xd,%al
+ 9e5:	74 0c                	je     9f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 9e7:	89 df                	mov    %ebx,%edi
+ 9e9:	83 c3 01             	add    $0x1,%ebx
+ 9ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 9ef:	7c cf                	jl     9c0 <gets+0x10>
+ 9f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 9f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 9fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9fd:	5b                   	pop    %ebx
+ 9fe:	5e                   	pop    %esi
+ 9ff:	5f                   	pop    %edi
+ a00:	5d                   	pop    %ebp
+ a01:	c3                   	ret
+ a02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a10 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	56                   	push   %esi
+ a14:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ a15:	83 ec 08             	sub    $0x8,%esp
+ a18:	6a 00                	push   $0x0
+ a1a:	ff 75 08             	push   0x8(%ebp)
+ a1d:	e8 f1 00 00 00       	call   b13 <open>
+  if(fd < 0)
+ a22:	83 c4 10             	add    $0x10,%esp
+ a25:	85 c0                	test   %eax,%eax
+ a27:	78 27                	js     a50 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ a29:	83 ec 08             	sub    $0x8,%esp
+ a2c:	ff 75 0c             	push   0xc(%ebp)
+ a2f:	89 c3                	mov    %eax,%ebx
+ a31:	50                   	push   %eax
+ a32:	e8 f4 00 00 00       	call   b2b <fstat>
+  close(fd);
+ a37:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ a3a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ a3c:	e8 ba 00 00 00       	call   afb <close>
+  return r;
+ a41:	83 c4 10             	add    $0x10,%esp
+}
+ a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a47:	89 f0                	mov    %esi,%eax
+ a49:	5b                   	pop    %ebx
+ a4a:	5e                   	pop    %esi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ a50:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ a55:	eb ed                	jmp    a44 <stat+0x34>
+ a57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5e:	66 90                	xchg   %ax,%ax
+
+00000a60 <atoi>:
+
+int
+atoi(const char *s)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	53                   	push   %ebx
+ a64:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ a67:	0f be 02             	movsbl (%edx),%eax
+ a6a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ a6d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ a70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ a75:	77 1e                	ja     a95 <atoi+0x35>
+ a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ a80:	83 c2 01             	add    $0x1,%edx
+ a83:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ a86:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ a8a:	0f be 02             	movsbl (%edx),%eax
+ a8d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ a90:	80 fb 09             	cmp    $0x9,%bl
+ a93:	76 eb                	jbe    a80 <atoi+0x20>
+  return n;
+}
+ a95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a98:	89 c8                	mov    %ecx,%eax
+ a9a:	c9                   	leave
+ a9b:	c3                   	ret
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000aa0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	8b 45 10             	mov    0x10(%ebp),%eax
+ aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+ aab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ aae:	85 c0                	test   %eax,%eax
+ ab0:	7e 13                	jle    ac5 <memmove+0x25>
+ ab2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ ab4:	89 d7                	mov    %edx,%edi
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ ac0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ ac1:	39 f8                	cmp    %edi,%eax
+ ac3:	75 fb                	jne    ac0 <memmove+0x20>
+  return vdst;
+}
+ ac5:	5e                   	pop    %esi
+ ac6:	89 d0                	mov    %edx,%eax
+ ac8:	5f                   	pop    %edi
+ ac9:	5d                   	pop    %ebp
+ aca:	c3                   	ret
+
+00000acb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ acb:	b8 01 00 00 00       	mov    $0x1,%eax
+ ad0:	cd 40                	int    $0x40
+ ad2:	c3                   	ret
+
+00000ad3 <exit>:
+SYSCALL(exit)
+ ad3:	b8 02 00 00 00       	mov    $0x2,%eax
+ ad8:	cd 40                	int    $0x40
+ ada:	c3                   	ret
+
+00000adb <wait>:
+SYSCALL(wait)
+ adb:	b8 03 00 00 00       	mov    $0x3,%eax
+ ae0:	cd 40                	int    $0x40
+ ae2:	c3                   	ret
+
+00000ae3 <pipe>:
+SYSCALL(pipe)
+ ae3:	b8 04 00 00 00       	mov    $0x4,%eax
+ ae8:	cd 40                	int    $0x40
+ aea:	c3                   	ret
+
+00000aeb <read>:
+SYSCALL(read)
+ aeb:	b8 05 00 00 00       	mov    $0x5,%eax
+ af0:	cd 40                	int    $0x40
+ af2:	c3                   	ret
+
+00000af3 <write>:
+SYSCALL(write)
+ af3:	b8 10 00 00 00       	mov    $0x10,%eax
+ af8:	cd 40                	int    $0x40
+ afa:	c3                   	ret
+
+00000afb <close>:
+SYSCALL(close)
+ afb:	b8 15 00 00 00       	mov    $0x15,%eax
+ b00:	cd 40                	int    $0x40
+ b02:	c3                   	ret
+
+00000b03 <kill>:
+SYSCALL(kill)
+ b03:	b8 06 00 00 00       	mov    $0x6,%eax
+ b08:	cd 40                	int    $0x40
+ b0a:	c3                   	ret
+
+00000b0b <exec>:
+SYSCALL(exec)
+ b0b:	b8 07 00 00 00       	mov    $0x7,%eax
+ b10:	cd 40                	int    $0x40
+ b12:	c3                   	ret
+
+00000b13 <open>:
+SYSCALL(open)
+ b13:	b8 0f 00 00 00       	mov    $0xf,%eax
+ b18:	cd 40                	int    $0x40
+ b1a:	c3                   	ret
+
+00000b1b <mknod>:
+SYSCALL(mknod)
+ b1b:	b8 11 00 00 00       	mov    $0x11,%eax
+ b20:	cd 40                	int    $0x40
+ b22:	c3                   	ret
+
+00000b23 <unlink>:
+SYSCALL(unlink)
+ b23:	b8 12 00 00 00       	mov    $0x12,%eax
+ b28:	cd 40                	int    $0x40
+ b2a:	c3                   	ret
+
+00000b2b <fstat>:
+SYSCALL(fstat)
+ b2b:	b8 08 00 00 00       	mov    $0x8,%eax
+ b30:	cd 40                	int    $0x40
+ b32:	c3                   	ret
+
+00000b33 <link>:
+SYSCALL(link)
+ b33:	b8 13 00 00 00       	mov    $0x13,%eax
+ b38:	cd 40                	int    $0x40
+ b3a:	c3                   	ret
+
+00000b3b <mkdir>:
+SYSCALL(mkdir)
+ b3b:	b8 14 00 00 00       	mov    $0x14,%eax
+ b40:	cd 40                	int    $0x40
+ b42:	c3                   	ret
+
+00000b43 <chdir>:
+SYSCALL(chdir)
+ b43:	b8 09 00 00 00       	mov    $0x9,%eax
+ b48:	cd 40                	int    $0x40
+ b4a:	c3                   	ret
+
+00000b4b <dup>:
+SYSCALL(dup)
+ b4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ b50:	cd 40                	int    $0x40
+ b52:	c3                   	ret
+
+00000b53 <getpid>:
+SYSCALL(getpid)
+ b53:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b58:	cd 40                	int    $0x40
+ b5a:	c3                   	ret
+
+00000b5b <sbrk>:
+SYSCALL(sbrk)
+ b5b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ b60:	cd 40                	int    $0x40
+ b62:	c3                   	ret
+
+00000b63 <sleep>:
+SYSCALL(sleep)
+ b63:	b8 0d 00 00 00       	mov    $0xd,%eax
+ b68:	cd 40                	int    $0x40
+ b6a:	c3                   	ret
+
+00000b6b <uptime>:
+SYSCALL(uptime)
+ b6b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ b70:	cd 40                	int    $0x40
+ b72:	c3                   	ret
+
+00000b73 <getrss>:
+SYSCALL(getrss)
+ b73:	b8 16 00 00 00       	mov    $0x16,%eax
+ b78:	cd 40                	int    $0x40
+ b7a:	c3                   	ret
+
+00000b7b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ b7b:	b8 17 00 00 00       	mov    $0x17,%eax
+ b80:	cd 40                	int    $0x40
+ b82:	c3                   	ret
+
+00000b83 <usleep>:
+SYSCALL(usleep)
+ b83:	b8 18 00 00 00       	mov    $0x18,%eax
+ b88:	cd 40                	int    $0x40
+ b8a:	c3                   	ret
+
+00000b8b <lockstat>:
+SYSCALL(lockstat)
+ b8b:	b8 19 00 00 00       	mov    $0x19,%eax
+ b90:	cd 40                	int    $0x40
+ b92:	c3                   	ret
+
+00000b93 <clone>:
+SYSCALL(clone)
+ b93:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ b98:	cd 40                	int    $0x40
+ b9a:	c3                   	ret
+
+00000b9b <join>:
+SYSCALL(join)
+ b9b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ ba0:	cd 40                	int    $0x40
+ ba2:	c3                   	ret
+
+00000ba3 <futex>:
+SYSCALL(futex)
+ ba3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ ba8:	cd 40                	int    $0x40
+ baa:	c3                   	ret
+
+00000bab <mmap>:
+SYSCALL(mmap)
+ bab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ bb0:	cd 40                	int    $0x40
+ bb2:	c3                   	ret
+
+00000bb3 <munmap>:
+SYSCALL(munmap)
+ bb3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ bb8:	cd 40                	int    $0x40
+ bba:	c3                   	ret
+
+00000bbb <sendfile>:
+SYSCALL(sendfile)
+ bbb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ bc0:	cd 40                	int    $0x40
+ bc2:	c3                   	ret
+
+00000bc3 <splice>:
+SYSCALL(splice)
+ bc3:	b8 20 00 00 00       	mov    $0x20,%eax
+ bc8:	cd 40                	int    $0x40
+ bca:	c3                   	ret
+ bcb:	66 90                	xchg   %ax,%ax
+ bcd:	66 90                	xchg   %ax,%ax
+ bcf:	90                   	nop
+
+00000bd0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	53                   	push   %ebx
+ bd6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ bd8:	89 d1                	mov    %edx,%ecx
+{
+ bda:	83 ec 3c             	sub    $0x3c,%esp
+ bdd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ be0:	85 d2                	test   %edx,%edx
+ be2:	0f 89 80 00 00 00    	jns    c68 <printint+0x98>
+ be8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ bec:	74 7a                	je     c68 <printint+0x98>
+    x = -xx;
+ bee:	f7 d9                	neg    %ecx
+    neg = 1;
+ bf0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ bf5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ bf8:	31 f6                	xor    %esi,%esi
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ c00:	89 c8                	mov    %ecx,%eax
+ c02:	31 d2                	xor    %edx,%edx
+ c04:	89 f7                	mov    %esi,%edi
+ c06:	f7 f3                	div    %ebx
+ c08:	8d 76 01             	lea    0x1(%esi),%esi
+ c0b:	0f b6 92 44 12 00 00 	movzbl 0x1244(%edx),%edx
+ c12:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ c16:	89 ca                	mov    %ecx,%edx
+ c18:	89 c1                	mov    %eax,%ecx
+ c1a:	39 da                	cmp    %ebx,%edx
+ c1c:	73 e2                	jae    c00 <printint+0x30>
+  if(neg)
+ c1e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c21:	85 c0                	test   %eax,%eax
+ c23:	74 07                	je     c2c <printint+0x5c>
+    buf[i++] = '-';
+ c25:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ c2a:	89 f7                	mov    %esi,%edi
+ c2c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ c2f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ c32:	01 df                	add    %ebx,%edi
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ c38:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ c41:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ c44:	6a 01                	push   $0x1
+ c46:	50                   	push   %eax
+ c47:	56                   	push   %esi
+ c48:	e8 a6 fe ff ff       	call   af3 <write>
+  while(--i >= 0)
+ c4d:	89 f8                	mov    %edi,%eax
+ c4f:	83 c4 10             	add    $0x10,%esp
+ c52:	83 ef 01             	sub    $0x1,%edi
+ c55:	39 d8                	cmp    %ebx,%eax
+ c57:	75 df                	jne    c38 <printint+0x68>
+}
+ c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c5c:	5b                   	pop    %ebx
+ c5d:	5e                   	pop    %esi
+ c5e:	5f                   	pop    %edi
+ c5f:	5d                   	pop    %ebp
+ c60:	c3                   	ret
+ c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ c68:	31 c0                	xor    %eax,%eax
+ c6a:	eb 89                	jmp    bf5 <printint+0x25>
+ c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	57                   	push   %edi
+ c74:	56                   	push   %esi
+ c75:	53                   	push   %ebx
+ c76:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ c79:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ c7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ c7f:	0f b6 1e             	movzbl (%esi),%ebx
+ c82:	83 c6 01             	add    $0x1,%esi
+ c85:	84 db                	test   %bl,%bl
+ c87:	74 67                	je     cf0 <printf+0x80>
+ c89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ c8c:	31 d2                	xor    %edx,%edx
+ c8e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ c91:	eb 34                	jmp    cc7 <printf+0x57>
+ c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c97:	90                   	nop
+ c98:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ c9b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ ca0:	83 f8 25             	cmp    $0x25,%eax
+ ca3:	74 18                	je     cbd <printf+0x4d>
+  write(fd, &c, 1);
+ ca5:	83 ec 04             	sub    $0x4,%esp
+ ca8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ cab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ cae:	6a 01                	push   $0x1
+ cb0:	50                   	push   %eax
+ cb1:	57                   	push   %edi
+ cb2:	e8 3c fe ff ff       	call   af3 <write>
+ cb7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ cba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ cbd:	0f b6 1e             	movzbl (%esi),%ebx
+ cc0:	83 c6 01             	add    $0x1,%esi
+ cc3:	84 db                	test   %bl,%bl
+ cc5:	74 29                	je     cf0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ cc7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ cca:	85 d2                	test   %edx,%edx
+ ccc:	74 ca                	je     c98 <printf+0x28>
+      }
+    } else if(state == '%'){
+ cce:	83 fa 25             	cmp    $0x25,%edx
+ cd1:	75 ea                	jne    cbd <printf+0x4d>
+      if(c == 'd'){
+ cd3:	83 f8 25             	cmp    $0x25,%eax
+ cd6:	0f 84 24 01 00 00    	je     e00 <printf+0x190>
+ cdc:	83 e8 63             	sub    $0x63,%eax
+ cdf:	83 f8 15             	cmp    $0x15,%eax
+ ce2:	77 1c                	ja     d00 <printf+0x90>
+ ce4:	ff 24 85 ec 11 00 00 	jmp    *0x11ec(,%eax,4)
+ ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cf3:	5b                   	pop    %ebx
+ cf4:	5e                   	pop    %esi
+ cf5:	5f                   	pop    %edi
+ cf6:	5d                   	pop    %ebp
+ cf7:	c3                   	ret
+ cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+  write(fd, &c, 1);
+ d00:	83 ec 04             	sub    $0x4,%esp
+ d03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ d0a:	6a 01                	push   $0x1
+ d0c:	52                   	push   %edx
+ d0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ d10:	57                   	push   %edi
+ d11:	e8 dd fd ff ff       	call   af3 <write>
+ d16:	83 c4 0c             	add    $0xc,%esp
+ d19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d1c:	6a 01                	push   $0x1
+ d1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ d21:	52                   	push   %edx
+ d22:	57                   	push   %edi
+ d23:	e8 cb fd ff ff       	call   af3 <write>
+        putc(fd, c);
+ d28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d2b:	31 d2                	xor    %edx,%edx
+ d2d:	eb 8e                	jmp    cbd <printf+0x4d>
+ d2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ d30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d33:	83 ec 0c             	sub    $0xc,%esp
+ d36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ d3b:	8b 13                	mov    (%ebx),%edx
+ d3d:	6a 00                	push   $0x0
+ d3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ d41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ d44:	e8 87 fe ff ff       	call   bd0 <printint>
+        ap++;
+ d49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d4f:	31 d2                	xor    %edx,%edx
+ d51:	e9 67 ff ff ff       	jmp    cbd <printf+0x4d>
+ d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ d60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ d63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ d65:	83 c0 04             	add    $0x4,%eax
+ d68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ d6b:	85 db                	test   %ebx,%ebx
+ d6d:	0f 84 9d 00 00 00    	je     e10 <printf+0x1a0>
+        while(*s != 0){
+ d73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ d76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ d78:	84 c0                	test   %al,%al
+ d7a:	0f 84 3d ff ff ff    	je     cbd <printf+0x4d>
+ d80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ d86:	89 de                	mov    %ebx,%esi
+ d88:	89 d3                	mov    %edx,%ebx
+ d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ d90:	83 ec 04             	sub    $0x4,%esp
+ d93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ d96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ d99:	6a 01                	push   $0x1
+ d9b:	53                   	push   %ebx
+ d9c:	57                   	push   %edi
+ d9d:	e8 51 fd ff ff       	call   af3 <write>
+        while(*s != 0){
+ da2:	0f b6 06             	movzbl (%esi),%eax
+ da5:	83 c4 10             	add    $0x10,%esp
+ da8:	84 c0                	test   %al,%al
+ daa:	75 e4                	jne    d90 <printf+0x120>
+      state = 0;
+ dac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ daf:	31 d2                	xor    %edx,%edx
+ db1:	e9 07 ff ff ff       	jmp    cbd <printf+0x4d>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ dc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ dc3:	83 ec 0c             	sub    $0xc,%esp
+ dc6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ dcb:	8b 13                	mov    (%ebx),%edx
+ dcd:	6a 01                	push   $0x1
+ dcf:	e9 6b ff ff ff       	jmp    d3f <printf+0xcf>
+ dd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ dd8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ ddb:	83 ec 04             	sub    $0x4,%esp
+ dde:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ de1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ de3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ de6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ de9:	6a 01                	push   $0x1
+ deb:	52                   	push   %edx
+ dec:	57                   	push   %edi
+ ded:	e8 01 fd ff ff       	call   af3 <write>
+        ap++;
+ df2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ df5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ df8:	31 d2                	xor    %edx,%edx
+ dfa:	e9 be fe ff ff       	jmp    cbd <printf+0x4d>
+ dff:	90                   	nop
+  write(fd, &c, 1);
+ e00:	83 ec 04             	sub    $0x4,%esp
+ e03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ e06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ e09:	6a 01                	push   $0x1
+ e0b:	e9 11 ff ff ff       	jmp    d21 <printf+0xb1>
+ e10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ e15:	bb e3 11 00 00       	mov    $0x11e3,%ebx
+ e1a:	e9 61 ff ff ff       	jmp    d80 <printf+0x110>
+ e1f:	90                   	nop
+
+00000e20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ e20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e21:	a1 60 26 00 00       	mov    0x2660,%eax
+{
+ e26:	89 e5                	mov    %esp,%ebp
+ e28:	57                   	push   %edi
+ e29:	56                   	push   %esi
+ e2a:	53                   	push   %ebx
+ e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ e2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e3c:	39 ca                	cmp    %ecx,%edx
+ e3e:	73 30                	jae    e70 <free+0x50>
+ e40:	39 c1                	cmp    %eax,%ecx
+ e42:	72 04                	jb     e48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e44:	39 c2                	cmp    %eax,%edx
+ e46:	72 f0                	jb     e38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e4e:	39 f8                	cmp    %edi,%eax
+ e50:	74 2e                	je     e80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e55:	8b 42 04             	mov    0x4(%edx),%eax
+ e58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e5b:	39 f1                	cmp    %esi,%ecx
+ e5d:	74 38                	je     e97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e61:	5b                   	pop    %ebx
+  freep = p;
+ e62:	89 15 60 26 00 00    	mov    %edx,0x2660
+}
+ e68:	5e                   	pop    %esi
+ e69:	5f                   	pop    %edi
+ e6a:	5d                   	pop    %ebp
+ e6b:	c3                   	ret
+ e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e70:	39 c1                	cmp    %eax,%ecx
+ e72:	72 d0                	jb     e44 <free+0x24>
+ e74:	eb c2                	jmp    e38 <free+0x18>
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e80:	03 70 04             	add    0x4(%eax),%esi
+ e83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e86:	8b 02                	mov    (%edx),%eax
+ e88:	8b 00                	mov    (%eax),%eax
+ e8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e8d:	8b 42 04             	mov    0x4(%edx),%eax
+ e90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e93:	39 f1                	cmp    %esi,%ecx
+ e95:	75 c8                	jne    e5f <free+0x3f>
+    p->s.size += bp->s.size;
+ e97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e9a:	89 15 60 26 00 00    	mov    %edx,0x2660
+    p->s.size += bp->s.size;
+ ea0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ea3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ea6:	89 0a                	mov    %ecx,(%edx)
+}
+ ea8:	5b                   	pop    %ebx
+ ea9:	5e                   	pop    %esi
+ eaa:	5f                   	pop    %edi
+ eab:	5d                   	pop    %ebp
+ eac:	c3                   	ret
+ ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000eb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ eb0:	55                   	push   %ebp
+ eb1:	89 e5                	mov    %esp,%ebp
+ eb3:	57                   	push   %edi
+ eb4:	56                   	push   %esi
+ eb5:	53                   	push   %ebx
+ eb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ ebc:	8b 15 60 26 00 00    	mov    0x2660,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ec2:	8d 78 07             	lea    0x7(%eax),%edi
+ ec5:	c1 ef 03             	shr    $0x3,%edi
+ ec8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ ecb:	85 d2                	test   %edx,%edx
+ ecd:	0f 84 8d 00 00 00    	je     f60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ed3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ed5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ed8:	39 f9                	cmp    %edi,%ecx
+ eda:	73 64                	jae    f40 <malloc+0x90>
+  if(nu < 4096)
+ edc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ee1:	39 df                	cmp    %ebx,%edi
+ ee3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ee6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ eed:	eb 0a                	jmp    ef9 <malloc+0x49>
+ eef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ef0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ef2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ef5:	39 f9                	cmp    %edi,%ecx
+ ef7:	73 47                	jae    f40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ef9:	89 c2                	mov    %eax,%edx
+ efb:	39 05 60 26 00 00    	cmp    %eax,0x2660
+ f01:	75 ed                	jne    ef0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ f03:	83 ec 0c             	sub    $0xc,%esp
+ f06:	56                   	push   %esi
+ f07:	e8 4f fc ff ff       	call   b5b <sbrk>
+  if(p == (char*)-1)
+ f0c:	83 c4 10             	add    $0x10,%esp
+ f0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ f12:	74 1c                	je     f30 <malloc+0x80>
+  hp->s.size = nu;
+ f14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ f17:	83 ec 0c             	sub    $0xc,%esp
+ f1a:	83 c0 08             	add    $0x8,%eax
+ f1d:	50                   	push   %eax
+ f1e:	e8 fd fe ff ff       	call   e20 <free>
+  return freep;
+ f23:	8b 15 60 26 00 00    	mov    0x2660,%edx
+      if((p = morecore(nunits)) == 0)
+ f29:	83 c4 10             	add    $0x10,%esp
+ f2c:	85 d2                	test   %edx,%edx
+ f2e:	75 c0                	jne    ef0 <malloc+0x40>
+        return 0;
+  }
+}
+ f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ f33:	31 c0                	xor    %eax,%eax
+}
+ f35:	5b                   	pop    %ebx
+ f36:	5e                   	pop    %esi
+ f37:	5f                   	pop    %edi
+ f38:	5d                   	pop    %ebp
+ f39:	c3                   	ret
+ f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f40:	39 cf                	cmp    %ecx,%edi
+ f42:	74 4c                	je     f90 <malloc+0xe0>
+        p->s.size -= nunits;
+ f44:	29 f9                	sub    %edi,%ecx
+ f46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f4f:	89 15 60 26 00 00    	mov    %edx,0x2660
+}
+ f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f58:	83 c0 08             	add    $0x8,%eax
+}
+ f5b:	5b                   	pop    %ebx
+ f5c:	5e                   	pop    %esi
+ f5d:	5f                   	pop    %edi
+ f5e:	5d                   	pop    %ebp
+ f5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f60:	c7 05 60 26 00 00 64 	movl   $0x2664,0x2660
+ f67:	26 00 00 
+    base.s.size = 0;
+ f6a:	b8 64 26 00 00       	mov    $0x2664,%eax
+    base.s.ptr = freep = prevp = &base;
+ f6f:	c7 05 64 26 00 00 64 	movl   $0x2664,0x2664
+ f76:	26 00 00 
+    base.s.size = 0;
+ f79:	c7 05 68 26 00 00 00 	movl   $0x0,0x2668
+ f80:	00 00 00 
+    if(p->s.size >= nunits){
+ f83:	e9 54 ff ff ff       	jmp    edc <malloc+0x2c>
+ f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f90:	8b 08                	mov    (%eax),%ecx
+ f92:	89 0a                	mov    %ecx,(%edx)
+ f94:	eb b9                	jmp    f4f <malloc+0x9f>
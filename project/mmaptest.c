@@ -0,0 +1,241 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mman.h"
+
+#define PGSIZE 4096
+#define NPAGE 4
+
+char *name = "mmaptest.tmp";
+char buf[PGSIZE];
+
+void
+failed(char *why)
+{
+  printf(1, "Mmaptest failed: %s\n", why);
+  unlink(name);
+  exit();
+}
+
+// A file of NPAGE pages and a half, page i filled with 'a'+i.
+void
+makefile(void)
+{
+  int fd, i;
+
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+    failed("create");
+  for(i = 0; i < NPAGE; i++){
+    memset(buf, 'a' + i, PGSIZE);
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+      failed("write");
+  }
+  memset(buf, 'z', PGSIZE/2);
+  if(write(fd, buf, PGSIZE/2) != PGSIZE/2)
+    failed("write");
+  close(fd);
+}
+
+char*
+mapfile(int omode, int prot, int flags)
+{
+  char *p;
+  int fd;
+
+  if((fd = open(name, omode)) < 0)
+    failed("open");
+  p = mmap(0, (NPAGE+1)*PGSIZE, prot, flags, fd, 0);
+  close(fd);  // the mapping holds the file
+  if(p == MAP_FAILED)
+    failed("mmap");
+  return p;
+}
+
+// A private mapping reads the file; stores do not reach it.
+void
+private(void)
+{
+  char *p;
+  int i, fd;
+
+  makefile();
+  p = mapfile(O_RDONLY, PROT_READ|PROT_WRITE, MAP_PRIVATE);
+  for(i = 0; i < NPAGE; i++)
+    if(p[i*PGSIZE] != 'a' + i || p[i*PGSIZE + PGSIZE-1] != 'a' + i)
+      failed("private contents");
+  if(p[NPAGE*PGSIZE] != 'z' || p[NPAGE*PGSIZE + PGSIZE/2] != 0)
+    failed("partial last page");
+  p[0] = 'X';
+  if(munmap(p, (NPAGE+1)*PGSIZE) < 0)
+    failed("munmap");
+  if((fd = open(name, O_RDONLY)) < 0 || read(fd, buf, 1) != 1 || buf[0] != 'a')
+    failed("private store reached the file");
+  close(fd);
+  printf(1, "private ok\n");
+}
+
+// Stores to a shared mapping reach the file, and write() is
+// allowed straight from a mapping.
+void
+shared(void)
+{
+  char *p;
+  int fd;
+
+  p = mapfile(O_RDWR, PROT_READ|PROT_WRITE, MAP_SHARED);
+  p[1] = 'Y';
+  p[2*PGSIZE] = 'Z';
+  if((fd = open(name, O_RDONLY)) < 0)
+    failed("open");
+  if(read(fd, buf, 2) != 2 || buf[1] != 'Y')
+    failed("read does not see the store");
+  close(fd);
+  if(munmap(p, (NPAGE+1)*PGSIZE) < 0)
+    failed("munmap");
+
+  p = mapfile(O_RDONLY, PROT_READ, MAP_SHARED);
+  if(p[1] != 'Y' || p[2*PGSIZE] != 'Z')
+    failed("store not written back");
+  if((fd = open("mmaptest.out", O_CREATE|O_RDWR)) < 0)
+    failed("create");
+  if(write(fd, p + PGSIZE, PGSIZE) != PGSIZE)
+    failed("write from mapping");
+  close(fd);
+  unlink("mmaptest.out");
+  munmap(p, (NPAGE+1)*PGSIZE);
+  printf(1, "shared ok\n");
+}
+
+// Anonymous shared memory is shared with children; private
+// memory is copied.
+void
+anon(void)
+{
+  int *sh, *pv, pid;
+
+  sh = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+  pv = mmap(0, 2*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(sh == MAP_FAILED || pv == MAP_FAILED)
+    failed("mmap anon");
+  if(sh[0] != 0 || pv[PGSIZE/sizeof(int)] != 0)
+    failed("not zero");
+  pv[0] = 1;
+  pid = fork();
+  if(pid < 0)
+    failed("fork");
+  if(pid == 0){
+    sh[PGSIZE/sizeof(int)] = 42;
+    if(pv[0] != 1)
+      failed("child private contents");
+    pv[0] = 2;
+    exit();
+  }
+  wait();
+  if(sh[PGSIZE/sizeof(int)] != 42)
+    failed("shared store not seen");
+  if(pv[0] != 1)
+    failed("private store seen");
+  if(munmap(sh, 2*PGSIZE) < 0 || munmap(pv, 2*PGSIZE) < 0)
+    failed("munmap anon");
+  printf(1, "anon ok\n");
+}
+
+// Anonymous pages of a mapping bigger than physical memory are
+// swapped out and read back in.
+void
+swapped(void)
+{
+  int *p, i, n;
+
+  n = 1024;  // 4MB, all of physical memory
+  p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(p == MAP_FAILED)
+    failed("mmap big");
+  for(i = 0; i < n; i++)
+    p[i*(PGSIZE/sizeof(int))] = i;
+  for(i = 0; i < n; i++)
+    if(p[i*(PGSIZE/sizeof(int))] != i)
+      failed("swapped contents");
+  if(munmap(p, n*PGSIZE) < 0)
+    failed("munmap big");
+  printf(1, "swapped ok\n");
+}
+
+// System calls refuse buffers the kernel could not fault in: a
+// read-only mapping to read into, or pages past the end of the
+// mapped file.
+void
+args(void)
+{
+  char *p;
+  int fd, pfd[2];
+
+  if((fd = open(name, O_RDONLY)) < 0)
+    failed("open");
+  p = mmap(0, (NPAGE+2)*PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED)
+    failed("mmap");
+  if(pipe(pfd) < 0)
+    failed("pipe");
+  if(read(fd, p, 10) != -1)
+    failed("read into read-only mapping");
+  if(write(pfd[1], p + NPAGE*PGSIZE, 1) != 1)
+    failed("write from last page of file");
+  if(write(pfd[1], p + (NPAGE+1)*PGSIZE, 1) != -1)
+    failed("write from past end of file");
+  close(pfd[0]);
+  close(pfd[1]);
+  close(fd);
+  munmap(p, (NPAGE+2)*PGSIZE);
+  printf(1, "args ok\n");
+}
+
+// A hole can be cut in a mapping, and touching it kills.
+void
+unmapped(void)
+{
+  char *p;
+  int pid;
+
+  p = mapfile(O_RDONLY, PROT_READ, MAP_PRIVATE);
+  if(munmap(p + PGSIZE, PGSIZE) < 0)
+    failed("munmap hole");
+  if(p[0] != 'a' || p[2*PGSIZE] != 'Z')
+    failed("contents around hole");
+  pid = fork();
+  if(pid < 0)
+    failed("fork");
+  if(pid == 0){
+    if(p[PGSIZE] == 'b')
+      printf(1, "read from hole\n");
+    exit();
+  }
+  wait();
+  pid = fork();
+  if(pid < 0)
+    failed("fork");
+  if(pid == 0){
+    p[0] = 'X';  // read-only
+    printf(1, "store to read-only mapping\n");
+    exit();
+  }
+  wait();
+  munmap(p, PGSIZE);
+  munmap(p + 2*PGSIZE, (NPAGE-1)*PGSIZE);
+  printf(1, "unmapped ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  private();
+  shared();
+  anon();
+  swapped();
+  args();
+  unmapped();
+  unlink(name);
+  printf(1, "Mmaptest Passed!\n");
+  exit();
+}
@@ -17,9 +17,10 @@
 #define SEG_UCODE 3  // user code
 #define SEG_UDATA 4  // user data+stack
 #define SEG_TSS   5  // this process's task state
+#define SEG_KCPU  6  // kernel per-cpu data, based at this cpu's struct cpu
 
 // cpu->gdt[NSEGS] holds the above segments.
-#define NSEGS     6
+#define NSEGS     7
 
 #ifndef __ASSEMBLER__
 // Segment Descriptor
@@ -96,7 +97,15 @@ struct segdesc {
 #define PTE_U           0x004   // User
 #define PTE_S           0x008   // Swap
 #define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_F           0x200   // Page cache page of a file mapping
+#define PTE_M           0x400   // Page of a mapping made by mmap()
+#define PTE_E           0x800   // Page read from the program file
+
+// Page fault error code bits
+#define FEC_WR          0x002   // Fault was caused by a write
+#define FEC_U           0x004   // Fault happened in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
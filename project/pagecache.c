@@ -0,0 +1,251 @@
+// Page cache.
+//
+// File data is cached a page at a time, keyed by (dev, inum, page
+// number), so that reading cached data is one copy from memory
+// rather than a trip through PGBLOCKS buffers. fs.c fills the pages
+// (see ipage()) and keeps them up to date: readi() reads through
+// the cache, and writei() writes the blocks as before and also
+// updates the cached page, if there is one. The inode's lock is held
+// while its pages are filled, read or written, so pages need no lock
+// of their own.
+//
+// A page's descriptor is found from its physical address, like the
+// rmap entries in pageswap.c. The cache takes pages only if they are
+// free anyway, up to 1/PCACHEFRAC of memory; beyond that it recycles
+// its least recently used unreferenced page, and takes more only if
+// every page is in use, as pages mapped by mmap() are. When kalloc()
+// runs out of pages it calls pcshrink() to take back an unreferenced
+// page before resorting to swapping. Cached pages are never dirty, so
+// taking one back costs nothing but a later read.
+//
+// pcache.lock protects the hash chains, the LRU list and the
+// descriptors.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NPCHASH 127
+#define PCACHEFRAC 8  // at most 1/PCACHEFRAC of memory from free pages
+
+struct page {
+  uint dev;
+  uint inum;          // 0 if the page is not in the cache
+  uint pgno;          // page number in the file
+  int ref;
+  struct page *hnext; // hash chain
+  struct page *lprev; // LRU list, while ref is 0 and inum is not
+  struct page *lnext;
+};
+
+extern char end[];  // first address after kernel loaded from ELF file
+
+static struct {
+  struct spinlock lock;
+  struct page *hash[NPCHASH];
+  struct page lru;          // least recently used first
+  struct page page[PHYSTOP/PGSIZE];
+  uint npage;               // Pages in the cache
+  uint maxpage;             // Limit on pages taken from the free list
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+  pcache.lru.lprev = pcache.lru.lnext = &pcache.lru;
+  pcache.maxpage = (PHYSTOP - V2P(end)) / PGSIZE / PCACHEFRAC;
+}
+
+static struct page*
+pdesc(char *pg)
+{
+  return &pcache.page[V2P(pg) / PGSIZE];
+}
+
+static char*
+paddr(struct page *p)
+{
+  return P2V((p - pcache.page) * PGSIZE);
+}
+
+static struct page**
+phash(uint dev, uint inum, uint pgno)
+{
+  return &pcache.hash[(dev*31 + inum*17 + pgno) % NPCHASH];
+}
+
+static struct page*
+pfind(uint dev, uint inum, uint pgno)
+{
+  struct page *p;
+
+  for(p = *phash(dev, inum, pgno); p; p = p->hnext)
+    if(p->inum == inum && p->pgno == pgno && p->dev == dev)
+      return p;
+  return 0;
+}
+
+static void
+punhash(struct page *p)
+{
+  struct page **pp;
+
+  for(pp = phash(p->dev, p->inum, p->pgno); *pp != p; pp = &(*pp)->hnext)
+    ;
+  *pp = p->hnext;
+  p->inum = 0;
+}
+
+static void
+lrudel(struct page *p)
+{
+  p->lnext->lprev = p->lprev;
+  p->lprev->lnext = p->lnext;
+}
+
+// Return page pgno of inode inum on dev with a reference,
+// or 0 if it is not cached.
+char*
+pclookup(uint dev, uint inum, uint pgno)
+{
+  struct page *p;
+
+  acquire(&pcache.lock);
+  if((p = pfind(dev, inum, pgno)) != 0 && p->ref++ == 0)
+    lrudel(p);
+  release(&pcache.lock);
+  return p ? paddr(p) : 0;
+}
+
+// Is page pgno of inode inum on dev cached?
+int
+pccached(uint dev, uint inum, uint pgno)
+{
+  int r;
+
+  acquire(&pcache.lock);
+  r = pfind(dev, inum, pgno) != 0;
+  release(&pcache.lock);
+  return r;
+}
+
+// Add page pgno of inode inum on dev to the cache, and return
+// it with a reference for the caller to fill. Returns 0 if no
+// page can be had without taking one from someone else.
+// The caller must hold the inode's lock, and must have
+// checked that the page is not cached.
+char*
+pcalloc(uint dev, uint inum, uint pgno)
+{
+  struct page *p, **pp;
+  char *pg;
+
+  acquire(&pcache.lock);
+  if((pcache.npage < pcache.maxpage || pcache.lru.lnext == &pcache.lru) &&
+     (pg = trykalloc()) != 0){
+    p = pdesc(pg);
+    pcache.npage++;
+  } else if((p = pcache.lru.lnext) != &pcache.lru){
+    lrudel(p);
+    punhash(p);
+  } else {
+    release(&pcache.lock);
+    return 0;
+  }
+  p->dev = dev;
+  p->inum = inum;
+  p->pgno = pgno;
+  p->ref = 1;
+  pp = phash(dev, inum, pgno);
+  p->hnext = *pp;
+  *pp = p;
+  release(&pcache.lock);
+  return paddr(p);
+}
+
+// Drop a reference to page pg. An unreferenced page stays
+// cached unless it was invalidated meanwhile.
+void
+pcput(char *pg)
+{
+  struct page *p = pdesc(pg);
+  int drop;
+
+  acquire(&pcache.lock);
+  if(p->ref <= 0)
+    panic("pcput");
+  drop = 0;
+  if(--p->ref == 0){
+    if(p->inum){
+      p->lnext = &pcache.lru;
+      p->lprev = pcache.lru.lprev;
+      pcache.lru.lprev->lnext = p;
+      pcache.lru.lprev = p;
+    } else {
+      pcache.npage--;
+      drop = 1;
+    }
+  }
+  release(&pcache.lock);
+  if(drop)
+    kfree(pg);
+}
+
+// Drop the cached pages of inode inum on dev, whose contents
+// are going away. Pages still referenced are freed by pcput().
+void
+pcinval(uint dev, uint inum)
+{
+  struct page *p, *n, **pp;
+  struct page *free;
+  int i;
+
+  free = 0;
+  acquire(&pcache.lock);
+  for(i = 0; i < NPCHASH; i++){
+    for(pp = &pcache.hash[i]; (p = *pp) != 0; ){
+      if(p->inum != inum || p->dev != dev){
+        pp = &p->hnext;
+        continue;
+      }
+      *pp = p->hnext;
+      p->inum = 0;
+      if(p->ref == 0){
+        lrudel(p);
+        pcache.npage--;
+        p->hnext = free;
+        free = p;
+      }
+    }
+  }
+  release(&pcache.lock);
+  for(p = free; p; p = n){
+    n = p->hnext;
+    kfree(paddr(p));
+  }
+}
+
+// Give the least recently used unreferenced page back to the page
+// allocator. Called by kalloc() when memory runs out; does not
+// sleep. Returns 1 if a page was freed.
+int
+pcshrink(void)
+{
+  struct page *p;
+
+  acquire(&pcache.lock);
+  if((p = pcache.lru.lnext) == &pcache.lru){
+    release(&pcache.lock);
+    return 0;
+  }
+  lrudel(p);
+  punhash(p);
+  pcache.npage--;
+  release(&pcache.lock);
+  kfree(paddr(p));
+  return 1;
+}
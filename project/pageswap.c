@@ -10,28 +10,45 @@
 #include "proc.h"
 #include "buf.h"
 
-#define NSLOTS SWAPBLOCKS/8
+#define NSLOTS NSWAPSLOT
 
 struct swap_slot ss[NSLOTS];
 
+// swaplock protects the swap slots, and the turning of PTEs into
+// swap entries and back. It is taken before the rmap locks.
+struct spinlock swaplock;
+
+
+// A page is mapped at most once by each process, and once more by
+// the program page cache (see textcache.c).
+#define NRMAP (NPROC+1)
 
 struct rmap{
   struct spinlock lock;
-  pte_t* pl[NPROC];
-  int free[NPROC];
+  pte_t* pl[NRMAP];
+  int free[NRMAP];
   int ref;
 };
 
 struct rmap allmap[PHYSTOP/PGSIZE];
 
+// Threads sharing a page table can fault on the same page at once.
+// page_fault() serializes faults on a shared page table with one of
+// these, chosen by page table, so only one thread resolves the fault.
+#define NFAULTLOCK 8
+struct sleeplock faultlock[NFAULTLOCK];
+
 
 // Initialize rmap 
 void init_rmap(void){
   uint sz= PHYSTOP/PGSIZE;
+  initlock(&swaplock, "swap");
+  for(int i=0; i<NFAULTLOCK; i++)
+    initsleeplock(&faultlock[i], "fault");
   for(uint i=0; i<sz; i++){
     initlock(&(allmap[i].lock), "rmap");
     (&allmap[i])->ref=0;
-    for(uint j=0; j<NPROC; j++){
+    for(uint j=0; j<NRMAP; j++){
       (&allmap[i])->free[j]=1;
     }
   }
@@ -46,10 +63,10 @@ void share_add(uint pa, pte_t* pte_child){
   acquire(&(cur->lock));
   cur->ref++;
   uint i;
-  for(i=0; i<NPROC; i++){
+  for(i=0; i<NRMAP; i++){
     if(cur->free[i]==1) break;
   }
-  if(i==NPROC){
+  if(i==NRMAP){
     panic("rmap filled");
   }
   cur->free[i]=0;
@@ -65,15 +82,16 @@ int share_remove(uint pa, pte_t* pte_proc) {
   struct rmap* cur = &allmap[index];
   acquire(&(cur->lock));
   uint i;
-  for(i=0; i<NPROC; i++){
+  for(i=0; i<NRMAP; i++){
     if(cur->pl[i]==pte_proc && cur->free[i]==0) break;
   }
-  if(i==NPROC) panic("Page table entry not found in rmap");
+  if(i==NRMAP) panic("Page table entry not found in rmap");
   cur->free[i]=1;
   cur->ref--;
   if(cur->ref==1){
-    for(uint j=0; j<NPROC; j++){
-      if(cur->free[j]==0){
+    for(uint j=0; j<NRMAP; j++){
+      // Pages of mappings keep their protection; see mmapfault().
+      if(cur->free[j]==0 && !(*(cur->pl[j]) & PTE_M)){
         *(cur->pl[j]) |= PTE_W;
       }
     }
@@ -83,38 +101,88 @@ int share_remove(uint pa, pte_t* pte_proc) {
 }
 
 
-// Make separate page for pte_t* trying to write shared page
-void share_split(uint pa, pte_t* pte_proc){
-  uint flag= PTE_FLAGS(*pte_proc);
-  flag |= PTE_W;
-  share_remove(pa,pte_proc);
+// Give pte, which maps a page read-only because it is shared
+// copy-on-write, a writable copy of its own. The copy is allocated
+// and made while pte still holds the shared page, so that kalloc()
+// cannot free it meanwhile through tcshrink(). Does nothing if pte
+// changed before swaplock was taken; the fault is then taken again.
+void share_split(pte_t* pte_proc){
   char* mem= kalloc();
+  pte_t old;
+  uint pa;
+  acquire(&swaplock);
+  old= *pte_proc;
+  if((old & (PTE_P|PTE_W)) != PTE_P){
+    release(&swaplock);
+    kfree(mem);
+    return;
+  }
+  pa= PTE_ADDR(old);
   memmove(mem,(char*)P2V(pa),PGSIZE);
-  *pte_proc = PTE_ADDR(V2P(mem)) | flag;
+  if(share_remove(pa,pte_proc) == 0){
+    // Nobody else maps it any more; keep it.
+    *pte_proc |= PTE_W;
+    share_add(pa,pte_proc);
+    release(&swaplock);
+    kfree(mem);
+    return;
+  }
+  *pte_proc = V2P(mem) | PTE_FLAGS(old) | PTE_W;
   share_add(V2P(mem),pte_proc);
+  release(&swaplock);
 }
 
 
-// Add physical page with address pa in swap slot
-void add_swap(uint pa, uint new_add, uint slot){
-  uint z = pa/PGSIZE;
-  struct rmap* cur = &allmap[z];
+// Turn the PTEs mapping physical page pa, one of which must be
+// pte, into swap entries for slot. Each PTE is swapped atomically,
+// so a store that the hardware has not yet marked in it cannot slip
+// in after. If every PTE was a clean program page, the page need
+// not be written, since execfault() can read it again: the entries
+// are cleared instead, and the slot is left unused. Returns 1 if the
+// page must be written to slot, 2 if it was dropped, and 0 if pte no
+// longer maps pa, the program page cache holds it, or it is being
+// unmapped.
+int swap_out(uint pa, pte_t* pte, uint slot){
+  struct rmap* cur = &allmap[pa/PGSIZE];
+  uint i, old, index=0;
+  int found=0, held=0, dirty=0, r=0;
+  acquire(&swaplock);
   acquire(&(cur->lock));
-  uint index=0;
-  for(uint i=0; i<NPROC; i++){
+  for(i=0; i<NRMAP; i++){
     if(cur->free[i]==0){
-      ss[slot].page_perm= PTE_FLAGS(*(cur->pl[i]));
-      cur->ref--;
-      cur->free[i]=1;
-      *(cur->pl[i])= new_add;
-      ss[slot].pl[index]=cur->pl[i];
-      ss[slot].present[index]=1;
-      index++;
+      if(cur->pl[i]==pte) found=1;
+      // unmappages() may have made a PTE not present, to let
+      // go of the page once every cpu has stopped using it.
+      if(tcheld(cur->pl[i]) || !(*(cur->pl[i]) & PTE_P)) held=1;
+    }
+  }
+  if(found && !held){
+    for(i=0; i<NRMAP; i++){
+      if(cur->free[i]==0){
+        old= xchg(cur->pl[i], (slot << 12) | PTE_S);
+        if((old & (PTE_E|PTE_D)) != PTE_E) dirty=1;
+        ss[slot].page_perm= PTE_FLAGS(old);
+        cur->free[i]=1;
+        ss[slot].pl[index]=cur->pl[i];
+        ss[slot].present[index]=1;
+        index++;
+      }
+    }
+    cur->ref=0;
+    r=1;
+    if(!dirty){
+      for(i=0; i<index; i++){
+        *(ss[slot].pl[i]) = 0;
+        ss[slot].present[i]=0;
+      }
+      index=0;
+      r=2;
     }
   }
   ss[slot].num=index;
-  if(cur->ref!=0) panic("Reference count should be 0");
   release(&(cur->lock));
+  release(&swaplock);
+  return r;
 }
 
 
@@ -122,6 +190,7 @@ void add_swap(uint pa, uint new_add, uint slot){
 void init_slot(){
   for(int i = 0; i<NSLOTS; i++){
     ss[i].is_free = 1;
+    ss[i].busy = 0;
     ss[i].num= 0;
     for(int j=0; j<NPROC; j++){
       ss[i].present[j]=0;
@@ -130,41 +199,73 @@ void init_slot(){
 }
 
 
-// Return page table entry pointing to victim page
+// Can the page at va in pgdir be swapped out? It must be a present
+// user page not recently used through any PTE mapping it. count
+// counts the pages passed over for being used. Page cache pages of
+// file mappings, and pages held by the program page cache, are
+// given back by those caches instead.
+static pte_t* victim_pte(pde_t* pgdir, uint va, int* count){
+  pte_t* pte = walkpgdir(pgdir, (void*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_F)) != (PTE_P|PTE_U))
+    return 0;
+  if(*pte & PTE_A){
+    (*count)++;
+    return 0;
+  }
+  struct rmap* cur= &allmap[PTE_ADDR(*pte)/PGSIZE];
+  acquire(&(cur->lock));
+  for(uint j=0; j<NRMAP; j++){
+    if(cur->free[j]==0 &&
+       ((*(cur->pl[j]) & PTE_A) || tcheld(cur->pl[j]))){
+      release(&(cur->lock));
+      (*count)++;
+      return 0;
+    }
+  }
+  release(&(cur->lock));
+  return pte;
+}
+
+
+// Return page table entry pointing to victim page, from the heap
+// or from an anonymous page of a mapping. Returns inside
+// rcu_read_lock(), so that the page table holding the entry stays
+// allocated; the caller calls rcu_read_unlock() when done with it.
 pte_t* victim_page(){
+  struct vma *v, *vma;
+  pte_t* pte;
+  uint a, start, end;
   while(1){
+    rcu_read_lock();
     struct proc *p = victim_proc();
+    pde_t *pgdir = p->pgdir;
     int count = 0;
-    for(int i = 0; i < p->sz; i+=PGSIZE){
-      pte_t* pte = walkpgdir(p->pgdir, (void*)i, 0);
-      if(*pte & PTE_P){
-        if(!(*pte & PTE_A)){
-          int found=1;
-          int ind= PTE_ADDR(*pte)/PGSIZE;
-          struct rmap* cur= &allmap[ind];
-          acquire(&(cur->lock));
-          for(uint j=0; j<NPROC; j++){
-            if(cur->free[j]==0){
-              if(*(cur->pl[j]) & PTE_A){
-                found=0; break;
-              }
-            }
-          }
-          release(&(cur->lock));
-          if(found){
-            change_rss(PTE_ADDR(*pte),-1);
-            return pte;
-          } 
-          else count++;
-          // change_rss(PTE_ADDR(*pte),-1);
-          // return pte;
-        }
-        else{
-          count++;
-        }
+    if(pgdir == 0){
+      // Reaped since victim_proc() looked at it.
+      rcu_read_unlock();
+      continue;
+    }
+    for(a = 0; a < p->sz; a+=PGSIZE){
+      if((pte = victim_pte(pgdir, a, &count)) != 0){
+        change_rss(PTE_ADDR(*pte),-1);
+        return pte;
+      }
+    }
+    // The mappings are read without lockfaults(); a stale bound
+    // only means looking at the wrong pages.
+    vma = vmatable(p);
+    for(v = vma; v < &vma[NVMA]; v++){
+      start = v->start;
+      end = v->end;
+      if(start == 0 || end > KERNBASE)
+        continue;
+      for(a = start; a < end; a+=PGSIZE){
+        if((pte = victim_pte(pgdir, a, &count)) != 0)
+          return pte;
       }
     }
-    unset_access(p->pgdir,count);
+    unset_access(pgdir,count);
+    rcu_read_unlock();
   }
   return 0;
 }
@@ -173,16 +274,16 @@ pte_t* victim_page(){
 // Unset 10% access bits of process with page directory p
 void unset_access(pde_t* p, int count){
   int z = (count+9)/10;
-  int i=0;
-  while(z){
+  uint i=0;
+  while(z && i < KERNBASE){
     pte_t* pte = walkpgdir(p, (void*)i, 0);
-    if(*pte & PTE_P){
+    if(pte && (*pte & (PTE_P|PTE_U)) == (PTE_P|PTE_U)){
       if(*pte & PTE_A){
         // *pte &= ~PTE_A;
         uint ind= PTE_ADDR(*pte)/PGSIZE;
         struct rmap* cur= &allmap[ind];
         acquire(&(cur->lock));
-        for(uint i=0; i<NPROC; i++){
+        for(uint i=0; i<NRMAP; i++){
           if(cur->free[i]==0){
             *(cur->pl[i]) &= ~PTE_A;
           }
@@ -196,29 +297,69 @@ void unset_access(pde_t* p, int count){
 }
 
 
-// Move page into swap slot to free memory
+// Number of mappings of physical page pa.
+int share_count(uint pa){
+  struct rmap* cur = &allmap[pa/PGSIZE];
+  int ref;
+  acquire(&(cur->lock));
+  ref = cur->ref;
+  release(&(cur->lock));
+  return ref;
+}
+
+
+// Move page into swap slot to free memory. The page's PTEs become
+// swap entries, and every cpu's TLB is flushed, before the page is
+// written out, so that no store is lost. Faults on the slot wait
+// until the write is done; see swapin(). A clean program page is
+// dropped instead.
 void allocate_page(){
   pte_t* pte = victim_page();
-  uint slot = NSLOTS;
+  uint slot;
+  pte_t old = *pte;
+  char* page = (char*)P2V(PTE_ADDR(old));
+  if(!(old & PTE_P)){
+    rcu_read_unlock();
+    return;  // changed under us; kalloc() tries again
+  }
+  acquire(&swaplock);
   for(slot=0; slot<NSLOTS; slot++){
-      if(ss[slot].is_free) break;
+      if(ss[slot].is_free && !ss[slot].busy) break;
   }
   if(slot == NSLOTS){
       panic("Slots filled");
   }
-  char* page = (char*)P2V(PTE_ADDR(*pte));   
-  write_page(page,2+8*slot);
   ss[slot].is_free = 0;
-  ss[slot].page_perm = PTE_FLAGS(*pte);
-  uint new_add= (slot << 12) | PTE_S;
-  add_swap(PTE_ADDR(*pte),new_add,slot);
+  ss[slot].busy = 1;
+  release(&swaplock);
+  int r = swap_out(V2P(page),pte,slot);
+  rcu_read_unlock();
+  if(r != 1){
+    acquire(&swaplock);
+    ss[slot].is_free = 1;
+    ss[slot].busy = 0;
+    wakeup(&ss[slot]);
+    release(&swaplock);
+    if(r == 2){
+      tlbshootdown(0);  // the page may be mapped on any cpu
+      kfree(page);
+    }
+    return;
+  }
+  tlbshootdown(0);  // the page may be mapped on any cpu
+  write_page(page,2+PGBLOCKS*slot);
+  acquire(&swaplock);
+  ss[slot].busy = 0;
+  wakeup(&ss[slot]);
+  release(&swaplock);
   kfree(page);
   return;
 }
 
 
-// Remove pte from list of page table entries in swap slot 
-void remove_swap(uint slot, pte_t* pte){
+// Remove pte from list of page table entries in swap slot.
+// Caller must hold swaplock.
+static void remove_swap(uint slot, pte_t* pte){
   if(ss[slot].is_free) panic("slot is free");
   uint i;
   for(i=0; i<NPROC; i++){
@@ -235,6 +376,7 @@ void remove_swap(uint slot, pte_t* pte){
 
 // Clean pointers of process with page directory pde in swap space
 void clean_swap(pde_t* pde){
+  acquire(&swaplock);
   for(int i = 0; i < NPDENTRIES; i++){
     if(pde[i] & PTE_P){
       pte_t* pte= (pte_t*)P2V(PTE_ADDR(pde[i]));
@@ -242,62 +384,192 @@ void clean_swap(pde_t* pde){
         if(pte[j] & PTE_S){
           uint slot= PTE_ADDR(pte[j]) >> 12;
           remove_swap(slot,&pte[j]);
+          pte[j] = 0;
         }
       }
     }
   }
+  release(&swaplock);
 }
 
 
-// Transfer page in swap slot to memory with new physical page address pa
-void recover_swap(uint pa, uint slot){
-  if(ss[slot].is_free) panic("slot is empty");
+// Transfer page in swap slot to memory with new physical page address pa.
+// Caller must hold swaplock. Returns the number of PTEs now mapping
+// the page, which is 0 if all of them went away meanwhile.
+static int recover_swap(uint pa, uint slot){
+  int n=0;
   for(int i=0; i<NPROC; i++){
     if(ss[slot].present[i]==1){
       *(ss[slot].pl[i])= pa;
       ss[slot].num--;
       ss[slot].present[i]=0;
       share_add(pa,ss[slot].pl[i]);
+      n++;
     }
   }
   if(ss[slot].num!=0) panic("present list and num are inconsistend");
   ss[slot].is_free=1;
+  return n;
+}
+
+
+// Read the page that swap entry *pte refers to back in, for every
+// PTE sharing its slot. Waits while the slot is being written out,
+// or read in for another PTE. Returns the page, or 0 if *pte is no
+// longer a swap entry.
+static char* swapin(pte_t* pte){
+  uint slot;
+  char* page;
+  acquire(&swaplock);
+  for(;;){
+    if(!(*pte & PTE_S)){
+      release(&swaplock);
+      return 0;
+    }
+    slot = *pte >> 12;
+    if(!ss[slot].busy) break;
+    sleep(&ss[slot], &swaplock);
+  }
+  ss[slot].busy = 1;
+  release(&swaplock);
+  page = kalloc();
+  read_page(page, PGBLOCKS*slot+2);
+  acquire(&swaplock);
+  ss[slot].busy = 0;
+  wakeup(&ss[slot]);
+  if(recover_swap(V2P(page) | ss[slot].page_perm | PTE_A, slot) == 0){
+    release(&swaplock);
+    kfree(page);
+    return 0;
+  }
+  release(&swaplock);
+  return page;
+}
+
+
+// Clear user PTE pte, letting go of the page or the swap slot it
+// refers to. The PTE may have been made not present already, as
+// unmappages() does. Returns 1 if it mapped a page.
+int unmap_page(pte_t* pte){
+  pte_t old;
+  uint pa;
+  int left;
+  acquire(&swaplock);
+  old = *pte;
+  if(old & PTE_S){
+    remove_swap(old >> 12, pte);
+    *pte = 0;
+    release(&swaplock);
+    return 0;
+  }
+  if(PTE_ADDR(old) == 0){
+    release(&swaplock);
+    return 0;
+  }
+  pa = PTE_ADDR(old);
+  left = share_remove(pa, pte);
+  *pte = 0;
+  release(&swaplock);
+  if(left == 0)
+    kfree(P2V(pa));
+  return 1;
 }
 
 
-// Either page is in swap space or it does not have write permissions
-void page_fault(){
+// Make child PTE cpte map the page that user PTE pte maps, as
+// fork() does, reading it back in first if it is swapped out. Both
+// map it read-only if cow is set. Returns 0 if pte maps nothing.
+int share_fork(pte_t* pte, pte_t* cpte, int cow){
+  for(;;){
+    acquire(&swaplock);
+    if(*pte & PTE_P)
+      break;
+    release(&swaplock);
+    if(!(*pte & PTE_S))
+      return 0;
+    swapin(pte);
+  }
+  if(cow)
+    *pte &= ~PTE_W;
+  *cpte = *pte;
+  share_add(PTE_ADDR(*pte), cpte);
+  release(&swaplock);
+  return 1;
+}
+
+
+// Serialize page faults on p's page table, and changes to the
+// mappings in it, with the threads sharing it. Returns the lock
+// to pass to unlockfaults(), or 0 if p has the table to itself.
+struct sleeplock*
+lockfaults(struct proc *p)
+{
+  struct sleeplock *lk;
+
+  if(!vmshared(p))
+    return 0;
+  lk = &faultlock[(V2P(p->pgdir) >> PTXSHIFT) % NFAULTLOCK];
+  acquiresleep(lk);
+  return lk;
+}
+
+void
+unlockfaults(struct sleeplock *lk)
+{
+  if(lk)
+    releasesleep(lk);
+}
+
+// Either page is in swap space or it does not have write permissions,
+// or it is a program page not read in yet, or va lies in a mapping
+// above p->sz. err is the fault's error code.
+// Returns -1 if va is not a user address that can be faulted in.
+int page_fault(uint err){
   uint va = rcr2();
   struct proc *p = myproc();
+  struct sleeplock *lk;
+  int r;
+  if(p == 0 || va >= KERNBASE) return -1;
   pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+  if(va >= p->sz && (pte == 0 || !(*pte & PTE_S))){
+    lk = lockfaults(p);
+    r = mmapfault(p, va, err & FEC_WR);
+    if(r < 0 && !(err & FEC_U))
+      r = mmapdead(p, va);
+    unlockfaults(lk);
+    return r;
+  }
+  if(pte == 0 || *pte == 0){
+    // Program page not read in yet, or dropped since.
+    lk = lockfaults(p);
+    r = execfault(p, va);
+    unlockfaults(lk);
+    return r;
+  }
+  if(!(*pte & (PTE_P|PTE_S)) || ((*pte & PTE_P) && !(*pte & PTE_U)))
+    return -1;
+  lk = lockfaults(p);
   if(*pte & PTE_S){
-    uint slot = *pte >> 12;
-    char* page = kalloc();
-    read_page(page, 8*slot+2);
-    uint perm = ss[slot].page_perm;
-    uint new_add= V2P(page) | perm | PTE_A;
-    recover_swap(new_add,slot);
-    change_rss(V2P(page),1);
+    char* page = swapin(pte);
+    if(page)
+      change_rss(V2P(page),1);
     // lcr3(V2P(p->pgdir));
   }
   else if(!(*pte & PTE_W)){
-    uint pa= PTE_ADDR(*pte);
-    share_split(pa,pte);
-    lcr3(V2P(p->pgdir));
+    share_split(pte);
+    tlbshootdown(p->pgdir);
   }
   else{
-    panic("page fault cannot be handled");
+    // Another thread got here first; drop our stale translation.
+    lcr3(V2P(p->pgdir));
   }
+  unlockfaults(lk);
+  return 0;
 }
 
 void page_fault_swap(pte_t* pte){
   if(*pte & PTE_S){
-    uint slot = *pte >> 12;
-    char* page = kalloc();
-    read_page(page, 8*slot+2);
-    uint perm = ss[slot].page_perm;
-    uint new_add= V2P(page) | perm | PTE_A;
-    recover_swap(new_add,slot);
+    swapin(pte);
     // change_rss(V2P(page),1);
     // lcr3(V2P(p->pgdir));
   }
@@ -308,10 +580,13 @@ void page_fault_swap(pte_t* pte){
 
 // Update rss value of process using physical page with address pa
 void change_rss(uint pa, int d){
+  rcu_read_lock();
   for(int z=0; z<NPROC; z++){
     if(is_proc(z)){
       struct proc* p= get_proc(z);
       pde_t* pde= p->pgdir;
+      if(pde == 0)
+        continue;
       for(int i = 0; i < NPDENTRIES; i++){
         if(pde[i] & PTE_P){
           pte_t* pte= (pte_t*)P2V(PTE_ADDR(pde[i]));
@@ -324,4 +599,5 @@ void change_rss(uint pa, int d){
       }
     }
   }
+  rcu_read_unlock();
 }
@@ -0,0 +1,74 @@
+// PCI configuration space, through configuration mechanism #1:
+// write the address of a register to port 0xCF8, then read or
+// write the register at port 0xCFC.
+//
+// Drivers find their device with pcifind() and turn on what
+// they need in its command register themselves.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define CONFADDR  0xCF8
+#define CONFDATA  0xCFC
+#define NBUS      8
+
+static uint
+confread(uint bus, uint dev, uint func, int off)
+{
+  outl(CONFADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (off & 0xFC));
+  return inl(CONFDATA);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+  return confread(d->bus, d->dev, d->func, off);
+}
+
+void
+pciwrite(struct pcidev *d, int off, uint v)
+{
+  outl(CONFADDR, 0x80000000 | d->bus<<16 | d->dev<<11 | d->func<<8 |
+       (off & 0xFC));
+  outl(CONFDATA, v);
+}
+
+// Find the first PCI function with the given device/vendor id
+// and class/subclass, either of which may be PCI_ANY, and fill
+// in d. Returns 0 if there is none.
+int
+pcifind(uint id, uint class, struct pcidev *d)
+{
+  uint bus, dev, func, nfunc, v;
+  int i;
+
+  for(bus = 0; bus < NBUS; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        v = confread(bus, dev, func, PCI_ID);
+        if((v & 0xFFFF) == 0xFFFF)
+          continue;
+        if(func == 0 && (confread(bus, dev, 0, PCI_HDR) & 0x800000))
+          nfunc = 8;  // multi-function device
+        if(id != PCI_ANY && v != id)
+          continue;
+        if(class != PCI_ANY &&
+           confread(bus, dev, func, PCI_CLASS) >> 16 != class)
+          continue;
+        d->bus = bus;
+        d->dev = dev;
+        d->func = func;
+        d->id = v;
+        d->class = confread(bus, dev, func, PCI_CLASS) >> 16;
+        for(i = 0; i < 6; i++)
+          d->bar[i] = confread(bus, dev, func, PCI_BAR0 + 4*i);
+        d->irq = confread(bus, dev, func, PCI_INTR) & 0xFF;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
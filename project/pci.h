@@ -0,0 +1,25 @@
+// PCI configuration space.
+
+#define PCI_ID        0x00  // Device ID << 16 | Vendor ID
+#define PCI_CMD       0x04  // Status << 16 | Command
+#define PCI_CLASS     0x08  // Class, subclass, prog IF, revision
+#define PCI_HDR       0x0C  // Header type in bits 16-23
+#define PCI_BAR0      0x10  // Base address registers, 6 of them
+#define PCI_INTR      0x3C  // Interrupt line in bits 0-7
+
+#define PCI_CMD_IO      0x1  // Respond to I/O space accesses
+#define PCI_CMD_MEM     0x2  // Respond to memory space accesses
+#define PCI_CMD_MASTER  0x4  // Bus mastering
+
+#define PCI_ANY       0xFFFFFFFF
+
+// A function on a PCI bus.
+struct pcidev {
+  uint bus;
+  uint dev;
+  uint func;
+  uint id;       // Device ID << 16 | Vendor ID
+  uint class;    // Class << 8 | subclass
+  uint bar[6];
+  uint irq;
+};
@@ -6,6 +6,7 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 
 struct {
   struct spinlock lock;
@@ -14,6 +15,11 @@ struct {
 
 static struct proc *initproc;
 
+// Serializes growproc() in processes with several threads.
+static struct sleeplock vmlock;
+
+DEFINE_PERCPU(cpustat);
+
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
@@ -24,44 +30,38 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  initsleeplock(&vmlock, "vm");
 }
 
 // Must be called with interrupts disabled
 int
 cpuid() {
-  return mycpu()-cpus;
+  return mycpu()->id;
 }
 
 // Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// rescheduled onto another cpu while using the result.
 struct cpu*
 mycpu(void)
 {
-  int apicid, i;
-  
+  struct cpu *c;
+
   if(readeflags()&FL_IF)
     panic("mycpu called with interrupts enabled\n");
-  
-  apicid = lapicid();
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid)
-      return &cpus[i];
-  }
-  panic("unknown apicid\n");
+
+  asm volatile("movl %%gs:%c1, %0" : "=r" (c)
+               : "i" (__builtin_offsetof(struct cpu, self)));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// A process is the current proc of whichever cpu it runs on,
+// so a single load needs no protection against rescheduling.
 struct proc*
 myproc(void) {
-  struct cpu *c;
   struct proc *p;
-  pushcli();
-  c = mycpu();
-  p = c->proc;
-  popcli();
+
+  asm volatile("movl %%gs:%c1, %0" : "=r" (p)
+               : "i" (__builtin_offsetof(struct cpu, proc)));
   return p;
 }
 
@@ -88,6 +88,9 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->leader = 0;
+  p->nthreads = 0;
+  p->ustack = 0;
 
   release(&ptable.lock);
 
@@ -153,25 +156,92 @@ userinit(void)
   release(&ptable.lock);
 }
 
+static void
+kthreadstart(void (*fn)(void))
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  fn();
+  panic("kthread returned");
+}
+
+// Start a kernel thread running fn, which must not return.
+// It has no user memory and never enters user space.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+  char *sp;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory?");
+
+  // Redo the context to start at kthreadstart(fn).
+  sp = (char*)p->tf;
+  sp -= 4;
+  *(uint*)sp = (uint)fn;
+  sp -= 4;
+  *(uint*)sp = 0;  // fake return PC
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+  p->context->eip = (uint)kthreadstart;
+  p->rss = 0;  // nothing for victim_proc() to swap out
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p->pid;
+}
+
 // Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Threads sharing the page table see the new size too.
+// Returns the old size on success, -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
-  struct proc *curproc = myproc();
-
-  sz = curproc->sz;
+  uint sz, oldsz;
+  struct proc *p, *curproc = myproc();
+  struct sleeplock *lk;
+  int shared;
+
+  shared = vmshared(curproc);
+  if(shared)
+    acquiresleep(&vmlock);
+  lk = lockfaults(curproc);  // keep mmap() out of the new heap
+  oldsz = sz = curproc->sz;
   if(n > 0){
+    if(mmapbusy(curproc, PGROUNDUP(sz), PGROUNDUP(sz + n) - PGROUNDUP(sz)))
+      goto bad;
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
+      goto bad;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
+      goto bad;
   }
   curproc->sz = sz;
+  unlockfaults(lk);
+  if(shared){
+    acquire(&ptable.lock);
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+      if(p->pgdir == curproc->pgdir)
+        p->sz = sz;
+    release(&ptable.lock);
+    if(n < 0)
+      tlbshootdown(curproc->pgdir);
+    releasesleep(&vmlock);
+  }
   switchuvm(curproc);
-  return 0;
+  return oldsz;
+
+bad:
+  unlockfaults(lk);
+  if(shared)
+    releasesleep(&vmlock);
+  return -1;
 }
 
 // Create a new process copying p as the parent.
@@ -197,6 +267,24 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
+  if((np->exe = image(curproc)->exe) != 0)
+    idup(np->exe);
+  memmove(np->seg, image(curproc)->seg, sizeof(np->seg));
+  if(mmapfork(curproc, np) < 0){
+    munmapall(np);
+    freevm(np->pgdir);
+    np->pgdir = 0;
+    if(np->exe){
+      begin_op();
+      iput(np->exe);
+      end_op();
+      np->exe = 0;
+    }
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
   np->parent = curproc;
   *np->tf = *curproc->tf;
 
@@ -204,8 +292,8 @@ fork(void)
   np->tf->eax = 0;
 
   for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
+    if(fdtable(curproc)[i])
+      np->ofile[i] = filedup(fdtable(curproc)[i]);
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
@@ -221,6 +309,97 @@ fork(void)
   return pid;
 }
 
+// Create a thread that shares the current process's page table,
+// size and open files, and starts running fcn(arg) on the one-page
+// user stack at stack. The thread ends by calling exit().
+// Returns the new thread's pid, or -1.
+int
+clone(void (*fcn)(void*), void *arg, void *stack)
+{
+  struct proc *np, *leader;
+  struct proc *curproc = myproc();
+  uint sp;
+
+  sp = (uint)stack + PGSIZE;
+  if(sp < (uint)stack || sp > curproc->sz)
+    return -1;
+
+  // Fake return PC, then the argument. Written through the user
+  // mapping so that a COW or swapped stack page faults in normally.
+  sp -= 2*sizeof(uint);
+  ((uint*)sp)[0] = 0xffffffff;
+  ((uint*)sp)[1] = (uint)arg;
+
+  if((np = allocproc()) == 0)
+    return -1;
+
+  leader = curproc->leader ? curproc->leader : curproc;
+  np->pgdir = curproc->pgdir;
+  np->sz = curproc->sz;
+  np->parent = curproc;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eax = 0;
+  np->tf->eip = (uint)fcn;
+  np->tf->esp = sp;
+  np->cwd = idup(curproc->cwd);
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  acquire(&ptable.lock);
+  np->leader = leader;
+  leader->nthreads++;
+  np->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return np->pid;
+}
+
+// Release a zombie thread's slot. Its page table and files
+// belong to the leader. Caller must hold ptable.lock.
+static void
+freethread(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  p->pgdir = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->leader->nthreads--;
+  p->leader = 0;
+  p->state = UNUSED;
+}
+
+// Kill the threads of leader and wait for them to exit.
+static void
+killthreads(struct proc *leader)
+{
+  struct proc *p;
+  int live;
+
+  acquire(&ptable.lock);
+  for(;;){
+    live = 0;
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p->leader != leader)
+        continue;
+      if(p->state == ZOMBIE){
+        freethread(p);
+        continue;
+      }
+      live = 1;
+      p->killed = 1;
+      if(p->state == SLEEPING)
+        p->state = RUNNABLE;
+    }
+    if(!live)
+      break;
+    sleep(leader, &ptable.lock);
+  }
+  release(&ptable.lock);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -234,8 +413,17 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  // The process ends with its last thread: make the others exit,
+  // and reap them, before releasing what they share.
+  if(curproc->nthreads > 0)
+    killthreads(curproc);
+
+  // Remove memory mappings, writing back shared file pages.
+  if(curproc->leader == 0)
+    munmapall(curproc);
+
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < NOFILE && curproc->leader == 0; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
@@ -244,20 +432,26 @@ exit(void)
 
   begin_op();
   iput(curproc->cwd);
+  if(curproc->exe)
+    iput(curproc->exe);
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
-  // Parent might be sleeping in wait().
+  // Parent might be sleeping in wait() or join(),
+  // and the leader in killthreads().
   wakeup1(curproc->parent);
+  if(curproc->leader)
+    wakeup1(curproc->leader);
 
-  // Pass abandoned children to init.
+  // Pass abandoned threads to the leader and other children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
-      p->parent = initproc;
+      p->parent = p->leader ? p->leader : initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup1(p->parent);
     }
   }
 
@@ -274,6 +468,8 @@ wait(void)
 {
   struct proc *p;
   int havekids, pid;
+  char *kstack;
+  pde_t *pgdir;
   struct proc *curproc = myproc();
   
   acquire(&ptable.lock);
@@ -281,22 +477,28 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || p->leader)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
         clean_swap(p->pgdir);
         pid = p->pid;
-        kfree(p->kstack);
+        kstack = p->kstack;
+        pgdir = p->pgdir;
         p->kstack = 0;
-        freevm(p->pgdir);
+        p->pgdir = 0;
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
         p->state = UNUSED;
         release(&ptable.lock);
+        kfree(kstack);
+        // Lockless readers of the process table may still be
+        // walking the page table itself.
+        deallocuvm(pgdir, KERNBASE, 0);
+        call_rcu((void(*)(void*))freepgdir, pgdir);
         return pid;
       }
     }
@@ -312,6 +514,43 @@ wait(void)
   }
 }
 
+// Wait for a thread created by this one with clone() to exit.
+// Stores the thread's user stack in *stack and returns its pid.
+// Return -1 if this thread has no such threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  int havekids, pid;
+  void *ustack;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    havekids = 0;
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p->parent != curproc || p->leader == 0)
+        continue;
+      havekids = 1;
+      if(p->state == ZOMBIE){
+        pid = p->pid;
+        ustack = p->ustack;
+        freethread(p);
+        release(&ptable.lock);
+        *stack = ustack;
+        return pid;
+      }
+    }
+
+    if(!havekids || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+
+    sleep(curproc, &ptable.lock);
+  }
+}
+
 //Print the resident size of all the current procs 
 void print_rss()
 {
@@ -348,6 +587,7 @@ scheduler(void)
 
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
+    rcu_quiescent();
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
       if(p->state != RUNNABLE)
         continue;
@@ -358,6 +598,7 @@ scheduler(void)
       c->proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      thiscpu(cpustat).switches++;
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
@@ -367,7 +608,7 @@ scheduler(void)
       c->proc = 0;
     }
     release(&ptable.lock);
-
+    rcu_poll();
   }
 }
 
@@ -423,6 +664,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    initalloc(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -497,18 +739,24 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
+  // Find the slot without the lock, then make sure it still holds
+  // pid once locked. Pids are never reused, so if it does not,
+  // the process has already been reaped.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+    if(p->pid != pid || p->state == UNUSED)
+      continue;
+    acquire(&ptable.lock);
+    if(p->pid != pid || p->state == UNUSED){
       release(&ptable.lock);
-      return 0;
+      return -1;
     }
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      p->state = RUNNABLE;
+    release(&ptable.lock);
+    return 0;
   }
-  release(&ptable.lock);
   return -1;
 }
 
@@ -547,16 +795,22 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: %d syscalls %d intrs %d faults %d switches\n", i,
+            percpu(cpustat, i).syscalls, percpu(cpustat, i).intrs,
+            percpu(cpustat, i).pgfaults, percpu(cpustat, i).switches);
 }
 
+// Pick the process with the largest resident set.
+// Scans without ptable.lock; caller must be inside
+// rcu_read_lock() while it uses the result.
 struct proc * victim_proc(){
     struct proc *p;
     uint max_rss = 0;
     struct proc *victim_proc=0;
     int first=0;
-    acquire(&ptable.lock);
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->state==UNUSED) continue;
+        if(p->state==UNUSED || p->state==EMBRYO || p->pgdir==0) continue;
         if(!first){
           first=1; victim_proc=p;
         }
@@ -565,13 +819,14 @@ struct proc * victim_proc(){
             max_rss = p->rss;
         }
     }
-    release(&ptable.lock);
     if(!first){
       panic("All Processes are UNUSED");
     }
     return victim_proc;
 }
 
+// Lockless accessors for the process table;
+// callers must be inside rcu_read_lock().
 int is_proc(int i){
   struct proc* p= &ptable.proc[i];
   if(p->state == UNUSED) return 0;
@@ -581,3 +836,68 @@ int is_proc(int i){
 struct proc* get_proc(int i){
   return &ptable.proc[i];
 }
+
+// Whether p's page table is shared with other threads.
+int
+vmshared(struct proc *p)
+{
+  return p->leader != 0 || p->nthreads > 0;
+}
+
+// Futexes. futexwait() sleeps only if the word at user address addr
+// still holds val, and futexwake() wakes up to n threads of the same
+// process sleeping on addr. User addresses lie below KERNBASE, so
+// they never collide with the kernel's sleep channels. Holding
+// ptable.lock across the check and the sleep means a wakeup cannot
+// be missed; the word is read through the kernel mapping of its page,
+// because taking a page fault with ptable.lock held is not allowed.
+int
+futexwait(uint addr, int val)
+{
+  struct proc *curproc = myproc();
+  pte_t *pte;
+  int cur;
+
+  if(addr % sizeof(int))
+    return -1;
+  for(;;){
+    if(fetchint(addr, &cur) < 0)  // fault the page in
+      return -1;
+    if(cur != val)
+      return -1;
+    acquire(&ptable.lock);
+    pte = walkpgdir(curproc->pgdir, (void*)addr, 0);
+    if(pte && (*pte & PTE_P))
+      break;
+    release(&ptable.lock);  // swapped out again
+  }
+  cur = *(int*)(P2V(PTE_ADDR(*pte)) + (addr & (PGSIZE-1)));
+  if(cur != val){
+    release(&ptable.lock);
+    return -1;
+  }
+  sleep((void*)addr, &ptable.lock);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Returns the number of threads woken.
+int
+futexwake(uint addr, int n)
+{
+  struct proc *p;
+  struct proc *curproc = myproc();
+  int woken;
+
+  woken = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && woken < n; p++){
+    if(p->state == SLEEPING && p->chan == (void*)addr &&
+       p->pgdir == curproc->pgdir){
+      p->state = RUNNABLE;
+      woken++;
+    }
+  }
+  release(&ptable.lock);
+  return woken;
+}
@@ -1,5 +1,9 @@
 // Per-CPU state
+// %gs holds a segment based at the running cpu's struct cpu (see
+// seginit), so mycpu() and myproc() are a single %gs-relative load.
 struct cpu {
+  struct cpu *self;            // This struct cpu, read through %gs
+  int id;                      // Index in cpus[]
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
   struct taskstate ts;         // Used by x86 to find stack for interrupt
@@ -13,6 +17,36 @@ struct cpu {
 extern struct cpu cpus[NCPU];
 extern int ncpu;
 
+// Per-cpu variables.
+// DECLARE_PERCPU(type, name) in a header and DEFINE_PERCPU(name) in
+// one .c file create an instance of name for each cpu, each in its
+// own cache line so that cpus updating their own instance do not
+// bounce lines between them. thiscpu(name) is the calling cpu's
+// instance and, like mycpu(), must be used with interrupts disabled.
+// percpu(name, i) is cpu i's instance.
+#define CACHELINE 64
+#define DECLARE_PERCPU(type, name) \
+  struct percpu_##name { type v; } __attribute__((aligned(CACHELINE))); \
+  extern struct percpu_##name name[NCPU]
+#define DEFINE_PERCPU(name)  struct percpu_##name name[NCPU]
+#define thiscpu(name)        (name[mycpu()->id].v)
+#define percpu(name, i)      (name[i].v)
+
+// Add n to a counter in the calling cpu's instance of a per-cpu
+// variable, e.g. percpu_add(thiscpu(cpustat).syscalls, 1), from
+// code that may run with interrupts enabled.
+#define percpu_add(var, n) \
+  do { pushcli(); (var) += (n); popcli(); } while(0)
+
+// Per-cpu event counters, printed by procdump().
+struct cpustat {
+  uint syscalls;               // System calls
+  uint intrs;                  // Device and timer interrupts
+  uint pgfaults;               // Page faults
+  uint switches;               // Context switches to a process
+};
+DECLARE_PERCPU(struct cpustat, cpustat);
+
 //PAGEBREAK: 17
 // Saved registers for kernel context switches.
 // Don't need to save all the segment registers (%cs, etc),
@@ -32,6 +66,39 @@ struct context {
   uint eip;
 };
 
+// A timer a process arms to sleep for a fixed time; see timer.c.
+struct timer {
+  uint expires;          // Tick at which a wheel timer fires
+  uint64 hrexpires;      // cpu 0 LAPIC count at which a usleep timer fires
+  uint64 hrdelta;        // Requested usleep delay in LAPIC counts
+  int fired;             // Has the timer expired?
+  struct timer *next;    // Wheel slot or usleep list
+  struct timer **pprev;  // Non-zero while armed
+};
+
+// A region mapped by mmap(); see mmap.c.
+struct vma {
+  uint start;            // First address, or 0 if the entry is unused
+  uint end;              // Address just past the region
+  int prot;              // PROT_READ, PROT_WRITE
+  int flags;             // MAP_SHARED or MAP_PRIVATE, MAP_ANON
+  struct inode *ip;      // File mapped, or 0 for anonymous memory
+  uint off;              // Offset in the file of start
+};
+
+#define NVMA 16          // Mappings per process
+
+// A loadable segment of the program, paged in from the program
+// file by execfault() when first touched.
+struct seg {
+  uint va;               // Page-aligned start
+  uint memsz;            // Size in memory, or 0 if the entry is unused
+  uint filesz;           // Bytes from the file; the rest is zero
+  uint off;              // Offset in the file of va
+};
+
+#define NSEG 4           // Demand-paged segments per program
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
@@ -47,13 +114,31 @@ struct proc {
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
+  struct timer timer;          // Armed while in sleep() or usleep()
+  struct proc *leader;         // If non-zero, a thread sharing leader's memory and files
+  int nthreads;                // Threads created by clone() not yet reaped
+  void *ustack;                // User stack passed to clone(), returned by join()
   struct file *ofile[NOFILE];  // Open files
+  struct vma vma[NVMA];        // Memory mappings
+  struct inode *exe;           // Program file, 0 if fully loaded
+  struct seg seg[NSEG];        // Segments of exe not loaded by exec()
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
 };
 
+// Open file table of p; threads use their leader's.
+#define fdtable(p) ((p)->leader ? (p)->leader->ofile : (p)->ofile)
+
+// Memory mappings of p; threads use their leader's.
+#define vmatable(p) ((p)->leader ? (p)->leader->vma : (p)->vma)
+
+// Process holding the program and segments of p.
+#define image(p) ((p)->leader ? (p)->leader : (p))
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+//   ...
+//   mmap() regions, placed top-down from KERNBASE
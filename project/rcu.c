@@ -0,0 +1,156 @@
+// Read-copy-update.
+//
+// Read-mostly lookups, such as scans of the process table, run
+// without taking the structure's spin lock. They bracket their
+// accesses with rcu_read_lock() and rcu_read_unlock(), which only
+// disable interrupts: a read-side critical section may not sleep,
+// and cannot be preempted, so it ends before its cpu next enters
+// scheduler(). scheduler() reports such a quiescent state with
+// rcu_quiescent() each time round its loop.
+//
+// Writers still serialize among themselves with the usual lock.
+// A writer that unpublishes memory (e.g. a dead process's page
+// table) hands the freeing of it to call_rcu(), which runs it once
+// every cpu has passed through a quiescent state, so no reader can
+// still hold a pointer to the memory. scheduler() runs the callbacks
+// whose grace period has ended with rcu_poll(). synchronize_rcu()
+// instead waits for a grace period in the caller.
+//
+// Structures that are never freed, only reused (struct proc and
+// struct inode slots), need no grace period: readers re-check the
+// identity of what they found once they hold a lock or reference.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NRCUCB NPROC
+
+DECLARE_PERCPU(uint, rcugen);  // quiescent states passed by each cpu
+DEFINE_PERCPU(rcugen);
+
+struct rcucb {
+  void (*fn)(void*);
+  void *arg;
+};
+
+// Callbacks in wait[] run once every cpu has passed a quiescent
+// state since snap was taken; those in next[], queued since, wait
+// for the grace period after that one.
+static struct {
+  struct spinlock lock;
+  struct rcucb wait[NRCUCB];
+  int nwait;
+  uint snap[NCPU];
+  struct rcucb next[NRCUCB];
+  int nnext;
+} rcu;
+
+void
+rcuinit(void)
+{
+  initlock(&rcu.lock, "rcu");
+}
+
+void
+rcu_read_lock(void)
+{
+  pushcli();
+}
+
+void
+rcu_read_unlock(void)
+{
+  popcli();
+}
+
+// Called by scheduler(), with interrupts disabled,
+// when this cpu is outside any read-side critical section.
+void
+rcu_quiescent(void)
+{
+  thiscpu(rcugen)++;
+}
+
+// Wait until all read-side critical sections that might have
+// started before the call have finished.
+// Must be called from a process, without holding any spin lock.
+void
+synchronize_rcu(void)
+{
+  uint snap[NCPU];
+  int i, me;
+
+  pushcli();
+  me = cpuid();
+  for(i = 0; i < ncpu; i++)
+    snap[i] = percpu(rcugen, i);
+  popcli();
+
+  // This cpu was running us, not a reader, when the snapshot was taken.
+  for(i = 0; i < ncpu; i++){
+    if(i == me)
+      continue;
+    while(*(volatile uint*)&percpu(rcugen, i) == snap[i])
+      yield();
+  }
+}
+
+// Call fn(arg) once all read-side critical sections that might
+// have started before the call have finished. Does not wait,
+// unless too many callbacks are pending already.
+void
+call_rcu(void (*fn)(void*), void *arg)
+{
+  acquire(&rcu.lock);
+  if(rcu.nnext == NRCUCB){
+    release(&rcu.lock);
+    synchronize_rcu();
+    fn(arg);
+    return;
+  }
+  rcu.next[rcu.nnext].fn = fn;
+  rcu.next[rcu.nnext].arg = arg;
+  rcu.nnext++;
+  release(&rcu.lock);
+}
+
+// Run the callbacks whose grace period has ended, and start the
+// next grace period. Called by scheduler(), outside any read-side
+// critical section and without holding any spin lock.
+void
+rcu_poll(void)
+{
+  struct rcucb done[NRCUCB];
+  int i, n;
+
+  if(rcu.nwait == 0 && rcu.nnext == 0)
+    return;
+  acquire(&rcu.lock);
+  n = 0;
+  if(rcu.nwait > 0){
+    for(i = 0; i < ncpu; i++)
+      if(percpu(rcugen, i) == rcu.snap[i])
+        break;
+    if(i == ncpu){
+      n = rcu.nwait;
+      memmove(done, rcu.wait, n*sizeof(done[0]));
+      rcu.nwait = 0;
+    }
+  }
+  if(rcu.nwait == 0 && rcu.nnext > 0){
+    memmove(rcu.wait, rcu.next, rcu.nnext*sizeof(rcu.wait[0]));
+    rcu.nwait = rcu.nnext;
+    rcu.nnext = 0;
+    for(i = 0; i < ncpu; i++)
+      rcu.snap[i] = percpu(rcugen, i);
+  }
+  release(&rcu.lock);
+  for(i = 0; i < n; i++)
+    done[i].fn(done[i].arg);
+}
@@ -0,0 +1,67 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NSLEEPER 20
+
+// Many processes sleeping at once must all wake on time.
+void
+sleepers(void)
+{
+  int i, pid, t0, t1;
+
+  t0 = uptime();
+  for(i = 0; i < NSLEEPER; i++){
+    pid = fork();
+    if(pid < 0)
+      goto failed;
+    if(pid == 0){
+      sleep(10 + i);
+      exit();
+    }
+  }
+  for(i = 0; i < NSLEEPER; i++)
+    if(wait() < 0)
+      goto failed;
+  t1 = uptime();
+  if(t1 - t0 < 10 + NSLEEPER - 1)
+    goto failed;
+  printf(1, "sleepers ok\n");
+  return;
+
+failed:
+  printf(1, "Sleeptest failed!\n");
+  exit();
+}
+
+// usleep must not return before the requested time has passed.
+void
+usleeps(void)
+{
+  int i, t0, t1;
+
+  t0 = uptime();
+  for(i = 0; i < 10; i++)
+    if(usleep(5000) < 0)
+      goto failed;
+  t1 = uptime();
+  if(t1 - t0 < 4)
+    goto failed;
+  if(usleep(0) < 0)
+    goto failed;
+  printf(1, "usleep ok\n");
+  return;
+
+failed:
+  printf(1, "Sleeptest failed!\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  sleepers();
+  usleeps();
+  printf(1, "Sleeptest Passed!\n");
+  exit();
+}
@@ -8,13 +8,33 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+extern char end[]; // first address after kernel loaded from ELF file
+
+// Statically allocated locks, linked through statnext,
+// for the lockstat system call.
+static struct spinlock *statlocks;
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->nacquire = 0;
+  lk->ncontended = 0;
+  lk->spincycles = 0;
+  lk->maxhold = 0;
+
+  // Locks in kalloc()ed memory (pipes) may be freed, so
+  // only locks in the kernel's data and bss are reported.
+  if((char*)lk < end){
+    do
+      lk->statnext = statlocks;
+    while(!__sync_bool_compare_and_swap(&statlocks, lk->statnext, lk));
+  }
 }
 
 // Acquire the lock.
@@ -24,13 +44,22 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket;
+  uint64 t0;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // Take a ticket and wait for our turn. Waiters only read
+  // lk->owner, so the cache line is not bounced between them.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  t0 = 0;
+  if(lk->owner != ticket){
+    t0 = rdtsc();
+    while(lk->owner != ticket)
+      pause();
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -39,17 +68,32 @@ acquire(struct spinlock *lk)
 
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
+#ifdef LOCKDEBUG
   getcallerpcs(&lk, lk->pcs);
+#endif
+  lk->tacquire = rdtsc();
+  lk->nacquire++;
+  if(t0){
+    lk->ncontended++;
+    lk->spincycles += lk->tacquire - t0;
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64 held;
+
   if(!holding(lk))
     panic("release");
 
+  held = rdtsc() - lk->tacquire;
+  if(held > lk->maxhold)
+    lk->maxhold = held;
+#ifdef LOCKDEBUG
   lk->pcs[0] = 0;
+#endif
   lk->cpu = 0;
 
   // Tell the C compiler and the processor to not move loads or stores
@@ -59,10 +103,10 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Serve the next ticket. Only the holder writes lk->owner,
+  // so a plain store suffices. This code can't use a C
+  // assignment, since it might not be atomic.
+  asm volatile("movl %1, %0" : "+m" (lk->owner) : "r" (lk->owner + 1));
 
   popcli();
 }
@@ -91,7 +135,7 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->owner != lock->next && lock->cpu == mycpu();
   popcli();
   return r;
 }
@@ -124,3 +168,40 @@ popcli(void)
     sti();
 }
 
+// Fill st[0..n-1] with the statistics of the statically allocated
+// locks, summed over locks with the same name. Returns the number of
+// entries filled in. With n == 0, resets all counters instead.
+// Counters are read without taking the locks, so a snapshot may be
+// slightly inconsistent.
+int
+lockstats(struct lockstat *st, int n)
+{
+  struct spinlock *lk;
+  int i, nst;
+
+  nst = 0;
+  for(lk = statlocks; lk; lk = lk->statnext){
+    if(n == 0){
+      lk->nacquire = lk->ncontended = 0;
+      lk->spincycles = lk->maxhold = 0;
+      continue;
+    }
+    for(i = 0; i < nst; i++)
+      if(strncmp(st[i].name, lk->name, sizeof(st[i].name)) == 0)
+        break;
+    if(i == nst){
+      if(nst == n)
+        continue;
+      memset(&st[i], 0, sizeof(st[i]));
+      safestrcpy(st[i].name, lk->name, sizeof(st[i].name));
+      nst++;
+    }
+    st[i].nlocks++;
+    st[i].nacquire += lk->nacquire;
+    st[i].ncontended += lk->ncontended;
+    st[i].spincycles += lk->spincycles;
+    if(lk->maxhold > st[i].maxhold)
+      st[i].maxhold = lk->maxhold;
+  }
+  return nst;
+}
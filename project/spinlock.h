@@ -1,11 +1,23 @@
 // Mutual exclusion lock.
+// A ticket lock: acquire() takes the next ticket and spins until
+// owner reaches it, so waiting cpus get the lock in FIFO order.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;            // Next ticket to hand out
+  volatile uint owner;  // Ticket of the current holder
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
+#ifdef LOCKDEBUG
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
-};
+#endif
 
+  // Contention statistics, only updated by the holder.
+  uint nacquire;     // Number of acquisitions
+  uint ncontended;   // Acquisitions that had to wait
+  uint64 spincycles; // rdtsc cycles spent waiting
+  uint64 maxhold;    // Longest hold, in rdtsc cycles
+  uint64 tacquire;   // rdtsc at the last acquisition
+  struct spinlock *statnext; // Next lock on the lockstat list
+};
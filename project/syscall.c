@@ -52,23 +52,52 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
+  uint a;
   struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0)
     return -1;
+  if(((uint)i >= curproc->sz || (uint)i+size > curproc->sz) &&
+     !mmapped(curproc, i, size, write))
+    return -1;
+  // Fault the block in now: pipes and the console copy to and from
+  // it with a spin lock held, and reading in a program page or a
+  // mapped file page would sleep. A block the kernel will store
+  // into is touched with a store, one that changes nothing even if
+  // another thread stores there too, to break copy-on-write.
+  for(a = PGROUNDDOWN((uint)i); a < (uint)i + size; a += PGSIZE){
+    if(write)
+      __sync_fetch_and_add((char*)a, 0);
+    else
+      (void)*(volatile char*)a;
+  }
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Like argptr, for a block the kernel will store into, so a
+// mapping must allow writes.
+int
+argwptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -105,6 +134,15 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_getrss(void);
 extern int sys_getNumFreePages(void);
+extern int sys_usleep(void);
+extern int sys_lockstat(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_sendfile(void);
+extern int sys_splice(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +168,15 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_getrss] sys_getrss,
 [SYS_getNumFreePages]   sys_getNumFreePages,
+[SYS_usleep]  sys_usleep,
+[SYS_lockstat] sys_lockstat,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex]   sys_futex,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_sendfile] sys_sendfile,
+[SYS_splice]  sys_splice,
 };
 
 void
@@ -22,3 +22,12 @@
 #define SYS_close  21
 #define SYS_getrss 22
 #define SYS_getNumFreePages  23
+#define SYS_usleep 24
+#define SYS_lockstat 25
+#define SYS_clone 26
+#define SYS_join 27
+#define SYS_futex 28
+#define SYS_mmap  29
+#define SYS_munmap 30
+#define SYS_sendfile 31
+#define SYS_splice 32
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "lockstat.h"
+#include "futex.h"
 
 
 int
@@ -40,6 +42,42 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_clone(void)
+{
+  int fcn, arg, stack;
+
+  if(argint(0, &fcn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*))fcn, (void*)arg, (void*)stack);
+}
+
+int
+sys_join(void)
+{
+  char *stack;
+
+  if(argwptr(0, &stack, sizeof(void*)) < 0)
+    return -1;
+  return join((void**)stack);
+}
+
+int
+sys_futex(void)
+{
+  int addr, op, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(addr, val);
+  case FUTEX_WAKE:
+    return futexwake(addr, val);
+  }
+  return -1;
+}
+
 int
 sys_kill(void)
 {
@@ -64,8 +102,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if((addr = growproc(n)) < 0)
     return -1;
   return addr;
 }
@@ -74,21 +111,25 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  if(n < 0)
+    n = 0;
+  return sleepticks(n);
+}
+
+// sleep for a number of microseconds.
+int
+sys_usleep(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  if(n < 0)
+    n = 0;
+  return sleepus(n);
 }
 
 // return how many clock tick interrupts have occurred
@@ -103,3 +144,18 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// Copy out spin lock contention statistics, one entry per lock name.
+// With n == 0, reset them.
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(argwptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return lockstats(st, n);
+}
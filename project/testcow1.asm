@@ -0,0 +1,1354 @@
+
+_testcow1:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+	exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "Test starting...\n");
+  11:	68 20 0a 00 00       	push   $0xa20
+  16:	6a 01                	push   $0x1
+  18:	e8 a3 05 00 00       	call   5c0 <printf>
+	test();
+  1d:	e8 0e 00 00 00       	call   30 <test>
+  22:	66 90                	xchg   %ax,%ax
+  24:	66 90                	xchg   %ax,%ax
+  26:	66 90                	xchg   %ax,%ax
+  28:	66 90                	xchg   %ax,%ax
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <test>:
+{
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	57                   	push   %edi
+  34:	56                   	push   %esi
+  35:	53                   	push   %ebx
+  36:	83 ec 1c             	sub    $0x1c,%esp
+    uint prev_free_pages = getNumFreePages();
+  39:	e8 8d 04 00 00       	call   4cb <getNumFreePages>
+    long long size = ((prev_free_pages - 20) * 4096); // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  3e:	31 d2                	xor    %edx,%edx
+  40:	8d 58 ec             	lea    -0x14(%eax),%ebx
+    printf(1, "Allocating %d bytes for each process\n", size);
+  43:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    long long size = ((prev_free_pages - 20) * 4096); // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  46:	c1 e3 0c             	shl    $0xc,%ebx
+    printf(1, "Allocating %d bytes for each process\n", size);
+  49:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  4c:	52                   	push   %edx
+  4d:	53                   	push   %ebx
+  4e:	68 e8 08 00 00       	push   $0x8e8
+  53:	6a 01                	push   $0x1
+  55:	e8 66 05 00 00       	call   5c0 <printf>
+    char *m1 = (char*)malloc(size);
+  5a:	89 1c 24             	mov    %ebx,(%esp)
+  5d:	e8 9e 07 00 00       	call   800 <malloc>
+    if (m1 == 0) goto out_of_memory;
+  62:	83 c4 10             	add    $0x10,%esp
+  65:	85 c0                	test   %eax,%eax
+  67:	0f 84 3a 01 00 00    	je     1a7 <test+0x177>
+  6d:	89 c7                	mov    %eax,%edi
+    for(int k=0;k<size;++k){
+  6f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  72:	31 c9                	xor    %ecx,%ecx
+        m1[k] = (char)(65+(k%26));
+  74:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    for(int k=0;k<size;++k){
+  79:	09 d8                	or     %ebx,%eax
+  7b:	74 1b                	je     98 <test+0x68>
+        m1[k] = (char)(65+(k%26));
+  7d:	89 c8                	mov    %ecx,%eax
+  7f:	f7 e6                	mul    %esi
+  81:	c1 ea 03             	shr    $0x3,%edx
+  84:	6b c2 1a             	imul   $0x1a,%edx,%eax
+  87:	89 ca                	mov    %ecx,%edx
+  89:	29 c2                	sub    %eax,%edx
+  8b:	83 c2 41             	add    $0x41,%edx
+  8e:	88 14 0f             	mov    %dl,(%edi,%ecx,1)
+    for(int k=0;k<size;++k){
+  91:	83 c1 01             	add    $0x1,%ecx
+  94:	39 d9                	cmp    %ebx,%ecx
+  96:	75 e5                	jne    7d <test+0x4d>
+    printf(1, "\n*** Forking ***\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 be 09 00 00       	push   $0x9be
+  a0:	6a 01                	push   $0x1
+  a2:	e8 19 05 00 00       	call   5c0 <printf>
+    pid = fork();
+  a7:	e8 6f 03 00 00       	call   41b <fork>
+    if (pid < 0) goto fork_failed; // Fork failed
+  ac:	83 c4 10             	add    $0x10,%esp
+  af:	85 c0                	test   %eax,%eax
+  b1:	0f 88 fc 00 00 00    	js     1b3 <test+0x183>
+    if (pid == 0) { // Child process
+  b7:	75 74                	jne    12d <test+0xfd>
+        printf(1, "\n*** Child ***\n");
+  b9:	50                   	push   %eax
+  ba:	50                   	push   %eax
+  bb:	68 eb 09 00 00       	push   $0x9eb
+  c0:	6a 01                	push   $0x1
+  c2:	e8 f9 04 00 00       	call   5c0 <printf>
+        for(int k=0;k<size;++k){
+  c7:	83 c4 10             	add    $0x10,%esp
+  ca:	0b 5d e4             	or     -0x1c(%ebp),%ebx
+  cd:	0f 84 ec 00 00 00    	je     1bf <test+0x18f>
+  d3:	31 db                	xor    %ebx,%ebx
+  d5:	31 f6                	xor    %esi,%esi
+  d7:	eb 18                	jmp    f1 <test+0xc1>
+  d9:	83 c3 01             	add    $0x1,%ebx
+  dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  df:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  e2:	83 d6 00             	adc    $0x0,%esi
+  e5:	31 f2                	xor    %esi,%edx
+  e7:	31 d8                	xor    %ebx,%eax
+  e9:	09 d0                	or     %edx,%eax
+  eb:	0f 84 ce 00 00 00    	je     1bf <test+0x18f>
+			if(m1[k] != (char)(65+(k%26))) goto failed;
+  f1:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+  f6:	f7 e3                	mul    %ebx
+  f8:	89 d0                	mov    %edx,%eax
+  fa:	89 da                	mov    %ebx,%edx
+  fc:	c1 e8 03             	shr    $0x3,%eax
+  ff:	6b c0 1a             	imul   $0x1a,%eax,%eax
+ 102:	29 c2                	sub    %eax,%edx
+ 104:	83 c2 41             	add    $0x41,%edx
+ 107:	38 14 1f             	cmp    %dl,(%edi,%ebx,1)
+ 10a:	74 cd                	je     d9 <test+0xa9>
+    printf(1, "Copy failed: The memory contents of the processes is inconsistent!\n");
+ 10c:	50                   	push   %eax
+ 10d:	50                   	push   %eax
+ 10e:	68 50 09 00 00       	push   $0x950
+	printf(1, "Failed to fork a process!\n");
+ 113:	6a 01                	push   $0x1
+ 115:	e8 a6 04 00 00       	call   5c0 <printf>
+    printf(1, "Lab5 test failed!\n");
+ 11a:	58                   	pop    %eax
+ 11b:	5a                   	pop    %edx
+ 11c:	68 ab 09 00 00       	push   $0x9ab
+ 121:	6a 01                	push   $0x1
+ 123:	e8 98 04 00 00       	call   5c0 <printf>
+	exit();
+ 128:	e8 f6 02 00 00       	call   423 <exit>
+        printf(1, "\n*** Parent ***\n");
+ 12d:	56                   	push   %esi
+ 12e:	56                   	push   %esi
+ 12f:	68 fb 09 00 00       	push   $0x9fb
+ 134:	6a 01                	push   $0x1
+ 136:	e8 85 04 00 00       	call   5c0 <printf>
+        for(int k=0;k<size;++k){
+ 13b:	83 c4 10             	add    $0x10,%esp
+ 13e:	0b 5d e4             	or     -0x1c(%ebp),%ebx
+ 141:	74 37                	je     17a <test+0x14a>
+ 143:	31 db                	xor    %ebx,%ebx
+ 145:	31 f6                	xor    %esi,%esi
+ 147:	eb 14                	jmp    15d <test+0x12d>
+ 149:	83 c3 01             	add    $0x1,%ebx
+ 14c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 14f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 152:	83 d6 00             	adc    $0x0,%esi
+ 155:	31 f2                	xor    %esi,%edx
+ 157:	31 d8                	xor    %ebx,%eax
+ 159:	09 d0                	or     %edx,%eax
+ 15b:	74 1d                	je     17a <test+0x14a>
+            if(m1[k] != (char)(65+(k%26))) goto failed;
+ 15d:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 162:	f7 e3                	mul    %ebx
+ 164:	89 d0                	mov    %edx,%eax
+ 166:	89 da                	mov    %ebx,%edx
+ 168:	c1 e8 03             	shr    $0x3,%eax
+ 16b:	6b c0 1a             	imul   $0x1a,%eax,%eax
+ 16e:	29 c2                	sub    %eax,%edx
+ 170:	83 c2 41             	add    $0x41,%edx
+ 173:	38 14 1f             	cmp    %dl,(%edi,%ebx,1)
+ 176:	74 d1                	je     149 <test+0x119>
+ 178:	eb 92                	jmp    10c <test+0xdc>
+        wait();
+ 17a:	e8 ac 02 00 00       	call   42b <wait>
+        printf(1, "done processing %d\n", x);
+ 17f:	52                   	push   %edx
+ 180:	68 ae ad 01 00       	push   $0x1adae
+ 185:	68 0c 0a 00 00       	push   $0xa0c
+ 18a:	6a 01                	push   $0x1
+ 18c:	e8 2f 04 00 00       	call   5c0 <printf>
+        printf(1, "[COW] Lab5 Parent test passed!\n");
+ 191:	59                   	pop    %ecx
+ 192:	5b                   	pop    %ebx
+ 193:	68 30 09 00 00       	push   $0x930
+ 198:	6a 01                	push   $0x1
+ 19a:	e8 21 04 00 00       	call   5c0 <printf>
+ 19f:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1a2:	e8 7c 02 00 00       	call   423 <exit>
+	printf(1, "Exceeded the PHYSTOP!\n");
+ 1a7:	53                   	push   %ebx
+ 1a8:	53                   	push   %ebx
+ 1a9:	68 94 09 00 00       	push   $0x994
+ 1ae:	e9 60 ff ff ff       	jmp    113 <test+0xe3>
+	printf(1, "Failed to fork a process!\n");
+ 1b3:	51                   	push   %ecx
+ 1b4:	51                   	push   %ecx
+ 1b5:	68 d0 09 00 00       	push   $0x9d0
+ 1ba:	e9 54 ff ff ff       	jmp    113 <test+0xe3>
+        printf(1, "[COW] Lab5 Child test passed!\n");
+ 1bf:	57                   	push   %edi
+ 1c0:	57                   	push   %edi
+ 1c1:	68 10 09 00 00       	push   $0x910
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	e8 f3 03 00 00       	call   5c0 <printf>
+ 1cd:	83 c4 10             	add    $0x10,%esp
+ 1d0:	eb d0                	jmp    1a2 <test+0x172>
+ 1d2:	66 90                	xchg   %ax,%ax
+ 1d4:	66 90                	xchg   %ax,%ax
+ 1d6:	66 90                	xchg   %ax,%ax
+ 1d8:	66 90                	xchg   %ax,%ax
+ 1da:	66 90                	xchg   %ax,%ax
+ 1dc:	66 90                	xchg   %ax,%ax
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f7:	83 c0 01             	add    $0x1,%eax
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	75 f2                	jne    1f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 201:	89 c8                	mov    %ecx,%eax
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+ 205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 276:	80 3a 00             	cmpb   $0x0,(%edx)
+ 279:	74 15                	je     290 <strlen+0x20>
+ 27b:	31 c0                	xor    %eax,%eax
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 287:	89 c1                	mov    %eax,%ecx
+ 289:	75 f5                	jne    280 <strlen+0x10>
+    ;
+  return n;
+}
+ 28b:	89 c8                	mov    %ecx,%eax
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+ 28f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 290:	31 c9                	xor    %ecx,%ecx
+}
+ 292:	5d                   	pop    %ebp
+ 293:	89 c8                	mov    %ecx,%eax
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ad:	89 d7                	mov    %edx,%edi
+ 2af:	fc                   	cld
+ 2b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2b5:	89 d0                	mov    %edx,%eax
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	84 d2                	test   %dl,%dl
+ 2cf:	75 12                	jne    2e3 <strchr+0x23>
+ 2d1:	eb 1d                	jmp    2f0 <strchr+0x30>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2dc:	83 c0 01             	add    $0x1,%eax
+ 2df:	84 d2                	test   %dl,%dl
+ 2e1:	74 0d                	je     2f0 <strchr+0x30>
+    if(*s == c)
+ 2e3:	38 d1                	cmp    %dl,%cl
+ 2e5:	75 f1                	jne    2d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2f0:	31 c0                	xor    %eax,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 305:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 308:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 309:	31 db                	xor    %ebx,%ebx
+{
+ 30b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 30e:	eb 27                	jmp    337 <gets+0x37>
+    cc = read(0, &c, 1);
+ 310:	83 ec 04             	sub    $0x4,%esp
+ 313:	6a 01                	push   $0x1
+ 315:	56                   	push   %esi
+ 316:	6a 00                	push   $0x0
+ 318:	e8 1e 01 00 00       	call   43b <read>
+    if(cc < 1)
+ 31d:	83 c4 10             	add    $0x10,%esp
+ 320:	85 c0                	test   %eax,%eax
+ 322:	7e 1d                	jle    341 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 324:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 32f:	3c 0a                	cmp    $0xa,%al
+ 331:	74 10                	je     343 <gets+0x43>
+ 333:	3c 0d                	cmp    $0xd,%al
+ 335:	74 0c                	je     343 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 337:	89 df                	mov    %ebx,%edi
+ 339:	83 c3 01             	add    $0x1,%ebx
+ 33c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 33f:	7c cf                	jl     310 <gets+0x10>
+ 341:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 34a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 34d:	5b                   	pop    %ebx
+ 34e:	5e                   	pop    %esi
+ 34f:	5f                   	pop    %edi
+ 350:	5d                   	pop    %ebp
+ 351:	c3                   	ret
+ 352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 365:	83 ec 08             	sub    $0x8,%esp
+ 368:	6a 00                	push   $0x0
+ 36a:	ff 75 08             	push   0x8(%ebp)
+ 36d:	e8 f1 00 00 00       	call   463 <open>
+  if(fd < 0)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	78 27                	js     3a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 379:	83 ec 08             	sub    $0x8,%esp
+ 37c:	ff 75 0c             	push   0xc(%ebp)
+ 37f:	89 c3                	mov    %eax,%ebx
+ 381:	50                   	push   %eax
+ 382:	e8 f4 00 00 00       	call   47b <fstat>
+  close(fd);
+ 387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 38a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 38c:	e8 ba 00 00 00       	call   44b <close>
+  return r;
+ 391:	83 c4 10             	add    $0x10,%esp
+}
+ 394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 397:	89 f0                	mov    %esi,%eax
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3a5:	eb ed                	jmp    394 <stat+0x34>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3b7:	0f be 02             	movsbl (%edx),%eax
+ 3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3c5:	77 1e                	ja     3e5 <atoi+0x35>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3da:	0f be 02             	movsbl (%edx),%eax
+ 3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3e0:	80 fb 09             	cmp    $0x9,%bl
+ 3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+ 3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	7e 13                	jle    415 <memmove+0x25>
+ 402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 404:	89 d7                	mov    %edx,%edi
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 411:	39 f8                	cmp    %edi,%eax
+ 413:	75 fb                	jne    410 <memmove+0x20>
+  return vdst;
+}
+ 415:	5e                   	pop    %esi
+ 416:	89 d0                	mov    %edx,%eax
+ 418:	5f                   	pop    %edi
+ 419:	5d                   	pop    %ebp
+ 41a:	c3                   	ret
+
+0000041b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 41b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <exit>:
+SYSCALL(exit)
+ 423:	b8 02 00 00 00       	mov    $0x2,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <wait>:
+SYSCALL(wait)
+ 42b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <pipe>:
+SYSCALL(pipe)
+ 433:	b8 04 00 00 00       	mov    $0x4,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <read>:
+SYSCALL(read)
+ 43b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <write>:
+SYSCALL(write)
+ 443:	b8 10 00 00 00       	mov    $0x10,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <close>:
+SYSCALL(close)
+ 44b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <kill>:
+SYSCALL(kill)
+ 453:	b8 06 00 00 00       	mov    $0x6,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <exec>:
+SYSCALL(exec)
+ 45b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <open>:
+SYSCALL(open)
+ 463:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mknod>:
+SYSCALL(mknod)
+ 46b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <unlink>:
+SYSCALL(unlink)
+ 473:	b8 12 00 00 00       	mov    $0x12,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <fstat>:
+SYSCALL(fstat)
+ 47b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <link>:
+SYSCALL(link)
+ 483:	b8 13 00 00 00       	mov    $0x13,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <chdir>:
+SYSCALL(chdir)
+ 493:	b8 09 00 00 00       	mov    $0x9,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dup>:
+SYSCALL(dup)
+ 49b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getpid>:
+SYSCALL(getpid)
+ 4a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <sbrk>:
+SYSCALL(sbrk)
+ 4ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <sleep>:
+SYSCALL(sleep)
+ 4b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <uptime>:
+SYSCALL(uptime)
+ 4bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getrss>:
+SYSCALL(getrss)
+ 4c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 4cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <usleep>:
+SYSCALL(usleep)
+ 4d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <lockstat>:
+SYSCALL(lockstat)
+ 4db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <clone>:
+SYSCALL(clone)
+ 4e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <join>:
+SYSCALL(join)
+ 4eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <futex>:
+SYSCALL(futex)
+ 4f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mmap>:
+SYSCALL(mmap)
+ 4fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <munmap>:
+SYSCALL(munmap)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <sendfile>:
+SYSCALL(sendfile)
+ 50b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <splice>:
+SYSCALL(splice)
+ 513:	b8 20 00 00 00       	mov    $0x20,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 528:	89 d1                	mov    %edx,%ecx
+{
+ 52a:	83 ec 3c             	sub    $0x3c,%esp
+ 52d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 530:	85 d2                	test   %edx,%edx
+ 532:	0f 89 80 00 00 00    	jns    5b8 <printint+0x98>
+ 538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 53c:	74 7a                	je     5b8 <printint+0x98>
+    x = -xx;
+ 53e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 548:	31 f6                	xor    %esi,%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	31 d2                	xor    %edx,%edx
+ 554:	89 f7                	mov    %esi,%edi
+ 556:	f7 f3                	div    %ebx
+ 558:	8d 76 01             	lea    0x1(%esi),%esi
+ 55b:	0f b6 92 94 0a 00 00 	movzbl 0xa94(%edx),%edx
+ 562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 566:	89 ca                	mov    %ecx,%edx
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	39 da                	cmp    %ebx,%edx
+ 56c:	73 e2                	jae    550 <printint+0x30>
+  if(neg)
+ 56e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 571:	85 c0                	test   %eax,%eax
+ 573:	74 07                	je     57c <printint+0x5c>
+    buf[i++] = '-';
+ 575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 57a:	89 f7                	mov    %esi,%edi
+ 57c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 582:	01 df                	add    %ebx,%edi
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 594:	6a 01                	push   $0x1
+ 596:	50                   	push   %eax
+ 597:	56                   	push   %esi
+ 598:	e8 a6 fe ff ff       	call   443 <write>
+  while(--i >= 0)
+ 59d:	89 f8                	mov    %edi,%eax
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 ef 01             	sub    $0x1,%edi
+ 5a5:	39 d8                	cmp    %ebx,%eax
+ 5a7:	75 df                	jne    588 <printint+0x68>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+ 5ba:	eb 89                	jmp    545 <printint+0x25>
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	83 c6 01             	add    $0x1,%esi
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	74 67                	je     640 <printf+0x80>
+ 5d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5e1:	eb 34                	jmp    617 <printf+0x57>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5f0:	83 f8 25             	cmp    $0x25,%eax
+ 5f3:	74 18                	je     60d <printf+0x4d>
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fe:	6a 01                	push   $0x1
+ 600:	50                   	push   %eax
+ 601:	57                   	push   %edi
+ 602:	e8 3c fe ff ff       	call   443 <write>
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 60a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 60d:	0f b6 1e             	movzbl (%esi),%ebx
+ 610:	83 c6 01             	add    $0x1,%esi
+ 613:	84 db                	test   %bl,%bl
+ 615:	74 29                	je     640 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 61a:	85 d2                	test   %edx,%edx
+ 61c:	74 ca                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 61e:	83 fa 25             	cmp    $0x25,%edx
+ 621:	75 ea                	jne    60d <printf+0x4d>
+      if(c == 'd'){
+ 623:	83 f8 25             	cmp    $0x25,%eax
+ 626:	0f 84 24 01 00 00    	je     750 <printf+0x190>
+ 62c:	83 e8 63             	sub    $0x63,%eax
+ 62f:	83 f8 15             	cmp    $0x15,%eax
+ 632:	77 1c                	ja     650 <printf+0x90>
+ 634:	ff 24 85 3c 0a 00 00 	jmp    *0xa3c(,%eax,4)
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65a:	6a 01                	push   $0x1
+ 65c:	52                   	push   %edx
+ 65d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 660:	57                   	push   %edi
+ 661:	e8 dd fd ff ff       	call   443 <write>
+ 666:	83 c4 0c             	add    $0xc,%esp
+ 669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66c:	6a 01                	push   $0x1
+ 66e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 671:	52                   	push   %edx
+ 672:	57                   	push   %edi
+ 673:	e8 cb fd ff ff       	call   443 <write>
+        putc(fd, c);
+ 678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67b:	31 d2                	xor    %edx,%edx
+ 67d:	eb 8e                	jmp    60d <printf+0x4d>
+ 67f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 00                	push   $0x0
+ 68f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 694:	e8 87 fe ff ff       	call   520 <printint>
+        ap++;
+ 699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 67 ff ff ff       	jmp    60d <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6b5:	83 c0 04             	add    $0x4,%eax
+ 6b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6bb:	85 db                	test   %ebx,%ebx
+ 6bd:	0f 84 9d 00 00 00    	je     760 <printf+0x1a0>
+        while(*s != 0){
+ 6c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	0f 84 3d ff ff ff    	je     60d <printf+0x4d>
+ 6d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6d6:	89 de                	mov    %ebx,%esi
+ 6d8:	89 d3                	mov    %edx,%ebx
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	53                   	push   %ebx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 51 fd ff ff       	call   443 <write>
+        while(*s != 0){
+ 6f2:	0f b6 06             	movzbl (%esi),%eax
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	75 e4                	jne    6e0 <printf+0x120>
+      state = 0;
+ 6fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 07 ff ff ff       	jmp    60d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 01                	push   $0x1
+ 71f:	e9 6b ff ff ff       	jmp    68f <printf+0xcf>
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	52                   	push   %edx
+ 73c:	57                   	push   %edi
+ 73d:	e8 01 fd ff ff       	call   443 <write>
+        ap++;
+ 742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 748:	31 d2                	xor    %edx,%edx
+ 74a:	e9 be fe ff ff       	jmp    60d <printf+0x4d>
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 759:	6a 01                	push   $0x1
+ 75b:	e9 11 ff ff ff       	jmp    671 <printf+0xb1>
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 765:	bb 32 0a 00 00       	mov    $0xa32,%ebx
+ 76a:	e9 61 ff ff ff       	jmp    6d0 <printf+0x110>
+ 76f:	90                   	nop
+
+00000770 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 770:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 771:	a1 50 0d 00 00       	mov    0xd50,%eax
+{
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	57                   	push   %edi
+ 779:	56                   	push   %esi
+ 77a:	53                   	push   %ebx
+ 77b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 77e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 788:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 78c:	39 ca                	cmp    %ecx,%edx
+ 78e:	73 30                	jae    7c0 <free+0x50>
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 04                	jb     798 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 794:	39 c2                	cmp    %eax,%edx
+ 796:	72 f0                	jb     788 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 798:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 79b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 79e:	39 f8                	cmp    %edi,%eax
+ 7a0:	74 2e                	je     7d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7ab:	39 f1                	cmp    %esi,%ecx
+ 7ad:	74 38                	je     7e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7b1:	5b                   	pop    %ebx
+  freep = p;
+ 7b2:	89 15 50 0d 00 00    	mov    %edx,0xd50
+}
+ 7b8:	5e                   	pop    %esi
+ 7b9:	5f                   	pop    %edi
+ 7ba:	5d                   	pop    %ebp
+ 7bb:	c3                   	ret
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 d0                	jb     794 <free+0x24>
+ 7c4:	eb c2                	jmp    788 <free+0x18>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7d0:	03 70 04             	add    0x4(%eax),%esi
+ 7d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d6:	8b 02                	mov    (%edx),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7e3:	39 f1                	cmp    %esi,%ecx
+ 7e5:	75 c8                	jne    7af <free+0x3f>
+    p->s.size += bp->s.size;
+ 7e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ea:	89 15 50 0d 00 00    	mov    %edx,0xd50
+    p->s.size += bp->s.size;
+ 7f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7f8:	5b                   	pop    %ebx
+ 7f9:	5e                   	pop    %esi
+ 7fa:	5f                   	pop    %edi
+ 7fb:	5d                   	pop    %ebp
+ 7fc:	c3                   	ret
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000800 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 809:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 80c:	8b 15 50 0d 00 00    	mov    0xd50,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 812:	8d 78 07             	lea    0x7(%eax),%edi
+ 815:	c1 ef 03             	shr    $0x3,%edi
+ 818:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 81b:	85 d2                	test   %edx,%edx
+ 81d:	0f 84 8d 00 00 00    	je     8b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 823:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 825:	8b 48 04             	mov    0x4(%eax),%ecx
+ 828:	39 f9                	cmp    %edi,%ecx
+ 82a:	73 64                	jae    890 <malloc+0x90>
+  if(nu < 4096)
+ 82c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 831:	39 df                	cmp    %ebx,%edi
+ 833:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 836:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 83d:	eb 0a                	jmp    849 <malloc+0x49>
+ 83f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 840:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 842:	8b 48 04             	mov    0x4(%eax),%ecx
+ 845:	39 f9                	cmp    %edi,%ecx
+ 847:	73 47                	jae    890 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 849:	89 c2                	mov    %eax,%edx
+ 84b:	39 05 50 0d 00 00    	cmp    %eax,0xd50
+ 851:	75 ed                	jne    840 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	56                   	push   %esi
+ 857:	e8 4f fc ff ff       	call   4ab <sbrk>
+  if(p == (char*)-1)
+ 85c:	83 c4 10             	add    $0x10,%esp
+ 85f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 862:	74 1c                	je     880 <malloc+0x80>
+  hp->s.size = nu;
+ 864:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 867:	83 ec 0c             	sub    $0xc,%esp
+ 86a:	83 c0 08             	add    $0x8,%eax
+ 86d:	50                   	push   %eax
+ 86e:	e8 fd fe ff ff       	call   770 <free>
+  return freep;
+ 873:	8b 15 50 0d 00 00    	mov    0xd50,%edx
+      if((p = morecore(nunits)) == 0)
+ 879:	83 c4 10             	add    $0x10,%esp
+ 87c:	85 d2                	test   %edx,%edx
+ 87e:	75 c0                	jne    840 <malloc+0x40>
+        return 0;
+  }
+}
+ 880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 883:	31 c0                	xor    %eax,%eax
+}
+ 885:	5b                   	pop    %ebx
+ 886:	5e                   	pop    %esi
+ 887:	5f                   	pop    %edi
+ 888:	5d                   	pop    %ebp
+ 889:	c3                   	ret
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 890:	39 cf                	cmp    %ecx,%edi
+ 892:	74 4c                	je     8e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 894:	29 f9                	sub    %edi,%ecx
+ 896:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 899:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 89c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 89f:	89 15 50 0d 00 00    	mov    %edx,0xd50
+}
+ 8a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8a8:	83 c0 08             	add    $0x8,%eax
+}
+ 8ab:	5b                   	pop    %ebx
+ 8ac:	5e                   	pop    %esi
+ 8ad:	5f                   	pop    %edi
+ 8ae:	5d                   	pop    %ebp
+ 8af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8b0:	c7 05 50 0d 00 00 54 	movl   $0xd54,0xd50
+ 8b7:	0d 00 00 
+    base.s.size = 0;
+ 8ba:	b8 54 0d 00 00       	mov    $0xd54,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8bf:	c7 05 54 0d 00 00 54 	movl   $0xd54,0xd54
+ 8c6:	0d 00 00 
+    base.s.size = 0;
+ 8c9:	c7 05 58 0d 00 00 00 	movl   $0x0,0xd58
+ 8d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8d3:	e9 54 ff ff ff       	jmp    82c <malloc+0x2c>
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8e0:	8b 08                	mov    (%eax),%ecx
+ 8e2:	89 0a                	mov    %ecx,(%edx)
+ 8e4:	eb b9                	jmp    89f <malloc+0x9f>
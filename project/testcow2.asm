@@ -0,0 +1,1424 @@
+
+_testcow2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+	exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "Test starting...\n");
+  11:	68 14 0a 00 00       	push   $0xa14
+  16:	6a 01                	push   $0x1
+  18:	e8 43 06 00 00       	call   660 <printf>
+	test();
+  1d:	e8 1e 00 00 00       	call   40 <test>
+  22:	66 90                	xchg   %ax,%ax
+  24:	66 90                	xchg   %ax,%ax
+  26:	66 90                	xchg   %ax,%ax
+  28:	66 90                	xchg   %ax,%ax
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <processing>:
+processing(int *x) {
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	8b 45 08             	mov    0x8(%ebp),%eax
+  36:	c7 00 ae ad 01 00    	movl   $0x1adae,(%eax)
+}
+  3c:	5d                   	pop    %ebp
+  3d:	c3                   	ret
+  3e:	66 90                	xchg   %ax,%ax
+
+00000040 <test>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  45:	53                   	push   %ebx
+  46:	83 ec 1c             	sub    $0x1c,%esp
+    uint prev_free_pages = getNumFreePages();
+  49:	e8 1d 05 00 00       	call   56b <getNumFreePages>
+    char *m1 = (char*)malloc(size);
+  4e:	83 ec 0c             	sub    $0xc,%esp
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 3; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  51:	8d 50 ec             	lea    -0x14(%eax),%edx
+  54:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+  59:	c1 e2 0c             	shl    $0xc,%edx
+  5c:	f7 e2                	mul    %edx
+  5e:	89 d3                	mov    %edx,%ebx
+  60:	d1 eb                	shr    %ebx
+    char *m1 = (char*)malloc(size);
+  62:	53                   	push   %ebx
+  63:	e8 38 08 00 00       	call   8a0 <malloc>
+    if (m1 == 0) goto out_of_memory;
+  68:	83 c4 10             	add    $0x10,%esp
+  6b:	85 c0                	test   %eax,%eax
+  6d:	0f 84 a7 01 00 00    	je     21a <test+0x1da>
+    printf(1, "\n*** Forking ***\n");
+  73:	83 ec 08             	sub    $0x8,%esp
+  76:	89 c7                	mov    %eax,%edi
+  78:	68 b2 09 00 00       	push   $0x9b2
+  7d:	6a 01                	push   $0x1
+  7f:	e8 dc 05 00 00       	call   660 <printf>
+    pid = fork();
+  84:	e8 32 04 00 00       	call   4bb <fork>
+    if (pid < 0) goto fork_failed; // Fork failed
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 c0                	test   %eax,%eax
+  8e:	0f 88 c4 01 00 00    	js     258 <test+0x218>
+    if (pid == 0) { // Child process
+  94:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 3; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  97:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  9a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    if (pid == 0) { // Child process
+  a1:	0f 85 ad 00 00 00    	jne    154 <test+0x114>
+        printf(1, "\n*** Child ***\n");
+  a7:	50                   	push   %eax
+  a8:	50                   	push   %eax
+  a9:	68 df 09 00 00       	push   $0x9df
+  ae:	6a 01                	push   $0x1
+  b0:	e8 ab 05 00 00       	call   660 <printf>
+        prev_free_pages = getNumFreePages();
+  b5:	e8 b1 04 00 00       	call   56b <getNumFreePages>
+        for (int i=0; i<size; i++) {
+  ba:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+  bd:	89 c6                	mov    %eax,%esi
+        for (int i=0; i<size; i++) {
+  bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c2:	09 d8                	or     %ebx,%eax
+  c4:	0f 84 5c 01 00 00    	je     226 <test+0x1e6>
+            m1[i] = (char)(65+(i%26));
+  ca:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  cd:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+  d2:	f7 e1                	mul    %ecx
+  d4:	89 d0                	mov    %edx,%eax
+  d6:	89 ca                	mov    %ecx,%edx
+  d8:	c1 e8 03             	shr    $0x3,%eax
+  db:	6b c0 1a             	imul   $0x1a,%eax,%eax
+  de:	29 c2                	sub    %eax,%edx
+  e0:	83 c2 41             	add    $0x41,%edx
+  e3:	88 14 0f             	mov    %dl,(%edi,%ecx,1)
+        for (int i=0; i<size; i++) {
+  e6:	83 c1 01             	add    $0x1,%ecx
+  e9:	39 d9                	cmp    %ebx,%ecx
+  eb:	75 e0                	jne    cd <test+0x8d>
+        curr_free_pages = getNumFreePages();
+  ed:	e8 79 04 00 00       	call   56b <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+  f2:	39 f0                	cmp    %esi,%eax
+  f4:	0f 83 6a 01 00 00    	jae    264 <test+0x224>
+  fa:	31 c9                	xor    %ecx,%ecx
+  fc:	31 db                	xor    %ebx,%ebx
+  fe:	eb 18                	jmp    118 <test+0xd8>
+        for(int k=0;k<size;++k){
+ 100:	83 c1 01             	add    $0x1,%ecx
+ 103:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 106:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 109:	83 d3 00             	adc    $0x0,%ebx
+ 10c:	31 da                	xor    %ebx,%edx
+ 10e:	31 c8                	xor    %ecx,%eax
+ 110:	09 d0                	or     %edx,%eax
+ 112:	0f 84 17 01 00 00    	je     22f <test+0x1ef>
+			if(m1[k] != (char)(65+(k%26))) goto failed;
+ 118:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 11d:	f7 e1                	mul    %ecx
+ 11f:	89 d0                	mov    %edx,%eax
+ 121:	89 ca                	mov    %ecx,%edx
+ 123:	c1 e8 03             	shr    $0x3,%eax
+ 126:	6b c0 1a             	imul   $0x1a,%eax,%eax
+ 129:	29 c2                	sub    %eax,%edx
+ 12b:	83 c2 41             	add    $0x41,%edx
+ 12e:	38 14 0f             	cmp    %dl,(%edi,%ecx,1)
+ 131:	74 cd                	je     100 <test+0xc0>
+    printf(1, "Copy failed: The memory contents of the processes is inconsistent!\n");
+ 133:	50                   	push   %eax
+ 134:	50                   	push   %eax
+ 135:	68 d4 0a 00 00       	push   $0xad4
+	printf(1, "Failed to fork a process!\n");
+ 13a:	6a 01                	push   $0x1
+ 13c:	e8 1f 05 00 00       	call   660 <printf>
+    printf(1, "Lab5 test failed!\n");
+ 141:	58                   	pop    %eax
+ 142:	5a                   	pop    %edx
+ 143:	68 9f 09 00 00       	push   $0x99f
+ 148:	6a 01                	push   $0x1
+ 14a:	e8 11 05 00 00       	call   660 <printf>
+	exit();
+ 14f:	e8 6f 03 00 00       	call   4c3 <exit>
+        printf(1, "\n*** Parent ***\n");
+ 154:	50                   	push   %eax
+ 155:	50                   	push   %eax
+ 156:	68 ef 09 00 00       	push   $0x9ef
+ 15b:	6a 01                	push   $0x1
+ 15d:	e8 fe 04 00 00       	call   660 <printf>
+        prev_free_pages = getNumFreePages();
+ 162:	e8 04 04 00 00       	call   56b <getNumFreePages>
+        for (int i=0; i<size; i++) {
+ 167:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+ 16a:	89 c6                	mov    %eax,%esi
+        for (int i=0; i<size; i++) {
+ 16c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 16f:	09 d8                	or     %ebx,%eax
+ 171:	74 71                	je     1e4 <test+0x1a4>
+ 173:	31 c9                	xor    %ecx,%ecx
+            m1[i] = (char)(97+(i%26));
+ 175:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 17a:	f7 e1                	mul    %ecx
+ 17c:	89 d0                	mov    %edx,%eax
+ 17e:	89 ca                	mov    %ecx,%edx
+ 180:	c1 e8 03             	shr    $0x3,%eax
+ 183:	6b c0 1a             	imul   $0x1a,%eax,%eax
+ 186:	29 c2                	sub    %eax,%edx
+ 188:	83 c2 61             	add    $0x61,%edx
+ 18b:	88 14 0f             	mov    %dl,(%edi,%ecx,1)
+        for (int i=0; i<size; i++) {
+ 18e:	83 c1 01             	add    $0x1,%ecx
+ 191:	39 d9                	cmp    %ebx,%ecx
+ 193:	75 e0                	jne    175 <test+0x135>
+        curr_free_pages = getNumFreePages();
+ 195:	e8 d1 03 00 00       	call   56b <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 19a:	31 db                	xor    %ebx,%ebx
+ 19c:	31 c9                	xor    %ecx,%ecx
+ 19e:	39 f0                	cmp    %esi,%eax
+ 1a0:	72 22                	jb     1c4 <test+0x184>
+ 1a2:	e9 9b 00 00 00       	jmp    242 <test+0x202>
+ 1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ae:	66 90                	xchg   %ax,%ax
+        for(int k=0;k<size;++k){
+ 1b0:	83 c1 01             	add    $0x1,%ecx
+ 1b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1b6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1b9:	83 d3 00             	adc    $0x0,%ebx
+ 1bc:	31 da                	xor    %ebx,%edx
+ 1be:	31 c8                	xor    %ecx,%eax
+ 1c0:	09 d0                	or     %edx,%eax
+ 1c2:	74 29                	je     1ed <test+0x1ad>
+			if(m1[k] != (char)(97+(k%26))) goto failed;
+ 1c4:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 1c9:	f7 e1                	mul    %ecx
+ 1cb:	89 d0                	mov    %edx,%eax
+ 1cd:	89 ca                	mov    %ecx,%edx
+ 1cf:	c1 e8 03             	shr    $0x3,%eax
+ 1d2:	6b c0 1a             	imul   $0x1a,%eax,%eax
+ 1d5:	29 c2                	sub    %eax,%edx
+ 1d7:	83 c2 61             	add    $0x61,%edx
+ 1da:	38 14 0f             	cmp    %dl,(%edi,%ecx,1)
+ 1dd:	74 d1                	je     1b0 <test+0x170>
+ 1df:	e9 4f ff ff ff       	jmp    133 <test+0xf3>
+        curr_free_pages = getNumFreePages();
+ 1e4:	e8 82 03 00 00       	call   56b <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 1e9:	39 f0                	cmp    %esi,%eax
+ 1eb:	73 55                	jae    242 <test+0x202>
+        wait();
+ 1ed:	e8 d9 02 00 00       	call   4cb <wait>
+        printf(1, "done processing %d\n", x);
+ 1f2:	52                   	push   %edx
+ 1f3:	68 ae ad 01 00       	push   $0x1adae
+ 1f8:	68 00 0a 00 00       	push   $0xa00
+ 1fd:	6a 01                	push   $0x1
+ 1ff:	e8 5c 04 00 00       	call   660 <printf>
+        printf(1, "[COW] Lab5 Parent test passed!\n");
+ 204:	59                   	pop    %ecx
+ 205:	5b                   	pop    %ebx
+ 206:	68 b4 0a 00 00       	push   $0xab4
+ 20b:	6a 01                	push   $0x1
+ 20d:	e8 4e 04 00 00       	call   660 <printf>
+ 212:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 215:	e8 a9 02 00 00       	call   4c3 <exit>
+	printf(1, "Exceeded the PHYSTOP!\n");
+ 21a:	53                   	push   %ebx
+ 21b:	53                   	push   %ebx
+ 21c:	68 88 09 00 00       	push   $0x988
+ 221:	e9 14 ff ff ff       	jmp    13a <test+0xfa>
+        curr_free_pages = getNumFreePages();
+ 226:	e8 40 03 00 00       	call   56b <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 22b:	39 f0                	cmp    %esi,%eax
+ 22d:	73 35                	jae    264 <test+0x224>
+        printf(1, "[COW] Lab5 Child test passed!\n");
+ 22f:	50                   	push   %eax
+ 230:	50                   	push   %eax
+ 231:	68 5c 0a 00 00       	push   $0xa5c
+ 236:	6a 01                	push   $0x1
+ 238:	e8 23 04 00 00       	call   660 <printf>
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	eb d3                	jmp    215 <test+0x1d5>
+            printf(1, "Lab5 Parent: Free pages should decrease after write\n");
+ 242:	56                   	push   %esi
+ 243:	56                   	push   %esi
+ 244:	68 7c 0a 00 00       	push   $0xa7c
+ 249:	6a 01                	push   $0x1
+ 24b:	e8 10 04 00 00       	call   660 <printf>
+            goto failed;
+ 250:	83 c4 10             	add    $0x10,%esp
+ 253:	e9 db fe ff ff       	jmp    133 <test+0xf3>
+	printf(1, "Failed to fork a process!\n");
+ 258:	51                   	push   %ecx
+ 259:	51                   	push   %ecx
+ 25a:	68 c4 09 00 00       	push   $0x9c4
+ 25f:	e9 d6 fe ff ff       	jmp    13a <test+0xfa>
+            printf(1, "Lab5 Child: Free pages should decrease after write\n");
+ 264:	50                   	push   %eax
+ 265:	50                   	push   %eax
+ 266:	68 28 0a 00 00       	push   $0xa28
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 ee 03 00 00       	call   660 <printf>
+            goto failed;
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	e9 b9 fe ff ff       	jmp    133 <test+0xf3>
+ 27a:	66 90                	xchg   %ax,%ax
+ 27c:	66 90                	xchg   %ax,%ax
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 1e 01 00 00       	call   4db <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getrss>:
+SYSCALL(getrss)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <usleep>:
+SYSCALL(usleep)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <lockstat>:
+SYSCALL(lockstat)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <clone>:
+SYSCALL(clone)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <join>:
+SYSCALL(join)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <futex>:
+SYSCALL(futex)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mmap>:
+SYSCALL(mmap)
+ 59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <munmap>:
+SYSCALL(munmap)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <sendfile>:
+SYSCALL(sendfile)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <splice>:
+SYSCALL(splice)
+ 5b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 78 0b 00 00 	movzbl 0xb78(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 a6 fe ff ff       	call   4e3 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 3c fe ff ff       	call   4e3 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 20 0b 00 00 	jmp    *0xb20(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 dd fd ff ff       	call   4e3 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 cb fd ff ff       	call   4e3 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 51 fd ff ff       	call   4e3 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 01 fd ff ff       	call   4e3 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb 18 0b 00 00       	mov    $0xb18,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 810:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	a1 54 0e 00 00       	mov    0xe54,%eax
+{
+ 816:	89 e5                	mov    %esp,%ebp
+ 818:	57                   	push   %edi
+ 819:	56                   	push   %esi
+ 81a:	53                   	push   %ebx
+ 81b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 81e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 828:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 82c:	39 ca                	cmp    %ecx,%edx
+ 82e:	73 30                	jae    860 <free+0x50>
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 04                	jb     838 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 834:	39 c2                	cmp    %eax,%edx
+ 836:	72 f0                	jb     828 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 838:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 83b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 83e:	39 f8                	cmp    %edi,%eax
+ 840:	74 2e                	je     870 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 842:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 845:	8b 42 04             	mov    0x4(%edx),%eax
+ 848:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 84b:	39 f1                	cmp    %esi,%ecx
+ 84d:	74 38                	je     887 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 84f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 851:	5b                   	pop    %ebx
+  freep = p;
+ 852:	89 15 54 0e 00 00    	mov    %edx,0xe54
+}
+ 858:	5e                   	pop    %esi
+ 859:	5f                   	pop    %edi
+ 85a:	5d                   	pop    %ebp
+ 85b:	c3                   	ret
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 860:	39 c1                	cmp    %eax,%ecx
+ 862:	72 d0                	jb     834 <free+0x24>
+ 864:	eb c2                	jmp    828 <free+0x18>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 870:	03 70 04             	add    0x4(%eax),%esi
+ 873:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 876:	8b 02                	mov    (%edx),%eax
+ 878:	8b 00                	mov    (%eax),%eax
+ 87a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 87d:	8b 42 04             	mov    0x4(%edx),%eax
+ 880:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 883:	39 f1                	cmp    %esi,%ecx
+ 885:	75 c8                	jne    84f <free+0x3f>
+    p->s.size += bp->s.size;
+ 887:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 88a:	89 15 54 0e 00 00    	mov    %edx,0xe54
+    p->s.size += bp->s.size;
+ 890:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 893:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 896:	89 0a                	mov    %ecx,(%edx)
+}
+ 898:	5b                   	pop    %ebx
+ 899:	5e                   	pop    %esi
+ 89a:	5f                   	pop    %edi
+ 89b:	5d                   	pop    %ebp
+ 89c:	c3                   	ret
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ac:	8b 15 54 0e 00 00    	mov    0xe54,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8b5:	c1 ef 03             	shr    $0x3,%edi
+ 8b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8bb:	85 d2                	test   %edx,%edx
+ 8bd:	0f 84 8d 00 00 00    	je     950 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c8:	39 f9                	cmp    %edi,%ecx
+ 8ca:	73 64                	jae    930 <malloc+0x90>
+  if(nu < 4096)
+ 8cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8d1:	39 df                	cmp    %ebx,%edi
+ 8d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8dd:	eb 0a                	jmp    8e9 <malloc+0x49>
+ 8df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e5:	39 f9                	cmp    %edi,%ecx
+ 8e7:	73 47                	jae    930 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8e9:	89 c2                	mov    %eax,%edx
+ 8eb:	39 05 54 0e 00 00    	cmp    %eax,0xe54
+ 8f1:	75 ed                	jne    8e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	56                   	push   %esi
+ 8f7:	e8 4f fc ff ff       	call   54b <sbrk>
+  if(p == (char*)-1)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 902:	74 1c                	je     920 <malloc+0x80>
+  hp->s.size = nu;
+ 904:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 907:	83 ec 0c             	sub    $0xc,%esp
+ 90a:	83 c0 08             	add    $0x8,%eax
+ 90d:	50                   	push   %eax
+ 90e:	e8 fd fe ff ff       	call   810 <free>
+  return freep;
+ 913:	8b 15 54 0e 00 00    	mov    0xe54,%edx
+      if((p = morecore(nunits)) == 0)
+ 919:	83 c4 10             	add    $0x10,%esp
+ 91c:	85 d2                	test   %edx,%edx
+ 91e:	75 c0                	jne    8e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 923:	31 c0                	xor    %eax,%eax
+}
+ 925:	5b                   	pop    %ebx
+ 926:	5e                   	pop    %esi
+ 927:	5f                   	pop    %edi
+ 928:	5d                   	pop    %ebp
+ 929:	c3                   	ret
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 930:	39 cf                	cmp    %ecx,%edi
+ 932:	74 4c                	je     980 <malloc+0xe0>
+        p->s.size -= nunits;
+ 934:	29 f9                	sub    %edi,%ecx
+ 936:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 939:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 93c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 93f:	89 15 54 0e 00 00    	mov    %edx,0xe54
+}
+ 945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 948:	83 c0 08             	add    $0x8,%eax
+}
+ 94b:	5b                   	pop    %ebx
+ 94c:	5e                   	pop    %esi
+ 94d:	5f                   	pop    %edi
+ 94e:	5d                   	pop    %ebp
+ 94f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 950:	c7 05 54 0e 00 00 58 	movl   $0xe58,0xe54
+ 957:	0e 00 00 
+    base.s.size = 0;
+ 95a:	b8 58 0e 00 00       	mov    $0xe58,%eax
+    base.s.ptr = freep = prevp = &base;
+ 95f:	c7 05 58 0e 00 00 58 	movl   $0xe58,0xe58
+ 966:	0e 00 00 
+    base.s.size = 0;
+ 969:	c7 05 5c 0e 00 00 00 	movl   $0x0,0xe5c
+ 970:	00 00 00 
+    if(p->s.size >= nunits){
+ 973:	e9 54 ff ff ff       	jmp    8cc <malloc+0x2c>
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 980:	8b 08                	mov    (%eax),%ecx
+ 982:	89 0a                	mov    %ecx,(%edx)
+ 984:	eb b9                	jmp    93f <malloc+0x9f>
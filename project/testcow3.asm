@@ -0,0 +1,1486 @@
+
+_testcow3:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+	exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "Test starting...\n");
+  11:	68 a4 0a 00 00       	push   $0xaa4
+  16:	6a 01                	push   $0x1
+  18:	e8 d3 06 00 00       	call   6f0 <printf>
+	test();
+  1d:	e8 3e 00 00 00       	call   60 <test>
+  22:	66 90                	xchg   %ax,%ax
+  24:	66 90                	xchg   %ax,%ax
+  26:	66 90                	xchg   %ax,%ax
+  28:	66 90                	xchg   %ax,%ax
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <processing>:
+processing(int *x) {
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	83 ec 0c             	sub    $0xc,%esp
+  36:	8b 45 08             	mov    0x8(%ebp),%eax
+  39:	c7 00 ae ad 01 00    	movl   $0x1adae,(%eax)
+    printf(1, "done processing %d\n", x);
+  3f:	50                   	push   %eax
+  40:	68 18 0a 00 00       	push   $0xa18
+  45:	6a 01                	push   $0x1
+  47:	e8 a4 06 00 00       	call   6f0 <printf>
+}
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	c9                   	leave
+  50:	c3                   	ret
+  51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+
+00000060 <test>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	57                   	push   %edi
+  64:	56                   	push   %esi
+  65:	53                   	push   %ebx
+  66:	83 ec 2c             	sub    $0x2c,%esp
+    uint prev_free_pages = getNumFreePages();
+  69:	e8 8d 05 00 00       	call   5fb <getNumFreePages>
+    char *m1 = (char*)malloc(size);
+  6e:	83 ec 0c             	sub    $0xc,%esp
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 2; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  71:	8d 70 ec             	lea    -0x14(%eax),%esi
+  74:	c1 e6 0c             	shl    $0xc,%esi
+  77:	d1 ee                	shr    %esi
+    char *m1 = (char*)malloc(size);
+  79:	56                   	push   %esi
+  7a:	e8 b1 08 00 00       	call   930 <malloc>
+    if (m1 == 0) goto out_of_memory;
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	85 c0                	test   %eax,%eax
+  84:	0f 84 ac 01 00 00    	je     236 <test+0x1d6>
+    printf(1, "\n*** Forking ***\n");
+  8a:	83 ec 08             	sub    $0x8,%esp
+  8d:	89 c3                	mov    %eax,%ebx
+  8f:	68 56 0a 00 00       	push   $0xa56
+  94:	6a 01                	push   $0x1
+  96:	e8 55 06 00 00       	call   6f0 <printf>
+    pid = fork();
+  9b:	e8 ab 04 00 00       	call   54b <fork>
+    if (pid < 0) goto fork_failed; // Fork failed
+  a0:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  a3:	89 c7                	mov    %eax,%edi
+    if (pid < 0) goto fork_failed; // Fork failed
+  a5:	85 c0                	test   %eax,%eax
+  a7:	0f 88 95 01 00 00    	js     242 <test+0x1e2>
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 2; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  ad:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  b0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    if (pid == 0) { // Child process
+  b7:	0f 85 cd 00 00 00    	jne    18a <test+0x12a>
+        printf(1, "\n*** Child ***\n");
+  bd:	51                   	push   %ecx
+  be:	51                   	push   %ecx
+  bf:	68 83 0a 00 00       	push   $0xa83
+  c4:	6a 01                	push   $0x1
+  c6:	e8 25 06 00 00       	call   6f0 <printf>
+        prev_free_pages = getNumFreePages();
+  cb:	e8 2b 05 00 00       	call   5fb <getNumFreePages>
+        for (int i=0; i<size; i++) {
+  d0:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+  d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        for (int i=0; i<size; i++) {
+  d6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  d9:	09 f0                	or     %esi,%eax
+  db:	0f 84 99 01 00 00    	je     27a <test+0x21a>
+            m1[i] = (char)(65+(i%26));
+  e1:	b9 4f ec c4 4e       	mov    $0x4ec4ec4f,%ecx
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  f0:	89 f8                	mov    %edi,%eax
+  f2:	f7 e1                	mul    %ecx
+  f4:	89 f8                	mov    %edi,%eax
+  f6:	c1 ea 03             	shr    $0x3,%edx
+  f9:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  fc:	29 d0                	sub    %edx,%eax
+  fe:	83 c0 41             	add    $0x41,%eax
+ 101:	88 04 3b             	mov    %al,(%ebx,%edi,1)
+        for (int i=0; i<size; i++) {
+ 104:	83 c7 01             	add    $0x1,%edi
+ 107:	39 f7                	cmp    %esi,%edi
+ 109:	75 e5                	jne    f0 <test+0x90>
+        curr_free_pages = getNumFreePages();
+ 10b:	e8 eb 04 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 110:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 113:	39 f8                	cmp    %edi,%eax
+ 115:	0f 83 49 01 00 00    	jae    264 <test+0x204>
+        int x = 0;
+ 11b:	31 c0                	xor    %eax,%eax
+        processing(&x);
+ 11d:	83 ec 0c             	sub    $0xc,%esp
+ 120:	31 f6                	xor    %esi,%esi
+ 122:	31 ff                	xor    %edi,%edi
+        int x = 0;
+ 124:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        processing(&x);
+ 127:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 12a:	50                   	push   %eax
+ 12b:	e8 00 ff ff ff       	call   30 <processing>
+        for(int k=0;k<size;++k){
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	eb 1b                	jmp    150 <test+0xf0>
+ 135:	8d 76 00             	lea    0x0(%esi),%esi
+ 138:	83 c6 01             	add    $0x1,%esi
+ 13b:	83 d7 00             	adc    $0x0,%edi
+ 13e:	89 f0                	mov    %esi,%eax
+ 140:	33 45 d0             	xor    -0x30(%ebp),%eax
+ 143:	89 fa                	mov    %edi,%edx
+ 145:	33 55 d4             	xor    -0x2c(%ebp),%edx
+ 148:	09 d0                	or     %edx,%eax
+ 14a:	0f 84 4a 01 00 00    	je     29a <test+0x23a>
+			if(m1[k] != (char)(65+(k%26))) goto failed;
+ 150:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 155:	f7 e6                	mul    %esi
+ 157:	89 f0                	mov    %esi,%eax
+ 159:	c1 ea 03             	shr    $0x3,%edx
+ 15c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 15f:	29 d0                	sub    %edx,%eax
+ 161:	83 c0 41             	add    $0x41,%eax
+ 164:	38 04 33             	cmp    %al,(%ebx,%esi,1)
+ 167:	74 cf                	je     138 <test+0xd8>
+    printf(1, "Copy failed: The memory contents of the processes is inconsistent!\n");
+ 169:	50                   	push   %eax
+ 16a:	50                   	push   %eax
+ 16b:	68 64 0b 00 00       	push   $0xb64
+	printf(1, "Failed to fork a process!\n");
+ 170:	6a 01                	push   $0x1
+ 172:	e8 79 05 00 00       	call   6f0 <printf>
+    printf(1, "Lab5 test failed!\n");
+ 177:	5b                   	pop    %ebx
+ 178:	5e                   	pop    %esi
+ 179:	68 43 0a 00 00       	push   $0xa43
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 6b 05 00 00       	call   6f0 <printf>
+	exit();
+ 185:	e8 c9 03 00 00       	call   553 <exit>
+        printf(1, "\n*** Parent ***\n");
+ 18a:	50                   	push   %eax
+ 18b:	50                   	push   %eax
+ 18c:	68 93 0a 00 00       	push   $0xa93
+ 191:	6a 01                	push   $0x1
+ 193:	e8 58 05 00 00       	call   6f0 <printf>
+        prev_free_pages = getNumFreePages();
+ 198:	e8 5e 04 00 00       	call   5fb <getNumFreePages>
+        for (int i=0; i<size; i++) {
+ 19d:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+ 1a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        for (int i=0; i<size; i++) {
+ 1a3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1a6:	09 f0                	or     %esi,%eax
+ 1a8:	0f 84 02 01 00 00    	je     2b0 <test+0x250>
+ 1ae:	31 c9                	xor    %ecx,%ecx
+            m1[i] = (char)(97+(i%26));
+ 1b0:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+ 1b5:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b8:	89 c8                	mov    %ecx,%eax
+ 1ba:	f7 e7                	mul    %edi
+ 1bc:	89 c8                	mov    %ecx,%eax
+ 1be:	c1 ea 03             	shr    $0x3,%edx
+ 1c1:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 1c4:	29 d0                	sub    %edx,%eax
+ 1c6:	83 c0 61             	add    $0x61,%eax
+ 1c9:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+        for (int i=0; i<size; i++) {
+ 1cc:	83 c1 01             	add    $0x1,%ecx
+ 1cf:	39 f1                	cmp    %esi,%ecx
+ 1d1:	75 e5                	jne    1b8 <test+0x158>
+        curr_free_pages = getNumFreePages();
+ 1d3:	e8 23 04 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 1d8:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 1db:	39 f8                	cmp    %edi,%eax
+ 1dd:	73 6f                	jae    24e <test+0x1ee>
+        processing(&x);
+ 1df:	83 ec 0c             	sub    $0xc,%esp
+ 1e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+        int x = 0;
+ 1e5:	31 f6                	xor    %esi,%esi
+        processing(&x);
+ 1e7:	31 ff                	xor    %edi,%edi
+        int x = 0;
+ 1e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+        processing(&x);
+ 1ec:	31 f6                	xor    %esi,%esi
+ 1ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 1f1:	50                   	push   %eax
+ 1f2:	e8 39 fe ff ff       	call   30 <processing>
+        for(int k=0;k<size;++k){
+ 1f7:	83 c4 10             	add    $0x10,%esp
+ 1fa:	eb 1c                	jmp    218 <test+0x1b8>
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 c6 01             	add    $0x1,%esi
+ 203:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 206:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 209:	83 d7 00             	adc    $0x0,%edi
+ 20c:	31 fa                	xor    %edi,%edx
+ 20e:	31 f0                	xor    %esi,%eax
+ 210:	09 d0                	or     %edx,%eax
+ 212:	0f 84 bb 00 00 00    	je     2d3 <test+0x273>
+			if(m1[k] != (char)(97+(k%26))) goto failed;
+ 218:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 21d:	f7 e6                	mul    %esi
+ 21f:	89 f0                	mov    %esi,%eax
+ 221:	c1 ea 03             	shr    $0x3,%edx
+ 224:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 227:	29 d0                	sub    %edx,%eax
+ 229:	83 c0 61             	add    $0x61,%eax
+ 22c:	38 04 33             	cmp    %al,(%ebx,%esi,1)
+ 22f:	74 cf                	je     200 <test+0x1a0>
+ 231:	e9 33 ff ff ff       	jmp    169 <test+0x109>
+	printf(1, "Exceeded the PHYSTOP!\n");
+ 236:	50                   	push   %eax
+ 237:	50                   	push   %eax
+ 238:	68 2c 0a 00 00       	push   $0xa2c
+ 23d:	e9 2e ff ff ff       	jmp    170 <test+0x110>
+	printf(1, "Failed to fork a process!\n");
+ 242:	57                   	push   %edi
+ 243:	57                   	push   %edi
+ 244:	68 68 0a 00 00       	push   $0xa68
+ 249:	e9 22 ff ff ff       	jmp    170 <test+0x110>
+            printf(1, "Lab5 Parent: Free pages should decrease after write\n");
+ 24e:	50                   	push   %eax
+ 24f:	50                   	push   %eax
+ 250:	68 0c 0b 00 00       	push   $0xb0c
+ 255:	6a 01                	push   $0x1
+ 257:	e8 94 04 00 00       	call   6f0 <printf>
+            goto failed;
+ 25c:	83 c4 10             	add    $0x10,%esp
+ 25f:	e9 05 ff ff ff       	jmp    169 <test+0x109>
+            printf(1, "Lab5 Child: Free pages should decrease after write\n");
+ 264:	52                   	push   %edx
+ 265:	52                   	push   %edx
+ 266:	68 b8 0a 00 00       	push   $0xab8
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 7e 04 00 00       	call   6f0 <printf>
+            goto failed;
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	e9 ef fe ff ff       	jmp    169 <test+0x109>
+        curr_free_pages = getNumFreePages();
+ 27a:	e8 7c 03 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 27f:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+ 282:	39 d8                	cmp    %ebx,%eax
+ 284:	73 de                	jae    264 <test+0x204>
+        int x = 0;
+ 286:	31 c0                	xor    %eax,%eax
+        processing(&x);
+ 288:	83 ec 0c             	sub    $0xc,%esp
+        int x = 0;
+ 28b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        processing(&x);
+ 28e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 291:	50                   	push   %eax
+ 292:	e8 99 fd ff ff       	call   30 <processing>
+ 297:	83 c4 10             	add    $0x10,%esp
+        printf(1, "[COW] Lab5 Child test passed!\n");
+ 29a:	50                   	push   %eax
+ 29b:	50                   	push   %eax
+ 29c:	68 ec 0a 00 00       	push   $0xaec
+ 2a1:	6a 01                	push   $0x1
+ 2a3:	e8 48 04 00 00       	call   6f0 <printf>
+ 2a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2ab:	e8 a3 02 00 00       	call   553 <exit>
+        curr_free_pages = getNumFreePages();
+ 2b0:	e8 46 03 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 2b5:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+ 2b8:	39 d8                	cmp    %ebx,%eax
+ 2ba:	73 92                	jae    24e <test+0x1ee>
+        processing(&x);
+ 2bc:	83 ec 0c             	sub    $0xc,%esp
+ 2bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+        int x = 0;
+ 2c2:	31 ff                	xor    %edi,%edi
+ 2c4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+        processing(&x);
+ 2c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 2ca:	50                   	push   %eax
+ 2cb:	e8 60 fd ff ff       	call   30 <processing>
+ 2d0:	83 c4 10             	add    $0x10,%esp
+        wait();
+ 2d3:	e8 83 02 00 00       	call   55b <wait>
+        processing(&x);
+ 2d8:	83 ec 0c             	sub    $0xc,%esp
+ 2db:	ff 75 cc             	push   -0x34(%ebp)
+ 2de:	e8 4d fd ff ff       	call   30 <processing>
+        printf(1, "done processing %d\n", x);
+ 2e3:	83 c4 0c             	add    $0xc,%esp
+ 2e6:	ff 75 e4             	push   -0x1c(%ebp)
+ 2e9:	68 18 0a 00 00       	push   $0xa18
+ 2ee:	6a 01                	push   $0x1
+ 2f0:	e8 fb 03 00 00       	call   6f0 <printf>
+        printf(1, "[COW] Lab5 Parent test passed!\n");
+ 2f5:	5a                   	pop    %edx
+ 2f6:	59                   	pop    %ecx
+ 2f7:	68 44 0b 00 00       	push   $0xb44
+ 2fc:	6a 01                	push   $0x1
+ 2fe:	e8 ed 03 00 00       	call   6f0 <printf>
+ 303:	83 c4 10             	add    $0x10,%esp
+ 306:	eb a3                	jmp    2ab <test+0x24b>
+ 308:	66 90                	xchg   %ax,%ax
+ 30a:	66 90                	xchg   %ax,%ax
+ 30c:	66 90                	xchg   %ax,%ax
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 310:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 311:	31 c0                	xor    %eax,%eax
+{
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	53                   	push   %ebx
+ 316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 320:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 324:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 327:	83 c0 01             	add    $0x1,%eax
+ 32a:	84 d2                	test   %dl,%dl
+ 32c:	75 f2                	jne    320 <strcpy+0x10>
+    ;
+  return os;
+}
+ 32e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 331:	89 c8                	mov    %ecx,%eax
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+ 335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+ 347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 34a:	0f b6 02             	movzbl (%edx),%eax
+ 34d:	84 c0                	test   %al,%al
+ 34f:	75 17                	jne    368 <strcmp+0x28>
+ 351:	eb 3a                	jmp    38d <strcmp+0x4d>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 35c:	83 c2 01             	add    $0x1,%edx
+ 35f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 362:	84 c0                	test   %al,%al
+ 364:	74 1a                	je     380 <strcmp+0x40>
+    p++, q++;
+ 366:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 368:	0f b6 19             	movzbl (%ecx),%ebx
+ 36b:	38 c3                	cmp    %al,%bl
+ 36d:	74 e9                	je     358 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 36f:	29 d8                	sub    %ebx,%eax
+}
+ 371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 374:	c9                   	leave
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 380:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 384:	31 c0                	xor    %eax,%eax
+ 386:	29 d8                	sub    %ebx,%eax
+}
+ 388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 38b:	c9                   	leave
+ 38c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 38d:	0f b6 19             	movzbl (%ecx),%ebx
+ 390:	31 c0                	xor    %eax,%eax
+ 392:	eb db                	jmp    36f <strcmp+0x2f>
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3a9:	74 15                	je     3c0 <strlen+0x20>
+ 3ab:	31 c0                	xor    %eax,%eax
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 3b0:	83 c0 01             	add    $0x1,%eax
+ 3b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	75 f5                	jne    3b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3bb:	89 c8                	mov    %ecx,%eax
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+ 3bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3c0:	31 c9                	xor    %ecx,%ecx
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	89 c8                	mov    %ecx,%eax
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dd:	89 d7                	mov    %edx,%edi
+ 3df:	fc                   	cld
+ 3e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3fa:	0f b6 10             	movzbl (%eax),%edx
+ 3fd:	84 d2                	test   %dl,%dl
+ 3ff:	75 12                	jne    413 <strchr+0x23>
+ 401:	eb 1d                	jmp    420 <strchr+0x30>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 40c:	83 c0 01             	add    $0x1,%eax
+ 40f:	84 d2                	test   %dl,%dl
+ 411:	74 0d                	je     420 <strchr+0x30>
+    if(*s == c)
+ 413:	38 d1                	cmp    %dl,%cl
+ 415:	75 f1                	jne    408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 420:	31 c0                	xor    %eax,%eax
+}
+ 422:	5d                   	pop    %ebp
+ 423:	c3                   	ret
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 439:	31 db                	xor    %ebx,%ebx
+{
+ 43b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 43e:	eb 27                	jmp    467 <gets+0x37>
+    cc = read(0, &c, 1);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	6a 01                	push   $0x1
+ 445:	56                   	push   %esi
+ 446:	6a 00                	push   $0x0
+ 448:	e8 1e 01 00 00       	call   56b <read>
+    if(cc < 1)
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	85 c0                	test   %eax,%eax
+ 452:	7e 1d                	jle    471 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 45f:	3c 0a                	cmp    $0xa,%al
+ 461:	74 10                	je     473 <gets+0x43>
+ 463:	3c 0d                	cmp    $0xd,%al
+ 465:	74 0c                	je     473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 467:	89 df                	mov    %ebx,%edi
+ 469:	83 c3 01             	add    $0x1,%ebx
+ 46c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 46f:	7c cf                	jl     440 <gets+0x10>
+ 471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 47a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47d:	5b                   	pop    %ebx
+ 47e:	5e                   	pop    %esi
+ 47f:	5f                   	pop    %edi
+ 480:	5d                   	pop    %ebp
+ 481:	c3                   	ret
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 495:	83 ec 08             	sub    $0x8,%esp
+ 498:	6a 00                	push   $0x0
+ 49a:	ff 75 08             	push   0x8(%ebp)
+ 49d:	e8 f1 00 00 00       	call   593 <open>
+  if(fd < 0)
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	78 27                	js     4d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	ff 75 0c             	push   0xc(%ebp)
+ 4af:	89 c3                	mov    %eax,%ebx
+ 4b1:	50                   	push   %eax
+ 4b2:	e8 f4 00 00 00       	call   5ab <fstat>
+  close(fd);
+ 4b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4bc:	e8 ba 00 00 00       	call   57b <close>
+  return r;
+ 4c1:	83 c4 10             	add    $0x10,%esp
+}
+ 4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4c7:	89 f0                	mov    %esi,%eax
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4d5:	eb ed                	jmp    4c4 <stat+0x34>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	53                   	push   %ebx
+ 4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4e7:	0f be 02             	movsbl (%edx),%eax
+ 4ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4f5:	77 1e                	ja     515 <atoi+0x35>
+ 4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 500:	83 c2 01             	add    $0x1,%edx
+ 503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 50a:	0f be 02             	movsbl (%edx),%eax
+ 50d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 510:	80 fb 09             	cmp    $0x9,%bl
+ 513:	76 eb                	jbe    500 <atoi+0x20>
+  return n;
+}
+ 515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 518:	89 c8                	mov    %ecx,%eax
+ 51a:	c9                   	leave
+ 51b:	c3                   	ret
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	8b 45 10             	mov    0x10(%ebp),%eax
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 52e:	85 c0                	test   %eax,%eax
+ 530:	7e 13                	jle    545 <memmove+0x25>
+ 532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 534:	89 d7                	mov    %edx,%edi
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 541:	39 f8                	cmp    %edi,%eax
+ 543:	75 fb                	jne    540 <memmove+0x20>
+  return vdst;
+}
+ 545:	5e                   	pop    %esi
+ 546:	89 d0                	mov    %edx,%eax
+ 548:	5f                   	pop    %edi
+ 549:	5d                   	pop    %ebp
+ 54a:	c3                   	ret
+
+0000054b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 54b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <exit>:
+SYSCALL(exit)
+ 553:	b8 02 00 00 00       	mov    $0x2,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <wait>:
+SYSCALL(wait)
+ 55b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <pipe>:
+SYSCALL(pipe)
+ 563:	b8 04 00 00 00       	mov    $0x4,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <read>:
+SYSCALL(read)
+ 56b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <write>:
+SYSCALL(write)
+ 573:	b8 10 00 00 00       	mov    $0x10,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <close>:
+SYSCALL(close)
+ 57b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <kill>:
+SYSCALL(kill)
+ 583:	b8 06 00 00 00       	mov    $0x6,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <exec>:
+SYSCALL(exec)
+ 58b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <open>:
+SYSCALL(open)
+ 593:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mknod>:
+SYSCALL(mknod)
+ 59b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <unlink>:
+SYSCALL(unlink)
+ 5a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <fstat>:
+SYSCALL(fstat)
+ 5ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <link>:
+SYSCALL(link)
+ 5b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mkdir>:
+SYSCALL(mkdir)
+ 5bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <chdir>:
+SYSCALL(chdir)
+ 5c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <dup>:
+SYSCALL(dup)
+ 5cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getpid>:
+SYSCALL(getpid)
+ 5d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sbrk>:
+SYSCALL(sbrk)
+ 5db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+ 5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <uptime>:
+SYSCALL(uptime)
+ 5eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getrss>:
+SYSCALL(getrss)
+ 5f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 5fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <usleep>:
+SYSCALL(usleep)
+ 603:	b8 18 00 00 00       	mov    $0x18,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <lockstat>:
+SYSCALL(lockstat)
+ 60b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <clone>:
+SYSCALL(clone)
+ 613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <join>:
+SYSCALL(join)
+ 61b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <futex>:
+SYSCALL(futex)
+ 623:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mmap>:
+SYSCALL(mmap)
+ 62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <munmap>:
+SYSCALL(munmap)
+ 633:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sendfile>:
+SYSCALL(sendfile)
+ 63b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <splice>:
+SYSCALL(splice)
+ 643:	b8 20 00 00 00       	mov    $0x20,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+ 64b:	66 90                	xchg   %ax,%ax
+ 64d:	66 90                	xchg   %ax,%ax
+ 64f:	90                   	nop
+
+00000650 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 658:	89 d1                	mov    %edx,%ecx
+{
+ 65a:	83 ec 3c             	sub    $0x3c,%esp
+ 65d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 660:	85 d2                	test   %edx,%edx
+ 662:	0f 89 80 00 00 00    	jns    6e8 <printint+0x98>
+ 668:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 66c:	74 7a                	je     6e8 <printint+0x98>
+    x = -xx;
+ 66e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 670:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 675:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 678:	31 f6                	xor    %esi,%esi
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 680:	89 c8                	mov    %ecx,%eax
+ 682:	31 d2                	xor    %edx,%edx
+ 684:	89 f7                	mov    %esi,%edi
+ 686:	f7 f3                	div    %ebx
+ 688:	8d 76 01             	lea    0x1(%esi),%esi
+ 68b:	0f b6 92 08 0c 00 00 	movzbl 0xc08(%edx),%edx
+ 692:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 696:	89 ca                	mov    %ecx,%edx
+ 698:	89 c1                	mov    %eax,%ecx
+ 69a:	39 da                	cmp    %ebx,%edx
+ 69c:	73 e2                	jae    680 <printint+0x30>
+  if(neg)
+ 69e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6a1:	85 c0                	test   %eax,%eax
+ 6a3:	74 07                	je     6ac <printint+0x5c>
+    buf[i++] = '-';
+ 6a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6aa:	89 f7                	mov    %esi,%edi
+ 6ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6b2:	01 df                	add    %ebx,%edi
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6bb:	83 ec 04             	sub    $0x4,%esp
+ 6be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6c4:	6a 01                	push   $0x1
+ 6c6:	50                   	push   %eax
+ 6c7:	56                   	push   %esi
+ 6c8:	e8 a6 fe ff ff       	call   573 <write>
+  while(--i >= 0)
+ 6cd:	89 f8                	mov    %edi,%eax
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	83 ef 01             	sub    $0x1,%edi
+ 6d5:	39 d8                	cmp    %ebx,%eax
+ 6d7:	75 df                	jne    6b8 <printint+0x68>
+}
+ 6d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6dc:	5b                   	pop    %ebx
+ 6dd:	5e                   	pop    %esi
+ 6de:	5f                   	pop    %edi
+ 6df:	5d                   	pop    %ebp
+ 6e0:	c3                   	ret
+ 6e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6e8:	31 c0                	xor    %eax,%eax
+ 6ea:	eb 89                	jmp    675 <printint+0x25>
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 702:	83 c6 01             	add    $0x1,%esi
+ 705:	84 db                	test   %bl,%bl
+ 707:	74 67                	je     770 <printf+0x80>
+ 709:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 70c:	31 d2                	xor    %edx,%edx
+ 70e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 711:	eb 34                	jmp    747 <printf+0x57>
+ 713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 717:	90                   	nop
+ 718:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 71b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 720:	83 f8 25             	cmp    $0x25,%eax
+ 723:	74 18                	je     73d <printf+0x4d>
+  write(fd, &c, 1);
+ 725:	83 ec 04             	sub    $0x4,%esp
+ 728:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 72b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72e:	6a 01                	push   $0x1
+ 730:	50                   	push   %eax
+ 731:	57                   	push   %edi
+ 732:	e8 3c fe ff ff       	call   573 <write>
+ 737:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 73a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 73d:	0f b6 1e             	movzbl (%esi),%ebx
+ 740:	83 c6 01             	add    $0x1,%esi
+ 743:	84 db                	test   %bl,%bl
+ 745:	74 29                	je     770 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 747:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 74a:	85 d2                	test   %edx,%edx
+ 74c:	74 ca                	je     718 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 74e:	83 fa 25             	cmp    $0x25,%edx
+ 751:	75 ea                	jne    73d <printf+0x4d>
+      if(c == 'd'){
+ 753:	83 f8 25             	cmp    $0x25,%eax
+ 756:	0f 84 24 01 00 00    	je     880 <printf+0x190>
+ 75c:	83 e8 63             	sub    $0x63,%eax
+ 75f:	83 f8 15             	cmp    $0x15,%eax
+ 762:	77 1c                	ja     780 <printf+0x90>
+ 764:	ff 24 85 b0 0b 00 00 	jmp    *0xbb0(,%eax,4)
+ 76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 773:	5b                   	pop    %ebx
+ 774:	5e                   	pop    %esi
+ 775:	5f                   	pop    %edi
+ 776:	5d                   	pop    %ebp
+ 777:	c3                   	ret
+ 778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 786:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 78a:	6a 01                	push   $0x1
+ 78c:	52                   	push   %edx
+ 78d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 790:	57                   	push   %edi
+ 791:	e8 dd fd ff ff       	call   573 <write>
+ 796:	83 c4 0c             	add    $0xc,%esp
+ 799:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 79c:	6a 01                	push   $0x1
+ 79e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7a1:	52                   	push   %edx
+ 7a2:	57                   	push   %edi
+ 7a3:	e8 cb fd ff ff       	call   573 <write>
+        putc(fd, c);
+ 7a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ab:	31 d2                	xor    %edx,%edx
+ 7ad:	eb 8e                	jmp    73d <printf+0x4d>
+ 7af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 00                	push   $0x0
+ 7bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7c4:	e8 87 fe ff ff       	call   650 <printint>
+        ap++;
+ 7c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cf:	31 d2                	xor    %edx,%edx
+ 7d1:	e9 67 ff ff ff       	jmp    73d <printf+0x4d>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7e5:	83 c0 04             	add    $0x4,%eax
+ 7e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7eb:	85 db                	test   %ebx,%ebx
+ 7ed:	0f 84 9d 00 00 00    	je     890 <printf+0x1a0>
+        while(*s != 0){
+ 7f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	0f 84 3d ff ff ff    	je     73d <printf+0x4d>
+ 800:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 803:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 806:	89 de                	mov    %ebx,%esi
+ 808:	89 d3                	mov    %edx,%ebx
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 816:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 819:	6a 01                	push   $0x1
+ 81b:	53                   	push   %ebx
+ 81c:	57                   	push   %edi
+ 81d:	e8 51 fd ff ff       	call   573 <write>
+        while(*s != 0){
+ 822:	0f b6 06             	movzbl (%esi),%eax
+ 825:	83 c4 10             	add    $0x10,%esp
+ 828:	84 c0                	test   %al,%al
+ 82a:	75 e4                	jne    810 <printf+0x120>
+      state = 0;
+ 82c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 82f:	31 d2                	xor    %edx,%edx
+ 831:	e9 07 ff ff ff       	jmp    73d <printf+0x4d>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 840:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 84b:	8b 13                	mov    (%ebx),%edx
+ 84d:	6a 01                	push   $0x1
+ 84f:	e9 6b ff ff ff       	jmp    7bf <printf+0xcf>
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 858:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 85b:	83 ec 04             	sub    $0x4,%esp
+ 85e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 861:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 863:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 866:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 869:	6a 01                	push   $0x1
+ 86b:	52                   	push   %edx
+ 86c:	57                   	push   %edi
+ 86d:	e8 01 fd ff ff       	call   573 <write>
+        ap++;
+ 872:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 875:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 878:	31 d2                	xor    %edx,%edx
+ 87a:	e9 be fe ff ff       	jmp    73d <printf+0x4d>
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 886:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 889:	6a 01                	push   $0x1
+ 88b:	e9 11 ff ff ff       	jmp    7a1 <printf+0xb1>
+ 890:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 895:	bb a8 0b 00 00       	mov    $0xba8,%ebx
+ 89a:	e9 61 ff ff ff       	jmp    800 <printf+0x110>
+ 89f:	90                   	nop
+
+000008a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	a1 e4 0e 00 00       	mov    0xee4,%eax
+{
+ 8a6:	89 e5                	mov    %esp,%ebp
+ 8a8:	57                   	push   %edi
+ 8a9:	56                   	push   %esi
+ 8aa:	53                   	push   %ebx
+ 8ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8bc:	39 ca                	cmp    %ecx,%edx
+ 8be:	73 30                	jae    8f0 <free+0x50>
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 04                	jb     8c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c4:	39 c2                	cmp    %eax,%edx
+ 8c6:	72 f0                	jb     8b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ce:	39 f8                	cmp    %edi,%eax
+ 8d0:	74 2e                	je     900 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8db:	39 f1                	cmp    %esi,%ecx
+ 8dd:	74 38                	je     917 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8e1:	5b                   	pop    %ebx
+  freep = p;
+ 8e2:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+}
+ 8e8:	5e                   	pop    %esi
+ 8e9:	5f                   	pop    %edi
+ 8ea:	5d                   	pop    %ebp
+ 8eb:	c3                   	ret
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f0:	39 c1                	cmp    %eax,%ecx
+ 8f2:	72 d0                	jb     8c4 <free+0x24>
+ 8f4:	eb c2                	jmp    8b8 <free+0x18>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 900:	03 70 04             	add    0x4(%eax),%esi
+ 903:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 906:	8b 02                	mov    (%edx),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 90d:	8b 42 04             	mov    0x4(%edx),%eax
+ 910:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 913:	39 f1                	cmp    %esi,%ecx
+ 915:	75 c8                	jne    8df <free+0x3f>
+    p->s.size += bp->s.size;
+ 917:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 91a:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+    p->s.size += bp->s.size;
+ 920:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 923:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 926:	89 0a                	mov    %ecx,(%edx)
+}
+ 928:	5b                   	pop    %ebx
+ 929:	5e                   	pop    %esi
+ 92a:	5f                   	pop    %edi
+ 92b:	5d                   	pop    %ebp
+ 92c:	c3                   	ret
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000930 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 939:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 93c:	8b 15 e4 0e 00 00    	mov    0xee4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 942:	8d 78 07             	lea    0x7(%eax),%edi
+ 945:	c1 ef 03             	shr    $0x3,%edi
+ 948:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 94b:	85 d2                	test   %edx,%edx
+ 94d:	0f 84 8d 00 00 00    	je     9e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 953:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 955:	8b 48 04             	mov    0x4(%eax),%ecx
+ 958:	39 f9                	cmp    %edi,%ecx
+ 95a:	73 64                	jae    9c0 <malloc+0x90>
+  if(nu < 4096)
+ 95c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 961:	39 df                	cmp    %ebx,%edi
+ 963:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 966:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 96d:	eb 0a                	jmp    979 <malloc+0x49>
+ 96f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 970:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 972:	8b 48 04             	mov    0x4(%eax),%ecx
+ 975:	39 f9                	cmp    %edi,%ecx
+ 977:	73 47                	jae    9c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 979:	89 c2                	mov    %eax,%edx
+ 97b:	39 05 e4 0e 00 00    	cmp    %eax,0xee4
+ 981:	75 ed                	jne    970 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	56                   	push   %esi
+ 987:	e8 4f fc ff ff       	call   5db <sbrk>
+  if(p == (char*)-1)
+ 98c:	83 c4 10             	add    $0x10,%esp
+ 98f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 992:	74 1c                	je     9b0 <malloc+0x80>
+  hp->s.size = nu;
+ 994:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 997:	83 ec 0c             	sub    $0xc,%esp
+ 99a:	83 c0 08             	add    $0x8,%eax
+ 99d:	50                   	push   %eax
+ 99e:	e8 fd fe ff ff       	call   8a0 <free>
+  return freep;
+ 9a3:	8b 15 e4 0e 00 00    	mov    0xee4,%edx
+      if((p = morecore(nunits)) == 0)
+ 9a9:	83 c4 10             	add    $0x10,%esp
+ 9ac:	85 d2                	test   %edx,%edx
+ 9ae:	75 c0                	jne    970 <malloc+0x40>
+        return 0;
+  }
+}
+ 9b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9b3:	31 c0                	xor    %eax,%eax
+}
+ 9b5:	5b                   	pop    %ebx
+ 9b6:	5e                   	pop    %esi
+ 9b7:	5f                   	pop    %edi
+ 9b8:	5d                   	pop    %ebp
+ 9b9:	c3                   	ret
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9c0:	39 cf                	cmp    %ecx,%edi
+ 9c2:	74 4c                	je     a10 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9c4:	29 f9                	sub    %edi,%ecx
+ 9c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9cf:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+}
+ 9d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9d8:	83 c0 08             	add    $0x8,%eax
+}
+ 9db:	5b                   	pop    %ebx
+ 9dc:	5e                   	pop    %esi
+ 9dd:	5f                   	pop    %edi
+ 9de:	5d                   	pop    %ebp
+ 9df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9e0:	c7 05 e4 0e 00 00 e8 	movl   $0xee8,0xee4
+ 9e7:	0e 00 00 
+    base.s.size = 0;
+ 9ea:	b8 e8 0e 00 00       	mov    $0xee8,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9ef:	c7 05 e8 0e 00 00 e8 	movl   $0xee8,0xee8
+ 9f6:	0e 00 00 
+    base.s.size = 0;
+ 9f9:	c7 05 ec 0e 00 00 00 	movl   $0x0,0xeec
+ a00:	00 00 00 
+    if(p->s.size >= nunits){
+ a03:	e9 54 ff ff ff       	jmp    95c <malloc+0x2c>
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a10:	8b 08                	mov    (%eax),%ecx
+ a12:	89 0a                	mov    %ecx,(%edx)
+ a14:	eb b9                	jmp    9cf <malloc+0x9f>
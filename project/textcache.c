@@ -0,0 +1,201 @@
+// Program page cache.
+//
+// Processes running the same program share the pages execfault()
+// reads from it. A cached page is keyed by the program's inode and
+// generation (see inewgen() in fs.c), the file offset of the page's
+// first byte, and the number of bytes read from the file, the rest
+// of the page being zero. Program segments need not start on a page
+// boundary in the file, so these pages are not those of the page
+// cache. A write to the program, or its truncation, gives the inode
+// a new generation, so pages cached before are never found again
+// and drop out of the cache as it recycles them.
+//
+// Processes map a cached page read-only and, like any other
+// copy-on-write page, get a copy of their own on the first store.
+// The cache's own reference is one more rmap entry: each descriptor
+// holds a PTE that is never used for translation but keeps the page
+// alive while it is cached. victim_page() skips pages held by the
+// cache; the cache gives them back itself, least recently used
+// first, when kalloc() runs out of pages (see tcshrink()).
+//
+// tcache.lock protects the descriptors, and is taken before the
+// rmap locks.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NTEXT 128
+#define NTHASH 61
+
+struct tpage {
+  uint dev;
+  uint inum;          // 0 if the descriptor is unused
+  uint gen;
+  uint off;           // file offset of the page
+  uint n;             // bytes from the file
+  pte_t pte;          // the cache's rmap entry for the page
+  struct tpage *hnext;
+  struct tpage *lprev;  // LRU list of used descriptors
+  struct tpage *lnext;
+};
+
+static struct {
+  struct spinlock lock;
+  struct tpage *hash[NTHASH];
+  struct tpage lru;         // least recently used first
+  struct tpage page[NTEXT];
+} tcache;
+
+void
+tcinit(void)
+{
+  struct tpage *t;
+
+  initlock(&tcache.lock, "tcache");
+  tcache.lru.lprev = tcache.lru.lnext = &tcache.lru;
+  for(t = tcache.page; t < &tcache.page[NTEXT]; t++){
+    t->lnext = tcache.lru.lnext;
+    t->lprev = &tcache.lru;
+    tcache.lru.lnext->lprev = t;
+    tcache.lru.lnext = t;
+  }
+}
+
+// Is pte the cache's own rmap entry for a page?
+int
+tcheld(pte_t *pte)
+{
+  return pte >= &tcache.page[0].pte && pte <= &tcache.page[NTEXT-1].pte;
+}
+
+static struct tpage**
+thash(uint dev, uint inum, uint off)
+{
+  return &tcache.hash[(dev*31 + inum*17 + off/PGSIZE) % NTHASH];
+}
+
+static void
+lrudel(struct tpage *t)
+{
+  t->lnext->lprev = t->lprev;
+  t->lprev->lnext = t->lnext;
+}
+
+static void
+lrutail(struct tpage *t)
+{
+  t->lnext = &tcache.lru;
+  t->lprev = tcache.lru.lprev;
+  tcache.lru.lprev->lnext = t;
+  tcache.lru.lprev = t;
+}
+
+// Take t out of the cache. Returns its page if that was the
+// last reference, for the caller to free.
+static char*
+tevict(struct tpage *t)
+{
+  struct tpage **pp;
+  uint pa;
+
+  for(pp = thash(t->dev, t->inum, t->off); *pp != t; pp = &(*pp)->hnext)
+    ;
+  *pp = t->hnext;
+  t->inum = 0;
+  pa = PTE_ADDR(t->pte);
+  if(share_remove(pa, &t->pte) == 0)
+    return P2V(pa);
+  return 0;
+}
+
+// If the page of inode inum on dev, generation gen, at file offset
+// off with n bytes from the file is cached, map it read-only at pte
+// and return 1. Otherwise return 0.
+int
+tcmap(uint dev, uint inum, uint gen, uint off, uint n, pte_t *pte)
+{
+  struct tpage *t;
+  uint pa;
+
+  acquire(&tcache.lock);
+  for(t = *thash(dev, inum, off); t; t = t->hnext)
+    if(t->inum == inum && t->dev == dev && t->gen == gen &&
+       t->off == off && t->n == n)
+      break;
+  if(t == 0){
+    release(&tcache.lock);
+    return 0;
+  }
+  lrudel(t);
+  lrutail(t);
+  pa = PTE_ADDR(t->pte);
+  *pte = pa | PTE_P | PTE_U | PTE_E;
+  share_add(pa, pte);
+  release(&tcache.lock);
+  return 1;
+}
+
+// Add page pg, just read for the page described as for tcmap(),
+// to the cache, recycling the least recently used descriptor.
+// The caller maps pg read-only first, so that tcshrink() cannot
+// take it back before the caller has it.
+void
+tcadd(uint dev, uint inum, uint gen, uint off, uint n, char *pg)
+{
+  struct tpage *t, **pp;
+  char *free;
+
+  free = 0;
+  acquire(&tcache.lock);
+  t = tcache.lru.lnext;
+  lrudel(t);
+  if(t->inum)
+    free = tevict(t);
+  t->dev = dev;
+  t->inum = inum;
+  t->gen = gen;
+  t->off = off;
+  t->n = n;
+  t->pte = V2P(pg) | PTE_E;
+  share_add(V2P(pg), &t->pte);
+  pp = thash(dev, inum, off);
+  t->hnext = *pp;
+  *pp = t;
+  lrutail(t);
+  release(&tcache.lock);
+  if(free)
+    kfree(free);
+}
+
+// Give the least recently used cached page that no process has
+// mapped back to the page allocator. Called by kalloc() when
+// memory runs out; does not sleep. Returns 1 if a page was freed.
+int
+tcshrink(void)
+{
+  struct tpage *t;
+  char *free;
+
+  free = 0;
+  acquire(&tcache.lock);
+  for(t = tcache.lru.lnext; t != &tcache.lru; t = t->lnext){
+    if(t->inum && share_count(PTE_ADDR(t->pte)) == 1){
+      free = tevict(t);
+      lrudel(t);
+      t->lnext = tcache.lru.lnext;  // unused descriptors go first
+      t->lprev = &tcache.lru;
+      tcache.lru.lnext->lprev = t;
+      tcache.lru.lnext = t;
+      break;
+    }
+  }
+  release(&tcache.lock);
+  if(free == 0)
+    return 0;
+  kfree(free);
+  return 1;
+}
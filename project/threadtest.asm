@@ -0,0 +1,1695 @@
+
+_threadtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "exiting ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  counting();
+  11:	e8 8a 02 00 00       	call   2a0 <counting>
+  sharing();
+  16:	e8 75 03 00 00       	call   390 <sharing>
+  exiting();
+  1b:	e8 a0 04 00 00       	call   4c0 <exiting>
+  printf(1, "Threadtest Passed!\n");
+  20:	83 ec 08             	sub    $0x8,%esp
+  23:	68 f7 0c 00 00       	push   $0xcf7
+  28:	6a 01                	push   $0x1
+  2a:	e8 f1 08 00 00       	call   920 <printf>
+  exit();
+  2f:	e8 4f 07 00 00       	call   783 <exit>
+  34:	66 90                	xchg   %ax,%ax
+  36:	66 90                	xchg   %ax,%ax
+  38:	66 90                	xchg   %ax,%ax
+  3a:	66 90                	xchg   %ax,%ax
+  3c:	66 90                	xchg   %ax,%ax
+  3e:	66 90                	xchg   %ax,%ax
+
+00000040 <sleeper>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	83 ec 0c             	sub    $0xc,%esp
+  futex((int*)&mutex, FUTEX_WAIT, 1);
+  46:	6a 01                	push   $0x1
+  48:	6a 00                	push   $0x0
+  4a:	68 ac 11 00 00       	push   $0x11ac
+  4f:	e8 ff 07 00 00       	call   853 <futex>
+  exit();
+  54:	e8 2a 07 00 00       	call   783 <exit>
+  59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <opener>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	83 ec 10             	sub    $0x10,%esp
+  fd = open((char*)arg, O_CREATE|O_RDWR);
+  66:	68 02 02 00 00       	push   $0x202
+  6b:	ff 75 08             	push   0x8(%ebp)
+  6e:	e8 50 07 00 00       	call   7c3 <open>
+  heap = sbrk(PGSIZE);
+  73:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  fd = open((char*)arg, O_CREATE|O_RDWR);
+  7a:	a3 a0 11 00 00       	mov    %eax,0x11a0
+  heap = sbrk(PGSIZE);
+  7f:	e8 87 07 00 00       	call   80b <sbrk>
+  84:	a3 a4 11 00 00       	mov    %eax,0x11a4
+  heap[0] = 'x';
+  89:	c6 00 78             	movb   $0x78,(%eax)
+  exit();
+  8c:	e8 f2 06 00 00       	call   783 <exit>
+  91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9f:	90                   	nop
+
+000000a0 <lock>:
+{
+  a0:	55                   	push   %ebp
+  if((c = __sync_val_compare_and_swap(m, 0, 1)) == 0)
+  a1:	31 c0                	xor    %eax,%eax
+  a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+  a8:	89 e5                	mov    %esp,%ebp
+  aa:	56                   	push   %esi
+  ab:	53                   	push   %ebx
+  ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(m, 0, 1)) == 0)
+  af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  b3:	85 c0                	test   %eax,%eax
+  b5:	74 29                	je     e0 <lock+0x40>
+  if(c != 2)
+  b7:	83 f8 02             	cmp    $0x2,%eax
+  ba:	75 34                	jne    f0 <lock+0x50>
+    c = __sync_lock_test_and_set(m, 2);
+  bc:	be 02 00 00 00       	mov    $0x2,%esi
+  c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex((int*)m, FUTEX_WAIT, 2);
+  c8:	83 ec 04             	sub    $0x4,%esp
+  cb:	6a 02                	push   $0x2
+  cd:	6a 00                	push   $0x0
+  cf:	53                   	push   %ebx
+  d0:	e8 7e 07 00 00       	call   853 <futex>
+    c = __sync_lock_test_and_set(m, 2);
+  d5:	89 f0                	mov    %esi,%eax
+  d7:	87 03                	xchg   %eax,(%ebx)
+  while(c != 0){
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	85 c0                	test   %eax,%eax
+  de:	75 e8                	jne    c8 <lock+0x28>
+}
+  e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  e3:	5b                   	pop    %ebx
+  e4:	5e                   	pop    %esi
+  e5:	5d                   	pop    %ebp
+  e6:	c3                   	ret
+  e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ee:	66 90                	xchg   %ax,%ax
+    c = __sync_lock_test_and_set(m, 2);
+  f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  f5:	87 03                	xchg   %eax,(%ebx)
+  while(c != 0){
+  f7:	85 c0                	test   %eax,%eax
+  f9:	75 c1                	jne    bc <lock+0x1c>
+}
+  fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  fe:	5b                   	pop    %ebx
+  ff:	5e                   	pop    %esi
+ 100:	5d                   	pop    %ebp
+ 101:	c3                   	ret
+ 102:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <adder>:
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 119:	83 ec 04             	sub    $0x4,%esp
+ 11c:	eb 07                	jmp    125 <adder+0x15>
+ 11e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < NITER; i++){
+ 120:	83 eb 01             	sub    $0x1,%ebx
+ 123:	74 4f                	je     174 <adder+0x64>
+    lock(&mutex);
+ 125:	83 ec 0c             	sub    $0xc,%esp
+ 128:	68 ac 11 00 00       	push   $0x11ac
+ 12d:	e8 6e ff ff ff       	call   a0 <lock>
+    counter = counter + 1;
+ 132:	a1 a8 11 00 00       	mov    0x11a8,%eax
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	a3 a8 11 00 00       	mov    %eax,0x11a8
+  if(__sync_fetch_and_sub(m, 1) != 1){
+ 13f:	f0 83 2d ac 11 00 00 	lock subl $0x1,0x11ac
+ 146:	01 
+ 147:	0f 95 c0             	setne  %al
+ 14a:	83 c4 10             	add    $0x10,%esp
+ 14d:	84 c0                	test   %al,%al
+ 14f:	74 cf                	je     120 <adder+0x10>
+    *m = 0;
+ 151:	c7 05 ac 11 00 00 00 	movl   $0x0,0x11ac
+ 158:	00 00 00 
+    futex((int*)m, FUTEX_WAKE, 1);
+ 15b:	83 ec 04             	sub    $0x4,%esp
+ 15e:	6a 01                	push   $0x1
+ 160:	6a 01                	push   $0x1
+ 162:	68 ac 11 00 00       	push   $0x11ac
+ 167:	e8 e7 06 00 00       	call   853 <futex>
+}
+ 16c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NITER; i++){
+ 16f:	83 eb 01             	sub    $0x1,%ebx
+ 172:	75 b1                	jne    125 <adder+0x15>
+  exit();
+ 174:	e8 0a 06 00 00       	call   783 <exit>
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <unlock>:
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	83 ec 08             	sub    $0x8,%esp
+ 186:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(m, 1) != 1){
+ 189:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 18d:	75 09                	jne    198 <unlock+0x18>
+}
+ 18f:	c9                   	leave
+ 190:	c3                   	ret
+ 191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex((int*)m, FUTEX_WAKE, 1);
+ 198:	83 ec 04             	sub    $0x4,%esp
+    *m = 0;
+ 19b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex((int*)m, FUTEX_WAKE, 1);
+ 1a1:	6a 01                	push   $0x1
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	50                   	push   %eax
+ 1a6:	e8 a8 06 00 00       	call   853 <futex>
+}
+ 1ab:	83 c4 10             	add    $0x10,%esp
+ 1ae:	c9                   	leave
+ 1af:	c3                   	ret
+
+000001b0 <failed>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "Threadtest failed: %s\n", why);
+ 1b6:	ff 75 08             	push   0x8(%ebp)
+ 1b9:	68 48 0c 00 00       	push   $0xc48
+ 1be:	6a 01                	push   $0x1
+ 1c0:	e8 5b 07 00 00       	call   920 <printf>
+  exit();
+ 1c5:	e8 b9 05 00 00       	call   783 <exit>
+ 1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001d0 <spawn>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	83 ec 14             	sub    $0x14,%esp
+  if((stack = malloc(PGSIZE)) == 0)
+ 1d6:	68 00 10 00 00       	push   $0x1000
+ 1db:	e8 80 09 00 00       	call   b60 <malloc>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	85 c0                	test   %eax,%eax
+ 1e5:	74 18                	je     1ff <spawn+0x2f>
+  if(clone(fn, arg, stack) < 0)
+ 1e7:	83 ec 04             	sub    $0x4,%esp
+ 1ea:	50                   	push   %eax
+ 1eb:	ff 75 0c             	push   0xc(%ebp)
+ 1ee:	ff 75 08             	push   0x8(%ebp)
+ 1f1:	e8 4d 06 00 00       	call   843 <clone>
+ 1f6:	83 c4 10             	add    $0x10,%esp
+ 1f9:	85 c0                	test   %eax,%eax
+ 1fb:	78 0f                	js     20c <spawn+0x3c>
+}
+ 1fd:	c9                   	leave
+ 1fe:	c3                   	ret
+    failed("malloc");
+ 1ff:	83 ec 0c             	sub    $0xc,%esp
+ 202:	68 5f 0c 00 00       	push   $0xc5f
+ 207:	e8 a4 ff ff ff       	call   1b0 <failed>
+    failed("clone");
+ 20c:	83 ec 0c             	sub    $0xc,%esp
+ 20f:	68 66 0c 00 00       	push   $0xc66
+ 214:	e8 97 ff ff ff       	call   1b0 <failed>
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <joinall>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	56                   	push   %esi
+ 224:	53                   	push   %ebx
+ 225:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 228:	83 ec 10             	sub    $0x10,%esp
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+  while(n-- > 0){
+ 22e:	85 c0                	test   %eax,%eax
+ 230:	7e 34                	jle    266 <joinall+0x46>
+ 232:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 235:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+    if(join(&stack) < 0)
+ 240:	83 ec 0c             	sub    $0xc,%esp
+ 243:	56                   	push   %esi
+ 244:	e8 02 06 00 00       	call   84b <join>
+ 249:	83 c4 10             	add    $0x10,%esp
+ 24c:	85 c0                	test   %eax,%eax
+ 24e:	78 2d                	js     27d <joinall+0x5d>
+    free(stack);
+ 250:	83 ec 0c             	sub    $0xc,%esp
+ 253:	ff 75 f4             	push   -0xc(%ebp)
+  while(n-- > 0){
+ 256:	83 eb 01             	sub    $0x1,%ebx
+    free(stack);
+ 259:	e8 72 08 00 00       	call   ad0 <free>
+  while(n-- > 0){
+ 25e:	83 c4 10             	add    $0x10,%esp
+ 261:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 264:	75 da                	jne    240 <joinall+0x20>
+  if(join(&stack) >= 0)
+ 266:	83 ec 0c             	sub    $0xc,%esp
+ 269:	56                   	push   %esi
+ 26a:	e8 dc 05 00 00       	call   84b <join>
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	85 c0                	test   %eax,%eax
+ 274:	79 14                	jns    28a <joinall+0x6a>
+}
+ 276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+      failed("join");
+ 27d:	83 ec 0c             	sub    $0xc,%esp
+ 280:	68 6c 0c 00 00       	push   $0xc6c
+ 285:	e8 26 ff ff ff       	call   1b0 <failed>
+    failed("join with no threads");
+ 28a:	83 ec 0c             	sub    $0xc,%esp
+ 28d:	68 71 0c 00 00       	push   $0xc71
+ 292:	e8 19 ff ff ff       	call   1b0 <failed>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <counting>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+ 2a5:	bb 04 00 00 00       	mov    $0x4,%ebx
+ 2aa:	83 ec 10             	sub    $0x10,%esp
+  if((stack = malloc(PGSIZE)) == 0)
+ 2ad:	83 ec 0c             	sub    $0xc,%esp
+ 2b0:	68 00 10 00 00       	push   $0x1000
+ 2b5:	e8 a6 08 00 00       	call   b60 <malloc>
+ 2ba:	83 c4 10             	add    $0x10,%esp
+ 2bd:	85 c0                	test   %eax,%eax
+ 2bf:	0f 84 9d 00 00 00    	je     362 <counting+0xc2>
+  if(clone(fn, arg, stack) < 0)
+ 2c5:	83 ec 04             	sub    $0x4,%esp
+ 2c8:	50                   	push   %eax
+ 2c9:	6a 00                	push   $0x0
+ 2cb:	68 10 01 00 00       	push   $0x110
+ 2d0:	e8 6e 05 00 00       	call   843 <clone>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+ 2d8:	85 c0                	test   %eax,%eax
+ 2da:	78 79                	js     355 <counting+0xb5>
+  for(i = 0; i < NTHREAD; i++)
+ 2dc:	83 eb 01             	sub    $0x1,%ebx
+ 2df:	75 cc                	jne    2ad <counting+0xd>
+ 2e1:	bb 04 00 00 00       	mov    $0x4,%ebx
+ 2e6:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(join(&stack) < 0)
+ 2f0:	83 ec 0c             	sub    $0xc,%esp
+ 2f3:	56                   	push   %esi
+ 2f4:	e8 52 05 00 00       	call   84b <join>
+ 2f9:	83 c4 10             	add    $0x10,%esp
+ 2fc:	85 c0                	test   %eax,%eax
+ 2fe:	78 48                	js     348 <counting+0xa8>
+    free(stack);
+ 300:	83 ec 0c             	sub    $0xc,%esp
+ 303:	ff 75 f4             	push   -0xc(%ebp)
+ 306:	e8 c5 07 00 00       	call   ad0 <free>
+  while(n-- > 0){
+ 30b:	83 c4 10             	add    $0x10,%esp
+ 30e:	83 eb 01             	sub    $0x1,%ebx
+ 311:	75 dd                	jne    2f0 <counting+0x50>
+  if(join(&stack) >= 0)
+ 313:	83 ec 0c             	sub    $0xc,%esp
+ 316:	56                   	push   %esi
+ 317:	e8 2f 05 00 00       	call   84b <join>
+ 31c:	83 c4 10             	add    $0x10,%esp
+ 31f:	85 c0                	test   %eax,%eax
+ 321:	79 59                	jns    37c <counting+0xdc>
+  if(counter != NTHREAD*NITER)
+ 323:	a1 a8 11 00 00       	mov    0x11a8,%eax
+ 328:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+ 32d:	75 40                	jne    36f <counting+0xcf>
+  printf(1, "counting ok\n");
+ 32f:	83 ec 08             	sub    $0x8,%esp
+ 332:	68 93 0c 00 00       	push   $0xc93
+ 337:	6a 01                	push   $0x1
+ 339:	e8 e2 05 00 00       	call   920 <printf>
+}
+ 33e:	83 c4 10             	add    $0x10,%esp
+ 341:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 344:	5b                   	pop    %ebx
+ 345:	5e                   	pop    %esi
+ 346:	5d                   	pop    %ebp
+ 347:	c3                   	ret
+      failed("join");
+ 348:	83 ec 0c             	sub    $0xc,%esp
+ 34b:	68 6c 0c 00 00       	push   $0xc6c
+ 350:	e8 5b fe ff ff       	call   1b0 <failed>
+    failed("clone");
+ 355:	83 ec 0c             	sub    $0xc,%esp
+ 358:	68 66 0c 00 00       	push   $0xc66
+ 35d:	e8 4e fe ff ff       	call   1b0 <failed>
+    failed("malloc");
+ 362:	83 ec 0c             	sub    $0xc,%esp
+ 365:	68 5f 0c 00 00       	push   $0xc5f
+ 36a:	e8 41 fe ff ff       	call   1b0 <failed>
+    failed("lost updates");
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	68 86 0c 00 00       	push   $0xc86
+ 377:	e8 34 fe ff ff       	call   1b0 <failed>
+    failed("join with no threads");
+ 37c:	83 ec 0c             	sub    $0xc,%esp
+ 37f:	68 71 0c 00 00       	push   $0xc71
+ 384:	e8 27 fe ff ff       	call   1b0 <failed>
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <sharing>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	83 ec 20             	sub    $0x20,%esp
+  if((stack = malloc(PGSIZE)) == 0)
+ 397:	68 00 10 00 00       	push   $0x1000
+ 39c:	e8 bf 07 00 00       	call   b60 <malloc>
+ 3a1:	83 c4 10             	add    $0x10,%esp
+ 3a4:	85 c0                	test   %eax,%eax
+ 3a6:	0f 84 dc 00 00 00    	je     488 <sharing+0xf8>
+  if(clone(fn, arg, stack) < 0)
+ 3ac:	83 ec 04             	sub    $0x4,%esp
+ 3af:	50                   	push   %eax
+ 3b0:	68 a0 0c 00 00       	push   $0xca0
+ 3b5:	68 60 00 00 00       	push   $0x60
+ 3ba:	e8 84 04 00 00       	call   843 <clone>
+ 3bf:	83 c4 10             	add    $0x10,%esp
+ 3c2:	85 c0                	test   %eax,%eax
+ 3c4:	0f 88 b1 00 00 00    	js     47b <sharing+0xeb>
+    if(join(&stack) < 0)
+ 3ca:	83 ec 0c             	sub    $0xc,%esp
+ 3cd:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+ 3d0:	53                   	push   %ebx
+ 3d1:	e8 75 04 00 00       	call   84b <join>
+ 3d6:	83 c4 10             	add    $0x10,%esp
+ 3d9:	85 c0                	test   %eax,%eax
+ 3db:	0f 88 8d 00 00 00    	js     46e <sharing+0xde>
+    free(stack);
+ 3e1:	83 ec 0c             	sub    $0xc,%esp
+ 3e4:	ff 75 f4             	push   -0xc(%ebp)
+ 3e7:	e8 e4 06 00 00       	call   ad0 <free>
+  if(join(&stack) >= 0)
+ 3ec:	89 1c 24             	mov    %ebx,(%esp)
+ 3ef:	e8 57 04 00 00       	call   84b <join>
+ 3f4:	83 c4 10             	add    $0x10,%esp
+ 3f7:	85 c0                	test   %eax,%eax
+ 3f9:	0f 89 b0 00 00 00    	jns    4af <sharing+0x11f>
+  if(fd < 0 || write(fd, "hello", 5) != 5)
+ 3ff:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 404:	85 c0                	test   %eax,%eax
+ 406:	0f 88 96 00 00 00    	js     4a2 <sharing+0x112>
+ 40c:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 411:	83 ec 04             	sub    $0x4,%esp
+ 414:	6a 05                	push   $0x5
+ 416:	68 bf 0c 00 00       	push   $0xcbf
+ 41b:	50                   	push   %eax
+ 41c:	e8 82 03 00 00       	call   7a3 <write>
+ 421:	83 c4 10             	add    $0x10,%esp
+ 424:	83 f8 05             	cmp    $0x5,%eax
+ 427:	75 79                	jne    4a2 <sharing+0x112>
+  close(fd);
+ 429:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 42e:	83 ec 0c             	sub    $0xc,%esp
+ 431:	50                   	push   %eax
+ 432:	e8 74 03 00 00       	call   7ab <close>
+  unlink(name);
+ 437:	c7 04 24 a0 0c 00 00 	movl   $0xca0,(%esp)
+ 43e:	e8 90 03 00 00       	call   7d3 <unlink>
+  if(heap == (char*)-1 || heap[0] != 'x')
+ 443:	a1 a4 11 00 00       	mov    0x11a4,%eax
+ 448:	83 c4 10             	add    $0x10,%esp
+ 44b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 44e:	74 45                	je     495 <sharing+0x105>
+ 450:	0f b6 00             	movzbl (%eax),%eax
+ 453:	3c 78                	cmp    $0x78,%al
+ 455:	75 3e                	jne    495 <sharing+0x105>
+  printf(1, "sharing ok\n");
+ 457:	83 ec 08             	sub    $0x8,%esp
+ 45a:	68 d5 0c 00 00       	push   $0xcd5
+ 45f:	6a 01                	push   $0x1
+ 461:	e8 ba 04 00 00       	call   920 <printf>
+}
+ 466:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 469:	83 c4 10             	add    $0x10,%esp
+ 46c:	c9                   	leave
+ 46d:	c3                   	ret
+      failed("join");
+ 46e:	83 ec 0c             	sub    $0xc,%esp
+ 471:	68 6c 0c 00 00       	push   $0xc6c
+ 476:	e8 35 fd ff ff       	call   1b0 <failed>
+    failed("clone");
+ 47b:	83 ec 0c             	sub    $0xc,%esp
+ 47e:	68 66 0c 00 00       	push   $0xc66
+ 483:	e8 28 fd ff ff       	call   1b0 <failed>
+    failed("malloc");
+ 488:	83 ec 0c             	sub    $0xc,%esp
+ 48b:	68 5f 0c 00 00       	push   $0xc5f
+ 490:	e8 1b fd ff ff       	call   1b0 <failed>
+    failed("sbrk not shared");
+ 495:	83 ec 0c             	sub    $0xc,%esp
+ 498:	68 c5 0c 00 00       	push   $0xcc5
+ 49d:	e8 0e fd ff ff       	call   1b0 <failed>
+    failed("file not shared");
+ 4a2:	83 ec 0c             	sub    $0xc,%esp
+ 4a5:	68 af 0c 00 00       	push   $0xcaf
+ 4aa:	e8 01 fd ff ff       	call   1b0 <failed>
+    failed("join with no threads");
+ 4af:	83 ec 0c             	sub    $0xc,%esp
+ 4b2:	68 71 0c 00 00       	push   $0xc71
+ 4b7:	e8 f4 fc ff ff       	call   1b0 <failed>
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <exiting>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	83 ec 04             	sub    $0x4,%esp
+  pid = fork();
+ 4c7:	e8 af 02 00 00       	call   77b <fork>
+  if(pid < 0)
+ 4cc:	85 c0                	test   %eax,%eax
+ 4ce:	78 24                	js     4f4 <exiting+0x34>
+  if(pid == 0){
+ 4d0:	74 3c                	je     50e <exiting+0x4e>
+ 4d2:	89 c3                	mov    %eax,%ebx
+  if(wait() != pid)
+ 4d4:	e8 b2 02 00 00       	call   78b <wait>
+ 4d9:	39 d8                	cmp    %ebx,%eax
+ 4db:	75 24                	jne    501 <exiting+0x41>
+  printf(1, "exiting ok\n");
+ 4dd:	83 ec 08             	sub    $0x8,%esp
+ 4e0:	68 eb 0c 00 00       	push   $0xceb
+ 4e5:	6a 01                	push   $0x1
+ 4e7:	e8 34 04 00 00       	call   920 <printf>
+}
+ 4ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	c9                   	leave
+ 4f3:	c3                   	ret
+    failed("fork");
+ 4f4:	83 ec 0c             	sub    $0xc,%esp
+ 4f7:	68 e1 0c 00 00       	push   $0xce1
+ 4fc:	e8 af fc ff ff       	call   1b0 <failed>
+    failed("wait");
+ 501:	83 ec 0c             	sub    $0xc,%esp
+ 504:	68 e6 0c 00 00       	push   $0xce6
+ 509:	e8 a2 fc ff ff       	call   1b0 <failed>
+    mutex = 1;
+ 50e:	c7 05 ac 11 00 00 01 	movl   $0x1,0x11ac
+ 515:	00 00 00 
+    spawn(sleeper, 0);
+ 518:	50                   	push   %eax
+ 519:	50                   	push   %eax
+ 51a:	6a 00                	push   $0x0
+ 51c:	68 40 00 00 00       	push   $0x40
+ 521:	e8 aa fc ff ff       	call   1d0 <spawn>
+    spawn(sleeper, 0);
+ 526:	5a                   	pop    %edx
+ 527:	59                   	pop    %ecx
+ 528:	6a 00                	push   $0x0
+ 52a:	68 40 00 00 00       	push   $0x40
+ 52f:	e8 9c fc ff ff       	call   1d0 <spawn>
+    exit();
+ 534:	e8 4a 02 00 00       	call   783 <exit>
+ 539:	66 90                	xchg   %ax,%ax
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 540:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 541:	31 c0                	xor    %eax,%eax
+{
+ 543:	89 e5                	mov    %esp,%ebp
+ 545:	53                   	push   %ebx
+ 546:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 549:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 550:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 554:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 557:	83 c0 01             	add    $0x1,%eax
+ 55a:	84 d2                	test   %dl,%dl
+ 55c:	75 f2                	jne    550 <strcpy+0x10>
+    ;
+  return os;
+}
+ 55e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 561:	89 c8                	mov    %ecx,%eax
+ 563:	c9                   	leave
+ 564:	c3                   	ret
+ 565:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+ 577:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 57a:	0f b6 02             	movzbl (%edx),%eax
+ 57d:	84 c0                	test   %al,%al
+ 57f:	75 17                	jne    598 <strcmp+0x28>
+ 581:	eb 3a                	jmp    5bd <strcmp+0x4d>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 58c:	83 c2 01             	add    $0x1,%edx
+ 58f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 592:	84 c0                	test   %al,%al
+ 594:	74 1a                	je     5b0 <strcmp+0x40>
+    p++, q++;
+ 596:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 598:	0f b6 19             	movzbl (%ecx),%ebx
+ 59b:	38 c3                	cmp    %al,%bl
+ 59d:	74 e9                	je     588 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 59f:	29 d8                	sub    %ebx,%eax
+}
+ 5a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a4:	c9                   	leave
+ 5a5:	c3                   	ret
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5b4:	31 c0                	xor    %eax,%eax
+ 5b6:	29 d8                	sub    %ebx,%eax
+}
+ 5b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5bb:	c9                   	leave
+ 5bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5c0:	31 c0                	xor    %eax,%eax
+ 5c2:	eb db                	jmp    59f <strcmp+0x2f>
+ 5c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+
+000005d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5d9:	74 15                	je     5f0 <strlen+0x20>
+ 5db:	31 c0                	xor    %eax,%eax
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5e0:	83 c0 01             	add    $0x1,%eax
+ 5e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5e7:	89 c1                	mov    %eax,%ecx
+ 5e9:	75 f5                	jne    5e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5eb:	89 c8                	mov    %ecx,%eax
+ 5ed:	5d                   	pop    %ebp
+ 5ee:	c3                   	ret
+ 5ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5f0:	31 c9                	xor    %ecx,%ecx
+}
+ 5f2:	5d                   	pop    %ebp
+ 5f3:	89 c8                	mov    %ecx,%eax
+ 5f5:	c3                   	ret
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 607:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 60a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60d:	89 d7                	mov    %edx,%edi
+ 60f:	fc                   	cld
+ 610:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 612:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 615:	89 d0                	mov    %edx,%eax
+ 617:	c9                   	leave
+ 618:	c3                   	ret
+ 619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 62a:	0f b6 10             	movzbl (%eax),%edx
+ 62d:	84 d2                	test   %dl,%dl
+ 62f:	75 12                	jne    643 <strchr+0x23>
+ 631:	eb 1d                	jmp    650 <strchr+0x30>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+ 638:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 63c:	83 c0 01             	add    $0x1,%eax
+ 63f:	84 d2                	test   %dl,%dl
+ 641:	74 0d                	je     650 <strchr+0x30>
+    if(*s == c)
+ 643:	38 d1                	cmp    %dl,%cl
+ 645:	75 f1                	jne    638 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 647:	5d                   	pop    %ebp
+ 648:	c3                   	ret
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 650:	31 c0                	xor    %eax,%eax
+}
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+ 654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+
+00000660 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 665:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 668:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 669:	31 db                	xor    %ebx,%ebx
+{
+ 66b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 66e:	eb 27                	jmp    697 <gets+0x37>
+    cc = read(0, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	6a 01                	push   $0x1
+ 675:	56                   	push   %esi
+ 676:	6a 00                	push   $0x0
+ 678:	e8 1e 01 00 00       	call   79b <read>
+    if(cc < 1)
+ 67d:	83 c4 10             	add    $0x10,%esp
+ 680:	85 c0                	test   %eax,%eax
+ 682:	7e 1d                	jle    6a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 684:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 688:	8b 55 08             	mov    0x8(%ebp),%edx
+ 68b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 68f:	3c 0a                	cmp    $0xa,%al
+ 691:	74 10                	je     6a3 <gets+0x43>
+ 693:	3c 0d                	cmp    $0xd,%al
+ 695:	74 0c                	je     6a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 697:	89 df                	mov    %ebx,%edi
+ 699:	83 c3 01             	add    $0x1,%ebx
+ 69c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 69f:	7c cf                	jl     670 <gets+0x10>
+ 6a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ad:	5b                   	pop    %ebx
+ 6ae:	5e                   	pop    %esi
+ 6af:	5f                   	pop    %edi
+ 6b0:	5d                   	pop    %ebp
+ 6b1:	c3                   	ret
+ 6b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	56                   	push   %esi
+ 6c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+ 6c8:	6a 00                	push   $0x0
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 f1 00 00 00       	call   7c3 <open>
+  if(fd < 0)
+ 6d2:	83 c4 10             	add    $0x10,%esp
+ 6d5:	85 c0                	test   %eax,%eax
+ 6d7:	78 27                	js     700 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6d9:	83 ec 08             	sub    $0x8,%esp
+ 6dc:	ff 75 0c             	push   0xc(%ebp)
+ 6df:	89 c3                	mov    %eax,%ebx
+ 6e1:	50                   	push   %eax
+ 6e2:	e8 f4 00 00 00       	call   7db <fstat>
+  close(fd);
+ 6e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6ec:	e8 ba 00 00 00       	call   7ab <close>
+  return r;
+ 6f1:	83 c4 10             	add    $0x10,%esp
+}
+ 6f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6f7:	89 f0                	mov    %esi,%eax
+ 6f9:	5b                   	pop    %ebx
+ 6fa:	5e                   	pop    %esi
+ 6fb:	5d                   	pop    %ebp
+ 6fc:	c3                   	ret
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 700:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 705:	eb ed                	jmp    6f4 <stat+0x34>
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	53                   	push   %ebx
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 717:	0f be 02             	movsbl (%edx),%eax
+ 71a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 71d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 725:	77 1e                	ja     745 <atoi+0x35>
+ 727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 730:	83 c2 01             	add    $0x1,%edx
+ 733:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 736:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 73a:	0f be 02             	movsbl (%edx),%eax
+ 73d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 740:	80 fb 09             	cmp    $0x9,%bl
+ 743:	76 eb                	jbe    730 <atoi+0x20>
+  return n;
+}
+ 745:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 748:	89 c8                	mov    %ecx,%eax
+ 74a:	c9                   	leave
+ 74b:	c3                   	ret
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	8b 45 10             	mov    0x10(%ebp),%eax
+ 758:	8b 55 08             	mov    0x8(%ebp),%edx
+ 75b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 75e:	85 c0                	test   %eax,%eax
+ 760:	7e 13                	jle    775 <memmove+0x25>
+ 762:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 764:	89 d7                	mov    %edx,%edi
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 770:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 771:	39 f8                	cmp    %edi,%eax
+ 773:	75 fb                	jne    770 <memmove+0x20>
+  return vdst;
+}
+ 775:	5e                   	pop    %esi
+ 776:	89 d0                	mov    %edx,%eax
+ 778:	5f                   	pop    %edi
+ 779:	5d                   	pop    %ebp
+ 77a:	c3                   	ret
+
+0000077b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 77b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <exit>:
+SYSCALL(exit)
+ 783:	b8 02 00 00 00       	mov    $0x2,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <wait>:
+SYSCALL(wait)
+ 78b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <pipe>:
+SYSCALL(pipe)
+ 793:	b8 04 00 00 00       	mov    $0x4,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <read>:
+SYSCALL(read)
+ 79b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <write>:
+SYSCALL(write)
+ 7a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <close>:
+SYSCALL(close)
+ 7ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <kill>:
+SYSCALL(kill)
+ 7b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <exec>:
+SYSCALL(exec)
+ 7bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <open>:
+SYSCALL(open)
+ 7c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mknod>:
+SYSCALL(mknod)
+ 7cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <unlink>:
+SYSCALL(unlink)
+ 7d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <fstat>:
+SYSCALL(fstat)
+ 7db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <link>:
+SYSCALL(link)
+ 7e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <mkdir>:
+SYSCALL(mkdir)
+ 7eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <chdir>:
+SYSCALL(chdir)
+ 7f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <dup>:
+SYSCALL(dup)
+ 7fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <getpid>:
+SYSCALL(getpid)
+ 803:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <sbrk>:
+SYSCALL(sbrk)
+ 80b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <sleep>:
+SYSCALL(sleep)
+ 813:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <uptime>:
+SYSCALL(uptime)
+ 81b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <getrss>:
+SYSCALL(getrss)
+ 823:	b8 16 00 00 00       	mov    $0x16,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 82b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <usleep>:
+SYSCALL(usleep)
+ 833:	b8 18 00 00 00       	mov    $0x18,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <lockstat>:
+SYSCALL(lockstat)
+ 83b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <clone>:
+SYSCALL(clone)
+ 843:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <join>:
+SYSCALL(join)
+ 84b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <futex>:
+SYSCALL(futex)
+ 853:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <mmap>:
+SYSCALL(mmap)
+ 85b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <munmap>:
+SYSCALL(munmap)
+ 863:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <sendfile>:
+SYSCALL(sendfile)
+ 86b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <splice>:
+SYSCALL(splice)
+ 873:	b8 20 00 00 00       	mov    $0x20,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+ 87b:	66 90                	xchg   %ax,%ax
+ 87d:	66 90                	xchg   %ax,%ax
+ 87f:	90                   	nop
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 888:	89 d1                	mov    %edx,%ecx
+{
+ 88a:	83 ec 3c             	sub    $0x3c,%esp
+ 88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 890:	85 d2                	test   %edx,%edx
+ 892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+ 898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+ 89e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8b0:	89 c8                	mov    %ecx,%eax
+ 8b2:	31 d2                	xor    %edx,%edx
+ 8b4:	89 f7                	mov    %esi,%edi
+ 8b6:	f7 f3                	div    %ebx
+ 8b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8bb:	0f b6 92 6c 0d 00 00 	movzbl 0xd6c(%edx),%edx
+ 8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8c6:	89 ca                	mov    %ecx,%edx
+ 8c8:	89 c1                	mov    %eax,%ecx
+ 8ca:	39 da                	cmp    %ebx,%edx
+ 8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+ 8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8d1:	85 c0                	test   %eax,%eax
+ 8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+ 8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8da:	89 f7                	mov    %esi,%edi
+ 8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e2:	01 df                	add    %ebx,%edi
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8f4:	6a 01                	push   $0x1
+ 8f6:	50                   	push   %eax
+ 8f7:	56                   	push   %esi
+ 8f8:	e8 a6 fe ff ff       	call   7a3 <write>
+  while(--i >= 0)
+ 8fd:	89 f8                	mov    %edi,%eax
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	83 ef 01             	sub    $0x1,%edi
+ 905:	39 d8                	cmp    %ebx,%eax
+ 907:	75 df                	jne    8e8 <printint+0x68>
+}
+ 909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 918:	31 c0                	xor    %eax,%eax
+ 91a:	eb 89                	jmp    8a5 <printint+0x25>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 92f:	0f b6 1e             	movzbl (%esi),%ebx
+ 932:	83 c6 01             	add    $0x1,%esi
+ 935:	84 db                	test   %bl,%bl
+ 937:	74 67                	je     9a0 <printf+0x80>
+ 939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 93c:	31 d2                	xor    %edx,%edx
+ 93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 941:	eb 34                	jmp    977 <printf+0x57>
+ 943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 947:	90                   	nop
+ 948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+ 955:	83 ec 04             	sub    $0x4,%esp
+ 958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95e:	6a 01                	push   $0x1
+ 960:	50                   	push   %eax
+ 961:	57                   	push   %edi
+ 962:	e8 3c fe ff ff       	call   7a3 <write>
+ 967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 96d:	0f b6 1e             	movzbl (%esi),%ebx
+ 970:	83 c6 01             	add    $0x1,%esi
+ 973:	84 db                	test   %bl,%bl
+ 975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 97a:	85 d2                	test   %edx,%edx
+ 97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 97e:	83 fa 25             	cmp    $0x25,%edx
+ 981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+ 983:	83 f8 25             	cmp    $0x25,%eax
+ 986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+ 98c:	83 e8 63             	sub    $0x63,%eax
+ 98f:	83 f8 15             	cmp    $0x15,%eax
+ 992:	77 1c                	ja     9b0 <printf+0x90>
+ 994:	ff 24 85 14 0d 00 00 	jmp    *0xd14(,%eax,4)
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	52                   	push   %edx
+ 9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9c0:	57                   	push   %edi
+ 9c1:	e8 dd fd ff ff       	call   7a3 <write>
+ 9c6:	83 c4 0c             	add    $0xc,%esp
+ 9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9cc:	6a 01                	push   $0x1
+ 9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9d1:	52                   	push   %edx
+ 9d2:	57                   	push   %edi
+ 9d3:	e8 cb fd ff ff       	call   7a3 <write>
+        putc(fd, c);
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9db:	31 d2                	xor    %edx,%edx
+ 9dd:	eb 8e                	jmp    96d <printf+0x4d>
+ 9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 00                	push   $0x0
+ 9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+ 9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a15:	83 c0 04             	add    $0x4,%eax
+ a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a1b:	85 db                	test   %ebx,%ebx
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+ a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a28:	84 c0                	test   %al,%al
+ a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+ a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	89 d3                	mov    %edx,%ebx
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	53                   	push   %ebx
+ a4c:	57                   	push   %edi
+ a4d:	e8 51 fd ff ff       	call   7a3 <write>
+        while(*s != 0){
+ a52:	0f b6 06             	movzbl (%esi),%eax
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+ a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	52                   	push   %edx
+ a9c:	57                   	push   %edi
+ a9d:	e8 01 fd ff ff       	call   7a3 <write>
+        ap++;
+ aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab9:	6a 01                	push   $0x1
+ abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+ ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ac5:	bb 0b 0d 00 00       	mov    $0xd0b,%ebx
+ aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+ acf:	90                   	nop
+
+00000ad0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ad0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	a1 b0 11 00 00       	mov    0x11b0,%eax
+{
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	57                   	push   %edi
+ ad9:	56                   	push   %esi
+ ada:	53                   	push   %ebx
+ adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ade:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ae8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aec:	39 ca                	cmp    %ecx,%edx
+ aee:	73 30                	jae    b20 <free+0x50>
+ af0:	39 c1                	cmp    %eax,%ecx
+ af2:	72 04                	jb     af8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af4:	39 c2                	cmp    %eax,%edx
+ af6:	72 f0                	jb     ae8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ af8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ afb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ afe:	39 f8                	cmp    %edi,%eax
+ b00:	74 2e                	je     b30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b05:	8b 42 04             	mov    0x4(%edx),%eax
+ b08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b0b:	39 f1                	cmp    %esi,%ecx
+ b0d:	74 38                	je     b47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b11:	5b                   	pop    %ebx
+  freep = p;
+ b12:	89 15 b0 11 00 00    	mov    %edx,0x11b0
+}
+ b18:	5e                   	pop    %esi
+ b19:	5f                   	pop    %edi
+ b1a:	5d                   	pop    %ebp
+ b1b:	c3                   	ret
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b20:	39 c1                	cmp    %eax,%ecx
+ b22:	72 d0                	jb     af4 <free+0x24>
+ b24:	eb c2                	jmp    ae8 <free+0x18>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b30:	03 70 04             	add    0x4(%eax),%esi
+ b33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b36:	8b 02                	mov    (%edx),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b3d:	8b 42 04             	mov    0x4(%edx),%eax
+ b40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b43:	39 f1                	cmp    %esi,%ecx
+ b45:	75 c8                	jne    b0f <free+0x3f>
+    p->s.size += bp->s.size;
+ b47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b4a:	89 15 b0 11 00 00    	mov    %edx,0x11b0
+    p->s.size += bp->s.size;
+ b50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b56:	89 0a                	mov    %ecx,(%edx)
+}
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b6c:	8b 15 b0 11 00 00    	mov    0x11b0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b72:	8d 78 07             	lea    0x7(%eax),%edi
+ b75:	c1 ef 03             	shr    $0x3,%edi
+ b78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b7b:	85 d2                	test   %edx,%edx
+ b7d:	0f 84 8d 00 00 00    	je     c10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b85:	8b 48 04             	mov    0x4(%eax),%ecx
+ b88:	39 f9                	cmp    %edi,%ecx
+ b8a:	73 64                	jae    bf0 <malloc+0x90>
+  if(nu < 4096)
+ b8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b91:	39 df                	cmp    %ebx,%edi
+ b93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b9d:	eb 0a                	jmp    ba9 <malloc+0x49>
+ b9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba5:	39 f9                	cmp    %edi,%ecx
+ ba7:	73 47                	jae    bf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ba9:	89 c2                	mov    %eax,%edx
+ bab:	39 05 b0 11 00 00    	cmp    %eax,0x11b0
+ bb1:	75 ed                	jne    ba0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	56                   	push   %esi
+ bb7:	e8 4f fc ff ff       	call   80b <sbrk>
+  if(p == (char*)-1)
+ bbc:	83 c4 10             	add    $0x10,%esp
+ bbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bc2:	74 1c                	je     be0 <malloc+0x80>
+  hp->s.size = nu;
+ bc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bc7:	83 ec 0c             	sub    $0xc,%esp
+ bca:	83 c0 08             	add    $0x8,%eax
+ bcd:	50                   	push   %eax
+ bce:	e8 fd fe ff ff       	call   ad0 <free>
+  return freep;
+ bd3:	8b 15 b0 11 00 00    	mov    0x11b0,%edx
+      if((p = morecore(nunits)) == 0)
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	85 d2                	test   %edx,%edx
+ bde:	75 c0                	jne    ba0 <malloc+0x40>
+        return 0;
+  }
+}
+ be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ be3:	31 c0                	xor    %eax,%eax
+}
+ be5:	5b                   	pop    %ebx
+ be6:	5e                   	pop    %esi
+ be7:	5f                   	pop    %edi
+ be8:	5d                   	pop    %ebp
+ be9:	c3                   	ret
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bf0:	39 cf                	cmp    %ecx,%edi
+ bf2:	74 4c                	je     c40 <malloc+0xe0>
+        p->s.size -= nunits;
+ bf4:	29 f9                	sub    %edi,%ecx
+ bf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bff:	89 15 b0 11 00 00    	mov    %edx,0x11b0
+}
+ c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c08:	83 c0 08             	add    $0x8,%eax
+}
+ c0b:	5b                   	pop    %ebx
+ c0c:	5e                   	pop    %esi
+ c0d:	5f                   	pop    %edi
+ c0e:	5d                   	pop    %ebp
+ c0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c10:	c7 05 b0 11 00 00 b4 	movl   $0x11b4,0x11b0
+ c17:	11 00 00 
+    base.s.size = 0;
+ c1a:	b8 b4 11 00 00       	mov    $0x11b4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c1f:	c7 05 b4 11 00 00 b4 	movl   $0x11b4,0x11b4
+ c26:	11 00 00 
+    base.s.size = 0;
+ c29:	c7 05 b8 11 00 00 00 	movl   $0x0,0x11b8
+ c30:	00 00 00 
+    if(p->s.size >= nunits){
+ c33:	e9 54 ff ff ff       	jmp    b8c <malloc+0x2c>
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c40:	8b 08                	mov    (%eax),%ecx
+ c42:	89 0a                	mov    %ecx,(%edx)
+ c44:	eb b9                	jmp    bff <malloc+0x9f>
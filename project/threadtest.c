@@ -0,0 +1,161 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "futex.h"
+
+#define NTHREAD 4
+#define NITER 1000
+#define PGSIZE 4096
+
+// Futex-based mutex: 0 unlocked, 1 locked, 2 locked with waiters.
+void
+lock(volatile int *m)
+{
+  int c;
+
+  if((c = __sync_val_compare_and_swap(m, 0, 1)) == 0)
+    return;
+  if(c != 2)
+    c = __sync_lock_test_and_set(m, 2);
+  while(c != 0){
+    futex((int*)m, FUTEX_WAIT, 2);
+    c = __sync_lock_test_and_set(m, 2);
+  }
+}
+
+void
+unlock(volatile int *m)
+{
+  if(__sync_fetch_and_sub(m, 1) != 1){
+    *m = 0;
+    futex((int*)m, FUTEX_WAKE, 1);
+  }
+}
+
+volatile int mutex;
+volatile int counter;
+volatile int fd = -1;
+volatile char *heap;
+
+void
+failed(char *why)
+{
+  printf(1, "Threadtest failed: %s\n", why);
+  exit();
+}
+
+void
+spawn(void (*fn)(void*), void *arg)
+{
+  char *stack;
+
+  if((stack = malloc(PGSIZE)) == 0)
+    failed("malloc");
+  if(clone(fn, arg, stack) < 0)
+    failed("clone");
+}
+
+void
+joinall(int n)
+{
+  void *stack;
+
+  while(n-- > 0){
+    if(join(&stack) < 0)
+      failed("join");
+    free(stack);
+  }
+  if(join(&stack) >= 0)
+    failed("join with no threads");
+}
+
+void
+adder(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NITER; i++){
+    lock(&mutex);
+    counter = counter + 1;
+    unlock(&mutex);
+  }
+  exit();
+}
+
+// Threads updating one variable under a futex lock.
+void
+counting(void)
+{
+  int i;
+
+  for(i = 0; i < NTHREAD; i++)
+    spawn(adder, 0);
+  joinall(NTHREAD);
+  if(counter != NTHREAD*NITER)
+    failed("lost updates");
+  printf(1, "counting ok\n");
+}
+
+void
+opener(void *arg)
+{
+  fd = open((char*)arg, O_CREATE|O_RDWR);
+  heap = sbrk(PGSIZE);
+  heap[0] = 'x';
+  exit();
+}
+
+// Open files and memory grown by one thread are visible to others.
+void
+sharing(void)
+{
+  char *name = "threadtest.tmp";
+
+  spawn(opener, name);
+  joinall(1);
+  if(fd < 0 || write(fd, "hello", 5) != 5)
+    failed("file not shared");
+  close(fd);
+  unlink(name);
+  if(heap == (char*)-1 || heap[0] != 'x')
+    failed("sbrk not shared");
+  printf(1, "sharing ok\n");
+}
+
+void
+sleeper(void *arg)
+{
+  futex((int*)&mutex, FUTEX_WAIT, 1);
+  exit();
+}
+
+// A process exiting takes its threads with it.
+void
+exiting(void)
+{
+  int pid;
+
+  pid = fork();
+  if(pid < 0)
+    failed("fork");
+  if(pid == 0){
+    mutex = 1;
+    spawn(sleeper, 0);
+    spawn(sleeper, 0);
+    exit();
+  }
+  if(wait() != pid)
+    failed("wait");
+  printf(1, "exiting ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  counting();
+  sharing();
+  exiting();
+  printf(1, "Threadtest Passed!\n");
+  exit();
+}
@@ -0,0 +1,262 @@
+// Timers for sleeping processes.
+//
+// sleep() used to sleep on &ticks, and the clock interrupt woke
+// every sleeper on every tick so that each could recheck its
+// deadline. Instead, a sleeping process arms the struct timer in
+// its proc and the clock interrupt wakes only the timers that expire.
+//
+// Tick timers live in a hierarchical timer wheel of NLEVEL levels
+// with WHEELSIZE slots each. Level 0 has one slot per tick and holds
+// timers due within WHEELSIZE ticks; level n has one slot per
+// WHEELSIZE^n ticks. Each time level n wraps, the next slot of
+// level n+1 is cascaded down into the finer levels. Arming and
+// disarming are O(1), and a tick with nothing due costs O(1) no
+// matter how many processes are asleep.
+//
+// High-resolution timers (usleep) run off cpu 0, which keeps ticks.
+// Its LAPIC timer runs in one-shot mode and is reprogrammed at every
+// interrupt to fire at the next tick or at the next high-resolution
+// deadline, whichever is sooner. Other cpus cannot read cpu 0's
+// LAPIC counter, so they queue the requested delay on tw.hrpending
+// and kick cpu 0 with an IPI to start the clock on it.
+//
+// tickslock protects ticks and everything in tw.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+
+#define WHEELBITS 6
+#define WHEELSIZE (1 << WHEELBITS)
+#define WHEELMASK (WHEELSIZE - 1)
+#define NLEVEL    4
+#define MAXDELTA  ((1 << (WHEELBITS*NLEVEL)) - 1)
+
+static struct {
+  struct timer *slot[NLEVEL][WHEELSIZE];
+  uint next;                 // Next tick whose timers have not run
+  struct timer *hrpending;   // usleep timers not yet on cpu 0's clock
+  struct timer *hrlist;      // Armed usleep timers, soonest first
+  uint64 now;                // cpu 0 LAPIC counts since timerinit
+  uint interval;             // Counts programmed at tw.now
+  uint64 nexttick;           // Value of tw.now when the next tick is due
+  uint lapicus;              // LAPIC counts per microsecond
+} tw;
+
+static void
+tlink(struct timer **head, struct timer *t)
+{
+  t->next = *head;
+  if(*head)
+    (*head)->pprev = &t->next;
+  *head = t;
+  t->pprev = head;
+}
+
+static void
+tunlink(struct timer *t)
+{
+  *t->pprev = t->next;
+  if(t->next)
+    t->next->pprev = t->pprev;
+  t->next = 0;
+  t->pprev = 0;
+}
+
+static void
+fire(struct timer *t)
+{
+  t->next = 0;
+  t->pprev = 0;
+  t->fired = 1;
+  wakeup(t);
+}
+
+// Put t in the wheel slot for t->expires.
+static void
+wheel_add(struct timer *t)
+{
+  uint delta, e;
+  int lvl;
+
+  delta = t->expires - tw.next;
+  if((int)delta < 0){
+    tlink(&tw.slot[0][tw.next & WHEELMASK], t);
+    return;
+  }
+  if(delta > MAXDELTA)
+    delta = MAXDELTA;
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+    if(delta < 1 << (WHEELBITS*(lvl+1)))
+      break;
+  e = tw.next + delta;
+  tlink(&tw.slot[lvl][(e >> (WHEELBITS*lvl)) & WHEELMASK], t);
+}
+
+// Move the current slot of level lvl down to the finer levels.
+// Returns the index of that slot.
+static int
+cascade(int lvl)
+{
+  struct timer *t, *n;
+  int idx;
+
+  idx = (tw.next >> (WHEELBITS*lvl)) & WHEELMASK;
+  t = tw.slot[lvl][idx];
+  tw.slot[lvl][idx] = 0;
+  for(; t; t = n){
+    n = t->next;
+    wheel_add(t);
+  }
+  return idx;
+}
+
+// Run the timers of every tick up to and including ticks.
+static void
+wheel_run(void)
+{
+  struct timer *t, *n;
+  int idx, lvl;
+
+  while((int)(ticks - tw.next) >= 0){
+    idx = tw.next & WHEELMASK;
+    if(idx == 0)
+      for(lvl = 1; lvl < NLEVEL && cascade(lvl) == 0; lvl++)
+        ;
+    t = tw.slot[0][idx];
+    tw.slot[0][idx] = 0;
+    for(; t; t = n){
+      n = t->next;
+      if((int)(t->expires - tw.next) > 0)
+        wheel_add(t);  // clamped to MAXDELTA, not due yet
+      else
+        fire(t);
+    }
+    tw.next++;
+  }
+}
+
+// Account for the LAPIC counts elapsed since the last reprogram,
+// advance ticks, fire expired timers and reprogram cpu 0's LAPIC
+// for the next event. Safe to call before the programmed interval
+// has elapsed. Caller must hold tickslock and be on cpu 0.
+static void
+clockupdate(void)
+{
+  struct timer *t, **pp;
+  uint64 next;
+  int ticked;
+
+  tw.now += tw.interval - lapiccount();
+
+  ticked = 0;
+  while(tw.now >= tw.nexttick){
+    tw.nexttick += lapictick;
+    ticks++;
+    ticked = 1;
+  }
+  if(ticked)
+    wheel_run();
+
+  while((t = tw.hrpending) != 0){
+    tunlink(t);
+    t->hrexpires = tw.now + t->hrdelta;
+    for(pp = &tw.hrlist; *pp && (*pp)->hrexpires <= t->hrexpires;
+        pp = &(*pp)->next)
+      ;
+    tlink(pp, t);
+  }
+  while((t = tw.hrlist) != 0 && t->hrexpires <= tw.now){
+    tunlink(t);
+    fire(t);
+  }
+
+  next = tw.nexttick;
+  if(tw.hrlist && tw.hrlist->hrexpires < next)
+    next = tw.hrlist->hrexpires;
+  tw.interval = next - tw.now;
+  lapiconeshot(tw.interval);
+}
+
+// Start the clock on cpu 0. Called once, before interrupts are enabled.
+void
+timerinit(void)
+{
+  tw.next = ticks + 1;
+  tw.lapicus = lapiccalibrate();
+  tw.now = 0;
+  tw.nexttick = lapictick;
+  tw.interval = lapictick;
+  lapiconeshot(tw.interval);
+}
+
+// LAPIC timer interrupt on cpu 0.
+void
+timerintr(void)
+{
+  acquire(&tickslock);
+  clockupdate();
+  release(&tickslock);
+}
+
+// Sleep for n clock ticks.
+// Returns -1 if the process was killed while sleeping.
+int
+sleepticks(uint n)
+{
+  struct proc *p = myproc();
+  struct timer *t = &p->timer;
+
+  acquire(&tickslock);
+  t->fired = (n == 0);
+  if(!t->fired){
+    t->expires = ticks + n;
+    wheel_add(t);
+  }
+  while(!t->fired){
+    if(p->killed){
+      tunlink(t);
+      release(&tickslock);
+      return -1;
+    }
+    sleep(t, &tickslock);
+  }
+  release(&tickslock);
+  return 0;
+}
+
+// Sleep for us microseconds, measured with cpu 0's LAPIC timer.
+// Returns -1 if the process was killed while sleeping.
+int
+sleepus(uint us)
+{
+  struct proc *p = myproc();
+  struct timer *t = &p->timer;
+
+  acquire(&tickslock);
+  t->fired = (us == 0);
+  if(!t->fired){
+    t->hrdelta = (uint64)us * tw.lapicus;
+    tlink(&tw.hrpending, t);
+    if(cpuid() == 0)
+      clockupdate();
+    else
+      lapicipi(cpus[0].apicid, T_IRQ0 + IRQ_TIMER);
+  }
+  while(!t->fired){
+    if(p->killed){
+      tunlink(t);
+      release(&tickslock);
+      return -1;
+    }
+    sleep(t, &tickslock);
+  }
+  release(&tickslock);
+  return 0;
+}
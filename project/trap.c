@@ -37,6 +37,7 @@ void
 trap(struct trapframe *tf)
 {
   if(tf->trapno == T_SYSCALL){
+    percpu_add(thiscpu(cpustat).syscalls, 1);
     if(myproc()->killed)
       exit();
     myproc()->tf = tf;
@@ -46,17 +47,23 @@ trap(struct trapframe *tf)
     return;
   }
 
+  // Interrupt gates have turned interrupts off.
+  if(tf->trapno >= T_IRQ0)
+    thiscpu(cpustat).intrs++;
+
   switch(tf->trapno){
   case T_PGFLT:
-    page_fault();
+    thiscpu(cpustat).pgfaults++;
+    if(page_fault(tf->err) == 0)
+      break;
+    goto bad;
+  case T_TLBFLUSH:
+    tlbintr();
+    lapiceoi();
     break;
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    if(cpuid() == 0)
+      timerintr();
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -83,6 +90,13 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+    if(tf->trapno == T_IRQ0 + diskirq){
+      // A PCI disk, whose IRQ is known only at boot.
+      ideintr();
+      lapiceoi();
+      break;
+    }
+  bad:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
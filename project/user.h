@@ -1,5 +1,6 @@
 struct stat;
 struct rtcdate;
+struct lockstat;
 
 // system calls
 int fork(void);
@@ -25,6 +26,15 @@ int sleep(int);
 int uptime(void);
 int getrss(void);
 int getNumFreePages(void);
+int usleep(int);
+int lockstat(struct lockstat*, int);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex(int*, int, int);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int sendfile(int, int, int, int);
+int splice(int, int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,6917 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 53 51 00 00       	push   $0x5153
+      16:	6a 01                	push   $0x1
+      18:	e8 33 3d 00 00       	call   3d50 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 67 51 00 00       	push   $0x5167
+      26:	e8 c8 3b 00 00       	call   3bf3 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 d0 58 00 00       	push   $0x58d0
+      39:	6a 01                	push   $0x1
+      3b:	e8 10 3d 00 00       	call   3d50 <printf>
+    exit();
+      40:	e8 6e 3b 00 00       	call   3bb3 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 67 51 00 00       	push   $0x5167
+      51:	e8 9d 3b 00 00       	call   3bf3 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 7d 3b 00 00       	call   3bdb <close>
+
+  argptest();
+      5e:	e8 7d 38 00 00       	call   38e0 <argptest>
+  createdelete();
+      63:	e8 c8 14 00 00       	call   1530 <createdelete>
+  linkunlink();
+      68:	e8 63 1d 00 00       	call   1dd0 <linkunlink>
+  concreate();
+      6d:	e8 5e 1a 00 00       	call   1ad0 <concreate>
+  fourfiles();
+      72:	e8 b9 12 00 00       	call   1330 <fourfiles>
+  sharedfd();
+      77:	e8 f4 10 00 00       	call   1170 <sharedfd>
+
+  bigargtest();
+      7c:	e8 1f 35 00 00       	call   35a0 <bigargtest>
+  bigwrite();
+      81:	e8 6a 26 00 00       	call   26f0 <bigwrite>
+  bigargtest();
+      86:	e8 15 35 00 00       	call   35a0 <bigargtest>
+  bsstest();
+      8b:	e8 a0 34 00 00       	call   3530 <bsstest>
+  sbrktest();
+      90:	e8 9b 2f 00 00       	call   3030 <sbrktest>
+  validatetest();
+      95:	e8 e6 33 00 00       	call   3480 <validatetest>
+
+  opentest();
+      9a:	e8 61 03 00 00       	call   400 <opentest>
+  writetest();
+      9f:	e8 ec 03 00 00       	call   490 <writetest>
+  writetest1();
+      a4:	e8 c7 05 00 00       	call   670 <writetest1>
+  createtest();
+      a9:	e8 82 07 00 00       	call   830 <createtest>
+
+  openiputtest();
+      ae:	e8 4d 02 00 00       	call   300 <openiputtest>
+  exitiputtest();
+      b3:	e8 48 01 00 00       	call   200 <exitiputtest>
+  iputtest();
+      b8:	e8 63 00 00 00       	call   120 <iputtest>
+
+  mem();
+      bd:	e8 de 0f 00 00       	call   10a0 <mem>
+  pipe1();
+      c2:	e8 49 09 00 00       	call   a10 <pipe1>
+  sendfiletest();
+      c7:	e8 e4 0a 00 00       	call   bb0 <sendfiletest>
+  preempt();
+      cc:	e8 ef 0d 00 00       	call   ec0 <preempt>
+  exitwait();
+      d1:	e8 4a 0f 00 00       	call   1020 <exitwait>
+
+  rmdot();
+      d6:	e8 05 2a 00 00       	call   2ae0 <rmdot>
+  fourteen();
+      db:	e8 c0 28 00 00       	call   29a0 <fourteen>
+  bigfile();
+      e0:	e8 eb 26 00 00       	call   27d0 <bigfile>
+  subdir();
+      e5:	e8 26 1f 00 00       	call   2010 <subdir>
+  linktest();
+      ea:	e8 d1 17 00 00       	call   18c0 <linktest>
+  unlinkread();
+      ef:	e8 3c 16 00 00       	call   1730 <unlinkread>
+  dirfile();
+      f4:	e8 67 2b 00 00       	call   2c60 <dirfile>
+  iref();
+      f9:	e8 62 2d 00 00       	call   2e60 <iref>
+  forktest();
+      fe:	e8 7d 2e 00 00       	call   2f80 <forktest>
+  bigdir(); // slow
+     103:	e8 d8 1d 00 00       	call   1ee0 <bigdir>
+
+  uio();
+     108:	e8 63 37 00 00       	call   3870 <uio>
+
+  exectest();
+     10d:	e8 ae 08 00 00       	call   9c0 <exectest>
+
+  exit();
+     112:	e8 9c 3a 00 00       	call   3bb3 <exit>
+     117:	66 90                	xchg   %ax,%ax
+     119:	66 90                	xchg   %ax,%ax
+     11b:	66 90                	xchg   %ax,%ax
+     11d:	66 90                	xchg   %ax,%ax
+     11f:	90                   	nop
+
+00000120 <iputtest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     126:	68 0c 41 00 00       	push   $0x410c
+     12b:	ff 35 74 62 00 00    	push   0x6274
+     131:	e8 1a 3c 00 00       	call   3d50 <printf>
+  if(mkdir("iputdir") < 0){
+     136:	c7 04 24 9f 40 00 00 	movl   $0x409f,(%esp)
+     13d:	e8 d9 3a 00 00       	call   3c1b <mkdir>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	78 58                	js     1a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     149:	83 ec 0c             	sub    $0xc,%esp
+     14c:	68 9f 40 00 00       	push   $0x409f
+     151:	e8 cd 3a 00 00       	call   3c23 <chdir>
+     156:	83 c4 10             	add    $0x10,%esp
+     159:	85 c0                	test   %eax,%eax
+     15b:	0f 88 85 00 00 00    	js     1e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     161:	83 ec 0c             	sub    $0xc,%esp
+     164:	68 9c 40 00 00       	push   $0x409c
+     169:	e8 95 3a 00 00       	call   3c03 <unlink>
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	78 5a                	js     1cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	68 c1 40 00 00       	push   $0x40c1
+     17d:	e8 a1 3a 00 00       	call   3c23 <chdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 2f                	js     1b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     189:	83 ec 08             	sub    $0x8,%esp
+     18c:	68 44 41 00 00       	push   $0x4144
+     191:	ff 35 74 62 00 00    	push   0x6274
+     197:	e8 b4 3b 00 00       	call   3d50 <printf>
+}
+     19c:	83 c4 10             	add    $0x10,%esp
+     19f:	c9                   	leave
+     1a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1a1:	50                   	push   %eax
+     1a2:	50                   	push   %eax
+     1a3:	68 78 40 00 00       	push   $0x4078
+     1a8:	ff 35 74 62 00 00    	push   0x6274
+     1ae:	e8 9d 3b 00 00       	call   3d50 <printf>
+    exit();
+     1b3:	e8 fb 39 00 00       	call   3bb3 <exit>
+    printf(stdout, "chdir / failed\n");
+     1b8:	50                   	push   %eax
+     1b9:	50                   	push   %eax
+     1ba:	68 c3 40 00 00       	push   $0x40c3
+     1bf:	ff 35 74 62 00 00    	push   0x6274
+     1c5:	e8 86 3b 00 00       	call   3d50 <printf>
+    exit();
+     1ca:	e8 e4 39 00 00       	call   3bb3 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1cf:	52                   	push   %edx
+     1d0:	52                   	push   %edx
+     1d1:	68 a7 40 00 00       	push   $0x40a7
+     1d6:	ff 35 74 62 00 00    	push   0x6274
+     1dc:	e8 6f 3b 00 00       	call   3d50 <printf>
+    exit();
+     1e1:	e8 cd 39 00 00       	call   3bb3 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1e6:	51                   	push   %ecx
+     1e7:	51                   	push   %ecx
+     1e8:	68 86 40 00 00       	push   $0x4086
+     1ed:	ff 35 74 62 00 00    	push   0x6274
+     1f3:	e8 58 3b 00 00       	call   3d50 <printf>
+    exit();
+     1f8:	e8 b6 39 00 00       	call   3bb3 <exit>
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <exitiputtest>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     206:	68 d3 40 00 00       	push   $0x40d3
+     20b:	ff 35 74 62 00 00    	push   0x6274
+     211:	e8 3a 3b 00 00       	call   3d50 <printf>
+  pid = fork();
+     216:	e8 90 39 00 00       	call   3bab <fork>
+  if(pid < 0){
+     21b:	83 c4 10             	add    $0x10,%esp
+     21e:	85 c0                	test   %eax,%eax
+     220:	0f 88 8a 00 00 00    	js     2b0 <exitiputtest+0xb0>
+  if(pid == 0){
+     226:	75 50                	jne    278 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     228:	83 ec 0c             	sub    $0xc,%esp
+     22b:	68 9f 40 00 00       	push   $0x409f
+     230:	e8 e6 39 00 00       	call   3c1b <mkdir>
+     235:	83 c4 10             	add    $0x10,%esp
+     238:	85 c0                	test   %eax,%eax
+     23a:	0f 88 87 00 00 00    	js     2c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     240:	83 ec 0c             	sub    $0xc,%esp
+     243:	68 9f 40 00 00       	push   $0x409f
+     248:	e8 d6 39 00 00       	call   3c23 <chdir>
+     24d:	83 c4 10             	add    $0x10,%esp
+     250:	85 c0                	test   %eax,%eax
+     252:	0f 88 86 00 00 00    	js     2de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 9c 40 00 00       	push   $0x409c
+     260:	e8 9e 39 00 00       	call   3c03 <unlink>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	78 2c                	js     298 <exitiputtest+0x98>
+    exit();
+     26c:	e8 42 39 00 00       	call   3bb3 <exit>
+     271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     278:	e8 3e 39 00 00       	call   3bbb <wait>
+  printf(stdout, "exitiput test ok\n");
+     27d:	83 ec 08             	sub    $0x8,%esp
+     280:	68 f6 40 00 00       	push   $0x40f6
+     285:	ff 35 74 62 00 00    	push   0x6274
+     28b:	e8 c0 3a 00 00       	call   3d50 <printf>
+}
+     290:	83 c4 10             	add    $0x10,%esp
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     298:	83 ec 08             	sub    $0x8,%esp
+     29b:	68 a7 40 00 00       	push   $0x40a7
+     2a0:	ff 35 74 62 00 00    	push   0x6274
+     2a6:	e8 a5 3a 00 00       	call   3d50 <printf>
+      exit();
+     2ab:	e8 03 39 00 00       	call   3bb3 <exit>
+    printf(stdout, "fork failed\n");
+     2b0:	51                   	push   %ecx
+     2b1:	51                   	push   %ecx
+     2b2:	68 a6 50 00 00       	push   $0x50a6
+     2b7:	ff 35 74 62 00 00    	push   0x6274
+     2bd:	e8 8e 3a 00 00       	call   3d50 <printf>
+    exit();
+     2c2:	e8 ec 38 00 00       	call   3bb3 <exit>
+      printf(stdout, "mkdir failed\n");
+     2c7:	52                   	push   %edx
+     2c8:	52                   	push   %edx
+     2c9:	68 78 40 00 00       	push   $0x4078
+     2ce:	ff 35 74 62 00 00    	push   0x6274
+     2d4:	e8 77 3a 00 00       	call   3d50 <printf>
+      exit();
+     2d9:	e8 d5 38 00 00       	call   3bb3 <exit>
+      printf(stdout, "child chdir failed\n");
+     2de:	50                   	push   %eax
+     2df:	50                   	push   %eax
+     2e0:	68 e2 40 00 00       	push   $0x40e2
+     2e5:	ff 35 74 62 00 00    	push   0x6274
+     2eb:	e8 60 3a 00 00       	call   3d50 <printf>
+      exit();
+     2f0:	e8 be 38 00 00       	call   3bb3 <exit>
+     2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <openiputtest>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     306:	68 08 41 00 00       	push   $0x4108
+     30b:	ff 35 74 62 00 00    	push   0x6274
+     311:	e8 3a 3a 00 00       	call   3d50 <printf>
+  if(mkdir("oidir") < 0){
+     316:	c7 04 24 17 41 00 00 	movl   $0x4117,(%esp)
+     31d:	e8 f9 38 00 00       	call   3c1b <mkdir>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	0f 88 9f 00 00 00    	js     3cc <openiputtest+0xcc>
+  pid = fork();
+     32d:	e8 79 38 00 00       	call   3bab <fork>
+  if(pid < 0){
+     332:	85 c0                	test   %eax,%eax
+     334:	78 7f                	js     3b5 <openiputtest+0xb5>
+  if(pid == 0){
+     336:	75 38                	jne    370 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	6a 02                	push   $0x2
+     33d:	68 17 41 00 00       	push   $0x4117
+     342:	e8 ac 38 00 00       	call   3bf3 <open>
+    if(fd >= 0){
+     347:	83 c4 10             	add    $0x10,%esp
+     34a:	85 c0                	test   %eax,%eax
+     34c:	78 62                	js     3b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 88 51 00 00       	push   $0x5188
+     356:	ff 35 74 62 00 00    	push   0x6274
+     35c:	e8 ef 39 00 00       	call   3d50 <printf>
+      exit();
+     361:	e8 4d 38 00 00       	call   3bb3 <exit>
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     370:	83 ec 0c             	sub    $0xc,%esp
+     373:	6a 01                	push   $0x1
+     375:	e8 c9 38 00 00       	call   3c43 <sleep>
+  if(unlink("oidir") != 0){
+     37a:	c7 04 24 17 41 00 00 	movl   $0x4117,(%esp)
+     381:	e8 7d 38 00 00       	call   3c03 <unlink>
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	85 c0                	test   %eax,%eax
+     38b:	75 56                	jne    3e3 <openiputtest+0xe3>
+  wait();
+     38d:	e8 29 38 00 00       	call   3bbb <wait>
+  printf(stdout, "openiput test ok\n");
+     392:	83 ec 08             	sub    $0x8,%esp
+     395:	68 40 41 00 00       	push   $0x4140
+     39a:	ff 35 74 62 00 00    	push   0x6274
+     3a0:	e8 ab 39 00 00       	call   3d50 <printf>
+}
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	c9                   	leave
+     3a9:	c3                   	ret
+     3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3b0:	e8 fe 37 00 00       	call   3bb3 <exit>
+    printf(stdout, "fork failed\n");
+     3b5:	52                   	push   %edx
+     3b6:	52                   	push   %edx
+     3b7:	68 a6 50 00 00       	push   $0x50a6
+     3bc:	ff 35 74 62 00 00    	push   0x6274
+     3c2:	e8 89 39 00 00       	call   3d50 <printf>
+    exit();
+     3c7:	e8 e7 37 00 00       	call   3bb3 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3cc:	51                   	push   %ecx
+     3cd:	51                   	push   %ecx
+     3ce:	68 1d 41 00 00       	push   $0x411d
+     3d3:	ff 35 74 62 00 00    	push   0x6274
+     3d9:	e8 72 39 00 00       	call   3d50 <printf>
+    exit();
+     3de:	e8 d0 37 00 00       	call   3bb3 <exit>
+    printf(stdout, "unlink failed\n");
+     3e3:	50                   	push   %eax
+     3e4:	50                   	push   %eax
+     3e5:	68 31 41 00 00       	push   $0x4131
+     3ea:	ff 35 74 62 00 00    	push   0x6274
+     3f0:	e8 5b 39 00 00       	call   3d50 <printf>
+    exit();
+     3f5:	e8 b9 37 00 00       	call   3bb3 <exit>
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <opentest>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     406:	68 52 41 00 00       	push   $0x4152
+     40b:	ff 35 74 62 00 00    	push   0x6274
+     411:	e8 3a 39 00 00       	call   3d50 <printf>
+  fd = open("echo", 0);
+     416:	58                   	pop    %eax
+     417:	5a                   	pop    %edx
+     418:	6a 00                	push   $0x0
+     41a:	68 5d 41 00 00       	push   $0x415d
+     41f:	e8 cf 37 00 00       	call   3bf3 <open>
+  if(fd < 0){
+     424:	83 c4 10             	add    $0x10,%esp
+     427:	85 c0                	test   %eax,%eax
+     429:	78 36                	js     461 <opentest+0x61>
+  close(fd);
+     42b:	83 ec 0c             	sub    $0xc,%esp
+     42e:	50                   	push   %eax
+     42f:	e8 a7 37 00 00       	call   3bdb <close>
+  fd = open("doesnotexist", 0);
+     434:	5a                   	pop    %edx
+     435:	59                   	pop    %ecx
+     436:	6a 00                	push   $0x0
+     438:	68 75 41 00 00       	push   $0x4175
+     43d:	e8 b1 37 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	79 2f                	jns    478 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	68 a0 41 00 00       	push   $0x41a0
+     451:	ff 35 74 62 00 00    	push   0x6274
+     457:	e8 f4 38 00 00       	call   3d50 <printf>
+}
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	c9                   	leave
+     460:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     461:	50                   	push   %eax
+     462:	50                   	push   %eax
+     463:	68 62 41 00 00       	push   $0x4162
+     468:	ff 35 74 62 00 00    	push   0x6274
+     46e:	e8 dd 38 00 00       	call   3d50 <printf>
+    exit();
+     473:	e8 3b 37 00 00       	call   3bb3 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     478:	50                   	push   %eax
+     479:	50                   	push   %eax
+     47a:	68 82 41 00 00       	push   $0x4182
+     47f:	ff 35 74 62 00 00    	push   0x6274
+     485:	e8 c6 38 00 00       	call   3d50 <printf>
+    exit();
+     48a:	e8 24 37 00 00       	call   3bb3 <exit>
+     48f:	90                   	nop
+
+00000490 <writetest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	68 ae 41 00 00       	push   $0x41ae
+     49d:	ff 35 74 62 00 00    	push   0x6274
+     4a3:	e8 a8 38 00 00       	call   3d50 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4a8:	58                   	pop    %eax
+     4a9:	5a                   	pop    %edx
+     4aa:	68 02 02 00 00       	push   $0x202
+     4af:	68 bf 41 00 00       	push   $0x41bf
+     4b4:	e8 3a 37 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	85 c0                	test   %eax,%eax
+     4be:	0f 88 88 01 00 00    	js     64c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4c4:	83 ec 08             	sub    $0x8,%esp
+     4c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4cb:	68 c5 41 00 00       	push   $0x41c5
+     4d0:	ff 35 74 62 00 00    	push   0x6274
+     4d6:	e8 75 38 00 00       	call   3d50 <printf>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	6a 0a                	push   $0xa
+     4e5:	68 fc 41 00 00       	push   $0x41fc
+     4ea:	56                   	push   %esi
+     4eb:	e8 e3 36 00 00       	call   3bd3 <write>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	83 f8 0a             	cmp    $0xa,%eax
+     4f6:	0f 85 d9 00 00 00    	jne    5d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	6a 0a                	push   $0xa
+     501:	68 07 42 00 00       	push   $0x4207
+     506:	56                   	push   %esi
+     507:	e8 c7 36 00 00       	call   3bd3 <write>
+     50c:	83 c4 10             	add    $0x10,%esp
+     50f:	83 f8 0a             	cmp    $0xa,%eax
+     512:	0f 85 d6 00 00 00    	jne    5ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     518:	83 c3 01             	add    $0x1,%ebx
+     51b:	83 fb 64             	cmp    $0x64,%ebx
+     51e:	75 c0                	jne    4e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     520:	83 ec 08             	sub    $0x8,%esp
+     523:	68 12 42 00 00       	push   $0x4212
+     528:	ff 35 74 62 00 00    	push   0x6274
+     52e:	e8 1d 38 00 00       	call   3d50 <printf>
+  close(fd);
+     533:	89 34 24             	mov    %esi,(%esp)
+     536:	e8 a0 36 00 00       	call   3bdb <close>
+  fd = open("small", O_RDONLY);
+     53b:	5b                   	pop    %ebx
+     53c:	5e                   	pop    %esi
+     53d:	6a 00                	push   $0x0
+     53f:	68 bf 41 00 00       	push   $0x41bf
+     544:	e8 aa 36 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+     549:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     54c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     54e:	85 c0                	test   %eax,%eax
+     550:	0f 88 b1 00 00 00    	js     607 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     556:	83 ec 08             	sub    $0x8,%esp
+     559:	68 1d 42 00 00       	push   $0x421d
+     55e:	ff 35 74 62 00 00    	push   0x6274
+     564:	e8 e7 37 00 00       	call   3d50 <printf>
+  i = read(fd, buf, 2000);
+     569:	83 c4 0c             	add    $0xc,%esp
+     56c:	68 d0 07 00 00       	push   $0x7d0
+     571:	68 c0 89 00 00       	push   $0x89c0
+     576:	53                   	push   %ebx
+     577:	e8 4f 36 00 00       	call   3bcb <read>
+  if(i == 2000){
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     584:	0f 85 94 00 00 00    	jne    61e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     58a:	83 ec 08             	sub    $0x8,%esp
+     58d:	68 51 42 00 00       	push   $0x4251
+     592:	ff 35 74 62 00 00    	push   0x6274
+     598:	e8 b3 37 00 00       	call   3d50 <printf>
+  close(fd);
+     59d:	89 1c 24             	mov    %ebx,(%esp)
+     5a0:	e8 36 36 00 00       	call   3bdb <close>
+  if(unlink("small") < 0){
+     5a5:	c7 04 24 bf 41 00 00 	movl   $0x41bf,(%esp)
+     5ac:	e8 52 36 00 00       	call   3c03 <unlink>
+     5b1:	83 c4 10             	add    $0x10,%esp
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	78 7d                	js     635 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5b8:	83 ec 08             	sub    $0x8,%esp
+     5bb:	68 79 42 00 00       	push   $0x4279
+     5c0:	ff 35 74 62 00 00    	push   0x6274
+     5c6:	e8 85 37 00 00       	call   3d50 <printf>
+}
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5d1:	5b                   	pop    %ebx
+     5d2:	5e                   	pop    %esi
+     5d3:	5d                   	pop    %ebp
+     5d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5d5:	83 ec 04             	sub    $0x4,%esp
+     5d8:	53                   	push   %ebx
+     5d9:	68 ac 51 00 00       	push   $0x51ac
+     5de:	ff 35 74 62 00 00    	push   0x6274
+     5e4:	e8 67 37 00 00       	call   3d50 <printf>
+      exit();
+     5e9:	e8 c5 35 00 00       	call   3bb3 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5ee:	83 ec 04             	sub    $0x4,%esp
+     5f1:	53                   	push   %ebx
+     5f2:	68 d0 51 00 00       	push   $0x51d0
+     5f7:	ff 35 74 62 00 00    	push   0x6274
+     5fd:	e8 4e 37 00 00       	call   3d50 <printf>
+      exit();
+     602:	e8 ac 35 00 00       	call   3bb3 <exit>
+    printf(stdout, "error: open small failed!\n");
+     607:	51                   	push   %ecx
+     608:	51                   	push   %ecx
+     609:	68 36 42 00 00       	push   $0x4236
+     60e:	ff 35 74 62 00 00    	push   0x6274
+     614:	e8 37 37 00 00       	call   3d50 <printf>
+    exit();
+     619:	e8 95 35 00 00       	call   3bb3 <exit>
+    printf(stdout, "read failed\n");
+     61e:	52                   	push   %edx
+     61f:	52                   	push   %edx
+     620:	68 6a 46 00 00       	push   $0x466a
+     625:	ff 35 74 62 00 00    	push   0x6274
+     62b:	e8 20 37 00 00       	call   3d50 <printf>
+    exit();
+     630:	e8 7e 35 00 00       	call   3bb3 <exit>
+    printf(stdout, "unlink small failed\n");
+     635:	50                   	push   %eax
+     636:	50                   	push   %eax
+     637:	68 64 42 00 00       	push   $0x4264
+     63c:	ff 35 74 62 00 00    	push   0x6274
+     642:	e8 09 37 00 00       	call   3d50 <printf>
+    exit();
+     647:	e8 67 35 00 00       	call   3bb3 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     64c:	50                   	push   %eax
+     64d:	50                   	push   %eax
+     64e:	68 e0 41 00 00       	push   $0x41e0
+     653:	ff 35 74 62 00 00    	push   0x6274
+     659:	e8 f2 36 00 00       	call   3d50 <printf>
+    exit();
+     65e:	e8 50 35 00 00       	call   3bb3 <exit>
+     663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <writetest1>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     675:	83 ec 08             	sub    $0x8,%esp
+     678:	68 8d 42 00 00       	push   $0x428d
+     67d:	ff 35 74 62 00 00    	push   0x6274
+     683:	e8 c8 36 00 00       	call   3d50 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     688:	58                   	pop    %eax
+     689:	5a                   	pop    %edx
+     68a:	68 02 02 00 00       	push   $0x202
+     68f:	68 07 43 00 00       	push   $0x4307
+     694:	e8 5a 35 00 00       	call   3bf3 <open>
+  if(fd < 0){
+     699:	83 c4 10             	add    $0x10,%esp
+     69c:	85 c0                	test   %eax,%eax
+     69e:	0f 88 5d 01 00 00    	js     801 <writetest1+0x191>
+     6a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6a6:	31 db                	xor    %ebx,%ebx
+     6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6b3:	89 1d c0 89 00 00    	mov    %ebx,0x89c0
+    if(write(fd, buf, 512) != 512){
+     6b9:	68 00 02 00 00       	push   $0x200
+     6be:	68 c0 89 00 00       	push   $0x89c0
+     6c3:	56                   	push   %esi
+     6c4:	e8 0a 35 00 00       	call   3bd3 <write>
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6d1:	0f 85 b3 00 00 00    	jne    78a <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6d7:	83 c3 01             	add    $0x1,%ebx
+     6da:	81 fb 8b 08 00 00    	cmp    $0x88b,%ebx
+     6e0:	75 ce                	jne    6b0 <writetest1+0x40>
+  close(fd);
+     6e2:	83 ec 0c             	sub    $0xc,%esp
+     6e5:	56                   	push   %esi
+     6e6:	e8 f0 34 00 00       	call   3bdb <close>
+  fd = open("big", O_RDONLY);
+     6eb:	5b                   	pop    %ebx
+     6ec:	5e                   	pop    %esi
+     6ed:	6a 00                	push   $0x0
+     6ef:	68 07 43 00 00       	push   $0x4307
+     6f4:	e8 fa 34 00 00       	call   3bf3 <open>
+  if(fd < 0){
+     6f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     6fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     6fe:	85 c0                	test   %eax,%eax
+     700:	0f 88 e4 00 00 00    	js     7ea <writetest1+0x17a>
+  n = 0;
+     706:	31 f6                	xor    %esi,%esi
+     708:	eb 1d                	jmp    727 <writetest1+0xb7>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     710:	3d 00 02 00 00       	cmp    $0x200,%eax
+     715:	0f 85 9f 00 00 00    	jne    7ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     71b:	a1 c0 89 00 00       	mov    0x89c0,%eax
+     720:	39 f0                	cmp    %esi,%eax
+     722:	75 7f                	jne    7a3 <writetest1+0x133>
+    n++;
+     724:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     727:	83 ec 04             	sub    $0x4,%esp
+     72a:	68 00 02 00 00       	push   $0x200
+     72f:	68 c0 89 00 00       	push   $0x89c0
+     734:	53                   	push   %ebx
+     735:	e8 91 34 00 00       	call   3bcb <read>
+    if(i == 0){
+     73a:	83 c4 10             	add    $0x10,%esp
+     73d:	85 c0                	test   %eax,%eax
+     73f:	75 cf                	jne    710 <writetest1+0xa0>
+      if(n != BIGBLOCKS){
+     741:	81 fe 8b 08 00 00    	cmp    $0x88b,%esi
+     747:	0f 85 86 00 00 00    	jne    7d3 <writetest1+0x163>
+  close(fd);
+     74d:	83 ec 0c             	sub    $0xc,%esp
+     750:	53                   	push   %ebx
+     751:	e8 85 34 00 00       	call   3bdb <close>
+  if(unlink("big") < 0){
+     756:	c7 04 24 07 43 00 00 	movl   $0x4307,(%esp)
+     75d:	e8 a1 34 00 00       	call   3c03 <unlink>
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	0f 88 ab 00 00 00    	js     818 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     76d:	83 ec 08             	sub    $0x8,%esp
+     770:	68 2e 43 00 00       	push   $0x432e
+     775:	ff 35 74 62 00 00    	push   0x6274
+     77b:	e8 d0 35 00 00       	call   3d50 <printf>
+}
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5d                   	pop    %ebp
+     789:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     78a:	83 ec 04             	sub    $0x4,%esp
+     78d:	53                   	push   %ebx
+     78e:	68 b7 42 00 00       	push   $0x42b7
+     793:	ff 35 74 62 00 00    	push   0x6274
+     799:	e8 b2 35 00 00       	call   3d50 <printf>
+      exit();
+     79e:	e8 10 34 00 00       	call   3bb3 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7a3:	50                   	push   %eax
+     7a4:	56                   	push   %esi
+     7a5:	68 f4 51 00 00       	push   $0x51f4
+     7aa:	ff 35 74 62 00 00    	push   0x6274
+     7b0:	e8 9b 35 00 00       	call   3d50 <printf>
+      exit();
+     7b5:	e8 f9 33 00 00       	call   3bb3 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	50                   	push   %eax
+     7be:	68 0b 43 00 00       	push   $0x430b
+     7c3:	ff 35 74 62 00 00    	push   0x6274
+     7c9:	e8 82 35 00 00       	call   3d50 <printf>
+      exit();
+     7ce:	e8 e0 33 00 00       	call   3bb3 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7d3:	52                   	push   %edx
+     7d4:	56                   	push   %esi
+     7d5:	68 ee 42 00 00       	push   $0x42ee
+     7da:	ff 35 74 62 00 00    	push   0x6274
+     7e0:	e8 6b 35 00 00       	call   3d50 <printf>
+        exit();
+     7e5:	e8 c9 33 00 00       	call   3bb3 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7ea:	51                   	push   %ecx
+     7eb:	51                   	push   %ecx
+     7ec:	68 d5 42 00 00       	push   $0x42d5
+     7f1:	ff 35 74 62 00 00    	push   0x6274
+     7f7:	e8 54 35 00 00       	call   3d50 <printf>
+    exit();
+     7fc:	e8 b2 33 00 00       	call   3bb3 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     801:	50                   	push   %eax
+     802:	50                   	push   %eax
+     803:	68 9d 42 00 00       	push   $0x429d
+     808:	ff 35 74 62 00 00    	push   0x6274
+     80e:	e8 3d 35 00 00       	call   3d50 <printf>
+    exit();
+     813:	e8 9b 33 00 00       	call   3bb3 <exit>
+    printf(stdout, "unlink big failed\n");
+     818:	50                   	push   %eax
+     819:	50                   	push   %eax
+     81a:	68 1b 43 00 00       	push   $0x431b
+     81f:	ff 35 74 62 00 00    	push   0x6274
+     825:	e8 26 35 00 00       	call   3d50 <printf>
+    exit();
+     82a:	e8 84 33 00 00       	call   3bb3 <exit>
+     82f:	90                   	nop
+
+00000830 <createtest>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	53                   	push   %ebx
+  name[2] = '\0';
+     834:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     839:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     83c:	68 14 52 00 00       	push   $0x5214
+     841:	ff 35 74 62 00 00    	push   0x6274
+     847:	e8 04 35 00 00       	call   3d50 <printf>
+  name[0] = 'a';
+     84c:	c6 05 b0 89 00 00 61 	movb   $0x61,0x89b0
+  name[2] = '\0';
+     853:	83 c4 10             	add    $0x10,%esp
+     856:	c6 05 b2 89 00 00 00 	movb   $0x0,0x89b2
+  for(i = 0; i < 52; i++){
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     860:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     863:	88 1d b1 89 00 00    	mov    %bl,0x89b1
+  for(i = 0; i < 52; i++){
+     869:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     86c:	68 02 02 00 00       	push   $0x202
+     871:	68 b0 89 00 00       	push   $0x89b0
+     876:	e8 78 33 00 00       	call   3bf3 <open>
+    close(fd);
+     87b:	89 04 24             	mov    %eax,(%esp)
+     87e:	e8 58 33 00 00       	call   3bdb <close>
+  for(i = 0; i < 52; i++){
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	80 fb 64             	cmp    $0x64,%bl
+     889:	75 d5                	jne    860 <createtest+0x30>
+  name[0] = 'a';
+     88b:	c6 05 b0 89 00 00 61 	movb   $0x61,0x89b0
+  name[2] = '\0';
+     892:	bb 30 00 00 00       	mov    $0x30,%ebx
+     897:	c6 05 b2 89 00 00 00 	movb   $0x0,0x89b2
+  for(i = 0; i < 52; i++){
+     89e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8a0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8a3:	88 1d b1 89 00 00    	mov    %bl,0x89b1
+  for(i = 0; i < 52; i++){
+     8a9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8ac:	68 b0 89 00 00       	push   $0x89b0
+     8b1:	e8 4d 33 00 00       	call   3c03 <unlink>
+  for(i = 0; i < 52; i++){
+     8b6:	83 c4 10             	add    $0x10,%esp
+     8b9:	80 fb 64             	cmp    $0x64,%bl
+     8bc:	75 e2                	jne    8a0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8be:	83 ec 08             	sub    $0x8,%esp
+     8c1:	68 3c 52 00 00       	push   $0x523c
+     8c6:	ff 35 74 62 00 00    	push   0x6274
+     8cc:	e8 7f 34 00 00       	call   3d50 <printf>
+}
+     8d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8d4:	83 c4 10             	add    $0x10,%esp
+     8d7:	c9                   	leave
+     8d8:	c3                   	ret
+     8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <dirtest>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8e6:	68 3c 43 00 00       	push   $0x433c
+     8eb:	ff 35 74 62 00 00    	push   0x6274
+     8f1:	e8 5a 34 00 00       	call   3d50 <printf>
+  if(mkdir("dir0") < 0){
+     8f6:	c7 04 24 48 43 00 00 	movl   $0x4348,(%esp)
+     8fd:	e8 19 33 00 00       	call   3c1b <mkdir>
+     902:	83 c4 10             	add    $0x10,%esp
+     905:	85 c0                	test   %eax,%eax
+     907:	78 58                	js     961 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     909:	83 ec 0c             	sub    $0xc,%esp
+     90c:	68 48 43 00 00       	push   $0x4348
+     911:	e8 0d 33 00 00       	call   3c23 <chdir>
+     916:	83 c4 10             	add    $0x10,%esp
+     919:	85 c0                	test   %eax,%eax
+     91b:	0f 88 85 00 00 00    	js     9a6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     921:	83 ec 0c             	sub    $0xc,%esp
+     924:	68 da 49 00 00       	push   $0x49da
+     929:	e8 f5 32 00 00       	call   3c23 <chdir>
+     92e:	83 c4 10             	add    $0x10,%esp
+     931:	85 c0                	test   %eax,%eax
+     933:	78 5a                	js     98f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	68 48 43 00 00       	push   $0x4348
+     93d:	e8 c1 32 00 00       	call   3c03 <unlink>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	78 2f                	js     978 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     949:	83 ec 08             	sub    $0x8,%esp
+     94c:	68 85 43 00 00       	push   $0x4385
+     951:	ff 35 74 62 00 00    	push   0x6274
+     957:	e8 f4 33 00 00       	call   3d50 <printf>
+}
+     95c:	83 c4 10             	add    $0x10,%esp
+     95f:	c9                   	leave
+     960:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     961:	50                   	push   %eax
+     962:	50                   	push   %eax
+     963:	68 78 40 00 00       	push   $0x4078
+     968:	ff 35 74 62 00 00    	push   0x6274
+     96e:	e8 dd 33 00 00       	call   3d50 <printf>
+    exit();
+     973:	e8 3b 32 00 00       	call   3bb3 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     978:	50                   	push   %eax
+     979:	50                   	push   %eax
+     97a:	68 71 43 00 00       	push   $0x4371
+     97f:	ff 35 74 62 00 00    	push   0x6274
+     985:	e8 c6 33 00 00       	call   3d50 <printf>
+    exit();
+     98a:	e8 24 32 00 00       	call   3bb3 <exit>
+    printf(stdout, "chdir .. failed\n");
+     98f:	52                   	push   %edx
+     990:	52                   	push   %edx
+     991:	68 60 43 00 00       	push   $0x4360
+     996:	ff 35 74 62 00 00    	push   0x6274
+     99c:	e8 af 33 00 00       	call   3d50 <printf>
+    exit();
+     9a1:	e8 0d 32 00 00       	call   3bb3 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9a6:	51                   	push   %ecx
+     9a7:	51                   	push   %ecx
+     9a8:	68 4d 43 00 00       	push   $0x434d
+     9ad:	ff 35 74 62 00 00    	push   0x6274
+     9b3:	e8 98 33 00 00       	call   3d50 <printf>
+    exit();
+     9b8:	e8 f6 31 00 00       	call   3bb3 <exit>
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <exectest>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9c6:	68 94 43 00 00       	push   $0x4394
+     9cb:	ff 35 74 62 00 00    	push   0x6274
+     9d1:	e8 7a 33 00 00       	call   3d50 <printf>
+  if(exec("echo", echoargv) < 0){
+     9d6:	5a                   	pop    %edx
+     9d7:	59                   	pop    %ecx
+     9d8:	68 78 62 00 00       	push   $0x6278
+     9dd:	68 5d 41 00 00       	push   $0x415d
+     9e2:	e8 04 32 00 00       	call   3beb <exec>
+     9e7:	83 c4 10             	add    $0x10,%esp
+     9ea:	85 c0                	test   %eax,%eax
+     9ec:	78 02                	js     9f0 <exectest+0x30>
+}
+     9ee:	c9                   	leave
+     9ef:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     9f0:	50                   	push   %eax
+     9f1:	50                   	push   %eax
+     9f2:	68 9f 43 00 00       	push   $0x439f
+     9f7:	ff 35 74 62 00 00    	push   0x6274
+     9fd:	e8 4e 33 00 00       	call   3d50 <printf>
+    exit();
+     a02:	e8 ac 31 00 00       	call   3bb3 <exit>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <pipe1>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a18:	53                   	push   %ebx
+     a19:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a1c:	50                   	push   %eax
+     a1d:	e8 a1 31 00 00       	call   3bc3 <pipe>
+     a22:	83 c4 10             	add    $0x10,%esp
+     a25:	85 c0                	test   %eax,%eax
+     a27:	0f 85 41 01 00 00    	jne    b6e <pipe1+0x15e>
+     a2d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a2f:	e8 77 31 00 00       	call   3bab <fork>
+  if(pid == 0){
+     a34:	85 c0                	test   %eax,%eax
+     a36:	0f 84 92 00 00 00    	je     ace <pipe1+0xbe>
+  } else if(pid > 0){
+     a3c:	0f 8e 3f 01 00 00    	jle    b81 <pipe1+0x171>
+    close(fds[1]);
+     a42:	83 ec 0c             	sub    $0xc,%esp
+     a45:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a48:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a4a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a4f:	e8 87 31 00 00       	call   3bdb <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	83 ec 04             	sub    $0x4,%esp
+     a5a:	57                   	push   %edi
+     a5b:	68 c0 89 00 00       	push   $0x89c0
+     a60:	ff 75 e0             	push   -0x20(%ebp)
+     a63:	e8 63 31 00 00       	call   3bcb <read>
+     a68:	83 c4 10             	add    $0x10,%esp
+     a6b:	89 c1                	mov    %eax,%ecx
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	0f 8e b8 00 00 00    	jle    b2d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a75:	89 f0                	mov    %esi,%eax
+     a77:	32 05 c0 89 00 00    	xor    0x89c0,%al
+     a7d:	0f b6 c0             	movzbl %al,%eax
+     a80:	85 c0                	test   %eax,%eax
+     a82:	75 30                	jne    ab4 <pipe1+0xa4>
+     a84:	83 c6 01             	add    $0x1,%esi
+     a87:	eb 0f                	jmp    a98 <pipe1+0x88>
+     a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a90:	38 90 c0 89 00 00    	cmp    %dl,0x89c0(%eax)
+     a96:	75 1c                	jne    ab4 <pipe1+0xa4>
+     a98:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     a9b:	83 c0 01             	add    $0x1,%eax
+     a9e:	39 c1                	cmp    %eax,%ecx
+     aa0:	75 ee                	jne    a90 <pipe1+0x80>
+      cc = cc * 2;
+     aa2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     aa4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     aa9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     aab:	89 d6                	mov    %edx,%esi
+     aad:	39 c7                	cmp    %eax,%edi
+     aaf:	0f 4f f8             	cmovg  %eax,%edi
+     ab2:	eb a3                	jmp    a57 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ab4:	83 ec 08             	sub    $0x8,%esp
+     ab7:	68 ce 43 00 00       	push   $0x43ce
+     abc:	6a 01                	push   $0x1
+     abe:	e8 8d 32 00 00       	call   3d50 <printf>
+     ac3:	83 c4 10             	add    $0x10,%esp
+}
+     ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac9:	5b                   	pop    %ebx
+     aca:	5e                   	pop    %esi
+     acb:	5f                   	pop    %edi
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+    close(fds[0]);
+     ace:	83 ec 0c             	sub    $0xc,%esp
+     ad1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ad4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ad6:	e8 00 31 00 00       	call   3bdb <close>
+     adb:	83 c4 10             	add    $0x10,%esp
+     ade:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     ae0:	31 c0                	xor    %eax,%eax
+     ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     ae8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     aeb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     aee:	88 90 bf 89 00 00    	mov    %dl,0x89bf(%eax)
+      for(i = 0; i < 1033; i++)
+     af4:	3d 09 04 00 00       	cmp    $0x409,%eax
+     af9:	75 ed                	jne    ae8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     afb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     afe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b04:	68 09 04 00 00       	push   $0x409
+     b09:	68 c0 89 00 00       	push   $0x89c0
+     b0e:	ff 75 e4             	push   -0x1c(%ebp)
+     b11:	e8 bd 30 00 00       	call   3bd3 <write>
+     b16:	83 c4 10             	add    $0x10,%esp
+     b19:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b1e:	75 74                	jne    b94 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b20:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b26:	75 b8                	jne    ae0 <pipe1+0xd0>
+    exit();
+     b28:	e8 86 30 00 00       	call   3bb3 <exit>
+    if(total != 5 * 1033){
+     b2d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b33:	75 26                	jne    b5b <pipe1+0x14b>
+    close(fds[0]);
+     b35:	83 ec 0c             	sub    $0xc,%esp
+     b38:	ff 75 e0             	push   -0x20(%ebp)
+     b3b:	e8 9b 30 00 00       	call   3bdb <close>
+    wait();
+     b40:	e8 76 30 00 00       	call   3bbb <wait>
+  printf(1, "pipe1 ok\n");
+     b45:	5a                   	pop    %edx
+     b46:	59                   	pop    %ecx
+     b47:	68 f3 43 00 00       	push   $0x43f3
+     b4c:	6a 01                	push   $0x1
+     b4e:	e8 fd 31 00 00       	call   3d50 <printf>
+     b53:	83 c4 10             	add    $0x10,%esp
+     b56:	e9 6b ff ff ff       	jmp    ac6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b5b:	56                   	push   %esi
+     b5c:	53                   	push   %ebx
+     b5d:	68 dc 43 00 00       	push   $0x43dc
+     b62:	6a 01                	push   $0x1
+     b64:	e8 e7 31 00 00       	call   3d50 <printf>
+      exit();
+     b69:	e8 45 30 00 00       	call   3bb3 <exit>
+    printf(1, "pipe() failed\n");
+     b6e:	50                   	push   %eax
+     b6f:	50                   	push   %eax
+     b70:	68 b1 43 00 00       	push   $0x43b1
+     b75:	6a 01                	push   $0x1
+     b77:	e8 d4 31 00 00       	call   3d50 <printf>
+    exit();
+     b7c:	e8 32 30 00 00       	call   3bb3 <exit>
+    printf(1, "fork() failed\n");
+     b81:	50                   	push   %eax
+     b82:	50                   	push   %eax
+     b83:	68 fd 43 00 00       	push   $0x43fd
+     b88:	6a 01                	push   $0x1
+     b8a:	e8 c1 31 00 00       	call   3d50 <printf>
+    exit();
+     b8f:	e8 1f 30 00 00       	call   3bb3 <exit>
+        printf(1, "pipe1 oops 1\n");
+     b94:	57                   	push   %edi
+     b95:	57                   	push   %edi
+     b96:	68 c0 43 00 00       	push   $0x43c0
+     b9b:	6a 01                	push   $0x1
+     b9d:	e8 ae 31 00 00       	call   3d50 <printf>
+        exit();
+     ba2:	e8 0c 30 00 00       	call   3bb3 <exit>
+     ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <sendfiletest>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sendfile test\n");
+     bb9:	68 0c 44 00 00       	push   $0x440c
+     bbe:	6a 01                	push   $0x1
+     bc0:	e8 8b 31 00 00       	call   3d50 <printf>
+  fd = open("sendfile", O_CREATE | O_RDWR);
+     bc5:	58                   	pop    %eax
+     bc6:	5a                   	pop    %edx
+     bc7:	68 02 02 00 00       	push   $0x202
+     bcc:	68 1b 44 00 00       	push   $0x441b
+     bd1:	e8 1d 30 00 00       	call   3bf3 <open>
+  out = open("sendfile.out", O_CREATE | O_RDWR);
+     bd6:	59                   	pop    %ecx
+     bd7:	5e                   	pop    %esi
+     bd8:	68 02 02 00 00       	push   $0x202
+     bdd:	68 24 44 00 00       	push   $0x4424
+  fd = open("sendfile", O_CREATE | O_RDWR);
+     be2:	89 c3                	mov    %eax,%ebx
+  out = open("sendfile.out", O_CREATE | O_RDWR);
+     be4:	e8 0a 30 00 00       	call   3bf3 <open>
+  if(fd < 0 || out < 0){
+     be9:	83 c4 10             	add    $0x10,%esp
+  out = open("sendfile.out", O_CREATE | O_RDWR);
+     bec:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || out < 0){
+     bee:	89 d8                	mov    %ebx,%eax
+     bf0:	09 f0                	or     %esi,%eax
+     bf2:	0f 88 67 02 00 00    	js     e5f <sendfiletest+0x2af>
+  for(i = 0; i < 5000; i++)
+     bf8:	31 c9                	xor    %ecx,%ecx
+    buf[i] = i % 251;
+     bfa:	bf bf bf 8c 82       	mov    $0x828cbfbf,%edi
+     bff:	90                   	nop
+     c00:	89 c8                	mov    %ecx,%eax
+     c02:	f7 e7                	mul    %edi
+     c04:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 5000; i++)
+     c06:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = i % 251;
+     c09:	c1 ea 07             	shr    $0x7,%edx
+     c0c:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     c12:	29 d0                	sub    %edx,%eax
+     c14:	88 81 bf 89 00 00    	mov    %al,0x89bf(%ecx)
+  for(i = 0; i < 5000; i++)
+     c1a:	81 f9 88 13 00 00    	cmp    $0x1388,%ecx
+     c20:	75 de                	jne    c00 <sendfiletest+0x50>
+  if(write(fd, buf, 5000) != 5000 || write(fd, buf, 5000) != 5000){
+     c22:	83 ec 04             	sub    $0x4,%esp
+     c25:	68 88 13 00 00       	push   $0x1388
+     c2a:	68 c0 89 00 00       	push   $0x89c0
+     c2f:	53                   	push   %ebx
+     c30:	e8 9e 2f 00 00       	call   3bd3 <write>
+     c35:	83 c4 10             	add    $0x10,%esp
+     c38:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     c3d:	0f 85 09 02 00 00    	jne    e4c <sendfiletest+0x29c>
+     c43:	83 ec 04             	sub    $0x4,%esp
+     c46:	68 88 13 00 00       	push   $0x1388
+     c4b:	68 c0 89 00 00       	push   $0x89c0
+     c50:	53                   	push   %ebx
+     c51:	e8 7d 2f 00 00       	call   3bd3 <write>
+     c56:	83 c4 10             	add    $0x10,%esp
+     c59:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     c5e:	0f 85 e8 01 00 00    	jne    e4c <sendfiletest+0x29c>
+  close(fd);
+     c64:	83 ec 0c             	sub    $0xc,%esp
+     c67:	53                   	push   %ebx
+     c68:	e8 6e 2f 00 00       	call   3bdb <close>
+  fd = open("sendfile", O_RDONLY);
+     c6d:	5f                   	pop    %edi
+     c6e:	58                   	pop    %eax
+     c6f:	6a 00                	push   $0x0
+     c71:	68 1b 44 00 00       	push   $0x441b
+     c76:	e8 78 2f 00 00       	call   3bf3 <open>
+     c7b:	89 c3                	mov    %eax,%ebx
+  if(pipe(fds) != 0){
+     c7d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c80:	89 04 24             	mov    %eax,(%esp)
+     c83:	e8 3b 2f 00 00       	call   3bc3 <pipe>
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	85 c0                	test   %eax,%eax
+     c8d:	0f 85 18 02 00 00    	jne    eab <sendfiletest+0x2fb>
+  pid = fork();
+     c93:	e8 13 2f 00 00       	call   3bab <fork>
+  if(pid < 0){
+     c98:	85 c0                	test   %eax,%eax
+     c9a:	0f 88 f8 01 00 00    	js     e98 <sendfiletest+0x2e8>
+  if(pid == 0){
+     ca0:	0f 84 0f 01 00 00    	je     db5 <sendfiletest+0x205>
+  close(fds[1]);
+     ca6:	83 ec 0c             	sub    $0xc,%esp
+     ca9:	ff 75 e4             	push   -0x1c(%ebp)
+     cac:	e8 2a 2f 00 00       	call   3bdb <close>
+  if((n = splice(fds[0], out, 20000)) != 10000){
+     cb1:	83 c4 0c             	add    $0xc,%esp
+     cb4:	68 20 4e 00 00       	push   $0x4e20
+     cb9:	56                   	push   %esi
+     cba:	ff 75 e0             	push   -0x20(%ebp)
+     cbd:	e8 e1 2f 00 00       	call   3ca3 <splice>
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     cca:	0f 85 a2 01 00 00    	jne    e72 <sendfiletest+0x2c2>
+  close(fds[0]);
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	ff 75 e0             	push   -0x20(%ebp)
+     cd6:	e8 00 2f 00 00       	call   3bdb <close>
+  wait();
+     cdb:	e8 db 2e 00 00       	call   3bbb <wait>
+  if(sendfile(out, fd, 9990, 100) != 10){
+     ce0:	6a 64                	push   $0x64
+     ce2:	68 06 27 00 00       	push   $0x2706
+     ce7:	53                   	push   %ebx
+     ce8:	56                   	push   %esi
+     ce9:	e8 ad 2f 00 00       	call   3c9b <sendfile>
+     cee:	83 c4 20             	add    $0x20,%esp
+     cf1:	83 f8 0a             	cmp    $0xa,%eax
+     cf4:	0f 85 8b 01 00 00    	jne    e85 <sendfiletest+0x2d5>
+  close(fd);
+     cfa:	83 ec 0c             	sub    $0xc,%esp
+  total = 0;
+     cfd:	31 ff                	xor    %edi,%edi
+  close(fd);
+     cff:	53                   	push   %ebx
+     d00:	e8 d6 2e 00 00       	call   3bdb <close>
+  close(out);
+     d05:	89 34 24             	mov    %esi,(%esp)
+     d08:	e8 ce 2e 00 00       	call   3bdb <close>
+  out = open("sendfile.out", O_RDONLY);
+     d0d:	5b                   	pop    %ebx
+     d0e:	5e                   	pop    %esi
+     d0f:	6a 00                	push   $0x0
+     d11:	68 24 44 00 00       	push   $0x4424
+     d16:	e8 d8 2e 00 00       	call   3bf3 <open>
+  while((n = read(out, buf, sizeof(buf))) > 0){
+     d1b:	83 c4 10             	add    $0x10,%esp
+     d1e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d28:	83 ec 04             	sub    $0x4,%esp
+     d2b:	68 00 20 00 00       	push   $0x2000
+     d30:	68 c0 89 00 00       	push   $0x89c0
+     d35:	ff 75 d0             	push   -0x30(%ebp)
+     d38:	e8 8e 2e 00 00       	call   3bcb <read>
+     d3d:	83 c4 10             	add    $0x10,%esp
+     d40:	85 c0                	test   %eax,%eax
+     d42:	0f 8e a7 00 00 00    	jle    def <sendfiletest+0x23f>
+     d48:	01 f8                	add    %edi,%eax
+    for(i = 0; i < n; i++, total++){
+     d4a:	31 db                	xor    %ebx,%ebx
+     d4c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     d4f:	eb 14                	jmp    d65 <sendfiletest+0x1b5>
+     d51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d58:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     d5b:	83 c7 01             	add    $0x1,%edi
+     d5e:	83 c3 01             	add    $0x1,%ebx
+     d61:	39 c7                	cmp    %eax,%edi
+     d63:	74 c3                	je     d28 <sendfiletest+0x178>
+      j = total < 10000 ? total : total - 10;
+     d65:	81 ff 0f 27 00 00    	cmp    $0x270f,%edi
+     d6b:	8d 4f f6             	lea    -0xa(%edi),%ecx
+      if((buf[i] & 0xff) != j % 5000 % 251){
+     d6e:	b8 59 17 b7 d1       	mov    $0xd1b71759,%eax
+     d73:	0f b6 b3 c0 89 00 00 	movzbl 0x89c0(%ebx),%esi
+      j = total < 10000 ? total : total - 10;
+     d7a:	0f 4e cf             	cmovle %edi,%ecx
+      if((buf[i] & 0xff) != j % 5000 % 251){
+     d7d:	f7 e1                	mul    %ecx
+     d7f:	b8 bf bf 8c 82       	mov    $0x828cbfbf,%eax
+     d84:	c1 ea 0c             	shr    $0xc,%edx
+     d87:	69 d2 88 13 00 00    	imul   $0x1388,%edx,%edx
+     d8d:	29 d1                	sub    %edx,%ecx
+     d8f:	f7 e1                	mul    %ecx
+     d91:	c1 ea 07             	shr    $0x7,%edx
+     d94:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     d9a:	29 d1                	sub    %edx,%ecx
+     d9c:	39 ce                	cmp    %ecx,%esi
+     d9e:	74 b8                	je     d58 <sendfiletest+0x1a8>
+        printf(1, "sendfile.out wrong at %d\n", total);
+     da0:	83 ec 04             	sub    $0x4,%esp
+     da3:	57                   	push   %edi
+     da4:	68 b7 44 00 00       	push   $0x44b7
+     da9:	6a 01                	push   $0x1
+     dab:	e8 a0 2f 00 00       	call   3d50 <printf>
+        exit();
+     db0:	e8 fe 2d 00 00       	call   3bb3 <exit>
+    close(fds[0]);
+     db5:	83 ec 0c             	sub    $0xc,%esp
+     db8:	ff 75 e0             	push   -0x20(%ebp)
+     dbb:	e8 1b 2e 00 00       	call   3bdb <close>
+    if((n = sendfile(fds[1], fd, -1, 20000)) != 10000){
+     dc0:	68 20 4e 00 00       	push   $0x4e20
+     dc5:	6a ff                	push   $0xffffffff
+     dc7:	53                   	push   %ebx
+     dc8:	ff 75 e4             	push   -0x1c(%ebp)
+     dcb:	e8 cb 2e 00 00       	call   3c9b <sendfile>
+     dd0:	83 c4 20             	add    $0x20,%esp
+     dd3:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     dd8:	74 5a                	je     e34 <sendfiletest+0x284>
+      printf(1, "sendfile to pipe returned %d\n", n);
+     dda:	83 ec 04             	sub    $0x4,%esp
+     ddd:	50                   	push   %eax
+     dde:	68 60 44 00 00       	push   $0x4460
+     de3:	6a 01                	push   $0x1
+     de5:	e8 66 2f 00 00       	call   3d50 <printf>
+      exit();
+     dea:	e8 c4 2d 00 00       	call   3bb3 <exit>
+  if(total != 10010){
+     def:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     df2:	81 ff 1a 27 00 00    	cmp    $0x271a,%edi
+     df8:	75 3f                	jne    e39 <sendfiletest+0x289>
+  close(out);
+     dfa:	83 ec 0c             	sub    $0xc,%esp
+     dfd:	56                   	push   %esi
+     dfe:	e8 d8 2d 00 00       	call   3bdb <close>
+  unlink("sendfile");
+     e03:	c7 04 24 1b 44 00 00 	movl   $0x441b,(%esp)
+     e0a:	e8 f4 2d 00 00       	call   3c03 <unlink>
+  unlink("sendfile.out");
+     e0f:	c7 04 24 24 44 00 00 	movl   $0x4424,(%esp)
+     e16:	e8 e8 2d 00 00       	call   3c03 <unlink>
+  printf(1, "sendfile ok\n");
+     e1b:	58                   	pop    %eax
+     e1c:	5a                   	pop    %edx
+     e1d:	68 ec 44 00 00       	push   $0x44ec
+     e22:	6a 01                	push   $0x1
+     e24:	e8 27 2f 00 00       	call   3d50 <printf>
+}
+     e29:	83 c4 10             	add    $0x10,%esp
+     e2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e2f:	5b                   	pop    %ebx
+     e30:	5e                   	pop    %esi
+     e31:	5f                   	pop    %edi
+     e32:	5d                   	pop    %ebp
+     e33:	c3                   	ret
+    exit();
+     e34:	e8 7a 2d 00 00       	call   3bb3 <exit>
+    printf(1, "sendfile.out has %d bytes\n", total);
+     e39:	51                   	push   %ecx
+     e3a:	57                   	push   %edi
+     e3b:	68 d1 44 00 00       	push   $0x44d1
+     e40:	6a 01                	push   $0x1
+     e42:	e8 09 2f 00 00       	call   3d50 <printf>
+    exit();
+     e47:	e8 67 2d 00 00       	call   3bb3 <exit>
+    printf(1, "write sendfile failed\n");
+     e4c:	50                   	push   %eax
+     e4d:	50                   	push   %eax
+     e4e:	68 49 44 00 00       	push   $0x4449
+     e53:	6a 01                	push   $0x1
+     e55:	e8 f6 2e 00 00       	call   3d50 <printf>
+    exit();
+     e5a:	e8 54 2d 00 00       	call   3bb3 <exit>
+    printf(1, "cannot create sendfile\n");
+     e5f:	50                   	push   %eax
+     e60:	50                   	push   %eax
+     e61:	68 31 44 00 00       	push   $0x4431
+     e66:	6a 01                	push   $0x1
+     e68:	e8 e3 2e 00 00       	call   3d50 <printf>
+    exit();
+     e6d:	e8 41 2d 00 00       	call   3bb3 <exit>
+    printf(1, "splice from pipe returned %d\n", n);
+     e72:	52                   	push   %edx
+     e73:	50                   	push   %eax
+     e74:	68 7e 44 00 00       	push   $0x447e
+     e79:	6a 01                	push   $0x1
+     e7b:	e8 d0 2e 00 00       	call   3d50 <printf>
+    exit();
+     e80:	e8 2e 2d 00 00       	call   3bb3 <exit>
+    printf(1, "sendfile at offset failed\n");
+     e85:	57                   	push   %edi
+     e86:	57                   	push   %edi
+     e87:	68 9c 44 00 00       	push   $0x449c
+     e8c:	6a 01                	push   $0x1
+     e8e:	e8 bd 2e 00 00       	call   3d50 <printf>
+    exit();
+     e93:	e8 1b 2d 00 00       	call   3bb3 <exit>
+    printf(1, "fork() failed\n");
+     e98:	51                   	push   %ecx
+     e99:	51                   	push   %ecx
+     e9a:	68 fd 43 00 00       	push   $0x43fd
+     e9f:	6a 01                	push   $0x1
+     ea1:	e8 aa 2e 00 00       	call   3d50 <printf>
+    exit();
+     ea6:	e8 08 2d 00 00       	call   3bb3 <exit>
+    printf(1, "pipe() failed\n");
+     eab:	53                   	push   %ebx
+     eac:	53                   	push   %ebx
+     ead:	68 b1 43 00 00       	push   $0x43b1
+     eb2:	6a 01                	push   $0x1
+     eb4:	e8 97 2e 00 00       	call   3d50 <printf>
+    exit();
+     eb9:	e8 f5 2c 00 00       	call   3bb3 <exit>
+     ebe:	66 90                	xchg   %ax,%ax
+
+00000ec0 <preempt>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	57                   	push   %edi
+     ec4:	56                   	push   %esi
+     ec5:	53                   	push   %ebx
+     ec6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     ec9:	68 f9 44 00 00       	push   $0x44f9
+     ece:	6a 01                	push   $0x1
+     ed0:	e8 7b 2e 00 00       	call   3d50 <printf>
+  pid1 = fork();
+     ed5:	e8 d1 2c 00 00       	call   3bab <fork>
+  if(pid1 == 0)
+     eda:	83 c4 10             	add    $0x10,%esp
+     edd:	85 c0                	test   %eax,%eax
+     edf:	75 07                	jne    ee8 <preempt+0x28>
+    for(;;)
+     ee1:	eb fe                	jmp    ee1 <preempt+0x21>
+     ee3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ee7:	90                   	nop
+     ee8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     eea:	e8 bc 2c 00 00       	call   3bab <fork>
+     eef:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     ef1:	85 c0                	test   %eax,%eax
+     ef3:	75 0b                	jne    f00 <preempt+0x40>
+    for(;;)
+     ef5:	eb fe                	jmp    ef5 <preempt+0x35>
+     ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efe:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     f06:	50                   	push   %eax
+     f07:	e8 b7 2c 00 00       	call   3bc3 <pipe>
+  pid3 = fork();
+     f0c:	e8 9a 2c 00 00       	call   3bab <fork>
+  if(pid3 == 0){
+     f11:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     f14:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     f16:	85 c0                	test   %eax,%eax
+     f18:	75 3e                	jne    f58 <preempt+0x98>
+    close(pfds[0]);
+     f1a:	83 ec 0c             	sub    $0xc,%esp
+     f1d:	ff 75 e0             	push   -0x20(%ebp)
+     f20:	e8 b6 2c 00 00       	call   3bdb <close>
+    if(write(pfds[1], "x", 1) != 1)
+     f25:	83 c4 0c             	add    $0xc,%esp
+     f28:	6a 01                	push   $0x1
+     f2a:	68 be 4a 00 00       	push   $0x4abe
+     f2f:	ff 75 e4             	push   -0x1c(%ebp)
+     f32:	e8 9c 2c 00 00       	call   3bd3 <write>
+     f37:	83 c4 10             	add    $0x10,%esp
+     f3a:	83 f8 01             	cmp    $0x1,%eax
+     f3d:	0f 85 b8 00 00 00    	jne    ffb <preempt+0x13b>
+    close(pfds[1]);
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	ff 75 e4             	push   -0x1c(%ebp)
+     f49:	e8 8d 2c 00 00       	call   3bdb <close>
+     f4e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     f51:	eb fe                	jmp    f51 <preempt+0x91>
+     f53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f57:	90                   	nop
+  close(pfds[1]);
+     f58:	83 ec 0c             	sub    $0xc,%esp
+     f5b:	ff 75 e4             	push   -0x1c(%ebp)
+     f5e:	e8 78 2c 00 00       	call   3bdb <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     f63:	83 c4 0c             	add    $0xc,%esp
+     f66:	68 00 20 00 00       	push   $0x2000
+     f6b:	68 c0 89 00 00       	push   $0x89c0
+     f70:	ff 75 e0             	push   -0x20(%ebp)
+     f73:	e8 53 2c 00 00       	call   3bcb <read>
+     f78:	83 c4 10             	add    $0x10,%esp
+     f7b:	83 f8 01             	cmp    $0x1,%eax
+     f7e:	75 67                	jne    fe7 <preempt+0x127>
+  close(pfds[0]);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	ff 75 e0             	push   -0x20(%ebp)
+     f86:	e8 50 2c 00 00       	call   3bdb <close>
+  printf(1, "kill... ");
+     f8b:	58                   	pop    %eax
+     f8c:	5a                   	pop    %edx
+     f8d:	68 2a 45 00 00       	push   $0x452a
+     f92:	6a 01                	push   $0x1
+     f94:	e8 b7 2d 00 00       	call   3d50 <printf>
+  kill(pid1);
+     f99:	89 1c 24             	mov    %ebx,(%esp)
+     f9c:	e8 42 2c 00 00       	call   3be3 <kill>
+  kill(pid2);
+     fa1:	89 34 24             	mov    %esi,(%esp)
+     fa4:	e8 3a 2c 00 00       	call   3be3 <kill>
+  kill(pid3);
+     fa9:	89 3c 24             	mov    %edi,(%esp)
+     fac:	e8 32 2c 00 00       	call   3be3 <kill>
+  printf(1, "wait... ");
+     fb1:	59                   	pop    %ecx
+     fb2:	5b                   	pop    %ebx
+     fb3:	68 33 45 00 00       	push   $0x4533
+     fb8:	6a 01                	push   $0x1
+     fba:	e8 91 2d 00 00       	call   3d50 <printf>
+  wait();
+     fbf:	e8 f7 2b 00 00       	call   3bbb <wait>
+  wait();
+     fc4:	e8 f2 2b 00 00       	call   3bbb <wait>
+  wait();
+     fc9:	e8 ed 2b 00 00       	call   3bbb <wait>
+  printf(1, "preempt ok\n");
+     fce:	5e                   	pop    %esi
+     fcf:	5f                   	pop    %edi
+     fd0:	68 3c 45 00 00       	push   $0x453c
+     fd5:	6a 01                	push   $0x1
+     fd7:	e8 74 2d 00 00       	call   3d50 <printf>
+     fdc:	83 c4 10             	add    $0x10,%esp
+}
+     fdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fe2:	5b                   	pop    %ebx
+     fe3:	5e                   	pop    %esi
+     fe4:	5f                   	pop    %edi
+     fe5:	5d                   	pop    %ebp
+     fe6:	c3                   	ret
+    printf(1, "preempt read error");
+     fe7:	83 ec 08             	sub    $0x8,%esp
+     fea:	68 17 45 00 00       	push   $0x4517
+     fef:	6a 01                	push   $0x1
+     ff1:	e8 5a 2d 00 00       	call   3d50 <printf>
+     ff6:	83 c4 10             	add    $0x10,%esp
+     ff9:	eb e4                	jmp    fdf <preempt+0x11f>
+      printf(1, "preempt write error");
+     ffb:	83 ec 08             	sub    $0x8,%esp
+     ffe:	68 03 45 00 00       	push   $0x4503
+    1003:	6a 01                	push   $0x1
+    1005:	e8 46 2d 00 00       	call   3d50 <printf>
+    100a:	83 c4 10             	add    $0x10,%esp
+    100d:	e9 31 ff ff ff       	jmp    f43 <preempt+0x83>
+    1012:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001020 <exitwait>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	56                   	push   %esi
+    1024:	be 64 00 00 00       	mov    $0x64,%esi
+    1029:	53                   	push   %ebx
+    102a:	eb 14                	jmp    1040 <exitwait+0x20>
+    102c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1030:	74 68                	je     109a <exitwait+0x7a>
+      if(wait() != pid){
+    1032:	e8 84 2b 00 00       	call   3bbb <wait>
+    1037:	39 d8                	cmp    %ebx,%eax
+    1039:	75 2d                	jne    1068 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    103b:	83 ee 01             	sub    $0x1,%esi
+    103e:	74 41                	je     1081 <exitwait+0x61>
+    pid = fork();
+    1040:	e8 66 2b 00 00       	call   3bab <fork>
+    1045:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1047:	85 c0                	test   %eax,%eax
+    1049:	79 e5                	jns    1030 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    104b:	83 ec 08             	sub    $0x8,%esp
+    104e:	68 a6 50 00 00       	push   $0x50a6
+    1053:	6a 01                	push   $0x1
+    1055:	e8 f6 2c 00 00       	call   3d50 <printf>
+      return;
+    105a:	83 c4 10             	add    $0x10,%esp
+}
+    105d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1060:	5b                   	pop    %ebx
+    1061:	5e                   	pop    %esi
+    1062:	5d                   	pop    %ebp
+    1063:	c3                   	ret
+    1064:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1068:	83 ec 08             	sub    $0x8,%esp
+    106b:	68 48 45 00 00       	push   $0x4548
+    1070:	6a 01                	push   $0x1
+    1072:	e8 d9 2c 00 00       	call   3d50 <printf>
+        return;
+    1077:	83 c4 10             	add    $0x10,%esp
+}
+    107a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    107d:	5b                   	pop    %ebx
+    107e:	5e                   	pop    %esi
+    107f:	5d                   	pop    %ebp
+    1080:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1081:	83 ec 08             	sub    $0x8,%esp
+    1084:	68 58 45 00 00       	push   $0x4558
+    1089:	6a 01                	push   $0x1
+    108b:	e8 c0 2c 00 00       	call   3d50 <printf>
+    1090:	83 c4 10             	add    $0x10,%esp
+}
+    1093:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1096:	5b                   	pop    %ebx
+    1097:	5e                   	pop    %esi
+    1098:	5d                   	pop    %ebp
+    1099:	c3                   	ret
+      exit();
+    109a:	e8 14 2b 00 00       	call   3bb3 <exit>
+    109f:	90                   	nop
+
+000010a0 <mem>:
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	56                   	push   %esi
+    10a4:	31 f6                	xor    %esi,%esi
+    10a6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    10a7:	83 ec 08             	sub    $0x8,%esp
+    10aa:	68 65 45 00 00       	push   $0x4565
+    10af:	6a 01                	push   $0x1
+    10b1:	e8 9a 2c 00 00       	call   3d50 <printf>
+  ppid = getpid();
+    10b6:	e8 78 2b 00 00       	call   3c33 <getpid>
+    10bb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    10bd:	e8 e9 2a 00 00       	call   3bab <fork>
+    10c2:	83 c4 10             	add    $0x10,%esp
+    10c5:	85 c0                	test   %eax,%eax
+    10c7:	74 0b                	je     10d4 <mem+0x34>
+    10c9:	e9 8a 00 00 00       	jmp    1158 <mem+0xb8>
+    10ce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    10d0:	89 30                	mov    %esi,(%eax)
+    10d2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    10d4:	83 ec 0c             	sub    $0xc,%esp
+    10d7:	68 11 27 00 00       	push   $0x2711
+    10dc:	e8 af 2e 00 00       	call   3f90 <malloc>
+    10e1:	83 c4 10             	add    $0x10,%esp
+    10e4:	85 c0                	test   %eax,%eax
+    10e6:	75 e8                	jne    10d0 <mem+0x30>
+    while(m1){
+    10e8:	85 f6                	test   %esi,%esi
+    10ea:	74 18                	je     1104 <mem+0x64>
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    10f0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    10f2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    10f5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    10f7:	50                   	push   %eax
+    10f8:	e8 03 2e 00 00       	call   3f00 <free>
+    while(m1){
+    10fd:	83 c4 10             	add    $0x10,%esp
+    1100:	85 f6                	test   %esi,%esi
+    1102:	75 ec                	jne    10f0 <mem+0x50>
+    m1 = malloc(1024*20);
+    1104:	83 ec 0c             	sub    $0xc,%esp
+    1107:	68 00 50 00 00       	push   $0x5000
+    110c:	e8 7f 2e 00 00       	call   3f90 <malloc>
+    if(m1 == 0){
+    1111:	83 c4 10             	add    $0x10,%esp
+    1114:	85 c0                	test   %eax,%eax
+    1116:	74 20                	je     1138 <mem+0x98>
+    free(m1);
+    1118:	83 ec 0c             	sub    $0xc,%esp
+    111b:	50                   	push   %eax
+    111c:	e8 df 2d 00 00       	call   3f00 <free>
+    printf(1, "mem ok\n");
+    1121:	58                   	pop    %eax
+    1122:	5a                   	pop    %edx
+    1123:	68 89 45 00 00       	push   $0x4589
+    1128:	6a 01                	push   $0x1
+    112a:	e8 21 2c 00 00       	call   3d50 <printf>
+    exit();
+    112f:	e8 7f 2a 00 00       	call   3bb3 <exit>
+    1134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1138:	83 ec 08             	sub    $0x8,%esp
+    113b:	68 6f 45 00 00       	push   $0x456f
+    1140:	6a 01                	push   $0x1
+    1142:	e8 09 2c 00 00       	call   3d50 <printf>
+      kill(ppid);
+    1147:	89 1c 24             	mov    %ebx,(%esp)
+    114a:	e8 94 2a 00 00       	call   3be3 <kill>
+      exit();
+    114f:	e8 5f 2a 00 00       	call   3bb3 <exit>
+    1154:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1158:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    115b:	5b                   	pop    %ebx
+    115c:	5e                   	pop    %esi
+    115d:	5d                   	pop    %ebp
+    wait();
+    115e:	e9 58 2a 00 00       	jmp    3bbb <wait>
+    1163:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001170 <sharedfd>:
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	56                   	push   %esi
+    1175:	53                   	push   %ebx
+    1176:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1179:	68 91 45 00 00       	push   $0x4591
+    117e:	6a 01                	push   $0x1
+    1180:	e8 cb 2b 00 00       	call   3d50 <printf>
+  unlink("sharedfd");
+    1185:	c7 04 24 a0 45 00 00 	movl   $0x45a0,(%esp)
+    118c:	e8 72 2a 00 00       	call   3c03 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1191:	5b                   	pop    %ebx
+    1192:	5e                   	pop    %esi
+    1193:	68 02 02 00 00       	push   $0x202
+    1198:	68 a0 45 00 00       	push   $0x45a0
+    119d:	e8 51 2a 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    11a2:	83 c4 10             	add    $0x10,%esp
+    11a5:	85 c0                	test   %eax,%eax
+    11a7:	0f 88 2a 01 00 00    	js     12d7 <sharedfd+0x167>
+    11ad:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    11af:	8d 75 de             	lea    -0x22(%ebp),%esi
+    11b2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    11b7:	e8 ef 29 00 00       	call   3bab <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    11bc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    11bf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    11c2:	19 c0                	sbb    %eax,%eax
+    11c4:	83 ec 04             	sub    $0x4,%esp
+    11c7:	83 e0 f3             	and    $0xfffffff3,%eax
+    11ca:	6a 0a                	push   $0xa
+    11cc:	83 c0 70             	add    $0x70,%eax
+    11cf:	50                   	push   %eax
+    11d0:	56                   	push   %esi
+    11d1:	e8 5a 28 00 00       	call   3a30 <memset>
+    11d6:	83 c4 10             	add    $0x10,%esp
+    11d9:	eb 0a                	jmp    11e5 <sharedfd+0x75>
+    11db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    11e0:	83 eb 01             	sub    $0x1,%ebx
+    11e3:	74 26                	je     120b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    11e5:	83 ec 04             	sub    $0x4,%esp
+    11e8:	6a 0a                	push   $0xa
+    11ea:	56                   	push   %esi
+    11eb:	57                   	push   %edi
+    11ec:	e8 e2 29 00 00       	call   3bd3 <write>
+    11f1:	83 c4 10             	add    $0x10,%esp
+    11f4:	83 f8 0a             	cmp    $0xa,%eax
+    11f7:	74 e7                	je     11e0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    11f9:	83 ec 08             	sub    $0x8,%esp
+    11fc:	68 90 52 00 00       	push   $0x5290
+    1201:	6a 01                	push   $0x1
+    1203:	e8 48 2b 00 00       	call   3d50 <printf>
+      break;
+    1208:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    120b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    120e:	85 c9                	test   %ecx,%ecx
+    1210:	0f 84 f5 00 00 00    	je     130b <sharedfd+0x19b>
+    wait();
+    1216:	e8 a0 29 00 00       	call   3bbb <wait>
+  close(fd);
+    121b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    121e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1220:	57                   	push   %edi
+    1221:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1224:	e8 b2 29 00 00       	call   3bdb <close>
+  fd = open("sharedfd", 0);
+    1229:	58                   	pop    %eax
+    122a:	5a                   	pop    %edx
+    122b:	6a 00                	push   $0x0
+    122d:	68 a0 45 00 00       	push   $0x45a0
+    1232:	e8 bc 29 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    1237:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    123a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    123c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    123f:	85 c0                	test   %eax,%eax
+    1241:	0f 88 aa 00 00 00    	js     12f1 <sharedfd+0x181>
+    1247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1250:	83 ec 04             	sub    $0x4,%esp
+    1253:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1256:	6a 0a                	push   $0xa
+    1258:	56                   	push   %esi
+    1259:	ff 75 d0             	push   -0x30(%ebp)
+    125c:	e8 6a 29 00 00       	call   3bcb <read>
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	85 c0                	test   %eax,%eax
+    1266:	7e 28                	jle    1290 <sharedfd+0x120>
+    1268:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    126b:	89 f0                	mov    %esi,%eax
+    126d:	eb 13                	jmp    1282 <sharedfd+0x112>
+    126f:	90                   	nop
+        np++;
+    1270:	80 f9 70             	cmp    $0x70,%cl
+    1273:	0f 94 c1             	sete   %cl
+    1276:	0f b6 c9             	movzbl %cl,%ecx
+    1279:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    127b:	83 c0 01             	add    $0x1,%eax
+    127e:	39 f8                	cmp    %edi,%eax
+    1280:	74 ce                	je     1250 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1282:	0f b6 08             	movzbl (%eax),%ecx
+    1285:	80 f9 63             	cmp    $0x63,%cl
+    1288:	75 e6                	jne    1270 <sharedfd+0x100>
+        nc++;
+    128a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    128d:	eb ec                	jmp    127b <sharedfd+0x10b>
+    128f:	90                   	nop
+  close(fd);
+    1290:	83 ec 0c             	sub    $0xc,%esp
+    1293:	ff 75 d0             	push   -0x30(%ebp)
+    1296:	e8 40 29 00 00       	call   3bdb <close>
+  unlink("sharedfd");
+    129b:	c7 04 24 a0 45 00 00 	movl   $0x45a0,(%esp)
+    12a2:	e8 5c 29 00 00       	call   3c03 <unlink>
+  if(nc == 10000 && np == 10000){
+    12a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    12aa:	83 c4 10             	add    $0x10,%esp
+    12ad:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    12b3:	75 5b                	jne    1310 <sharedfd+0x1a0>
+    12b5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    12bb:	75 53                	jne    1310 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    12bd:	83 ec 08             	sub    $0x8,%esp
+    12c0:	68 a9 45 00 00       	push   $0x45a9
+    12c5:	6a 01                	push   $0x1
+    12c7:	e8 84 2a 00 00       	call   3d50 <printf>
+    12cc:	83 c4 10             	add    $0x10,%esp
+}
+    12cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12d2:	5b                   	pop    %ebx
+    12d3:	5e                   	pop    %esi
+    12d4:	5f                   	pop    %edi
+    12d5:	5d                   	pop    %ebp
+    12d6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    12d7:	83 ec 08             	sub    $0x8,%esp
+    12da:	68 64 52 00 00       	push   $0x5264
+    12df:	6a 01                	push   $0x1
+    12e1:	e8 6a 2a 00 00       	call   3d50 <printf>
+    return;
+    12e6:	83 c4 10             	add    $0x10,%esp
+}
+    12e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ec:	5b                   	pop    %ebx
+    12ed:	5e                   	pop    %esi
+    12ee:	5f                   	pop    %edi
+    12ef:	5d                   	pop    %ebp
+    12f0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    12f1:	83 ec 08             	sub    $0x8,%esp
+    12f4:	68 b0 52 00 00       	push   $0x52b0
+    12f9:	6a 01                	push   $0x1
+    12fb:	e8 50 2a 00 00       	call   3d50 <printf>
+    return;
+    1300:	83 c4 10             	add    $0x10,%esp
+}
+    1303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1306:	5b                   	pop    %ebx
+    1307:	5e                   	pop    %esi
+    1308:	5f                   	pop    %edi
+    1309:	5d                   	pop    %ebp
+    130a:	c3                   	ret
+    exit();
+    130b:	e8 a3 28 00 00       	call   3bb3 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1310:	53                   	push   %ebx
+    1311:	52                   	push   %edx
+    1312:	68 b6 45 00 00       	push   $0x45b6
+    1317:	6a 01                	push   $0x1
+    1319:	e8 32 2a 00 00       	call   3d50 <printf>
+    exit();
+    131e:	e8 90 28 00 00       	call   3bb3 <exit>
+    1323:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001330 <fourfiles>:
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	56                   	push   %esi
+    1335:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1336:	31 db                	xor    %ebx,%ebx
+{
+    1338:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    133b:	c7 45 d8 cb 45 00 00 	movl   $0x45cb,-0x28(%ebp)
+    1342:	c7 45 dc 14 47 00 00 	movl   $0x4714,-0x24(%ebp)
+    1349:	c7 45 e0 18 47 00 00 	movl   $0x4718,-0x20(%ebp)
+    1350:	c7 45 e4 ce 45 00 00 	movl   $0x45ce,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1357:	68 d1 45 00 00       	push   $0x45d1
+    135c:	6a 01                	push   $0x1
+    135e:	e8 ed 29 00 00       	call   3d50 <printf>
+    1363:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1366:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    136a:	83 ec 0c             	sub    $0xc,%esp
+    136d:	56                   	push   %esi
+    136e:	e8 90 28 00 00       	call   3c03 <unlink>
+    pid = fork();
+    1373:	e8 33 28 00 00       	call   3bab <fork>
+    if(pid < 0){
+    1378:	83 c4 10             	add    $0x10,%esp
+    137b:	85 c0                	test   %eax,%eax
+    137d:	0f 88 65 01 00 00    	js     14e8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1383:	0f 84 eb 00 00 00    	je     1474 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1389:	83 c3 01             	add    $0x1,%ebx
+    138c:	83 fb 04             	cmp    $0x4,%ebx
+    138f:	75 d5                	jne    1366 <fourfiles+0x36>
+    wait();
+    1391:	e8 25 28 00 00       	call   3bbb <wait>
+  for(i = 0; i < 2; i++){
+    1396:	31 f6                	xor    %esi,%esi
+    wait();
+    1398:	e8 1e 28 00 00       	call   3bbb <wait>
+    139d:	e8 19 28 00 00       	call   3bbb <wait>
+    13a2:	e8 14 28 00 00       	call   3bbb <wait>
+    fname = names[i];
+    13a7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    13ab:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    13ae:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    13b0:	6a 00                	push   $0x0
+    13b2:	53                   	push   %ebx
+    13b3:	e8 3b 28 00 00       	call   3bf3 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    13b8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    13bb:	83 c4 10             	add    $0x10,%esp
+    13be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    13c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13c8:	83 ec 04             	sub    $0x4,%esp
+    13cb:	68 00 20 00 00       	push   $0x2000
+    13d0:	68 c0 89 00 00       	push   $0x89c0
+    13d5:	ff 75 d4             	push   -0x2c(%ebp)
+    13d8:	e8 ee 27 00 00       	call   3bcb <read>
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	89 c3                	mov    %eax,%ebx
+    13e2:	85 c0                	test   %eax,%eax
+    13e4:	7e 28                	jle    140e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    13e6:	31 c0                	xor    %eax,%eax
+    13e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ef:	90                   	nop
+        if(buf[j] != '0'+i){
+    13f0:	83 fe 01             	cmp    $0x1,%esi
+    13f3:	0f be 88 c0 89 00 00 	movsbl 0x89c0(%eax),%ecx
+    13fa:	19 d2                	sbb    %edx,%edx
+    13fc:	83 c2 31             	add    $0x31,%edx
+    13ff:	39 d1                	cmp    %edx,%ecx
+    1401:	75 5d                	jne    1460 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1403:	83 c0 01             	add    $0x1,%eax
+    1406:	39 c3                	cmp    %eax,%ebx
+    1408:	75 e6                	jne    13f0 <fourfiles+0xc0>
+      total += n;
+    140a:	01 df                	add    %ebx,%edi
+    140c:	eb ba                	jmp    13c8 <fourfiles+0x98>
+    close(fd);
+    140e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1411:	83 ec 0c             	sub    $0xc,%esp
+    1414:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1417:	51                   	push   %ecx
+    1418:	e8 be 27 00 00       	call   3bdb <close>
+    if(total != 12*500){
+    141d:	83 c4 10             	add    $0x10,%esp
+    1420:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1426:	0f 85 d0 00 00 00    	jne    14fc <fourfiles+0x1cc>
+    unlink(fname);
+    142c:	83 ec 0c             	sub    $0xc,%esp
+    142f:	53                   	push   %ebx
+    1430:	e8 ce 27 00 00       	call   3c03 <unlink>
+  for(i = 0; i < 2; i++){
+    1435:	83 c4 10             	add    $0x10,%esp
+    1438:	85 f6                	test   %esi,%esi
+    143a:	75 0a                	jne    1446 <fourfiles+0x116>
+    143c:	be 01 00 00 00       	mov    $0x1,%esi
+    1441:	e9 61 ff ff ff       	jmp    13a7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1446:	83 ec 08             	sub    $0x8,%esp
+    1449:	68 0f 46 00 00       	push   $0x460f
+    144e:	6a 01                	push   $0x1
+    1450:	e8 fb 28 00 00       	call   3d50 <printf>
+}
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    145b:	5b                   	pop    %ebx
+    145c:	5e                   	pop    %esi
+    145d:	5f                   	pop    %edi
+    145e:	5d                   	pop    %ebp
+    145f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1460:	83 ec 08             	sub    $0x8,%esp
+    1463:	68 f2 45 00 00       	push   $0x45f2
+    1468:	6a 01                	push   $0x1
+    146a:	e8 e1 28 00 00       	call   3d50 <printf>
+          exit();
+    146f:	e8 3f 27 00 00       	call   3bb3 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1474:	83 ec 08             	sub    $0x8,%esp
+    1477:	68 02 02 00 00       	push   $0x202
+    147c:	56                   	push   %esi
+    147d:	e8 71 27 00 00       	call   3bf3 <open>
+      if(fd < 0){
+    1482:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1485:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1487:	85 c0                	test   %eax,%eax
+    1489:	78 45                	js     14d0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    148b:	83 ec 04             	sub    $0x4,%esp
+    148e:	83 c3 30             	add    $0x30,%ebx
+    1491:	68 00 02 00 00       	push   $0x200
+    1496:	53                   	push   %ebx
+    1497:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    149c:	68 c0 89 00 00       	push   $0x89c0
+    14a1:	e8 8a 25 00 00       	call   3a30 <memset>
+    14a6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    14a9:	83 ec 04             	sub    $0x4,%esp
+    14ac:	68 f4 01 00 00       	push   $0x1f4
+    14b1:	68 c0 89 00 00       	push   $0x89c0
+    14b6:	56                   	push   %esi
+    14b7:	e8 17 27 00 00       	call   3bd3 <write>
+    14bc:	83 c4 10             	add    $0x10,%esp
+    14bf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    14c4:	75 49                	jne    150f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    14c6:	83 eb 01             	sub    $0x1,%ebx
+    14c9:	75 de                	jne    14a9 <fourfiles+0x179>
+      exit();
+    14cb:	e8 e3 26 00 00       	call   3bb3 <exit>
+        printf(1, "create failed\n");
+    14d0:	51                   	push   %ecx
+    14d1:	51                   	push   %ecx
+    14d2:	68 6c 48 00 00       	push   $0x486c
+    14d7:	6a 01                	push   $0x1
+    14d9:	e8 72 28 00 00       	call   3d50 <printf>
+        exit();
+    14de:	e8 d0 26 00 00       	call   3bb3 <exit>
+    14e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14e7:	90                   	nop
+      printf(1, "fork failed\n");
+    14e8:	83 ec 08             	sub    $0x8,%esp
+    14eb:	68 a6 50 00 00       	push   $0x50a6
+    14f0:	6a 01                	push   $0x1
+    14f2:	e8 59 28 00 00       	call   3d50 <printf>
+      exit();
+    14f7:	e8 b7 26 00 00       	call   3bb3 <exit>
+      printf(1, "wrong length %d\n", total);
+    14fc:	50                   	push   %eax
+    14fd:	57                   	push   %edi
+    14fe:	68 fe 45 00 00       	push   $0x45fe
+    1503:	6a 01                	push   $0x1
+    1505:	e8 46 28 00 00       	call   3d50 <printf>
+      exit();
+    150a:	e8 a4 26 00 00       	call   3bb3 <exit>
+          printf(1, "write failed %d\n", n);
+    150f:	52                   	push   %edx
+    1510:	50                   	push   %eax
+    1511:	68 e1 45 00 00       	push   $0x45e1
+    1516:	6a 01                	push   $0x1
+    1518:	e8 33 28 00 00       	call   3d50 <printf>
+          exit();
+    151d:	e8 91 26 00 00       	call   3bb3 <exit>
+    1522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001530 <createdelete>:
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1535:	31 f6                	xor    %esi,%esi
+{
+    1537:	53                   	push   %ebx
+    1538:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    153b:	68 1d 46 00 00       	push   $0x461d
+    1540:	6a 01                	push   $0x1
+    1542:	e8 09 28 00 00       	call   3d50 <printf>
+    1547:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    154a:	e8 5c 26 00 00       	call   3bab <fork>
+    154f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1551:	85 c0                	test   %eax,%eax
+    1553:	0f 88 ac 01 00 00    	js     1705 <createdelete+0x1d5>
+    if(pid == 0){
+    1559:	0f 84 01 01 00 00    	je     1660 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    155f:	83 c6 01             	add    $0x1,%esi
+    1562:	83 fe 04             	cmp    $0x4,%esi
+    1565:	75 e3                	jne    154a <createdelete+0x1a>
+    wait();
+    1567:	e8 4f 26 00 00       	call   3bbb <wait>
+  for(i = 0; i < N; i++){
+    156c:	31 ff                	xor    %edi,%edi
+    156e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1571:	e8 45 26 00 00       	call   3bbb <wait>
+    1576:	e8 40 26 00 00       	call   3bbb <wait>
+    157b:	e8 3b 26 00 00       	call   3bbb <wait>
+  name[0] = name[1] = name[2] = 0;
+    1580:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1588:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    158a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    158d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1592:	0f 94 c2             	sete   %dl
+    1595:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1598:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    159b:	0f 9f c0             	setg   %al
+    159e:	09 c2                	or     %eax,%edx
+    15a0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    15a3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    15a7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    15aa:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    15ad:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    15b0:	6a 00                	push   $0x0
+    15b2:	56                   	push   %esi
+    15b3:	e8 3b 26 00 00       	call   3bf3 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    15b8:	83 c4 10             	add    $0x10,%esp
+    15bb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    15bf:	74 7f                	je     1640 <createdelete+0x110>
+    15c1:	85 c0                	test   %eax,%eax
+    15c3:	0f 88 27 01 00 00    	js     16f0 <createdelete+0x1c0>
+        close(fd);
+    15c9:	83 ec 0c             	sub    $0xc,%esp
+    15cc:	50                   	push   %eax
+    15cd:	e8 09 26 00 00       	call   3bdb <close>
+    15d2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    15d5:	83 c3 01             	add    $0x1,%ebx
+    15d8:	80 fb 74             	cmp    $0x74,%bl
+    15db:	75 c6                	jne    15a3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    15dd:	83 c7 01             	add    $0x1,%edi
+    15e0:	83 ff 14             	cmp    $0x14,%edi
+    15e3:	75 a3                	jne    1588 <createdelete+0x58>
+    15e5:	bf 70 00 00 00       	mov    $0x70,%edi
+    15ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    15f0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    15f3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    15f8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    15fb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    15fd:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1600:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1603:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1607:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    160a:	56                   	push   %esi
+    160b:	e8 f3 25 00 00       	call   3c03 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1610:	83 c4 10             	add    $0x10,%esp
+    1613:	83 eb 01             	sub    $0x1,%ebx
+    1616:	75 e3                	jne    15fb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1618:	83 c7 01             	add    $0x1,%edi
+    161b:	89 f8                	mov    %edi,%eax
+    161d:	3c 84                	cmp    $0x84,%al
+    161f:	75 cf                	jne    15f0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1621:	83 ec 08             	sub    $0x8,%esp
+    1624:	68 30 46 00 00       	push   $0x4630
+    1629:	6a 01                	push   $0x1
+    162b:	e8 20 27 00 00       	call   3d50 <printf>
+}
+    1630:	83 c4 10             	add    $0x10,%esp
+    1633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1636:	5b                   	pop    %ebx
+    1637:	5e                   	pop    %esi
+    1638:	5f                   	pop    %edi
+    1639:	5d                   	pop    %ebp
+    163a:	c3                   	ret
+    163b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1640:	85 c0                	test   %eax,%eax
+    1642:	78 91                	js     15d5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1644:	50                   	push   %eax
+    1645:	56                   	push   %esi
+    1646:	68 00 53 00 00       	push   $0x5300
+    164b:	6a 01                	push   $0x1
+    164d:	e8 fe 26 00 00       	call   3d50 <printf>
+        exit();
+    1652:	e8 5c 25 00 00       	call   3bb3 <exit>
+    1657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1660:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1663:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1667:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    166a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1670:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1673:	8d 43 30             	lea    0x30(%ebx),%eax
+    1676:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1679:	68 02 02 00 00       	push   $0x202
+    167e:	56                   	push   %esi
+    167f:	e8 6f 25 00 00       	call   3bf3 <open>
+        if(fd < 0){
+    1684:	83 c4 10             	add    $0x10,%esp
+    1687:	85 c0                	test   %eax,%eax
+    1689:	0f 88 8a 00 00 00    	js     1719 <createdelete+0x1e9>
+        close(fd);
+    168f:	83 ec 0c             	sub    $0xc,%esp
+    1692:	50                   	push   %eax
+    1693:	e8 43 25 00 00       	call   3bdb <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1698:	83 c4 10             	add    $0x10,%esp
+    169b:	85 db                	test   %ebx,%ebx
+    169d:	74 19                	je     16b8 <createdelete+0x188>
+    169f:	f6 c3 01             	test   $0x1,%bl
+    16a2:	74 1b                	je     16bf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    16a4:	83 c3 01             	add    $0x1,%ebx
+    16a7:	83 fb 14             	cmp    $0x14,%ebx
+    16aa:	75 c4                	jne    1670 <createdelete+0x140>
+      exit();
+    16ac:	e8 02 25 00 00       	call   3bb3 <exit>
+    16b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    16b8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    16bd:	eb b1                	jmp    1670 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    16bf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    16c1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    16c4:	d1 f8                	sar    %eax
+    16c6:	83 c0 30             	add    $0x30,%eax
+    16c9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    16cc:	56                   	push   %esi
+    16cd:	e8 31 25 00 00       	call   3c03 <unlink>
+    16d2:	83 c4 10             	add    $0x10,%esp
+    16d5:	85 c0                	test   %eax,%eax
+    16d7:	79 cb                	jns    16a4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    16d9:	52                   	push   %edx
+    16da:	52                   	push   %edx
+    16db:	68 31 41 00 00       	push   $0x4131
+    16e0:	6a 01                	push   $0x1
+    16e2:	e8 69 26 00 00       	call   3d50 <printf>
+            exit();
+    16e7:	e8 c7 24 00 00       	call   3bb3 <exit>
+    16ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    16f0:	83 ec 04             	sub    $0x4,%esp
+    16f3:	56                   	push   %esi
+    16f4:	68 dc 52 00 00       	push   $0x52dc
+    16f9:	6a 01                	push   $0x1
+    16fb:	e8 50 26 00 00       	call   3d50 <printf>
+        exit();
+    1700:	e8 ae 24 00 00       	call   3bb3 <exit>
+      printf(1, "fork failed\n");
+    1705:	83 ec 08             	sub    $0x8,%esp
+    1708:	68 a6 50 00 00       	push   $0x50a6
+    170d:	6a 01                	push   $0x1
+    170f:	e8 3c 26 00 00       	call   3d50 <printf>
+      exit();
+    1714:	e8 9a 24 00 00       	call   3bb3 <exit>
+          printf(1, "create failed\n");
+    1719:	83 ec 08             	sub    $0x8,%esp
+    171c:	68 6c 48 00 00       	push   $0x486c
+    1721:	6a 01                	push   $0x1
+    1723:	e8 28 26 00 00       	call   3d50 <printf>
+          exit();
+    1728:	e8 86 24 00 00       	call   3bb3 <exit>
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001730 <unlinkread>:
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	56                   	push   %esi
+    1734:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1735:	83 ec 08             	sub    $0x8,%esp
+    1738:	68 41 46 00 00       	push   $0x4641
+    173d:	6a 01                	push   $0x1
+    173f:	e8 0c 26 00 00       	call   3d50 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1744:	5b                   	pop    %ebx
+    1745:	5e                   	pop    %esi
+    1746:	68 02 02 00 00       	push   $0x202
+    174b:	68 52 46 00 00       	push   $0x4652
+    1750:	e8 9e 24 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    1755:	83 c4 10             	add    $0x10,%esp
+    1758:	85 c0                	test   %eax,%eax
+    175a:	0f 88 e6 00 00 00    	js     1846 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1760:	83 ec 04             	sub    $0x4,%esp
+    1763:	89 c3                	mov    %eax,%ebx
+    1765:	6a 05                	push   $0x5
+    1767:	68 77 46 00 00       	push   $0x4677
+    176c:	50                   	push   %eax
+    176d:	e8 61 24 00 00       	call   3bd3 <write>
+  close(fd);
+    1772:	89 1c 24             	mov    %ebx,(%esp)
+    1775:	e8 61 24 00 00       	call   3bdb <close>
+  fd = open("unlinkread", O_RDWR);
+    177a:	58                   	pop    %eax
+    177b:	5a                   	pop    %edx
+    177c:	6a 02                	push   $0x2
+    177e:	68 52 46 00 00       	push   $0x4652
+    1783:	e8 6b 24 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    1788:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    178b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    178d:	85 c0                	test   %eax,%eax
+    178f:	0f 88 10 01 00 00    	js     18a5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1795:	83 ec 0c             	sub    $0xc,%esp
+    1798:	68 52 46 00 00       	push   $0x4652
+    179d:	e8 61 24 00 00       	call   3c03 <unlink>
+    17a2:	83 c4 10             	add    $0x10,%esp
+    17a5:	85 c0                	test   %eax,%eax
+    17a7:	0f 85 e5 00 00 00    	jne    1892 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    17ad:	83 ec 08             	sub    $0x8,%esp
+    17b0:	68 02 02 00 00       	push   $0x202
+    17b5:	68 52 46 00 00       	push   $0x4652
+    17ba:	e8 34 24 00 00       	call   3bf3 <open>
+  write(fd1, "yyy", 3);
+    17bf:	83 c4 0c             	add    $0xc,%esp
+    17c2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    17c4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    17c6:	68 af 46 00 00       	push   $0x46af
+    17cb:	50                   	push   %eax
+    17cc:	e8 02 24 00 00       	call   3bd3 <write>
+  close(fd1);
+    17d1:	89 34 24             	mov    %esi,(%esp)
+    17d4:	e8 02 24 00 00       	call   3bdb <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    17d9:	83 c4 0c             	add    $0xc,%esp
+    17dc:	68 00 20 00 00       	push   $0x2000
+    17e1:	68 c0 89 00 00       	push   $0x89c0
+    17e6:	53                   	push   %ebx
+    17e7:	e8 df 23 00 00       	call   3bcb <read>
+    17ec:	83 c4 10             	add    $0x10,%esp
+    17ef:	83 f8 05             	cmp    $0x5,%eax
+    17f2:	0f 85 87 00 00 00    	jne    187f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    17f8:	80 3d c0 89 00 00 68 	cmpb   $0x68,0x89c0
+    17ff:	75 6b                	jne    186c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1801:	83 ec 04             	sub    $0x4,%esp
+    1804:	6a 0a                	push   $0xa
+    1806:	68 c0 89 00 00       	push   $0x89c0
+    180b:	53                   	push   %ebx
+    180c:	e8 c2 23 00 00       	call   3bd3 <write>
+    1811:	83 c4 10             	add    $0x10,%esp
+    1814:	83 f8 0a             	cmp    $0xa,%eax
+    1817:	75 40                	jne    1859 <unlinkread+0x129>
+  close(fd);
+    1819:	83 ec 0c             	sub    $0xc,%esp
+    181c:	53                   	push   %ebx
+    181d:	e8 b9 23 00 00       	call   3bdb <close>
+  unlink("unlinkread");
+    1822:	c7 04 24 52 46 00 00 	movl   $0x4652,(%esp)
+    1829:	e8 d5 23 00 00       	call   3c03 <unlink>
+  printf(1, "unlinkread ok\n");
+    182e:	58                   	pop    %eax
+    182f:	5a                   	pop    %edx
+    1830:	68 fa 46 00 00       	push   $0x46fa
+    1835:	6a 01                	push   $0x1
+    1837:	e8 14 25 00 00       	call   3d50 <printf>
+}
+    183c:	83 c4 10             	add    $0x10,%esp
+    183f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1842:	5b                   	pop    %ebx
+    1843:	5e                   	pop    %esi
+    1844:	5d                   	pop    %ebp
+    1845:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1846:	51                   	push   %ecx
+    1847:	51                   	push   %ecx
+    1848:	68 5d 46 00 00       	push   $0x465d
+    184d:	6a 01                	push   $0x1
+    184f:	e8 fc 24 00 00       	call   3d50 <printf>
+    exit();
+    1854:	e8 5a 23 00 00       	call   3bb3 <exit>
+    printf(1, "unlinkread write failed\n");
+    1859:	51                   	push   %ecx
+    185a:	51                   	push   %ecx
+    185b:	68 e1 46 00 00       	push   $0x46e1
+    1860:	6a 01                	push   $0x1
+    1862:	e8 e9 24 00 00       	call   3d50 <printf>
+    exit();
+    1867:	e8 47 23 00 00       	call   3bb3 <exit>
+    printf(1, "unlinkread wrong data\n");
+    186c:	53                   	push   %ebx
+    186d:	53                   	push   %ebx
+    186e:	68 ca 46 00 00       	push   $0x46ca
+    1873:	6a 01                	push   $0x1
+    1875:	e8 d6 24 00 00       	call   3d50 <printf>
+    exit();
+    187a:	e8 34 23 00 00       	call   3bb3 <exit>
+    printf(1, "unlinkread read failed");
+    187f:	56                   	push   %esi
+    1880:	56                   	push   %esi
+    1881:	68 b3 46 00 00       	push   $0x46b3
+    1886:	6a 01                	push   $0x1
+    1888:	e8 c3 24 00 00       	call   3d50 <printf>
+    exit();
+    188d:	e8 21 23 00 00       	call   3bb3 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1892:	50                   	push   %eax
+    1893:	50                   	push   %eax
+    1894:	68 95 46 00 00       	push   $0x4695
+    1899:	6a 01                	push   $0x1
+    189b:	e8 b0 24 00 00       	call   3d50 <printf>
+    exit();
+    18a0:	e8 0e 23 00 00       	call   3bb3 <exit>
+    printf(1, "open unlinkread failed\n");
+    18a5:	50                   	push   %eax
+    18a6:	50                   	push   %eax
+    18a7:	68 7d 46 00 00       	push   $0x467d
+    18ac:	6a 01                	push   $0x1
+    18ae:	e8 9d 24 00 00       	call   3d50 <printf>
+    exit();
+    18b3:	e8 fb 22 00 00       	call   3bb3 <exit>
+    18b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bf:	90                   	nop
+
+000018c0 <linktest>:
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	53                   	push   %ebx
+    18c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    18c7:	68 09 47 00 00       	push   $0x4709
+    18cc:	6a 01                	push   $0x1
+    18ce:	e8 7d 24 00 00       	call   3d50 <printf>
+  unlink("lf1");
+    18d3:	c7 04 24 13 47 00 00 	movl   $0x4713,(%esp)
+    18da:	e8 24 23 00 00       	call   3c03 <unlink>
+  unlink("lf2");
+    18df:	c7 04 24 17 47 00 00 	movl   $0x4717,(%esp)
+    18e6:	e8 18 23 00 00       	call   3c03 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    18eb:	58                   	pop    %eax
+    18ec:	5a                   	pop    %edx
+    18ed:	68 02 02 00 00       	push   $0x202
+    18f2:	68 13 47 00 00       	push   $0x4713
+    18f7:	e8 f7 22 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    18fc:	83 c4 10             	add    $0x10,%esp
+    18ff:	85 c0                	test   %eax,%eax
+    1901:	0f 88 1e 01 00 00    	js     1a25 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1907:	83 ec 04             	sub    $0x4,%esp
+    190a:	89 c3                	mov    %eax,%ebx
+    190c:	6a 05                	push   $0x5
+    190e:	68 77 46 00 00       	push   $0x4677
+    1913:	50                   	push   %eax
+    1914:	e8 ba 22 00 00       	call   3bd3 <write>
+    1919:	83 c4 10             	add    $0x10,%esp
+    191c:	83 f8 05             	cmp    $0x5,%eax
+    191f:	0f 85 98 01 00 00    	jne    1abd <linktest+0x1fd>
+  close(fd);
+    1925:	83 ec 0c             	sub    $0xc,%esp
+    1928:	53                   	push   %ebx
+    1929:	e8 ad 22 00 00       	call   3bdb <close>
+  if(link("lf1", "lf2") < 0){
+    192e:	5b                   	pop    %ebx
+    192f:	58                   	pop    %eax
+    1930:	68 17 47 00 00       	push   $0x4717
+    1935:	68 13 47 00 00       	push   $0x4713
+    193a:	e8 d4 22 00 00       	call   3c13 <link>
+    193f:	83 c4 10             	add    $0x10,%esp
+    1942:	85 c0                	test   %eax,%eax
+    1944:	0f 88 60 01 00 00    	js     1aaa <linktest+0x1ea>
+  unlink("lf1");
+    194a:	83 ec 0c             	sub    $0xc,%esp
+    194d:	68 13 47 00 00       	push   $0x4713
+    1952:	e8 ac 22 00 00       	call   3c03 <unlink>
+  if(open("lf1", 0) >= 0){
+    1957:	58                   	pop    %eax
+    1958:	5a                   	pop    %edx
+    1959:	6a 00                	push   $0x0
+    195b:	68 13 47 00 00       	push   $0x4713
+    1960:	e8 8e 22 00 00       	call   3bf3 <open>
+    1965:	83 c4 10             	add    $0x10,%esp
+    1968:	85 c0                	test   %eax,%eax
+    196a:	0f 89 27 01 00 00    	jns    1a97 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1970:	83 ec 08             	sub    $0x8,%esp
+    1973:	6a 00                	push   $0x0
+    1975:	68 17 47 00 00       	push   $0x4717
+    197a:	e8 74 22 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    197f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1982:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1984:	85 c0                	test   %eax,%eax
+    1986:	0f 88 f8 00 00 00    	js     1a84 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    198c:	83 ec 04             	sub    $0x4,%esp
+    198f:	68 00 20 00 00       	push   $0x2000
+    1994:	68 c0 89 00 00       	push   $0x89c0
+    1999:	50                   	push   %eax
+    199a:	e8 2c 22 00 00       	call   3bcb <read>
+    199f:	83 c4 10             	add    $0x10,%esp
+    19a2:	83 f8 05             	cmp    $0x5,%eax
+    19a5:	0f 85 c6 00 00 00    	jne    1a71 <linktest+0x1b1>
+  close(fd);
+    19ab:	83 ec 0c             	sub    $0xc,%esp
+    19ae:	53                   	push   %ebx
+    19af:	e8 27 22 00 00       	call   3bdb <close>
+  if(link("lf2", "lf2") >= 0){
+    19b4:	58                   	pop    %eax
+    19b5:	5a                   	pop    %edx
+    19b6:	68 17 47 00 00       	push   $0x4717
+    19bb:	68 17 47 00 00       	push   $0x4717
+    19c0:	e8 4e 22 00 00       	call   3c13 <link>
+    19c5:	83 c4 10             	add    $0x10,%esp
+    19c8:	85 c0                	test   %eax,%eax
+    19ca:	0f 89 8e 00 00 00    	jns    1a5e <linktest+0x19e>
+  unlink("lf2");
+    19d0:	83 ec 0c             	sub    $0xc,%esp
+    19d3:	68 17 47 00 00       	push   $0x4717
+    19d8:	e8 26 22 00 00       	call   3c03 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    19dd:	59                   	pop    %ecx
+    19de:	5b                   	pop    %ebx
+    19df:	68 13 47 00 00       	push   $0x4713
+    19e4:	68 17 47 00 00       	push   $0x4717
+    19e9:	e8 25 22 00 00       	call   3c13 <link>
+    19ee:	83 c4 10             	add    $0x10,%esp
+    19f1:	85 c0                	test   %eax,%eax
+    19f3:	79 56                	jns    1a4b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    19f5:	83 ec 08             	sub    $0x8,%esp
+    19f8:	68 13 47 00 00       	push   $0x4713
+    19fd:	68 db 49 00 00       	push   $0x49db
+    1a02:	e8 0c 22 00 00       	call   3c13 <link>
+    1a07:	83 c4 10             	add    $0x10,%esp
+    1a0a:	85 c0                	test   %eax,%eax
+    1a0c:	79 2a                	jns    1a38 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    1a0e:	83 ec 08             	sub    $0x8,%esp
+    1a11:	68 b1 47 00 00       	push   $0x47b1
+    1a16:	6a 01                	push   $0x1
+    1a18:	e8 33 23 00 00       	call   3d50 <printf>
+}
+    1a1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a20:	83 c4 10             	add    $0x10,%esp
+    1a23:	c9                   	leave
+    1a24:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1a25:	50                   	push   %eax
+    1a26:	50                   	push   %eax
+    1a27:	68 1b 47 00 00       	push   $0x471b
+    1a2c:	6a 01                	push   $0x1
+    1a2e:	e8 1d 23 00 00       	call   3d50 <printf>
+    exit();
+    1a33:	e8 7b 21 00 00       	call   3bb3 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1a38:	50                   	push   %eax
+    1a39:	50                   	push   %eax
+    1a3a:	68 95 47 00 00       	push   $0x4795
+    1a3f:	6a 01                	push   $0x1
+    1a41:	e8 0a 23 00 00       	call   3d50 <printf>
+    exit();
+    1a46:	e8 68 21 00 00       	call   3bb3 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1a4b:	52                   	push   %edx
+    1a4c:	52                   	push   %edx
+    1a4d:	68 48 53 00 00       	push   $0x5348
+    1a52:	6a 01                	push   $0x1
+    1a54:	e8 f7 22 00 00       	call   3d50 <printf>
+    exit();
+    1a59:	e8 55 21 00 00       	call   3bb3 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1a5e:	50                   	push   %eax
+    1a5f:	50                   	push   %eax
+    1a60:	68 77 47 00 00       	push   $0x4777
+    1a65:	6a 01                	push   $0x1
+    1a67:	e8 e4 22 00 00       	call   3d50 <printf>
+    exit();
+    1a6c:	e8 42 21 00 00       	call   3bb3 <exit>
+    printf(1, "read lf2 failed\n");
+    1a71:	51                   	push   %ecx
+    1a72:	51                   	push   %ecx
+    1a73:	68 66 47 00 00       	push   $0x4766
+    1a78:	6a 01                	push   $0x1
+    1a7a:	e8 d1 22 00 00       	call   3d50 <printf>
+    exit();
+    1a7f:	e8 2f 21 00 00       	call   3bb3 <exit>
+    printf(1, "open lf2 failed\n");
+    1a84:	53                   	push   %ebx
+    1a85:	53                   	push   %ebx
+    1a86:	68 55 47 00 00       	push   $0x4755
+    1a8b:	6a 01                	push   $0x1
+    1a8d:	e8 be 22 00 00       	call   3d50 <printf>
+    exit();
+    1a92:	e8 1c 21 00 00       	call   3bb3 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1a97:	50                   	push   %eax
+    1a98:	50                   	push   %eax
+    1a99:	68 20 53 00 00       	push   $0x5320
+    1a9e:	6a 01                	push   $0x1
+    1aa0:	e8 ab 22 00 00       	call   3d50 <printf>
+    exit();
+    1aa5:	e8 09 21 00 00       	call   3bb3 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1aaa:	51                   	push   %ecx
+    1aab:	51                   	push   %ecx
+    1aac:	68 40 47 00 00       	push   $0x4740
+    1ab1:	6a 01                	push   $0x1
+    1ab3:	e8 98 22 00 00       	call   3d50 <printf>
+    exit();
+    1ab8:	e8 f6 20 00 00       	call   3bb3 <exit>
+    printf(1, "write lf1 failed\n");
+    1abd:	50                   	push   %eax
+    1abe:	50                   	push   %eax
+    1abf:	68 2e 47 00 00       	push   $0x472e
+    1ac4:	6a 01                	push   $0x1
+    1ac6:	e8 85 22 00 00       	call   3d50 <printf>
+    exit();
+    1acb:	e8 e3 20 00 00       	call   3bb3 <exit>
+
+00001ad0 <concreate>:
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	57                   	push   %edi
+    1ad4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1ad5:	31 f6                	xor    %esi,%esi
+{
+    1ad7:	53                   	push   %ebx
+    1ad8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1adb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1ade:	68 be 47 00 00       	push   $0x47be
+    1ae3:	6a 01                	push   $0x1
+    1ae5:	e8 66 22 00 00       	call   3d50 <printf>
+  file[0] = 'C';
+    1aea:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1aee:	83 c4 10             	add    $0x10,%esp
+    1af1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1af5:	eb 4c                	jmp    1b43 <concreate+0x73>
+    1af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afe:	66 90                	xchg   %ax,%ax
+    1b00:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1b06:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1b0b:	0f 83 8f 00 00 00    	jae    1ba0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1b11:	83 ec 08             	sub    $0x8,%esp
+    1b14:	68 02 02 00 00       	push   $0x202
+    1b19:	53                   	push   %ebx
+    1b1a:	e8 d4 20 00 00       	call   3bf3 <open>
+      if(fd < 0){
+    1b1f:	83 c4 10             	add    $0x10,%esp
+    1b22:	85 c0                	test   %eax,%eax
+    1b24:	78 63                	js     1b89 <concreate+0xb9>
+      close(fd);
+    1b26:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1b29:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1b2c:	50                   	push   %eax
+    1b2d:	e8 a9 20 00 00       	call   3bdb <close>
+    1b32:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1b35:	e8 81 20 00 00       	call   3bbb <wait>
+  for(i = 0; i < 40; i++){
+    1b3a:	83 fe 28             	cmp    $0x28,%esi
+    1b3d:	0f 84 7f 00 00 00    	je     1bc2 <concreate+0xf2>
+    unlink(file);
+    1b43:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1b46:	8d 46 30             	lea    0x30(%esi),%eax
+    1b49:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1b4c:	53                   	push   %ebx
+    1b4d:	e8 b1 20 00 00       	call   3c03 <unlink>
+    pid = fork();
+    1b52:	e8 54 20 00 00       	call   3bab <fork>
+    if(pid && (i % 3) == 1){
+    1b57:	83 c4 10             	add    $0x10,%esp
+    1b5a:	85 c0                	test   %eax,%eax
+    1b5c:	75 a2                	jne    1b00 <concreate+0x30>
+      link("C0", file);
+    1b5e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1b64:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1b6a:	0f 83 d0 00 00 00    	jae    1c40 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1b70:	83 ec 08             	sub    $0x8,%esp
+    1b73:	68 02 02 00 00       	push   $0x202
+    1b78:	53                   	push   %ebx
+    1b79:	e8 75 20 00 00       	call   3bf3 <open>
+      if(fd < 0){
+    1b7e:	83 c4 10             	add    $0x10,%esp
+    1b81:	85 c0                	test   %eax,%eax
+    1b83:	0f 89 ea 01 00 00    	jns    1d73 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1b89:	83 ec 04             	sub    $0x4,%esp
+    1b8c:	53                   	push   %ebx
+    1b8d:	68 d1 47 00 00       	push   $0x47d1
+    1b92:	6a 01                	push   $0x1
+    1b94:	e8 b7 21 00 00       	call   3d50 <printf>
+        exit();
+    1b99:	e8 15 20 00 00       	call   3bb3 <exit>
+    1b9e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1ba0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1ba3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1ba6:	53                   	push   %ebx
+    1ba7:	68 ce 47 00 00       	push   $0x47ce
+    1bac:	e8 62 20 00 00       	call   3c13 <link>
+    1bb1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1bb4:	e8 02 20 00 00       	call   3bbb <wait>
+  for(i = 0; i < 40; i++){
+    1bb9:	83 fe 28             	cmp    $0x28,%esi
+    1bbc:	0f 85 81 ff ff ff    	jne    1b43 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1bc2:	83 ec 04             	sub    $0x4,%esp
+    1bc5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1bc8:	6a 28                	push   $0x28
+    1bca:	6a 00                	push   $0x0
+    1bcc:	50                   	push   %eax
+    1bcd:	e8 5e 1e 00 00       	call   3a30 <memset>
+  fd = open(".", 0);
+    1bd2:	5e                   	pop    %esi
+    1bd3:	5f                   	pop    %edi
+    1bd4:	6a 00                	push   $0x0
+    1bd6:	68 db 49 00 00       	push   $0x49db
+    1bdb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1bde:	e8 10 20 00 00       	call   3bf3 <open>
+  n = 0;
+    1be3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1bea:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1bed:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1bef:	90                   	nop
+    1bf0:	83 ec 04             	sub    $0x4,%esp
+    1bf3:	6a 10                	push   $0x10
+    1bf5:	57                   	push   %edi
+    1bf6:	56                   	push   %esi
+    1bf7:	e8 cf 1f 00 00       	call   3bcb <read>
+    1bfc:	83 c4 10             	add    $0x10,%esp
+    1bff:	85 c0                	test   %eax,%eax
+    1c01:	7e 5d                	jle    1c60 <concreate+0x190>
+    if(de.inum == 0)
+    1c03:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1c08:	74 e6                	je     1bf0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1c0a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1c0e:	75 e0                	jne    1bf0 <concreate+0x120>
+    1c10:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1c14:	75 da                	jne    1bf0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1c16:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1c1a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1c1d:	83 f8 27             	cmp    $0x27,%eax
+    1c20:	0f 87 5e 01 00 00    	ja     1d84 <concreate+0x2b4>
+      if(fa[i]){
+    1c26:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1c2b:	0f 85 7e 01 00 00    	jne    1daf <concreate+0x2df>
+      n++;
+    1c31:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1c35:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1c3a:	eb b4                	jmp    1bf0 <concreate+0x120>
+    1c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1c40:	83 ec 08             	sub    $0x8,%esp
+    1c43:	53                   	push   %ebx
+    1c44:	68 ce 47 00 00       	push   $0x47ce
+    1c49:	e8 c5 1f 00 00       	call   3c13 <link>
+    1c4e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c51:	e8 5d 1f 00 00       	call   3bb3 <exit>
+    1c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c5d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1c60:	83 ec 0c             	sub    $0xc,%esp
+    1c63:	56                   	push   %esi
+    1c64:	e8 72 1f 00 00       	call   3bdb <close>
+  if(n != 40){
+    1c69:	83 c4 10             	add    $0x10,%esp
+    1c6c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1c70:	0f 85 26 01 00 00    	jne    1d9c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1c76:	31 f6                	xor    %esi,%esi
+    1c78:	eb 48                	jmp    1cc2 <concreate+0x1f2>
+    1c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1c80:	85 ff                	test   %edi,%edi
+    1c82:	74 05                	je     1c89 <concreate+0x1b9>
+    1c84:	83 f8 01             	cmp    $0x1,%eax
+    1c87:	74 68                	je     1cf1 <concreate+0x221>
+      unlink(file);
+    1c89:	83 ec 0c             	sub    $0xc,%esp
+    1c8c:	53                   	push   %ebx
+    1c8d:	e8 71 1f 00 00       	call   3c03 <unlink>
+      unlink(file);
+    1c92:	89 1c 24             	mov    %ebx,(%esp)
+    1c95:	e8 69 1f 00 00       	call   3c03 <unlink>
+      unlink(file);
+    1c9a:	89 1c 24             	mov    %ebx,(%esp)
+    1c9d:	e8 61 1f 00 00       	call   3c03 <unlink>
+      unlink(file);
+    1ca2:	89 1c 24             	mov    %ebx,(%esp)
+    1ca5:	e8 59 1f 00 00       	call   3c03 <unlink>
+    1caa:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1cad:	85 ff                	test   %edi,%edi
+    1caf:	74 a0                	je     1c51 <concreate+0x181>
+      wait();
+    1cb1:	e8 05 1f 00 00       	call   3bbb <wait>
+  for(i = 0; i < 40; i++){
+    1cb6:	83 c6 01             	add    $0x1,%esi
+    1cb9:	83 fe 28             	cmp    $0x28,%esi
+    1cbc:	0f 84 86 00 00 00    	je     1d48 <concreate+0x278>
+    file[1] = '0' + i;
+    1cc2:	8d 46 30             	lea    0x30(%esi),%eax
+    1cc5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1cc8:	e8 de 1e 00 00       	call   3bab <fork>
+    1ccd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1ccf:	85 c0                	test   %eax,%eax
+    1cd1:	0f 88 88 00 00 00    	js     1d5f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1cd7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1cdc:	f7 e6                	mul    %esi
+    1cde:	89 d0                	mov    %edx,%eax
+    1ce0:	83 e2 fe             	and    $0xfffffffe,%edx
+    1ce3:	d1 e8                	shr    %eax
+    1ce5:	01 c2                	add    %eax,%edx
+    1ce7:	89 f0                	mov    %esi,%eax
+    1ce9:	29 d0                	sub    %edx,%eax
+    1ceb:	89 c1                	mov    %eax,%ecx
+    1ced:	09 f9                	or     %edi,%ecx
+    1cef:	75 8f                	jne    1c80 <concreate+0x1b0>
+      close(open(file, 0));
+    1cf1:	83 ec 08             	sub    $0x8,%esp
+    1cf4:	6a 00                	push   $0x0
+    1cf6:	53                   	push   %ebx
+    1cf7:	e8 f7 1e 00 00       	call   3bf3 <open>
+    1cfc:	89 04 24             	mov    %eax,(%esp)
+    1cff:	e8 d7 1e 00 00       	call   3bdb <close>
+      close(open(file, 0));
+    1d04:	58                   	pop    %eax
+    1d05:	5a                   	pop    %edx
+    1d06:	6a 00                	push   $0x0
+    1d08:	53                   	push   %ebx
+    1d09:	e8 e5 1e 00 00       	call   3bf3 <open>
+    1d0e:	89 04 24             	mov    %eax,(%esp)
+    1d11:	e8 c5 1e 00 00       	call   3bdb <close>
+      close(open(file, 0));
+    1d16:	59                   	pop    %ecx
+    1d17:	58                   	pop    %eax
+    1d18:	6a 00                	push   $0x0
+    1d1a:	53                   	push   %ebx
+    1d1b:	e8 d3 1e 00 00       	call   3bf3 <open>
+    1d20:	89 04 24             	mov    %eax,(%esp)
+    1d23:	e8 b3 1e 00 00       	call   3bdb <close>
+      close(open(file, 0));
+    1d28:	58                   	pop    %eax
+    1d29:	5a                   	pop    %edx
+    1d2a:	6a 00                	push   $0x0
+    1d2c:	53                   	push   %ebx
+    1d2d:	e8 c1 1e 00 00       	call   3bf3 <open>
+    1d32:	89 04 24             	mov    %eax,(%esp)
+    1d35:	e8 a1 1e 00 00       	call   3bdb <close>
+    1d3a:	83 c4 10             	add    $0x10,%esp
+    1d3d:	e9 6b ff ff ff       	jmp    1cad <concreate+0x1dd>
+    1d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1d48:	83 ec 08             	sub    $0x8,%esp
+    1d4b:	68 23 48 00 00       	push   $0x4823
+    1d50:	6a 01                	push   $0x1
+    1d52:	e8 f9 1f 00 00       	call   3d50 <printf>
+}
+    1d57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d5a:	5b                   	pop    %ebx
+    1d5b:	5e                   	pop    %esi
+    1d5c:	5f                   	pop    %edi
+    1d5d:	5d                   	pop    %ebp
+    1d5e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1d5f:	83 ec 08             	sub    $0x8,%esp
+    1d62:	68 a6 50 00 00       	push   $0x50a6
+    1d67:	6a 01                	push   $0x1
+    1d69:	e8 e2 1f 00 00       	call   3d50 <printf>
+      exit();
+    1d6e:	e8 40 1e 00 00       	call   3bb3 <exit>
+      close(fd);
+    1d73:	83 ec 0c             	sub    $0xc,%esp
+    1d76:	50                   	push   %eax
+    1d77:	e8 5f 1e 00 00       	call   3bdb <close>
+    1d7c:	83 c4 10             	add    $0x10,%esp
+    1d7f:	e9 cd fe ff ff       	jmp    1c51 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1d84:	83 ec 04             	sub    $0x4,%esp
+    1d87:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1d8a:	50                   	push   %eax
+    1d8b:	68 ed 47 00 00       	push   $0x47ed
+    1d90:	6a 01                	push   $0x1
+    1d92:	e8 b9 1f 00 00       	call   3d50 <printf>
+        exit();
+    1d97:	e8 17 1e 00 00       	call   3bb3 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1d9c:	51                   	push   %ecx
+    1d9d:	51                   	push   %ecx
+    1d9e:	68 6c 53 00 00       	push   $0x536c
+    1da3:	6a 01                	push   $0x1
+    1da5:	e8 a6 1f 00 00       	call   3d50 <printf>
+    exit();
+    1daa:	e8 04 1e 00 00       	call   3bb3 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1daf:	83 ec 04             	sub    $0x4,%esp
+    1db2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1db5:	50                   	push   %eax
+    1db6:	68 06 48 00 00       	push   $0x4806
+    1dbb:	6a 01                	push   $0x1
+    1dbd:	e8 8e 1f 00 00       	call   3d50 <printf>
+        exit();
+    1dc2:	e8 ec 1d 00 00       	call   3bb3 <exit>
+    1dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dce:	66 90                	xchg   %ax,%ax
+
+00001dd0 <linkunlink>:
+{
+    1dd0:	55                   	push   %ebp
+    1dd1:	89 e5                	mov    %esp,%ebp
+    1dd3:	57                   	push   %edi
+    1dd4:	56                   	push   %esi
+    1dd5:	53                   	push   %ebx
+    1dd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1dd9:	68 31 48 00 00       	push   $0x4831
+    1dde:	6a 01                	push   $0x1
+    1de0:	e8 6b 1f 00 00       	call   3d50 <printf>
+  unlink("x");
+    1de5:	c7 04 24 be 4a 00 00 	movl   $0x4abe,(%esp)
+    1dec:	e8 12 1e 00 00       	call   3c03 <unlink>
+  pid = fork();
+    1df1:	e8 b5 1d 00 00       	call   3bab <fork>
+  if(pid < 0){
+    1df6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1df9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1dfc:	85 c0                	test   %eax,%eax
+    1dfe:	0f 88 b6 00 00 00    	js     1eba <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1e04:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1e08:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1e0d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1e12:	19 ff                	sbb    %edi,%edi
+    1e14:	83 e7 60             	and    $0x60,%edi
+    1e17:	83 c7 01             	add    $0x1,%edi
+    1e1a:	eb 1e                	jmp    1e3a <linkunlink+0x6a>
+    1e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1e20:	83 f8 01             	cmp    $0x1,%eax
+    1e23:	74 7b                	je     1ea0 <linkunlink+0xd0>
+      unlink("x");
+    1e25:	83 ec 0c             	sub    $0xc,%esp
+    1e28:	68 be 4a 00 00       	push   $0x4abe
+    1e2d:	e8 d1 1d 00 00       	call   3c03 <unlink>
+    1e32:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1e35:	83 eb 01             	sub    $0x1,%ebx
+    1e38:	74 41                	je     1e7b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1e3a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1e40:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1e46:	89 f8                	mov    %edi,%eax
+    1e48:	f7 e6                	mul    %esi
+    1e4a:	89 d0                	mov    %edx,%eax
+    1e4c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1e4f:	d1 e8                	shr    %eax
+    1e51:	01 c2                	add    %eax,%edx
+    1e53:	89 f8                	mov    %edi,%eax
+    1e55:	29 d0                	sub    %edx,%eax
+    1e57:	75 c7                	jne    1e20 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1e59:	83 ec 08             	sub    $0x8,%esp
+    1e5c:	68 02 02 00 00       	push   $0x202
+    1e61:	68 be 4a 00 00       	push   $0x4abe
+    1e66:	e8 88 1d 00 00       	call   3bf3 <open>
+    1e6b:	89 04 24             	mov    %eax,(%esp)
+    1e6e:	e8 68 1d 00 00       	call   3bdb <close>
+    1e73:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1e76:	83 eb 01             	sub    $0x1,%ebx
+    1e79:	75 bf                	jne    1e3a <linkunlink+0x6a>
+  if(pid)
+    1e7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1e7e:	85 c0                	test   %eax,%eax
+    1e80:	74 4b                	je     1ecd <linkunlink+0xfd>
+    wait();
+    1e82:	e8 34 1d 00 00       	call   3bbb <wait>
+  printf(1, "linkunlink ok\n");
+    1e87:	83 ec 08             	sub    $0x8,%esp
+    1e8a:	68 46 48 00 00       	push   $0x4846
+    1e8f:	6a 01                	push   $0x1
+    1e91:	e8 ba 1e 00 00       	call   3d50 <printf>
+}
+    1e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e99:	5b                   	pop    %ebx
+    1e9a:	5e                   	pop    %esi
+    1e9b:	5f                   	pop    %edi
+    1e9c:	5d                   	pop    %ebp
+    1e9d:	c3                   	ret
+    1e9e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1ea0:	83 ec 08             	sub    $0x8,%esp
+    1ea3:	68 be 4a 00 00       	push   $0x4abe
+    1ea8:	68 42 48 00 00       	push   $0x4842
+    1ead:	e8 61 1d 00 00       	call   3c13 <link>
+    1eb2:	83 c4 10             	add    $0x10,%esp
+    1eb5:	e9 7b ff ff ff       	jmp    1e35 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1eba:	52                   	push   %edx
+    1ebb:	52                   	push   %edx
+    1ebc:	68 a6 50 00 00       	push   $0x50a6
+    1ec1:	6a 01                	push   $0x1
+    1ec3:	e8 88 1e 00 00       	call   3d50 <printf>
+    exit();
+    1ec8:	e8 e6 1c 00 00       	call   3bb3 <exit>
+    exit();
+    1ecd:	e8 e1 1c 00 00       	call   3bb3 <exit>
+    1ed2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ee0 <bigdir>:
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	57                   	push   %edi
+    1ee4:	56                   	push   %esi
+    1ee5:	53                   	push   %ebx
+    1ee6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1ee9:	68 55 48 00 00       	push   $0x4855
+    1eee:	6a 01                	push   $0x1
+    1ef0:	e8 5b 1e 00 00       	call   3d50 <printf>
+  unlink("bd");
+    1ef5:	c7 04 24 62 48 00 00 	movl   $0x4862,(%esp)
+    1efc:	e8 02 1d 00 00       	call   3c03 <unlink>
+  fd = open("bd", O_CREATE);
+    1f01:	5a                   	pop    %edx
+    1f02:	59                   	pop    %ecx
+    1f03:	68 00 02 00 00       	push   $0x200
+    1f08:	68 62 48 00 00       	push   $0x4862
+    1f0d:	e8 e1 1c 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    1f12:	83 c4 10             	add    $0x10,%esp
+    1f15:	85 c0                	test   %eax,%eax
+    1f17:	0f 88 de 00 00 00    	js     1ffb <bigdir+0x11b>
+  close(fd);
+    1f1d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1f20:	31 f6                	xor    %esi,%esi
+    1f22:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1f25:	50                   	push   %eax
+    1f26:	e8 b0 1c 00 00       	call   3bdb <close>
+    1f2b:	83 c4 10             	add    $0x10,%esp
+    1f2e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1f30:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1f32:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1f35:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1f39:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1f3c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1f40:	83 c0 30             	add    $0x30,%eax
+    1f43:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1f46:	89 f0                	mov    %esi,%eax
+    1f48:	83 e0 3f             	and    $0x3f,%eax
+    1f4b:	83 c0 30             	add    $0x30,%eax
+    1f4e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1f51:	57                   	push   %edi
+    1f52:	68 62 48 00 00       	push   $0x4862
+    1f57:	e8 b7 1c 00 00       	call   3c13 <link>
+    1f5c:	83 c4 10             	add    $0x10,%esp
+    1f5f:	89 c3                	mov    %eax,%ebx
+    1f61:	85 c0                	test   %eax,%eax
+    1f63:	75 6e                	jne    1fd3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1f65:	83 c6 01             	add    $0x1,%esi
+    1f68:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1f6e:	75 c0                	jne    1f30 <bigdir+0x50>
+  unlink("bd");
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	68 62 48 00 00       	push   $0x4862
+    1f78:	e8 86 1c 00 00       	call   3c03 <unlink>
+    1f7d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1f80:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1f82:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1f85:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1f89:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1f8c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1f90:	83 c0 30             	add    $0x30,%eax
+    1f93:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1f96:	89 d8                	mov    %ebx,%eax
+    1f98:	83 e0 3f             	and    $0x3f,%eax
+    1f9b:	83 c0 30             	add    $0x30,%eax
+    1f9e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1fa1:	57                   	push   %edi
+    1fa2:	e8 5c 1c 00 00       	call   3c03 <unlink>
+    1fa7:	83 c4 10             	add    $0x10,%esp
+    1faa:	85 c0                	test   %eax,%eax
+    1fac:	75 39                	jne    1fe7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1fae:	83 c3 01             	add    $0x1,%ebx
+    1fb1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1fb7:	75 c7                	jne    1f80 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1fb9:	83 ec 08             	sub    $0x8,%esp
+    1fbc:	68 a4 48 00 00       	push   $0x48a4
+    1fc1:	6a 01                	push   $0x1
+    1fc3:	e8 88 1d 00 00       	call   3d50 <printf>
+    1fc8:	83 c4 10             	add    $0x10,%esp
+}
+    1fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fce:	5b                   	pop    %ebx
+    1fcf:	5e                   	pop    %esi
+    1fd0:	5f                   	pop    %edi
+    1fd1:	5d                   	pop    %ebp
+    1fd2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1fd3:	83 ec 08             	sub    $0x8,%esp
+    1fd6:	68 7b 48 00 00       	push   $0x487b
+    1fdb:	6a 01                	push   $0x1
+    1fdd:	e8 6e 1d 00 00       	call   3d50 <printf>
+      exit();
+    1fe2:	e8 cc 1b 00 00       	call   3bb3 <exit>
+      printf(1, "bigdir unlink failed");
+    1fe7:	83 ec 08             	sub    $0x8,%esp
+    1fea:	68 8f 48 00 00       	push   $0x488f
+    1fef:	6a 01                	push   $0x1
+    1ff1:	e8 5a 1d 00 00       	call   3d50 <printf>
+      exit();
+    1ff6:	e8 b8 1b 00 00       	call   3bb3 <exit>
+    printf(1, "bigdir create failed\n");
+    1ffb:	50                   	push   %eax
+    1ffc:	50                   	push   %eax
+    1ffd:	68 65 48 00 00       	push   $0x4865
+    2002:	6a 01                	push   $0x1
+    2004:	e8 47 1d 00 00       	call   3d50 <printf>
+    exit();
+    2009:	e8 a5 1b 00 00       	call   3bb3 <exit>
+    200e:	66 90                	xchg   %ax,%ax
+
+00002010 <subdir>:
+{
+    2010:	55                   	push   %ebp
+    2011:	89 e5                	mov    %esp,%ebp
+    2013:	53                   	push   %ebx
+    2014:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2017:	68 af 48 00 00       	push   $0x48af
+    201c:	6a 01                	push   $0x1
+    201e:	e8 2d 1d 00 00       	call   3d50 <printf>
+  unlink("ff");
+    2023:	c7 04 24 38 49 00 00 	movl   $0x4938,(%esp)
+    202a:	e8 d4 1b 00 00       	call   3c03 <unlink>
+  if(mkdir("dd") != 0){
+    202f:	c7 04 24 d5 49 00 00 	movl   $0x49d5,(%esp)
+    2036:	e8 e0 1b 00 00       	call   3c1b <mkdir>
+    203b:	83 c4 10             	add    $0x10,%esp
+    203e:	85 c0                	test   %eax,%eax
+    2040:	0f 85 b3 05 00 00    	jne    25f9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2046:	83 ec 08             	sub    $0x8,%esp
+    2049:	68 02 02 00 00       	push   $0x202
+    204e:	68 0e 49 00 00       	push   $0x490e
+    2053:	e8 9b 1b 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    2058:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    205b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    205d:	85 c0                	test   %eax,%eax
+    205f:	0f 88 81 05 00 00    	js     25e6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2065:	83 ec 04             	sub    $0x4,%esp
+    2068:	6a 02                	push   $0x2
+    206a:	68 38 49 00 00       	push   $0x4938
+    206f:	50                   	push   %eax
+    2070:	e8 5e 1b 00 00       	call   3bd3 <write>
+  close(fd);
+    2075:	89 1c 24             	mov    %ebx,(%esp)
+    2078:	e8 5e 1b 00 00       	call   3bdb <close>
+  if(unlink("dd") >= 0){
+    207d:	c7 04 24 d5 49 00 00 	movl   $0x49d5,(%esp)
+    2084:	e8 7a 1b 00 00       	call   3c03 <unlink>
+    2089:	83 c4 10             	add    $0x10,%esp
+    208c:	85 c0                	test   %eax,%eax
+    208e:	0f 89 3f 05 00 00    	jns    25d3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2094:	83 ec 0c             	sub    $0xc,%esp
+    2097:	68 e9 48 00 00       	push   $0x48e9
+    209c:	e8 7a 1b 00 00       	call   3c1b <mkdir>
+    20a1:	83 c4 10             	add    $0x10,%esp
+    20a4:	85 c0                	test   %eax,%eax
+    20a6:	0f 85 14 05 00 00    	jne    25c0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    20ac:	83 ec 08             	sub    $0x8,%esp
+    20af:	68 02 02 00 00       	push   $0x202
+    20b4:	68 0b 49 00 00       	push   $0x490b
+    20b9:	e8 35 1b 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    20be:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    20c1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    20c3:	85 c0                	test   %eax,%eax
+    20c5:	0f 88 24 04 00 00    	js     24ef <subdir+0x4df>
+  write(fd, "FF", 2);
+    20cb:	83 ec 04             	sub    $0x4,%esp
+    20ce:	6a 02                	push   $0x2
+    20d0:	68 2c 49 00 00       	push   $0x492c
+    20d5:	50                   	push   %eax
+    20d6:	e8 f8 1a 00 00       	call   3bd3 <write>
+  close(fd);
+    20db:	89 1c 24             	mov    %ebx,(%esp)
+    20de:	e8 f8 1a 00 00       	call   3bdb <close>
+  fd = open("dd/dd/../ff", 0);
+    20e3:	58                   	pop    %eax
+    20e4:	5a                   	pop    %edx
+    20e5:	6a 00                	push   $0x0
+    20e7:	68 2f 49 00 00       	push   $0x492f
+    20ec:	e8 02 1b 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    20f1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    20f4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    20f6:	85 c0                	test   %eax,%eax
+    20f8:	0f 88 de 03 00 00    	js     24dc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    20fe:	83 ec 04             	sub    $0x4,%esp
+    2101:	68 00 20 00 00       	push   $0x2000
+    2106:	68 c0 89 00 00       	push   $0x89c0
+    210b:	50                   	push   %eax
+    210c:	e8 ba 1a 00 00       	call   3bcb <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2111:	83 c4 10             	add    $0x10,%esp
+    2114:	83 f8 02             	cmp    $0x2,%eax
+    2117:	0f 85 3a 03 00 00    	jne    2457 <subdir+0x447>
+    211d:	80 3d c0 89 00 00 66 	cmpb   $0x66,0x89c0
+    2124:	0f 85 2d 03 00 00    	jne    2457 <subdir+0x447>
+  close(fd);
+    212a:	83 ec 0c             	sub    $0xc,%esp
+    212d:	53                   	push   %ebx
+    212e:	e8 a8 1a 00 00       	call   3bdb <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2133:	59                   	pop    %ecx
+    2134:	5b                   	pop    %ebx
+    2135:	68 6f 49 00 00       	push   $0x496f
+    213a:	68 0b 49 00 00       	push   $0x490b
+    213f:	e8 cf 1a 00 00       	call   3c13 <link>
+    2144:	83 c4 10             	add    $0x10,%esp
+    2147:	85 c0                	test   %eax,%eax
+    2149:	0f 85 c6 03 00 00    	jne    2515 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    214f:	83 ec 0c             	sub    $0xc,%esp
+    2152:	68 0b 49 00 00       	push   $0x490b
+    2157:	e8 a7 1a 00 00       	call   3c03 <unlink>
+    215c:	83 c4 10             	add    $0x10,%esp
+    215f:	85 c0                	test   %eax,%eax
+    2161:	0f 85 16 03 00 00    	jne    247d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2167:	83 ec 08             	sub    $0x8,%esp
+    216a:	6a 00                	push   $0x0
+    216c:	68 0b 49 00 00       	push   $0x490b
+    2171:	e8 7d 1a 00 00       	call   3bf3 <open>
+    2176:	83 c4 10             	add    $0x10,%esp
+    2179:	85 c0                	test   %eax,%eax
+    217b:	0f 89 2c 04 00 00    	jns    25ad <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2181:	83 ec 0c             	sub    $0xc,%esp
+    2184:	68 d5 49 00 00       	push   $0x49d5
+    2189:	e8 95 1a 00 00       	call   3c23 <chdir>
+    218e:	83 c4 10             	add    $0x10,%esp
+    2191:	85 c0                	test   %eax,%eax
+    2193:	0f 85 01 04 00 00    	jne    259a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2199:	83 ec 0c             	sub    $0xc,%esp
+    219c:	68 a3 49 00 00       	push   $0x49a3
+    21a1:	e8 7d 1a 00 00       	call   3c23 <chdir>
+    21a6:	83 c4 10             	add    $0x10,%esp
+    21a9:	85 c0                	test   %eax,%eax
+    21ab:	0f 85 b9 02 00 00    	jne    246a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    21b1:	83 ec 0c             	sub    $0xc,%esp
+    21b4:	68 c9 49 00 00       	push   $0x49c9
+    21b9:	e8 65 1a 00 00       	call   3c23 <chdir>
+    21be:	83 c4 10             	add    $0x10,%esp
+    21c1:	85 c0                	test   %eax,%eax
+    21c3:	0f 85 a1 02 00 00    	jne    246a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    21c9:	83 ec 0c             	sub    $0xc,%esp
+    21cc:	68 d8 49 00 00       	push   $0x49d8
+    21d1:	e8 4d 1a 00 00       	call   3c23 <chdir>
+    21d6:	83 c4 10             	add    $0x10,%esp
+    21d9:	85 c0                	test   %eax,%eax
+    21db:	0f 85 21 03 00 00    	jne    2502 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    21e1:	83 ec 08             	sub    $0x8,%esp
+    21e4:	6a 00                	push   $0x0
+    21e6:	68 6f 49 00 00       	push   $0x496f
+    21eb:	e8 03 1a 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    21f0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    21f3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    21f5:	85 c0                	test   %eax,%eax
+    21f7:	0f 88 e0 04 00 00    	js     26dd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    21fd:	83 ec 04             	sub    $0x4,%esp
+    2200:	68 00 20 00 00       	push   $0x2000
+    2205:	68 c0 89 00 00       	push   $0x89c0
+    220a:	50                   	push   %eax
+    220b:	e8 bb 19 00 00       	call   3bcb <read>
+    2210:	83 c4 10             	add    $0x10,%esp
+    2213:	83 f8 02             	cmp    $0x2,%eax
+    2216:	0f 85 ae 04 00 00    	jne    26ca <subdir+0x6ba>
+  close(fd);
+    221c:	83 ec 0c             	sub    $0xc,%esp
+    221f:	53                   	push   %ebx
+    2220:	e8 b6 19 00 00       	call   3bdb <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2225:	58                   	pop    %eax
+    2226:	5a                   	pop    %edx
+    2227:	6a 00                	push   $0x0
+    2229:	68 0b 49 00 00       	push   $0x490b
+    222e:	e8 c0 19 00 00       	call   3bf3 <open>
+    2233:	83 c4 10             	add    $0x10,%esp
+    2236:	85 c0                	test   %eax,%eax
+    2238:	0f 89 65 02 00 00    	jns    24a3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    223e:	83 ec 08             	sub    $0x8,%esp
+    2241:	68 02 02 00 00       	push   $0x202
+    2246:	68 23 4a 00 00       	push   $0x4a23
+    224b:	e8 a3 19 00 00       	call   3bf3 <open>
+    2250:	83 c4 10             	add    $0x10,%esp
+    2253:	85 c0                	test   %eax,%eax
+    2255:	0f 89 35 02 00 00    	jns    2490 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    225b:	83 ec 08             	sub    $0x8,%esp
+    225e:	68 02 02 00 00       	push   $0x202
+    2263:	68 48 4a 00 00       	push   $0x4a48
+    2268:	e8 86 19 00 00       	call   3bf3 <open>
+    226d:	83 c4 10             	add    $0x10,%esp
+    2270:	85 c0                	test   %eax,%eax
+    2272:	0f 89 0f 03 00 00    	jns    2587 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2278:	83 ec 08             	sub    $0x8,%esp
+    227b:	68 00 02 00 00       	push   $0x200
+    2280:	68 d5 49 00 00       	push   $0x49d5
+    2285:	e8 69 19 00 00       	call   3bf3 <open>
+    228a:	83 c4 10             	add    $0x10,%esp
+    228d:	85 c0                	test   %eax,%eax
+    228f:	0f 89 df 02 00 00    	jns    2574 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2295:	83 ec 08             	sub    $0x8,%esp
+    2298:	6a 02                	push   $0x2
+    229a:	68 d5 49 00 00       	push   $0x49d5
+    229f:	e8 4f 19 00 00       	call   3bf3 <open>
+    22a4:	83 c4 10             	add    $0x10,%esp
+    22a7:	85 c0                	test   %eax,%eax
+    22a9:	0f 89 b2 02 00 00    	jns    2561 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    22af:	83 ec 08             	sub    $0x8,%esp
+    22b2:	6a 01                	push   $0x1
+    22b4:	68 d5 49 00 00       	push   $0x49d5
+    22b9:	e8 35 19 00 00       	call   3bf3 <open>
+    22be:	83 c4 10             	add    $0x10,%esp
+    22c1:	85 c0                	test   %eax,%eax
+    22c3:	0f 89 85 02 00 00    	jns    254e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    22c9:	83 ec 08             	sub    $0x8,%esp
+    22cc:	68 b7 4a 00 00       	push   $0x4ab7
+    22d1:	68 23 4a 00 00       	push   $0x4a23
+    22d6:	e8 38 19 00 00       	call   3c13 <link>
+    22db:	83 c4 10             	add    $0x10,%esp
+    22de:	85 c0                	test   %eax,%eax
+    22e0:	0f 84 55 02 00 00    	je     253b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    22e6:	83 ec 08             	sub    $0x8,%esp
+    22e9:	68 b7 4a 00 00       	push   $0x4ab7
+    22ee:	68 48 4a 00 00       	push   $0x4a48
+    22f3:	e8 1b 19 00 00       	call   3c13 <link>
+    22f8:	83 c4 10             	add    $0x10,%esp
+    22fb:	85 c0                	test   %eax,%eax
+    22fd:	0f 84 25 02 00 00    	je     2528 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2303:	83 ec 08             	sub    $0x8,%esp
+    2306:	68 6f 49 00 00       	push   $0x496f
+    230b:	68 0e 49 00 00       	push   $0x490e
+    2310:	e8 fe 18 00 00       	call   3c13 <link>
+    2315:	83 c4 10             	add    $0x10,%esp
+    2318:	85 c0                	test   %eax,%eax
+    231a:	0f 84 a9 01 00 00    	je     24c9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2320:	83 ec 0c             	sub    $0xc,%esp
+    2323:	68 23 4a 00 00       	push   $0x4a23
+    2328:	e8 ee 18 00 00       	call   3c1b <mkdir>
+    232d:	83 c4 10             	add    $0x10,%esp
+    2330:	85 c0                	test   %eax,%eax
+    2332:	0f 84 7e 01 00 00    	je     24b6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2338:	83 ec 0c             	sub    $0xc,%esp
+    233b:	68 48 4a 00 00       	push   $0x4a48
+    2340:	e8 d6 18 00 00       	call   3c1b <mkdir>
+    2345:	83 c4 10             	add    $0x10,%esp
+    2348:	85 c0                	test   %eax,%eax
+    234a:	0f 84 67 03 00 00    	je     26b7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2350:	83 ec 0c             	sub    $0xc,%esp
+    2353:	68 6f 49 00 00       	push   $0x496f
+    2358:	e8 be 18 00 00       	call   3c1b <mkdir>
+    235d:	83 c4 10             	add    $0x10,%esp
+    2360:	85 c0                	test   %eax,%eax
+    2362:	0f 84 3c 03 00 00    	je     26a4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2368:	83 ec 0c             	sub    $0xc,%esp
+    236b:	68 48 4a 00 00       	push   $0x4a48
+    2370:	e8 8e 18 00 00       	call   3c03 <unlink>
+    2375:	83 c4 10             	add    $0x10,%esp
+    2378:	85 c0                	test   %eax,%eax
+    237a:	0f 84 11 03 00 00    	je     2691 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2380:	83 ec 0c             	sub    $0xc,%esp
+    2383:	68 23 4a 00 00       	push   $0x4a23
+    2388:	e8 76 18 00 00       	call   3c03 <unlink>
+    238d:	83 c4 10             	add    $0x10,%esp
+    2390:	85 c0                	test   %eax,%eax
+    2392:	0f 84 e6 02 00 00    	je     267e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2398:	83 ec 0c             	sub    $0xc,%esp
+    239b:	68 0e 49 00 00       	push   $0x490e
+    23a0:	e8 7e 18 00 00       	call   3c23 <chdir>
+    23a5:	83 c4 10             	add    $0x10,%esp
+    23a8:	85 c0                	test   %eax,%eax
+    23aa:	0f 84 bb 02 00 00    	je     266b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    23b0:	83 ec 0c             	sub    $0xc,%esp
+    23b3:	68 ba 4a 00 00       	push   $0x4aba
+    23b8:	e8 66 18 00 00       	call   3c23 <chdir>
+    23bd:	83 c4 10             	add    $0x10,%esp
+    23c0:	85 c0                	test   %eax,%eax
+    23c2:	0f 84 90 02 00 00    	je     2658 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    23c8:	83 ec 0c             	sub    $0xc,%esp
+    23cb:	68 6f 49 00 00       	push   $0x496f
+    23d0:	e8 2e 18 00 00       	call   3c03 <unlink>
+    23d5:	83 c4 10             	add    $0x10,%esp
+    23d8:	85 c0                	test   %eax,%eax
+    23da:	0f 85 9d 00 00 00    	jne    247d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    23e0:	83 ec 0c             	sub    $0xc,%esp
+    23e3:	68 0e 49 00 00       	push   $0x490e
+    23e8:	e8 16 18 00 00       	call   3c03 <unlink>
+    23ed:	83 c4 10             	add    $0x10,%esp
+    23f0:	85 c0                	test   %eax,%eax
+    23f2:	0f 85 4d 02 00 00    	jne    2645 <subdir+0x635>
+  if(unlink("dd") == 0){
+    23f8:	83 ec 0c             	sub    $0xc,%esp
+    23fb:	68 d5 49 00 00       	push   $0x49d5
+    2400:	e8 fe 17 00 00       	call   3c03 <unlink>
+    2405:	83 c4 10             	add    $0x10,%esp
+    2408:	85 c0                	test   %eax,%eax
+    240a:	0f 84 22 02 00 00    	je     2632 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2410:	83 ec 0c             	sub    $0xc,%esp
+    2413:	68 ea 48 00 00       	push   $0x48ea
+    2418:	e8 e6 17 00 00       	call   3c03 <unlink>
+    241d:	83 c4 10             	add    $0x10,%esp
+    2420:	85 c0                	test   %eax,%eax
+    2422:	0f 88 f7 01 00 00    	js     261f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2428:	83 ec 0c             	sub    $0xc,%esp
+    242b:	68 d5 49 00 00       	push   $0x49d5
+    2430:	e8 ce 17 00 00       	call   3c03 <unlink>
+    2435:	83 c4 10             	add    $0x10,%esp
+    2438:	85 c0                	test   %eax,%eax
+    243a:	0f 88 cc 01 00 00    	js     260c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2440:	83 ec 08             	sub    $0x8,%esp
+    2443:	68 b7 4b 00 00       	push   $0x4bb7
+    2448:	6a 01                	push   $0x1
+    244a:	e8 01 19 00 00       	call   3d50 <printf>
+}
+    244f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2452:	83 c4 10             	add    $0x10,%esp
+    2455:	c9                   	leave
+    2456:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2457:	50                   	push   %eax
+    2458:	50                   	push   %eax
+    2459:	68 54 49 00 00       	push   $0x4954
+    245e:	6a 01                	push   $0x1
+    2460:	e8 eb 18 00 00       	call   3d50 <printf>
+    exit();
+    2465:	e8 49 17 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    246a:	50                   	push   %eax
+    246b:	50                   	push   %eax
+    246c:	68 af 49 00 00       	push   $0x49af
+    2471:	6a 01                	push   $0x1
+    2473:	e8 d8 18 00 00       	call   3d50 <printf>
+    exit();
+    2478:	e8 36 17 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    247d:	50                   	push   %eax
+    247e:	50                   	push   %eax
+    247f:	68 7a 49 00 00       	push   $0x497a
+    2484:	6a 01                	push   $0x1
+    2486:	e8 c5 18 00 00       	call   3d50 <printf>
+    exit();
+    248b:	e8 23 17 00 00       	call   3bb3 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2490:	51                   	push   %ecx
+    2491:	51                   	push   %ecx
+    2492:	68 2c 4a 00 00       	push   $0x4a2c
+    2497:	6a 01                	push   $0x1
+    2499:	e8 b2 18 00 00       	call   3d50 <printf>
+    exit();
+    249e:	e8 10 17 00 00       	call   3bb3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    24a3:	53                   	push   %ebx
+    24a4:	53                   	push   %ebx
+    24a5:	68 10 54 00 00       	push   $0x5410
+    24aa:	6a 01                	push   $0x1
+    24ac:	e8 9f 18 00 00       	call   3d50 <printf>
+    exit();
+    24b1:	e8 fd 16 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    24b6:	51                   	push   %ecx
+    24b7:	51                   	push   %ecx
+    24b8:	68 c0 4a 00 00       	push   $0x4ac0
+    24bd:	6a 01                	push   $0x1
+    24bf:	e8 8c 18 00 00       	call   3d50 <printf>
+    exit();
+    24c4:	e8 ea 16 00 00       	call   3bb3 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    24c9:	53                   	push   %ebx
+    24ca:	53                   	push   %ebx
+    24cb:	68 80 54 00 00       	push   $0x5480
+    24d0:	6a 01                	push   $0x1
+    24d2:	e8 79 18 00 00       	call   3d50 <printf>
+    exit();
+    24d7:	e8 d7 16 00 00       	call   3bb3 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    24dc:	50                   	push   %eax
+    24dd:	50                   	push   %eax
+    24de:	68 3b 49 00 00       	push   $0x493b
+    24e3:	6a 01                	push   $0x1
+    24e5:	e8 66 18 00 00       	call   3d50 <printf>
+    exit();
+    24ea:	e8 c4 16 00 00       	call   3bb3 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    24ef:	51                   	push   %ecx
+    24f0:	51                   	push   %ecx
+    24f1:	68 14 49 00 00       	push   $0x4914
+    24f6:	6a 01                	push   $0x1
+    24f8:	e8 53 18 00 00       	call   3d50 <printf>
+    exit();
+    24fd:	e8 b1 16 00 00       	call   3bb3 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2502:	50                   	push   %eax
+    2503:	50                   	push   %eax
+    2504:	68 dd 49 00 00       	push   $0x49dd
+    2509:	6a 01                	push   $0x1
+    250b:	e8 40 18 00 00       	call   3d50 <printf>
+    exit();
+    2510:	e8 9e 16 00 00       	call   3bb3 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2515:	52                   	push   %edx
+    2516:	52                   	push   %edx
+    2517:	68 c8 53 00 00       	push   $0x53c8
+    251c:	6a 01                	push   $0x1
+    251e:	e8 2d 18 00 00       	call   3d50 <printf>
+    exit();
+    2523:	e8 8b 16 00 00       	call   3bb3 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2528:	50                   	push   %eax
+    2529:	50                   	push   %eax
+    252a:	68 5c 54 00 00       	push   $0x545c
+    252f:	6a 01                	push   $0x1
+    2531:	e8 1a 18 00 00       	call   3d50 <printf>
+    exit();
+    2536:	e8 78 16 00 00       	call   3bb3 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    253b:	50                   	push   %eax
+    253c:	50                   	push   %eax
+    253d:	68 38 54 00 00       	push   $0x5438
+    2542:	6a 01                	push   $0x1
+    2544:	e8 07 18 00 00       	call   3d50 <printf>
+    exit();
+    2549:	e8 65 16 00 00       	call   3bb3 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    254e:	50                   	push   %eax
+    254f:	50                   	push   %eax
+    2550:	68 9c 4a 00 00       	push   $0x4a9c
+    2555:	6a 01                	push   $0x1
+    2557:	e8 f4 17 00 00       	call   3d50 <printf>
+    exit();
+    255c:	e8 52 16 00 00       	call   3bb3 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2561:	50                   	push   %eax
+    2562:	50                   	push   %eax
+    2563:	68 83 4a 00 00       	push   $0x4a83
+    2568:	6a 01                	push   $0x1
+    256a:	e8 e1 17 00 00       	call   3d50 <printf>
+    exit();
+    256f:	e8 3f 16 00 00       	call   3bb3 <exit>
+    printf(1, "create dd succeeded!\n");
+    2574:	50                   	push   %eax
+    2575:	50                   	push   %eax
+    2576:	68 6d 4a 00 00       	push   $0x4a6d
+    257b:	6a 01                	push   $0x1
+    257d:	e8 ce 17 00 00       	call   3d50 <printf>
+    exit();
+    2582:	e8 2c 16 00 00       	call   3bb3 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2587:	52                   	push   %edx
+    2588:	52                   	push   %edx
+    2589:	68 51 4a 00 00       	push   $0x4a51
+    258e:	6a 01                	push   $0x1
+    2590:	e8 bb 17 00 00       	call   3d50 <printf>
+    exit();
+    2595:	e8 19 16 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dd failed\n");
+    259a:	50                   	push   %eax
+    259b:	50                   	push   %eax
+    259c:	68 92 49 00 00       	push   $0x4992
+    25a1:	6a 01                	push   $0x1
+    25a3:	e8 a8 17 00 00       	call   3d50 <printf>
+    exit();
+    25a8:	e8 06 16 00 00       	call   3bb3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    25ad:	50                   	push   %eax
+    25ae:	50                   	push   %eax
+    25af:	68 ec 53 00 00       	push   $0x53ec
+    25b4:	6a 01                	push   $0x1
+    25b6:	e8 95 17 00 00       	call   3d50 <printf>
+    exit();
+    25bb:	e8 f3 15 00 00       	call   3bb3 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    25c0:	53                   	push   %ebx
+    25c1:	53                   	push   %ebx
+    25c2:	68 f0 48 00 00       	push   $0x48f0
+    25c7:	6a 01                	push   $0x1
+    25c9:	e8 82 17 00 00       	call   3d50 <printf>
+    exit();
+    25ce:	e8 e0 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    25d3:	50                   	push   %eax
+    25d4:	50                   	push   %eax
+    25d5:	68 a0 53 00 00       	push   $0x53a0
+    25da:	6a 01                	push   $0x1
+    25dc:	e8 6f 17 00 00       	call   3d50 <printf>
+    exit();
+    25e1:	e8 cd 15 00 00       	call   3bb3 <exit>
+    printf(1, "create dd/ff failed\n");
+    25e6:	50                   	push   %eax
+    25e7:	50                   	push   %eax
+    25e8:	68 d4 48 00 00       	push   $0x48d4
+    25ed:	6a 01                	push   $0x1
+    25ef:	e8 5c 17 00 00       	call   3d50 <printf>
+    exit();
+    25f4:	e8 ba 15 00 00       	call   3bb3 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    25f9:	50                   	push   %eax
+    25fa:	50                   	push   %eax
+    25fb:	68 bc 48 00 00       	push   $0x48bc
+    2600:	6a 01                	push   $0x1
+    2602:	e8 49 17 00 00       	call   3d50 <printf>
+    exit();
+    2607:	e8 a7 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd failed\n");
+    260c:	50                   	push   %eax
+    260d:	50                   	push   %eax
+    260e:	68 a5 4b 00 00       	push   $0x4ba5
+    2613:	6a 01                	push   $0x1
+    2615:	e8 36 17 00 00       	call   3d50 <printf>
+    exit();
+    261a:	e8 94 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    261f:	52                   	push   %edx
+    2620:	52                   	push   %edx
+    2621:	68 90 4b 00 00       	push   $0x4b90
+    2626:	6a 01                	push   $0x1
+    2628:	e8 23 17 00 00       	call   3d50 <printf>
+    exit();
+    262d:	e8 81 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2632:	51                   	push   %ecx
+    2633:	51                   	push   %ecx
+    2634:	68 a4 54 00 00       	push   $0x54a4
+    2639:	6a 01                	push   $0x1
+    263b:	e8 10 17 00 00       	call   3d50 <printf>
+    exit();
+    2640:	e8 6e 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2645:	53                   	push   %ebx
+    2646:	53                   	push   %ebx
+    2647:	68 7b 4b 00 00       	push   $0x4b7b
+    264c:	6a 01                	push   $0x1
+    264e:	e8 fd 16 00 00       	call   3d50 <printf>
+    exit();
+    2653:	e8 5b 15 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2658:	50                   	push   %eax
+    2659:	50                   	push   %eax
+    265a:	68 63 4b 00 00       	push   $0x4b63
+    265f:	6a 01                	push   $0x1
+    2661:	e8 ea 16 00 00       	call   3d50 <printf>
+    exit();
+    2666:	e8 48 15 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    266b:	50                   	push   %eax
+    266c:	50                   	push   %eax
+    266d:	68 4b 4b 00 00       	push   $0x4b4b
+    2672:	6a 01                	push   $0x1
+    2674:	e8 d7 16 00 00       	call   3d50 <printf>
+    exit();
+    2679:	e8 35 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    267e:	50                   	push   %eax
+    267f:	50                   	push   %eax
+    2680:	68 2f 4b 00 00       	push   $0x4b2f
+    2685:	6a 01                	push   $0x1
+    2687:	e8 c4 16 00 00       	call   3d50 <printf>
+    exit();
+    268c:	e8 22 15 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2691:	50                   	push   %eax
+    2692:	50                   	push   %eax
+    2693:	68 13 4b 00 00       	push   $0x4b13
+    2698:	6a 01                	push   $0x1
+    269a:	e8 b1 16 00 00       	call   3d50 <printf>
+    exit();
+    269f:	e8 0f 15 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    26a4:	50                   	push   %eax
+    26a5:	50                   	push   %eax
+    26a6:	68 f6 4a 00 00       	push   $0x4af6
+    26ab:	6a 01                	push   $0x1
+    26ad:	e8 9e 16 00 00       	call   3d50 <printf>
+    exit();
+    26b2:	e8 fc 14 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    26b7:	52                   	push   %edx
+    26b8:	52                   	push   %edx
+    26b9:	68 db 4a 00 00       	push   $0x4adb
+    26be:	6a 01                	push   $0x1
+    26c0:	e8 8b 16 00 00       	call   3d50 <printf>
+    exit();
+    26c5:	e8 e9 14 00 00       	call   3bb3 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    26ca:	51                   	push   %ecx
+    26cb:	51                   	push   %ecx
+    26cc:	68 08 4a 00 00       	push   $0x4a08
+    26d1:	6a 01                	push   $0x1
+    26d3:	e8 78 16 00 00       	call   3d50 <printf>
+    exit();
+    26d8:	e8 d6 14 00 00       	call   3bb3 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    26dd:	53                   	push   %ebx
+    26de:	53                   	push   %ebx
+    26df:	68 f0 49 00 00       	push   $0x49f0
+    26e4:	6a 01                	push   $0x1
+    26e6:	e8 65 16 00 00       	call   3d50 <printf>
+    exit();
+    26eb:	e8 c3 14 00 00       	call   3bb3 <exit>
+
+000026f0 <bigwrite>:
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	56                   	push   %esi
+    26f4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    26f5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    26fa:	83 ec 08             	sub    $0x8,%esp
+    26fd:	68 c2 4b 00 00       	push   $0x4bc2
+    2702:	6a 01                	push   $0x1
+    2704:	e8 47 16 00 00       	call   3d50 <printf>
+  unlink("bigwrite");
+    2709:	c7 04 24 d1 4b 00 00 	movl   $0x4bd1,(%esp)
+    2710:	e8 ee 14 00 00       	call   3c03 <unlink>
+    2715:	83 c4 10             	add    $0x10,%esp
+    2718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    271f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2720:	83 ec 08             	sub    $0x8,%esp
+    2723:	68 02 02 00 00       	push   $0x202
+    2728:	68 d1 4b 00 00       	push   $0x4bd1
+    272d:	e8 c1 14 00 00       	call   3bf3 <open>
+    if(fd < 0){
+    2732:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2735:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2737:	85 c0                	test   %eax,%eax
+    2739:	78 7e                	js     27b9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    273b:	83 ec 04             	sub    $0x4,%esp
+    273e:	53                   	push   %ebx
+    273f:	68 c0 89 00 00       	push   $0x89c0
+    2744:	50                   	push   %eax
+    2745:	e8 89 14 00 00       	call   3bd3 <write>
+      if(cc != sz){
+    274a:	83 c4 10             	add    $0x10,%esp
+    274d:	39 d8                	cmp    %ebx,%eax
+    274f:	75 55                	jne    27a6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2751:	83 ec 04             	sub    $0x4,%esp
+    2754:	53                   	push   %ebx
+    2755:	68 c0 89 00 00       	push   $0x89c0
+    275a:	56                   	push   %esi
+    275b:	e8 73 14 00 00       	call   3bd3 <write>
+      if(cc != sz){
+    2760:	83 c4 10             	add    $0x10,%esp
+    2763:	39 c3                	cmp    %eax,%ebx
+    2765:	75 3f                	jne    27a6 <bigwrite+0xb6>
+    close(fd);
+    2767:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    276a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2770:	56                   	push   %esi
+    2771:	e8 65 14 00 00       	call   3bdb <close>
+    unlink("bigwrite");
+    2776:	c7 04 24 d1 4b 00 00 	movl   $0x4bd1,(%esp)
+    277d:	e8 81 14 00 00       	call   3c03 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2782:	83 c4 10             	add    $0x10,%esp
+    2785:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    278b:	75 93                	jne    2720 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    278d:	83 ec 08             	sub    $0x8,%esp
+    2790:	68 04 4c 00 00       	push   $0x4c04
+    2795:	6a 01                	push   $0x1
+    2797:	e8 b4 15 00 00       	call   3d50 <printf>
+}
+    279c:	83 c4 10             	add    $0x10,%esp
+    279f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    27a2:	5b                   	pop    %ebx
+    27a3:	5e                   	pop    %esi
+    27a4:	5d                   	pop    %ebp
+    27a5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    27a6:	50                   	push   %eax
+    27a7:	53                   	push   %ebx
+    27a8:	68 f2 4b 00 00       	push   $0x4bf2
+    27ad:	6a 01                	push   $0x1
+    27af:	e8 9c 15 00 00       	call   3d50 <printf>
+        exit();
+    27b4:	e8 fa 13 00 00       	call   3bb3 <exit>
+      printf(1, "cannot create bigwrite\n");
+    27b9:	83 ec 08             	sub    $0x8,%esp
+    27bc:	68 da 4b 00 00       	push   $0x4bda
+    27c1:	6a 01                	push   $0x1
+    27c3:	e8 88 15 00 00       	call   3d50 <printf>
+      exit();
+    27c8:	e8 e6 13 00 00       	call   3bb3 <exit>
+    27cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000027d0 <bigfile>:
+{
+    27d0:	55                   	push   %ebp
+    27d1:	89 e5                	mov    %esp,%ebp
+    27d3:	57                   	push   %edi
+    27d4:	56                   	push   %esi
+    27d5:	53                   	push   %ebx
+    27d6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    27d9:	68 11 4c 00 00       	push   $0x4c11
+    27de:	6a 01                	push   $0x1
+    27e0:	e8 6b 15 00 00       	call   3d50 <printf>
+  unlink("bigfile");
+    27e5:	c7 04 24 2d 4c 00 00 	movl   $0x4c2d,(%esp)
+    27ec:	e8 12 14 00 00       	call   3c03 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    27f1:	58                   	pop    %eax
+    27f2:	5a                   	pop    %edx
+    27f3:	68 02 02 00 00       	push   $0x202
+    27f8:	68 2d 4c 00 00       	push   $0x4c2d
+    27fd:	e8 f1 13 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    2802:	83 c4 10             	add    $0x10,%esp
+    2805:	85 c0                	test   %eax,%eax
+    2807:	0f 88 5e 01 00 00    	js     296b <bigfile+0x19b>
+    280d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    280f:	31 db                	xor    %ebx,%ebx
+    2811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2818:	83 ec 04             	sub    $0x4,%esp
+    281b:	68 58 02 00 00       	push   $0x258
+    2820:	53                   	push   %ebx
+    2821:	68 c0 89 00 00       	push   $0x89c0
+    2826:	e8 05 12 00 00       	call   3a30 <memset>
+    if(write(fd, buf, 600) != 600){
+    282b:	83 c4 0c             	add    $0xc,%esp
+    282e:	68 58 02 00 00       	push   $0x258
+    2833:	68 c0 89 00 00       	push   $0x89c0
+    2838:	56                   	push   %esi
+    2839:	e8 95 13 00 00       	call   3bd3 <write>
+    283e:	83 c4 10             	add    $0x10,%esp
+    2841:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2846:	0f 85 f8 00 00 00    	jne    2944 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    284c:	83 c3 01             	add    $0x1,%ebx
+    284f:	83 fb 14             	cmp    $0x14,%ebx
+    2852:	75 c4                	jne    2818 <bigfile+0x48>
+  close(fd);
+    2854:	83 ec 0c             	sub    $0xc,%esp
+    2857:	56                   	push   %esi
+    2858:	e8 7e 13 00 00       	call   3bdb <close>
+  fd = open("bigfile", 0);
+    285d:	5e                   	pop    %esi
+    285e:	5f                   	pop    %edi
+    285f:	6a 00                	push   $0x0
+    2861:	68 2d 4c 00 00       	push   $0x4c2d
+    2866:	e8 88 13 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    286b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    286e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2870:	85 c0                	test   %eax,%eax
+    2872:	0f 88 e0 00 00 00    	js     2958 <bigfile+0x188>
+  total = 0;
+    2878:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    287a:	31 ff                	xor    %edi,%edi
+    287c:	eb 30                	jmp    28ae <bigfile+0xde>
+    287e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2880:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2885:	0f 85 91 00 00 00    	jne    291c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    288b:	89 fa                	mov    %edi,%edx
+    288d:	0f be 05 c0 89 00 00 	movsbl 0x89c0,%eax
+    2894:	d1 fa                	sar    %edx
+    2896:	39 d0                	cmp    %edx,%eax
+    2898:	75 6e                	jne    2908 <bigfile+0x138>
+    289a:	0f be 15 eb 8a 00 00 	movsbl 0x8aeb,%edx
+    28a1:	39 d0                	cmp    %edx,%eax
+    28a3:	75 63                	jne    2908 <bigfile+0x138>
+    total += cc;
+    28a5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    28ab:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    28ae:	83 ec 04             	sub    $0x4,%esp
+    28b1:	68 2c 01 00 00       	push   $0x12c
+    28b6:	68 c0 89 00 00       	push   $0x89c0
+    28bb:	56                   	push   %esi
+    28bc:	e8 0a 13 00 00       	call   3bcb <read>
+    if(cc < 0){
+    28c1:	83 c4 10             	add    $0x10,%esp
+    28c4:	85 c0                	test   %eax,%eax
+    28c6:	78 68                	js     2930 <bigfile+0x160>
+    if(cc == 0)
+    28c8:	75 b6                	jne    2880 <bigfile+0xb0>
+  close(fd);
+    28ca:	83 ec 0c             	sub    $0xc,%esp
+    28cd:	56                   	push   %esi
+    28ce:	e8 08 13 00 00       	call   3bdb <close>
+  if(total != 20*600){
+    28d3:	83 c4 10             	add    $0x10,%esp
+    28d6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    28dc:	0f 85 9c 00 00 00    	jne    297e <bigfile+0x1ae>
+  unlink("bigfile");
+    28e2:	83 ec 0c             	sub    $0xc,%esp
+    28e5:	68 2d 4c 00 00       	push   $0x4c2d
+    28ea:	e8 14 13 00 00       	call   3c03 <unlink>
+  printf(1, "bigfile test ok\n");
+    28ef:	58                   	pop    %eax
+    28f0:	5a                   	pop    %edx
+    28f1:	68 bc 4c 00 00       	push   $0x4cbc
+    28f6:	6a 01                	push   $0x1
+    28f8:	e8 53 14 00 00       	call   3d50 <printf>
+}
+    28fd:	83 c4 10             	add    $0x10,%esp
+    2900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2903:	5b                   	pop    %ebx
+    2904:	5e                   	pop    %esi
+    2905:	5f                   	pop    %edi
+    2906:	5d                   	pop    %ebp
+    2907:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2908:	83 ec 08             	sub    $0x8,%esp
+    290b:	68 89 4c 00 00       	push   $0x4c89
+    2910:	6a 01                	push   $0x1
+    2912:	e8 39 14 00 00       	call   3d50 <printf>
+      exit();
+    2917:	e8 97 12 00 00       	call   3bb3 <exit>
+      printf(1, "short read bigfile\n");
+    291c:	83 ec 08             	sub    $0x8,%esp
+    291f:	68 75 4c 00 00       	push   $0x4c75
+    2924:	6a 01                	push   $0x1
+    2926:	e8 25 14 00 00       	call   3d50 <printf>
+      exit();
+    292b:	e8 83 12 00 00       	call   3bb3 <exit>
+      printf(1, "read bigfile failed\n");
+    2930:	83 ec 08             	sub    $0x8,%esp
+    2933:	68 60 4c 00 00       	push   $0x4c60
+    2938:	6a 01                	push   $0x1
+    293a:	e8 11 14 00 00       	call   3d50 <printf>
+      exit();
+    293f:	e8 6f 12 00 00       	call   3bb3 <exit>
+      printf(1, "write bigfile failed\n");
+    2944:	83 ec 08             	sub    $0x8,%esp
+    2947:	68 35 4c 00 00       	push   $0x4c35
+    294c:	6a 01                	push   $0x1
+    294e:	e8 fd 13 00 00       	call   3d50 <printf>
+      exit();
+    2953:	e8 5b 12 00 00       	call   3bb3 <exit>
+    printf(1, "cannot open bigfile\n");
+    2958:	53                   	push   %ebx
+    2959:	53                   	push   %ebx
+    295a:	68 4b 4c 00 00       	push   $0x4c4b
+    295f:	6a 01                	push   $0x1
+    2961:	e8 ea 13 00 00       	call   3d50 <printf>
+    exit();
+    2966:	e8 48 12 00 00       	call   3bb3 <exit>
+    printf(1, "cannot create bigfile");
+    296b:	50                   	push   %eax
+    296c:	50                   	push   %eax
+    296d:	68 1f 4c 00 00       	push   $0x4c1f
+    2972:	6a 01                	push   $0x1
+    2974:	e8 d7 13 00 00       	call   3d50 <printf>
+    exit();
+    2979:	e8 35 12 00 00       	call   3bb3 <exit>
+    printf(1, "read bigfile wrong total\n");
+    297e:	51                   	push   %ecx
+    297f:	51                   	push   %ecx
+    2980:	68 a2 4c 00 00       	push   $0x4ca2
+    2985:	6a 01                	push   $0x1
+    2987:	e8 c4 13 00 00       	call   3d50 <printf>
+    exit();
+    298c:	e8 22 12 00 00       	call   3bb3 <exit>
+    2991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    299f:	90                   	nop
+
+000029a0 <fourteen>:
+{
+    29a0:	55                   	push   %ebp
+    29a1:	89 e5                	mov    %esp,%ebp
+    29a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    29a6:	68 cd 4c 00 00       	push   $0x4ccd
+    29ab:	6a 01                	push   $0x1
+    29ad:	e8 9e 13 00 00       	call   3d50 <printf>
+  if(mkdir("12345678901234") != 0){
+    29b2:	c7 04 24 08 4d 00 00 	movl   $0x4d08,(%esp)
+    29b9:	e8 5d 12 00 00       	call   3c1b <mkdir>
+    29be:	83 c4 10             	add    $0x10,%esp
+    29c1:	85 c0                	test   %eax,%eax
+    29c3:	0f 85 97 00 00 00    	jne    2a60 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    29c9:	83 ec 0c             	sub    $0xc,%esp
+    29cc:	68 c4 54 00 00       	push   $0x54c4
+    29d1:	e8 45 12 00 00       	call   3c1b <mkdir>
+    29d6:	83 c4 10             	add    $0x10,%esp
+    29d9:	85 c0                	test   %eax,%eax
+    29db:	0f 85 de 00 00 00    	jne    2abf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    29e1:	83 ec 08             	sub    $0x8,%esp
+    29e4:	68 00 02 00 00       	push   $0x200
+    29e9:	68 14 55 00 00       	push   $0x5514
+    29ee:	e8 00 12 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    29f3:	83 c4 10             	add    $0x10,%esp
+    29f6:	85 c0                	test   %eax,%eax
+    29f8:	0f 88 ae 00 00 00    	js     2aac <fourteen+0x10c>
+  close(fd);
+    29fe:	83 ec 0c             	sub    $0xc,%esp
+    2a01:	50                   	push   %eax
+    2a02:	e8 d4 11 00 00       	call   3bdb <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2a07:	58                   	pop    %eax
+    2a08:	5a                   	pop    %edx
+    2a09:	6a 00                	push   $0x0
+    2a0b:	68 84 55 00 00       	push   $0x5584
+    2a10:	e8 de 11 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    2a15:	83 c4 10             	add    $0x10,%esp
+    2a18:	85 c0                	test   %eax,%eax
+    2a1a:	78 7d                	js     2a99 <fourteen+0xf9>
+  close(fd);
+    2a1c:	83 ec 0c             	sub    $0xc,%esp
+    2a1f:	50                   	push   %eax
+    2a20:	e8 b6 11 00 00       	call   3bdb <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2a25:	c7 04 24 f9 4c 00 00 	movl   $0x4cf9,(%esp)
+    2a2c:	e8 ea 11 00 00       	call   3c1b <mkdir>
+    2a31:	83 c4 10             	add    $0x10,%esp
+    2a34:	85 c0                	test   %eax,%eax
+    2a36:	74 4e                	je     2a86 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2a38:	83 ec 0c             	sub    $0xc,%esp
+    2a3b:	68 20 56 00 00       	push   $0x5620
+    2a40:	e8 d6 11 00 00       	call   3c1b <mkdir>
+    2a45:	83 c4 10             	add    $0x10,%esp
+    2a48:	85 c0                	test   %eax,%eax
+    2a4a:	74 27                	je     2a73 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    2a4c:	83 ec 08             	sub    $0x8,%esp
+    2a4f:	68 17 4d 00 00       	push   $0x4d17
+    2a54:	6a 01                	push   $0x1
+    2a56:	e8 f5 12 00 00       	call   3d50 <printf>
+}
+    2a5b:	83 c4 10             	add    $0x10,%esp
+    2a5e:	c9                   	leave
+    2a5f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2a60:	50                   	push   %eax
+    2a61:	50                   	push   %eax
+    2a62:	68 dc 4c 00 00       	push   $0x4cdc
+    2a67:	6a 01                	push   $0x1
+    2a69:	e8 e2 12 00 00       	call   3d50 <printf>
+    exit();
+    2a6e:	e8 40 11 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2a73:	50                   	push   %eax
+    2a74:	50                   	push   %eax
+    2a75:	68 40 56 00 00       	push   $0x5640
+    2a7a:	6a 01                	push   $0x1
+    2a7c:	e8 cf 12 00 00       	call   3d50 <printf>
+    exit();
+    2a81:	e8 2d 11 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2a86:	52                   	push   %edx
+    2a87:	52                   	push   %edx
+    2a88:	68 f0 55 00 00       	push   $0x55f0
+    2a8d:	6a 01                	push   $0x1
+    2a8f:	e8 bc 12 00 00       	call   3d50 <printf>
+    exit();
+    2a94:	e8 1a 11 00 00       	call   3bb3 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2a99:	51                   	push   %ecx
+    2a9a:	51                   	push   %ecx
+    2a9b:	68 b4 55 00 00       	push   $0x55b4
+    2aa0:	6a 01                	push   $0x1
+    2aa2:	e8 a9 12 00 00       	call   3d50 <printf>
+    exit();
+    2aa7:	e8 07 11 00 00       	call   3bb3 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2aac:	51                   	push   %ecx
+    2aad:	51                   	push   %ecx
+    2aae:	68 44 55 00 00       	push   $0x5544
+    2ab3:	6a 01                	push   $0x1
+    2ab5:	e8 96 12 00 00       	call   3d50 <printf>
+    exit();
+    2aba:	e8 f4 10 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2abf:	50                   	push   %eax
+    2ac0:	50                   	push   %eax
+    2ac1:	68 e4 54 00 00       	push   $0x54e4
+    2ac6:	6a 01                	push   $0x1
+    2ac8:	e8 83 12 00 00       	call   3d50 <printf>
+    exit();
+    2acd:	e8 e1 10 00 00       	call   3bb3 <exit>
+    2ad2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002ae0 <rmdot>:
+{
+    2ae0:	55                   	push   %ebp
+    2ae1:	89 e5                	mov    %esp,%ebp
+    2ae3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2ae6:	68 24 4d 00 00       	push   $0x4d24
+    2aeb:	6a 01                	push   $0x1
+    2aed:	e8 5e 12 00 00       	call   3d50 <printf>
+  if(mkdir("dots") != 0){
+    2af2:	c7 04 24 30 4d 00 00 	movl   $0x4d30,(%esp)
+    2af9:	e8 1d 11 00 00       	call   3c1b <mkdir>
+    2afe:	83 c4 10             	add    $0x10,%esp
+    2b01:	85 c0                	test   %eax,%eax
+    2b03:	0f 85 b0 00 00 00    	jne    2bb9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2b09:	83 ec 0c             	sub    $0xc,%esp
+    2b0c:	68 30 4d 00 00       	push   $0x4d30
+    2b11:	e8 0d 11 00 00       	call   3c23 <chdir>
+    2b16:	83 c4 10             	add    $0x10,%esp
+    2b19:	85 c0                	test   %eax,%eax
+    2b1b:	0f 85 1d 01 00 00    	jne    2c3e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2b21:	83 ec 0c             	sub    $0xc,%esp
+    2b24:	68 db 49 00 00       	push   $0x49db
+    2b29:	e8 d5 10 00 00       	call   3c03 <unlink>
+    2b2e:	83 c4 10             	add    $0x10,%esp
+    2b31:	85 c0                	test   %eax,%eax
+    2b33:	0f 84 f2 00 00 00    	je     2c2b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2b39:	83 ec 0c             	sub    $0xc,%esp
+    2b3c:	68 da 49 00 00       	push   $0x49da
+    2b41:	e8 bd 10 00 00       	call   3c03 <unlink>
+    2b46:	83 c4 10             	add    $0x10,%esp
+    2b49:	85 c0                	test   %eax,%eax
+    2b4b:	0f 84 c7 00 00 00    	je     2c18 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2b51:	83 ec 0c             	sub    $0xc,%esp
+    2b54:	68 c1 40 00 00       	push   $0x40c1
+    2b59:	e8 c5 10 00 00       	call   3c23 <chdir>
+    2b5e:	83 c4 10             	add    $0x10,%esp
+    2b61:	85 c0                	test   %eax,%eax
+    2b63:	0f 85 9c 00 00 00    	jne    2c05 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2b69:	83 ec 0c             	sub    $0xc,%esp
+    2b6c:	68 78 4d 00 00       	push   $0x4d78
+    2b71:	e8 8d 10 00 00       	call   3c03 <unlink>
+    2b76:	83 c4 10             	add    $0x10,%esp
+    2b79:	85 c0                	test   %eax,%eax
+    2b7b:	74 75                	je     2bf2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2b7d:	83 ec 0c             	sub    $0xc,%esp
+    2b80:	68 96 4d 00 00       	push   $0x4d96
+    2b85:	e8 79 10 00 00       	call   3c03 <unlink>
+    2b8a:	83 c4 10             	add    $0x10,%esp
+    2b8d:	85 c0                	test   %eax,%eax
+    2b8f:	74 4e                	je     2bdf <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2b91:	83 ec 0c             	sub    $0xc,%esp
+    2b94:	68 30 4d 00 00       	push   $0x4d30
+    2b99:	e8 65 10 00 00       	call   3c03 <unlink>
+    2b9e:	83 c4 10             	add    $0x10,%esp
+    2ba1:	85 c0                	test   %eax,%eax
+    2ba3:	75 27                	jne    2bcc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2ba5:	83 ec 08             	sub    $0x8,%esp
+    2ba8:	68 cb 4d 00 00       	push   $0x4dcb
+    2bad:	6a 01                	push   $0x1
+    2baf:	e8 9c 11 00 00       	call   3d50 <printf>
+}
+    2bb4:	83 c4 10             	add    $0x10,%esp
+    2bb7:	c9                   	leave
+    2bb8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2bb9:	50                   	push   %eax
+    2bba:	50                   	push   %eax
+    2bbb:	68 35 4d 00 00       	push   $0x4d35
+    2bc0:	6a 01                	push   $0x1
+    2bc2:	e8 89 11 00 00       	call   3d50 <printf>
+    exit();
+    2bc7:	e8 e7 0f 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dots failed!\n");
+    2bcc:	50                   	push   %eax
+    2bcd:	50                   	push   %eax
+    2bce:	68 b6 4d 00 00       	push   $0x4db6
+    2bd3:	6a 01                	push   $0x1
+    2bd5:	e8 76 11 00 00       	call   3d50 <printf>
+    exit();
+    2bda:	e8 d4 0f 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2bdf:	52                   	push   %edx
+    2be0:	52                   	push   %edx
+    2be1:	68 9e 4d 00 00       	push   $0x4d9e
+    2be6:	6a 01                	push   $0x1
+    2be8:	e8 63 11 00 00       	call   3d50 <printf>
+    exit();
+    2bed:	e8 c1 0f 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2bf2:	51                   	push   %ecx
+    2bf3:	51                   	push   %ecx
+    2bf4:	68 7f 4d 00 00       	push   $0x4d7f
+    2bf9:	6a 01                	push   $0x1
+    2bfb:	e8 50 11 00 00       	call   3d50 <printf>
+    exit();
+    2c00:	e8 ae 0f 00 00       	call   3bb3 <exit>
+    printf(1, "chdir / failed\n");
+    2c05:	50                   	push   %eax
+    2c06:	50                   	push   %eax
+    2c07:	68 c3 40 00 00       	push   $0x40c3
+    2c0c:	6a 01                	push   $0x1
+    2c0e:	e8 3d 11 00 00       	call   3d50 <printf>
+    exit();
+    2c13:	e8 9b 0f 00 00       	call   3bb3 <exit>
+    printf(1, "rm .. worked!\n");
+    2c18:	50                   	push   %eax
+    2c19:	50                   	push   %eax
+    2c1a:	68 69 4d 00 00       	push   $0x4d69
+    2c1f:	6a 01                	push   $0x1
+    2c21:	e8 2a 11 00 00       	call   3d50 <printf>
+    exit();
+    2c26:	e8 88 0f 00 00       	call   3bb3 <exit>
+    printf(1, "rm . worked!\n");
+    2c2b:	50                   	push   %eax
+    2c2c:	50                   	push   %eax
+    2c2d:	68 5b 4d 00 00       	push   $0x4d5b
+    2c32:	6a 01                	push   $0x1
+    2c34:	e8 17 11 00 00       	call   3d50 <printf>
+    exit();
+    2c39:	e8 75 0f 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dots failed\n");
+    2c3e:	50                   	push   %eax
+    2c3f:	50                   	push   %eax
+    2c40:	68 48 4d 00 00       	push   $0x4d48
+    2c45:	6a 01                	push   $0x1
+    2c47:	e8 04 11 00 00       	call   3d50 <printf>
+    exit();
+    2c4c:	e8 62 0f 00 00       	call   3bb3 <exit>
+    2c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c5f:	90                   	nop
+
+00002c60 <dirfile>:
+{
+    2c60:	55                   	push   %ebp
+    2c61:	89 e5                	mov    %esp,%ebp
+    2c63:	53                   	push   %ebx
+    2c64:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2c67:	68 d5 4d 00 00       	push   $0x4dd5
+    2c6c:	6a 01                	push   $0x1
+    2c6e:	e8 dd 10 00 00       	call   3d50 <printf>
+  fd = open("dirfile", O_CREATE);
+    2c73:	5b                   	pop    %ebx
+    2c74:	58                   	pop    %eax
+    2c75:	68 00 02 00 00       	push   $0x200
+    2c7a:	68 e2 4d 00 00       	push   $0x4de2
+    2c7f:	e8 6f 0f 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    2c84:	83 c4 10             	add    $0x10,%esp
+    2c87:	85 c0                	test   %eax,%eax
+    2c89:	0f 88 43 01 00 00    	js     2dd2 <dirfile+0x172>
+  close(fd);
+    2c8f:	83 ec 0c             	sub    $0xc,%esp
+    2c92:	50                   	push   %eax
+    2c93:	e8 43 0f 00 00       	call   3bdb <close>
+  if(chdir("dirfile") == 0){
+    2c98:	c7 04 24 e2 4d 00 00 	movl   $0x4de2,(%esp)
+    2c9f:	e8 7f 0f 00 00       	call   3c23 <chdir>
+    2ca4:	83 c4 10             	add    $0x10,%esp
+    2ca7:	85 c0                	test   %eax,%eax
+    2ca9:	0f 84 10 01 00 00    	je     2dbf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2caf:	83 ec 08             	sub    $0x8,%esp
+    2cb2:	6a 00                	push   $0x0
+    2cb4:	68 1b 4e 00 00       	push   $0x4e1b
+    2cb9:	e8 35 0f 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+    2cbe:	83 c4 10             	add    $0x10,%esp
+    2cc1:	85 c0                	test   %eax,%eax
+    2cc3:	0f 89 e3 00 00 00    	jns    2dac <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2cc9:	83 ec 08             	sub    $0x8,%esp
+    2ccc:	68 00 02 00 00       	push   $0x200
+    2cd1:	68 1b 4e 00 00       	push   $0x4e1b
+    2cd6:	e8 18 0f 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+    2cdb:	83 c4 10             	add    $0x10,%esp
+    2cde:	85 c0                	test   %eax,%eax
+    2ce0:	0f 89 c6 00 00 00    	jns    2dac <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2ce6:	83 ec 0c             	sub    $0xc,%esp
+    2ce9:	68 1b 4e 00 00       	push   $0x4e1b
+    2cee:	e8 28 0f 00 00       	call   3c1b <mkdir>
+    2cf3:	83 c4 10             	add    $0x10,%esp
+    2cf6:	85 c0                	test   %eax,%eax
+    2cf8:	0f 84 46 01 00 00    	je     2e44 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2cfe:	83 ec 0c             	sub    $0xc,%esp
+    2d01:	68 1b 4e 00 00       	push   $0x4e1b
+    2d06:	e8 f8 0e 00 00       	call   3c03 <unlink>
+    2d0b:	83 c4 10             	add    $0x10,%esp
+    2d0e:	85 c0                	test   %eax,%eax
+    2d10:	0f 84 1b 01 00 00    	je     2e31 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2d16:	83 ec 08             	sub    $0x8,%esp
+    2d19:	68 1b 4e 00 00       	push   $0x4e1b
+    2d1e:	68 7f 4e 00 00       	push   $0x4e7f
+    2d23:	e8 eb 0e 00 00       	call   3c13 <link>
+    2d28:	83 c4 10             	add    $0x10,%esp
+    2d2b:	85 c0                	test   %eax,%eax
+    2d2d:	0f 84 eb 00 00 00    	je     2e1e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2d33:	83 ec 0c             	sub    $0xc,%esp
+    2d36:	68 e2 4d 00 00       	push   $0x4de2
+    2d3b:	e8 c3 0e 00 00       	call   3c03 <unlink>
+    2d40:	83 c4 10             	add    $0x10,%esp
+    2d43:	85 c0                	test   %eax,%eax
+    2d45:	0f 85 c0 00 00 00    	jne    2e0b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2d4b:	83 ec 08             	sub    $0x8,%esp
+    2d4e:	6a 02                	push   $0x2
+    2d50:	68 db 49 00 00       	push   $0x49db
+    2d55:	e8 99 0e 00 00       	call   3bf3 <open>
+  if(fd >= 0){
+    2d5a:	83 c4 10             	add    $0x10,%esp
+    2d5d:	85 c0                	test   %eax,%eax
+    2d5f:	0f 89 93 00 00 00    	jns    2df8 <dirfile+0x198>
+  fd = open(".", 0);
+    2d65:	83 ec 08             	sub    $0x8,%esp
+    2d68:	6a 00                	push   $0x0
+    2d6a:	68 db 49 00 00       	push   $0x49db
+    2d6f:	e8 7f 0e 00 00       	call   3bf3 <open>
+  if(write(fd, "x", 1) > 0){
+    2d74:	83 c4 0c             	add    $0xc,%esp
+    2d77:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2d79:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2d7b:	68 be 4a 00 00       	push   $0x4abe
+    2d80:	50                   	push   %eax
+    2d81:	e8 4d 0e 00 00       	call   3bd3 <write>
+    2d86:	83 c4 10             	add    $0x10,%esp
+    2d89:	85 c0                	test   %eax,%eax
+    2d8b:	7f 58                	jg     2de5 <dirfile+0x185>
+  close(fd);
+    2d8d:	83 ec 0c             	sub    $0xc,%esp
+    2d90:	53                   	push   %ebx
+    2d91:	e8 45 0e 00 00       	call   3bdb <close>
+  printf(1, "dir vs file OK\n");
+    2d96:	58                   	pop    %eax
+    2d97:	5a                   	pop    %edx
+    2d98:	68 b2 4e 00 00       	push   $0x4eb2
+    2d9d:	6a 01                	push   $0x1
+    2d9f:	e8 ac 0f 00 00       	call   3d50 <printf>
+}
+    2da4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2da7:	83 c4 10             	add    $0x10,%esp
+    2daa:	c9                   	leave
+    2dab:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2dac:	50                   	push   %eax
+    2dad:	50                   	push   %eax
+    2dae:	68 26 4e 00 00       	push   $0x4e26
+    2db3:	6a 01                	push   $0x1
+    2db5:	e8 96 0f 00 00       	call   3d50 <printf>
+    exit();
+    2dba:	e8 f4 0d 00 00       	call   3bb3 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2dbf:	52                   	push   %edx
+    2dc0:	52                   	push   %edx
+    2dc1:	68 01 4e 00 00       	push   $0x4e01
+    2dc6:	6a 01                	push   $0x1
+    2dc8:	e8 83 0f 00 00       	call   3d50 <printf>
+    exit();
+    2dcd:	e8 e1 0d 00 00       	call   3bb3 <exit>
+    printf(1, "create dirfile failed\n");
+    2dd2:	51                   	push   %ecx
+    2dd3:	51                   	push   %ecx
+    2dd4:	68 ea 4d 00 00       	push   $0x4dea
+    2dd9:	6a 01                	push   $0x1
+    2ddb:	e8 70 0f 00 00       	call   3d50 <printf>
+    exit();
+    2de0:	e8 ce 0d 00 00       	call   3bb3 <exit>
+    printf(1, "write . succeeded!\n");
+    2de5:	51                   	push   %ecx
+    2de6:	51                   	push   %ecx
+    2de7:	68 9e 4e 00 00       	push   $0x4e9e
+    2dec:	6a 01                	push   $0x1
+    2dee:	e8 5d 0f 00 00       	call   3d50 <printf>
+    exit();
+    2df3:	e8 bb 0d 00 00       	call   3bb3 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2df8:	53                   	push   %ebx
+    2df9:	53                   	push   %ebx
+    2dfa:	68 94 56 00 00       	push   $0x5694
+    2dff:	6a 01                	push   $0x1
+    2e01:	e8 4a 0f 00 00       	call   3d50 <printf>
+    exit();
+    2e06:	e8 a8 0d 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2e0b:	50                   	push   %eax
+    2e0c:	50                   	push   %eax
+    2e0d:	68 86 4e 00 00       	push   $0x4e86
+    2e12:	6a 01                	push   $0x1
+    2e14:	e8 37 0f 00 00       	call   3d50 <printf>
+    exit();
+    2e19:	e8 95 0d 00 00       	call   3bb3 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2e1e:	50                   	push   %eax
+    2e1f:	50                   	push   %eax
+    2e20:	68 74 56 00 00       	push   $0x5674
+    2e25:	6a 01                	push   $0x1
+    2e27:	e8 24 0f 00 00       	call   3d50 <printf>
+    exit();
+    2e2c:	e8 82 0d 00 00       	call   3bb3 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2e31:	50                   	push   %eax
+    2e32:	50                   	push   %eax
+    2e33:	68 61 4e 00 00       	push   $0x4e61
+    2e38:	6a 01                	push   $0x1
+    2e3a:	e8 11 0f 00 00       	call   3d50 <printf>
+    exit();
+    2e3f:	e8 6f 0d 00 00       	call   3bb3 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2e44:	50                   	push   %eax
+    2e45:	50                   	push   %eax
+    2e46:	68 44 4e 00 00       	push   $0x4e44
+    2e4b:	6a 01                	push   $0x1
+    2e4d:	e8 fe 0e 00 00       	call   3d50 <printf>
+    exit();
+    2e52:	e8 5c 0d 00 00       	call   3bb3 <exit>
+    2e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e5e:	66 90                	xchg   %ax,%ax
+
+00002e60 <iref>:
+{
+    2e60:	55                   	push   %ebp
+    2e61:	89 e5                	mov    %esp,%ebp
+    2e63:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2e64:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2e69:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2e6c:	68 c2 4e 00 00       	push   $0x4ec2
+    2e71:	6a 01                	push   $0x1
+    2e73:	e8 d8 0e 00 00       	call   3d50 <printf>
+    2e78:	83 c4 10             	add    $0x10,%esp
+    2e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2e7f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2e80:	83 ec 0c             	sub    $0xc,%esp
+    2e83:	68 d3 4e 00 00       	push   $0x4ed3
+    2e88:	e8 8e 0d 00 00       	call   3c1b <mkdir>
+    2e8d:	83 c4 10             	add    $0x10,%esp
+    2e90:	85 c0                	test   %eax,%eax
+    2e92:	0f 85 bb 00 00 00    	jne    2f53 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2e98:	83 ec 0c             	sub    $0xc,%esp
+    2e9b:	68 d3 4e 00 00       	push   $0x4ed3
+    2ea0:	e8 7e 0d 00 00       	call   3c23 <chdir>
+    2ea5:	83 c4 10             	add    $0x10,%esp
+    2ea8:	85 c0                	test   %eax,%eax
+    2eaa:	0f 85 b7 00 00 00    	jne    2f67 <iref+0x107>
+    mkdir("");
+    2eb0:	83 ec 0c             	sub    $0xc,%esp
+    2eb3:	68 88 45 00 00       	push   $0x4588
+    2eb8:	e8 5e 0d 00 00       	call   3c1b <mkdir>
+    link("README", "");
+    2ebd:	59                   	pop    %ecx
+    2ebe:	58                   	pop    %eax
+    2ebf:	68 88 45 00 00       	push   $0x4588
+    2ec4:	68 7f 4e 00 00       	push   $0x4e7f
+    2ec9:	e8 45 0d 00 00       	call   3c13 <link>
+    fd = open("", O_CREATE);
+    2ece:	58                   	pop    %eax
+    2ecf:	5a                   	pop    %edx
+    2ed0:	68 00 02 00 00       	push   $0x200
+    2ed5:	68 88 45 00 00       	push   $0x4588
+    2eda:	e8 14 0d 00 00       	call   3bf3 <open>
+    if(fd >= 0)
+    2edf:	83 c4 10             	add    $0x10,%esp
+    2ee2:	85 c0                	test   %eax,%eax
+    2ee4:	78 0c                	js     2ef2 <iref+0x92>
+      close(fd);
+    2ee6:	83 ec 0c             	sub    $0xc,%esp
+    2ee9:	50                   	push   %eax
+    2eea:	e8 ec 0c 00 00       	call   3bdb <close>
+    2eef:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2ef2:	83 ec 08             	sub    $0x8,%esp
+    2ef5:	68 00 02 00 00       	push   $0x200
+    2efa:	68 bd 4a 00 00       	push   $0x4abd
+    2eff:	e8 ef 0c 00 00       	call   3bf3 <open>
+    if(fd >= 0)
+    2f04:	83 c4 10             	add    $0x10,%esp
+    2f07:	85 c0                	test   %eax,%eax
+    2f09:	78 0c                	js     2f17 <iref+0xb7>
+      close(fd);
+    2f0b:	83 ec 0c             	sub    $0xc,%esp
+    2f0e:	50                   	push   %eax
+    2f0f:	e8 c7 0c 00 00       	call   3bdb <close>
+    2f14:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2f17:	83 ec 0c             	sub    $0xc,%esp
+    2f1a:	68 bd 4a 00 00       	push   $0x4abd
+    2f1f:	e8 df 0c 00 00       	call   3c03 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2f24:	83 c4 10             	add    $0x10,%esp
+    2f27:	83 eb 01             	sub    $0x1,%ebx
+    2f2a:	0f 85 50 ff ff ff    	jne    2e80 <iref+0x20>
+  chdir("/");
+    2f30:	83 ec 0c             	sub    $0xc,%esp
+    2f33:	68 c1 40 00 00       	push   $0x40c1
+    2f38:	e8 e6 0c 00 00       	call   3c23 <chdir>
+  printf(1, "empty file name OK\n");
+    2f3d:	58                   	pop    %eax
+    2f3e:	5a                   	pop    %edx
+    2f3f:	68 01 4f 00 00       	push   $0x4f01
+    2f44:	6a 01                	push   $0x1
+    2f46:	e8 05 0e 00 00       	call   3d50 <printf>
+}
+    2f4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f4e:	83 c4 10             	add    $0x10,%esp
+    2f51:	c9                   	leave
+    2f52:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2f53:	83 ec 08             	sub    $0x8,%esp
+    2f56:	68 d9 4e 00 00       	push   $0x4ed9
+    2f5b:	6a 01                	push   $0x1
+    2f5d:	e8 ee 0d 00 00       	call   3d50 <printf>
+      exit();
+    2f62:	e8 4c 0c 00 00       	call   3bb3 <exit>
+      printf(1, "chdir irefd failed\n");
+    2f67:	83 ec 08             	sub    $0x8,%esp
+    2f6a:	68 ed 4e 00 00       	push   $0x4eed
+    2f6f:	6a 01                	push   $0x1
+    2f71:	e8 da 0d 00 00       	call   3d50 <printf>
+      exit();
+    2f76:	e8 38 0c 00 00       	call   3bb3 <exit>
+    2f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2f7f:	90                   	nop
+
+00002f80 <forktest>:
+{
+    2f80:	55                   	push   %ebp
+    2f81:	89 e5                	mov    %esp,%ebp
+    2f83:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2f84:	31 db                	xor    %ebx,%ebx
+{
+    2f86:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2f89:	68 15 4f 00 00       	push   $0x4f15
+    2f8e:	6a 01                	push   $0x1
+    2f90:	e8 bb 0d 00 00       	call   3d50 <printf>
+    2f95:	83 c4 10             	add    $0x10,%esp
+    2f98:	eb 13                	jmp    2fad <forktest+0x2d>
+    2f9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2fa0:	74 4d                	je     2fef <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2fa2:	83 c3 01             	add    $0x1,%ebx
+    2fa5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2fab:	74 6e                	je     301b <forktest+0x9b>
+    pid = fork();
+    2fad:	e8 f9 0b 00 00       	call   3bab <fork>
+    if(pid < 0)
+    2fb2:	85 c0                	test   %eax,%eax
+    2fb4:	79 ea                	jns    2fa0 <forktest+0x20>
+  for(; n > 0; n--){
+    2fb6:	85 db                	test   %ebx,%ebx
+    2fb8:	74 14                	je     2fce <forktest+0x4e>
+    2fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2fc0:	e8 f6 0b 00 00       	call   3bbb <wait>
+    2fc5:	85 c0                	test   %eax,%eax
+    2fc7:	78 2b                	js     2ff4 <forktest+0x74>
+  for(; n > 0; n--){
+    2fc9:	83 eb 01             	sub    $0x1,%ebx
+    2fcc:	75 f2                	jne    2fc0 <forktest+0x40>
+  if(wait() != -1){
+    2fce:	e8 e8 0b 00 00       	call   3bbb <wait>
+    2fd3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fd6:	75 30                	jne    3008 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2fd8:	83 ec 08             	sub    $0x8,%esp
+    2fdb:	68 47 4f 00 00       	push   $0x4f47
+    2fe0:	6a 01                	push   $0x1
+    2fe2:	e8 69 0d 00 00       	call   3d50 <printf>
+}
+    2fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2fea:	83 c4 10             	add    $0x10,%esp
+    2fed:	c9                   	leave
+    2fee:	c3                   	ret
+      exit();
+    2fef:	e8 bf 0b 00 00       	call   3bb3 <exit>
+      printf(1, "wait stopped early\n");
+    2ff4:	83 ec 08             	sub    $0x8,%esp
+    2ff7:	68 20 4f 00 00       	push   $0x4f20
+    2ffc:	6a 01                	push   $0x1
+    2ffe:	e8 4d 0d 00 00       	call   3d50 <printf>
+      exit();
+    3003:	e8 ab 0b 00 00       	call   3bb3 <exit>
+    printf(1, "wait got too many\n");
+    3008:	50                   	push   %eax
+    3009:	50                   	push   %eax
+    300a:	68 34 4f 00 00       	push   $0x4f34
+    300f:	6a 01                	push   $0x1
+    3011:	e8 3a 0d 00 00       	call   3d50 <printf>
+    exit();
+    3016:	e8 98 0b 00 00       	call   3bb3 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    301b:	52                   	push   %edx
+    301c:	52                   	push   %edx
+    301d:	68 b4 56 00 00       	push   $0x56b4
+    3022:	6a 01                	push   $0x1
+    3024:	e8 27 0d 00 00       	call   3d50 <printf>
+    exit();
+    3029:	e8 85 0b 00 00       	call   3bb3 <exit>
+    302e:	66 90                	xchg   %ax,%ax
+
+00003030 <sbrktest>:
+{
+    3030:	55                   	push   %ebp
+    3031:	89 e5                	mov    %esp,%ebp
+    3033:	57                   	push   %edi
+    3034:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3035:	31 f6                	xor    %esi,%esi
+{
+    3037:	53                   	push   %ebx
+    3038:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    303b:	68 55 4f 00 00       	push   $0x4f55
+    3040:	ff 35 74 62 00 00    	push   0x6274
+    3046:	e8 05 0d 00 00       	call   3d50 <printf>
+  oldbrk = sbrk(0);
+    304b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3052:	e8 e4 0b 00 00       	call   3c3b <sbrk>
+    3057:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    305a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3061:	e8 d5 0b 00 00       	call   3c3b <sbrk>
+    3066:	83 c4 10             	add    $0x10,%esp
+    3069:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    306b:	eb 05                	jmp    3072 <sbrktest+0x42>
+    306d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3070:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3072:	83 ec 0c             	sub    $0xc,%esp
+    3075:	6a 01                	push   $0x1
+    3077:	e8 bf 0b 00 00       	call   3c3b <sbrk>
+    if(b != a){
+    307c:	83 c4 10             	add    $0x10,%esp
+    307f:	39 d8                	cmp    %ebx,%eax
+    3081:	0f 85 9c 02 00 00    	jne    3323 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3087:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    308a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    308d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3090:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3096:	75 d8                	jne    3070 <sbrktest+0x40>
+  pid = fork();
+    3098:	e8 0e 0b 00 00       	call   3bab <fork>
+    309d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    309f:	85 c0                	test   %eax,%eax
+    30a1:	0f 88 02 03 00 00    	js     33a9 <sbrktest+0x379>
+  c = sbrk(1);
+    30a7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    30aa:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    30ad:	6a 01                	push   $0x1
+    30af:	e8 87 0b 00 00       	call   3c3b <sbrk>
+  c = sbrk(1);
+    30b4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    30bb:	e8 7b 0b 00 00       	call   3c3b <sbrk>
+  if(c != a + 1){
+    30c0:	83 c4 10             	add    $0x10,%esp
+    30c3:	39 c3                	cmp    %eax,%ebx
+    30c5:	0f 85 3b 03 00 00    	jne    3406 <sbrktest+0x3d6>
+  if(pid == 0)
+    30cb:	85 f6                	test   %esi,%esi
+    30cd:	0f 84 2e 03 00 00    	je     3401 <sbrktest+0x3d1>
+  wait();
+    30d3:	e8 e3 0a 00 00       	call   3bbb <wait>
+  a = sbrk(0);
+    30d8:	83 ec 0c             	sub    $0xc,%esp
+    30db:	6a 00                	push   $0x0
+    30dd:	e8 59 0b 00 00       	call   3c3b <sbrk>
+    30e2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    30e4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    30e9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    30eb:	89 04 24             	mov    %eax,(%esp)
+    30ee:	e8 48 0b 00 00       	call   3c3b <sbrk>
+  if (p != a) {
+    30f3:	83 c4 10             	add    $0x10,%esp
+    30f6:	39 c3                	cmp    %eax,%ebx
+    30f8:	0f 85 94 02 00 00    	jne    3392 <sbrktest+0x362>
+  a = sbrk(0);
+    30fe:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3101:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3108:	6a 00                	push   $0x0
+    310a:	e8 2c 0b 00 00       	call   3c3b <sbrk>
+  c = sbrk(-4096);
+    310f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3116:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3118:	e8 1e 0b 00 00       	call   3c3b <sbrk>
+  if(c == (char*)0xffffffff){
+    311d:	83 c4 10             	add    $0x10,%esp
+    3120:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3123:	0f 84 22 03 00 00    	je     344b <sbrktest+0x41b>
+  c = sbrk(0);
+    3129:	83 ec 0c             	sub    $0xc,%esp
+    312c:	6a 00                	push   $0x0
+    312e:	e8 08 0b 00 00       	call   3c3b <sbrk>
+  if(c != a - 4096){
+    3133:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3139:	83 c4 10             	add    $0x10,%esp
+    313c:	39 d0                	cmp    %edx,%eax
+    313e:	0f 85 f0 02 00 00    	jne    3434 <sbrktest+0x404>
+  a = sbrk(0);
+    3144:	83 ec 0c             	sub    $0xc,%esp
+    3147:	6a 00                	push   $0x0
+    3149:	e8 ed 0a 00 00       	call   3c3b <sbrk>
+  c = sbrk(4096);
+    314e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3155:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3157:	e8 df 0a 00 00       	call   3c3b <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    315c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    315f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3161:	39 c3                	cmp    %eax,%ebx
+    3163:	0f 85 b4 02 00 00    	jne    341d <sbrktest+0x3ed>
+    3169:	83 ec 0c             	sub    $0xc,%esp
+    316c:	6a 00                	push   $0x0
+    316e:	e8 c8 0a 00 00       	call   3c3b <sbrk>
+    3173:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3179:	83 c4 10             	add    $0x10,%esp
+    317c:	39 c2                	cmp    %eax,%edx
+    317e:	0f 85 99 02 00 00    	jne    341d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3184:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    318b:	0f 84 2f 02 00 00    	je     33c0 <sbrktest+0x390>
+  a = sbrk(0);
+    3191:	83 ec 0c             	sub    $0xc,%esp
+    3194:	6a 00                	push   $0x0
+    3196:	e8 a0 0a 00 00       	call   3c3b <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    319b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    31a2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    31a4:	e8 92 0a 00 00       	call   3c3b <sbrk>
+    31a9:	89 c2                	mov    %eax,%edx
+    31ab:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    31ae:	29 d0                	sub    %edx,%eax
+    31b0:	89 04 24             	mov    %eax,(%esp)
+    31b3:	e8 83 0a 00 00       	call   3c3b <sbrk>
+  if(c != a){
+    31b8:	83 c4 10             	add    $0x10,%esp
+    31bb:	39 c3                	cmp    %eax,%ebx
+    31bd:	0f 85 b8 01 00 00    	jne    337b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    31c3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    31c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31cf:	90                   	nop
+    ppid = getpid();
+    31d0:	e8 5e 0a 00 00       	call   3c33 <getpid>
+    31d5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    31d7:	e8 cf 09 00 00       	call   3bab <fork>
+    if(pid < 0){
+    31dc:	85 c0                	test   %eax,%eax
+    31de:	0f 88 5d 01 00 00    	js     3341 <sbrktest+0x311>
+    if(pid == 0){
+    31e4:	0f 84 6f 01 00 00    	je     3359 <sbrktest+0x329>
+    wait();
+    31ea:	e8 cc 09 00 00       	call   3bbb <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    31ef:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    31f5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    31fb:	75 d3                	jne    31d0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    31fd:	83 ec 0c             	sub    $0xc,%esp
+    3200:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3203:	50                   	push   %eax
+    3204:	e8 ba 09 00 00       	call   3bc3 <pipe>
+    3209:	83 c4 10             	add    $0x10,%esp
+    320c:	85 c0                	test   %eax,%eax
+    320e:	0f 85 da 01 00 00    	jne    33ee <sbrktest+0x3be>
+    3214:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3217:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    321a:	89 df                	mov    %ebx,%edi
+    321c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3220:	e8 86 09 00 00       	call   3bab <fork>
+    3225:	89 07                	mov    %eax,(%edi)
+    3227:	85 c0                	test   %eax,%eax
+    3229:	0f 84 91 00 00 00    	je     32c0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    322f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3232:	74 14                	je     3248 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3234:	83 ec 04             	sub    $0x4,%esp
+    3237:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    323a:	6a 01                	push   $0x1
+    323c:	50                   	push   %eax
+    323d:	ff 75 b8             	push   -0x48(%ebp)
+    3240:	e8 86 09 00 00       	call   3bcb <read>
+    3245:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3248:	83 c7 04             	add    $0x4,%edi
+    324b:	39 f7                	cmp    %esi,%edi
+    324d:	75 d1                	jne    3220 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    324f:	83 ec 0c             	sub    $0xc,%esp
+    3252:	68 00 10 00 00       	push   $0x1000
+    3257:	e8 df 09 00 00       	call   3c3b <sbrk>
+    325c:	83 c4 10             	add    $0x10,%esp
+    325f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3268:	8b 03                	mov    (%ebx),%eax
+    326a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    326d:	74 11                	je     3280 <sbrktest+0x250>
+    kill(pids[i]);
+    326f:	83 ec 0c             	sub    $0xc,%esp
+    3272:	50                   	push   %eax
+    3273:	e8 6b 09 00 00       	call   3be3 <kill>
+    wait();
+    3278:	e8 3e 09 00 00       	call   3bbb <wait>
+    327d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3280:	83 c3 04             	add    $0x4,%ebx
+    3283:	39 f3                	cmp    %esi,%ebx
+    3285:	75 e1                	jne    3268 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3287:	83 ff ff             	cmp    $0xffffffff,%edi
+    328a:	0f 84 47 01 00 00    	je     33d7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3290:	83 ec 0c             	sub    $0xc,%esp
+    3293:	6a 00                	push   $0x0
+    3295:	e8 a1 09 00 00       	call   3c3b <sbrk>
+    329a:	83 c4 10             	add    $0x10,%esp
+    329d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    32a0:	72 60                	jb     3302 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    32a2:	83 ec 08             	sub    $0x8,%esp
+    32a5:	68 fd 4f 00 00       	push   $0x4ffd
+    32aa:	ff 35 74 62 00 00    	push   0x6274
+    32b0:	e8 9b 0a 00 00       	call   3d50 <printf>
+}
+    32b5:	83 c4 10             	add    $0x10,%esp
+    32b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    32bb:	5b                   	pop    %ebx
+    32bc:	5e                   	pop    %esi
+    32bd:	5f                   	pop    %edi
+    32be:	5d                   	pop    %ebp
+    32bf:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    32c0:	83 ec 0c             	sub    $0xc,%esp
+    32c3:	6a 00                	push   $0x0
+    32c5:	e8 71 09 00 00       	call   3c3b <sbrk>
+    32ca:	89 c2                	mov    %eax,%edx
+    32cc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    32d1:	29 d0                	sub    %edx,%eax
+    32d3:	89 04 24             	mov    %eax,(%esp)
+    32d6:	e8 60 09 00 00       	call   3c3b <sbrk>
+      write(fds[1], "x", 1);
+    32db:	83 c4 0c             	add    $0xc,%esp
+    32de:	6a 01                	push   $0x1
+    32e0:	68 be 4a 00 00       	push   $0x4abe
+    32e5:	ff 75 bc             	push   -0x44(%ebp)
+    32e8:	e8 e6 08 00 00       	call   3bd3 <write>
+    32ed:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    32f0:	83 ec 0c             	sub    $0xc,%esp
+    32f3:	68 e8 03 00 00       	push   $0x3e8
+    32f8:	e8 46 09 00 00       	call   3c43 <sleep>
+    32fd:	83 c4 10             	add    $0x10,%esp
+    3300:	eb ee                	jmp    32f0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3302:	83 ec 0c             	sub    $0xc,%esp
+    3305:	6a 00                	push   $0x0
+    3307:	e8 2f 09 00 00       	call   3c3b <sbrk>
+    330c:	89 c2                	mov    %eax,%edx
+    330e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3311:	29 d0                	sub    %edx,%eax
+    3313:	89 04 24             	mov    %eax,(%esp)
+    3316:	e8 20 09 00 00       	call   3c3b <sbrk>
+    331b:	83 c4 10             	add    $0x10,%esp
+    331e:	e9 7f ff ff ff       	jmp    32a2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3323:	83 ec 0c             	sub    $0xc,%esp
+    3326:	50                   	push   %eax
+    3327:	53                   	push   %ebx
+    3328:	56                   	push   %esi
+    3329:	68 60 4f 00 00       	push   $0x4f60
+    332e:	ff 35 74 62 00 00    	push   0x6274
+    3334:	e8 17 0a 00 00       	call   3d50 <printf>
+      exit();
+    3339:	83 c4 20             	add    $0x20,%esp
+    333c:	e8 72 08 00 00       	call   3bb3 <exit>
+      printf(stdout, "fork failed\n");
+    3341:	83 ec 08             	sub    $0x8,%esp
+    3344:	68 a6 50 00 00       	push   $0x50a6
+    3349:	ff 35 74 62 00 00    	push   0x6274
+    334f:	e8 fc 09 00 00       	call   3d50 <printf>
+      exit();
+    3354:	e8 5a 08 00 00       	call   3bb3 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3359:	0f be 03             	movsbl (%ebx),%eax
+    335c:	50                   	push   %eax
+    335d:	53                   	push   %ebx
+    335e:	68 c9 4f 00 00       	push   $0x4fc9
+    3363:	ff 35 74 62 00 00    	push   0x6274
+    3369:	e8 e2 09 00 00       	call   3d50 <printf>
+      kill(ppid);
+    336e:	89 34 24             	mov    %esi,(%esp)
+    3371:	e8 6d 08 00 00       	call   3be3 <kill>
+      exit();
+    3376:	e8 38 08 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    337b:	50                   	push   %eax
+    337c:	53                   	push   %ebx
+    337d:	68 a8 57 00 00       	push   $0x57a8
+    3382:	ff 35 74 62 00 00    	push   0x6274
+    3388:	e8 c3 09 00 00       	call   3d50 <printf>
+    exit();
+    338d:	e8 21 08 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3392:	56                   	push   %esi
+    3393:	56                   	push   %esi
+    3394:	68 d8 56 00 00       	push   $0x56d8
+    3399:	ff 35 74 62 00 00    	push   0x6274
+    339f:	e8 ac 09 00 00       	call   3d50 <printf>
+    exit();
+    33a4:	e8 0a 08 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    33a9:	50                   	push   %eax
+    33aa:	50                   	push   %eax
+    33ab:	68 7b 4f 00 00       	push   $0x4f7b
+    33b0:	ff 35 74 62 00 00    	push   0x6274
+    33b6:	e8 95 09 00 00       	call   3d50 <printf>
+    exit();
+    33bb:	e8 f3 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    33c0:	51                   	push   %ecx
+    33c1:	51                   	push   %ecx
+    33c2:	68 78 57 00 00       	push   $0x5778
+    33c7:	ff 35 74 62 00 00    	push   0x6274
+    33cd:	e8 7e 09 00 00       	call   3d50 <printf>
+    exit();
+    33d2:	e8 dc 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    33d7:	50                   	push   %eax
+    33d8:	50                   	push   %eax
+    33d9:	68 e2 4f 00 00       	push   $0x4fe2
+    33de:	ff 35 74 62 00 00    	push   0x6274
+    33e4:	e8 67 09 00 00       	call   3d50 <printf>
+    exit();
+    33e9:	e8 c5 07 00 00       	call   3bb3 <exit>
+    printf(1, "pipe() failed\n");
+    33ee:	52                   	push   %edx
+    33ef:	52                   	push   %edx
+    33f0:	68 b1 43 00 00       	push   $0x43b1
+    33f5:	6a 01                	push   $0x1
+    33f7:	e8 54 09 00 00       	call   3d50 <printf>
+    exit();
+    33fc:	e8 b2 07 00 00       	call   3bb3 <exit>
+    exit();
+    3401:	e8 ad 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3406:	57                   	push   %edi
+    3407:	57                   	push   %edi
+    3408:	68 92 4f 00 00       	push   $0x4f92
+    340d:	ff 35 74 62 00 00    	push   0x6274
+    3413:	e8 38 09 00 00       	call   3d50 <printf>
+    exit();
+    3418:	e8 96 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    341d:	56                   	push   %esi
+    341e:	53                   	push   %ebx
+    341f:	68 50 57 00 00       	push   $0x5750
+    3424:	ff 35 74 62 00 00    	push   0x6274
+    342a:	e8 21 09 00 00       	call   3d50 <printf>
+    exit();
+    342f:	e8 7f 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3434:	50                   	push   %eax
+    3435:	53                   	push   %ebx
+    3436:	68 18 57 00 00       	push   $0x5718
+    343b:	ff 35 74 62 00 00    	push   0x6274
+    3441:	e8 0a 09 00 00       	call   3d50 <printf>
+    exit();
+    3446:	e8 68 07 00 00       	call   3bb3 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    344b:	53                   	push   %ebx
+    344c:	53                   	push   %ebx
+    344d:	68 ae 4f 00 00       	push   $0x4fae
+    3452:	ff 35 74 62 00 00    	push   0x6274
+    3458:	e8 f3 08 00 00       	call   3d50 <printf>
+    exit();
+    345d:	e8 51 07 00 00       	call   3bb3 <exit>
+    3462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003470 <validateint>:
+}
+    3470:	c3                   	ret
+    3471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    347f:	90                   	nop
+
+00003480 <validatetest>:
+{
+    3480:	55                   	push   %ebp
+    3481:	89 e5                	mov    %esp,%ebp
+    3483:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3484:	31 f6                	xor    %esi,%esi
+{
+    3486:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3487:	83 ec 08             	sub    $0x8,%esp
+    348a:	68 0b 50 00 00       	push   $0x500b
+    348f:	ff 35 74 62 00 00    	push   0x6274
+    3495:	e8 b6 08 00 00       	call   3d50 <printf>
+    349a:	83 c4 10             	add    $0x10,%esp
+    349d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    34a0:	e8 06 07 00 00       	call   3bab <fork>
+    34a5:	89 c3                	mov    %eax,%ebx
+    34a7:	85 c0                	test   %eax,%eax
+    34a9:	74 63                	je     350e <validatetest+0x8e>
+    sleep(0);
+    34ab:	83 ec 0c             	sub    $0xc,%esp
+    34ae:	6a 00                	push   $0x0
+    34b0:	e8 8e 07 00 00       	call   3c43 <sleep>
+    sleep(0);
+    34b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    34bc:	e8 82 07 00 00       	call   3c43 <sleep>
+    kill(pid);
+    34c1:	89 1c 24             	mov    %ebx,(%esp)
+    34c4:	e8 1a 07 00 00       	call   3be3 <kill>
+    wait();
+    34c9:	e8 ed 06 00 00       	call   3bbb <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    34ce:	58                   	pop    %eax
+    34cf:	5a                   	pop    %edx
+    34d0:	56                   	push   %esi
+    34d1:	68 1a 50 00 00       	push   $0x501a
+    34d6:	e8 38 07 00 00       	call   3c13 <link>
+    34db:	83 c4 10             	add    $0x10,%esp
+    34de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    34e1:	75 30                	jne    3513 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    34e3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    34e9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    34ef:	75 af                	jne    34a0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    34f1:	83 ec 08             	sub    $0x8,%esp
+    34f4:	68 3e 50 00 00       	push   $0x503e
+    34f9:	ff 35 74 62 00 00    	push   0x6274
+    34ff:	e8 4c 08 00 00       	call   3d50 <printf>
+}
+    3504:	83 c4 10             	add    $0x10,%esp
+    3507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    350a:	5b                   	pop    %ebx
+    350b:	5e                   	pop    %esi
+    350c:	5d                   	pop    %ebp
+    350d:	c3                   	ret
+      exit();
+    350e:	e8 a0 06 00 00       	call   3bb3 <exit>
+      printf(stdout, "link should not succeed\n");
+    3513:	83 ec 08             	sub    $0x8,%esp
+    3516:	68 25 50 00 00       	push   $0x5025
+    351b:	ff 35 74 62 00 00    	push   0x6274
+    3521:	e8 2a 08 00 00       	call   3d50 <printf>
+      exit();
+    3526:	e8 88 06 00 00       	call   3bb3 <exit>
+    352b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    352f:	90                   	nop
+
+00003530 <bsstest>:
+{
+    3530:	55                   	push   %ebp
+    3531:	89 e5                	mov    %esp,%ebp
+    3533:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3536:	68 4b 50 00 00       	push   $0x504b
+    353b:	ff 35 74 62 00 00    	push   0x6274
+    3541:	e8 0a 08 00 00       	call   3d50 <printf>
+    3546:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3549:	31 c0                	xor    %eax,%eax
+    354b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    354f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3550:	80 b8 a0 62 00 00 00 	cmpb   $0x0,0x62a0(%eax)
+    3557:	75 22                	jne    357b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3559:	83 c0 01             	add    $0x1,%eax
+    355c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3561:	75 ed                	jne    3550 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3563:	83 ec 08             	sub    $0x8,%esp
+    3566:	68 66 50 00 00       	push   $0x5066
+    356b:	ff 35 74 62 00 00    	push   0x6274
+    3571:	e8 da 07 00 00       	call   3d50 <printf>
+}
+    3576:	83 c4 10             	add    $0x10,%esp
+    3579:	c9                   	leave
+    357a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    357b:	83 ec 08             	sub    $0x8,%esp
+    357e:	68 55 50 00 00       	push   $0x5055
+    3583:	ff 35 74 62 00 00    	push   0x6274
+    3589:	e8 c2 07 00 00       	call   3d50 <printf>
+      exit();
+    358e:	e8 20 06 00 00       	call   3bb3 <exit>
+    3593:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    359a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000035a0 <bigargtest>:
+{
+    35a0:	55                   	push   %ebp
+    35a1:	89 e5                	mov    %esp,%ebp
+    35a3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    35a6:	68 73 50 00 00       	push   $0x5073
+    35ab:	e8 53 06 00 00       	call   3c03 <unlink>
+  pid = fork();
+    35b0:	e8 f6 05 00 00       	call   3bab <fork>
+  if(pid == 0){
+    35b5:	83 c4 10             	add    $0x10,%esp
+    35b8:	85 c0                	test   %eax,%eax
+    35ba:	74 44                	je     3600 <bigargtest+0x60>
+  } else if(pid < 0){
+    35bc:	0f 88 c3 00 00 00    	js     3685 <bigargtest+0xe5>
+  wait();
+    35c2:	e8 f4 05 00 00       	call   3bbb <wait>
+  fd = open("bigarg-ok", 0);
+    35c7:	83 ec 08             	sub    $0x8,%esp
+    35ca:	6a 00                	push   $0x0
+    35cc:	68 73 50 00 00       	push   $0x5073
+    35d1:	e8 1d 06 00 00       	call   3bf3 <open>
+  if(fd < 0){
+    35d6:	83 c4 10             	add    $0x10,%esp
+    35d9:	85 c0                	test   %eax,%eax
+    35db:	0f 88 8d 00 00 00    	js     366e <bigargtest+0xce>
+  close(fd);
+    35e1:	83 ec 0c             	sub    $0xc,%esp
+    35e4:	50                   	push   %eax
+    35e5:	e8 f1 05 00 00       	call   3bdb <close>
+  unlink("bigarg-ok");
+    35ea:	c7 04 24 73 50 00 00 	movl   $0x5073,(%esp)
+    35f1:	e8 0d 06 00 00       	call   3c03 <unlink>
+}
+    35f6:	83 c4 10             	add    $0x10,%esp
+    35f9:	c9                   	leave
+    35fa:	c3                   	ret
+    35fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    35ff:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3600:	c7 04 85 c0 a9 00 00 	movl   $0x57cc,0xa9c0(,%eax,4)
+    3607:	cc 57 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    360b:	83 c0 01             	add    $0x1,%eax
+    360e:	83 f8 1f             	cmp    $0x1f,%eax
+    3611:	75 ed                	jne    3600 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3613:	31 c9                	xor    %ecx,%ecx
+    3615:	89 0d 3c aa 00 00    	mov    %ecx,0xaa3c
+    printf(stdout, "bigarg test\n");
+    361b:	50                   	push   %eax
+    361c:	50                   	push   %eax
+    361d:	68 7d 50 00 00       	push   $0x507d
+    3622:	ff 35 74 62 00 00    	push   0x6274
+    3628:	e8 23 07 00 00       	call   3d50 <printf>
+    exec("echo", args);
+    362d:	58                   	pop    %eax
+    362e:	5a                   	pop    %edx
+    362f:	68 c0 a9 00 00       	push   $0xa9c0
+    3634:	68 5d 41 00 00       	push   $0x415d
+    3639:	e8 ad 05 00 00       	call   3beb <exec>
+    printf(stdout, "bigarg test ok\n");
+    363e:	59                   	pop    %ecx
+    363f:	58                   	pop    %eax
+    3640:	68 8a 50 00 00       	push   $0x508a
+    3645:	ff 35 74 62 00 00    	push   0x6274
+    364b:	e8 00 07 00 00       	call   3d50 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3650:	58                   	pop    %eax
+    3651:	5a                   	pop    %edx
+    3652:	68 00 02 00 00       	push   $0x200
+    3657:	68 73 50 00 00       	push   $0x5073
+    365c:	e8 92 05 00 00       	call   3bf3 <open>
+    close(fd);
+    3661:	89 04 24             	mov    %eax,(%esp)
+    3664:	e8 72 05 00 00       	call   3bdb <close>
+    exit();
+    3669:	e8 45 05 00 00       	call   3bb3 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    366e:	50                   	push   %eax
+    366f:	50                   	push   %eax
+    3670:	68 b3 50 00 00       	push   $0x50b3
+    3675:	ff 35 74 62 00 00    	push   0x6274
+    367b:	e8 d0 06 00 00       	call   3d50 <printf>
+    exit();
+    3680:	e8 2e 05 00 00       	call   3bb3 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3685:	52                   	push   %edx
+    3686:	52                   	push   %edx
+    3687:	68 9a 50 00 00       	push   $0x509a
+    368c:	ff 35 74 62 00 00    	push   0x6274
+    3692:	e8 b9 06 00 00       	call   3d50 <printf>
+    exit();
+    3697:	e8 17 05 00 00       	call   3bb3 <exit>
+    369c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000036a0 <fsfull>:
+{
+    36a0:	55                   	push   %ebp
+    36a1:	89 e5                	mov    %esp,%ebp
+    36a3:	57                   	push   %edi
+    36a4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    36a5:	31 f6                	xor    %esi,%esi
+{
+    36a7:	53                   	push   %ebx
+    36a8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    36ab:	68 c8 50 00 00       	push   $0x50c8
+    36b0:	6a 01                	push   $0x1
+    36b2:	e8 99 06 00 00       	call   3d50 <printf>
+    36b7:	83 c4 10             	add    $0x10,%esp
+    36ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    36c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    36c5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    36ca:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    36cd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    36d1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    36d3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    36d7:	c1 ea 06             	shr    $0x6,%edx
+    36da:	8d 42 30             	lea    0x30(%edx),%eax
+    36dd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    36e0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    36e6:	89 f2                	mov    %esi,%edx
+    36e8:	29 c2                	sub    %eax,%edx
+    36ea:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    36ef:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    36f1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    36f6:	c1 ea 05             	shr    $0x5,%edx
+    36f9:	83 c2 30             	add    $0x30,%edx
+    36fc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    36ff:	f7 e6                	mul    %esi
+    3701:	c1 ea 05             	shr    $0x5,%edx
+    3704:	6b c2 64             	imul   $0x64,%edx,%eax
+    3707:	89 f2                	mov    %esi,%edx
+    3709:	29 c2                	sub    %eax,%edx
+    370b:	89 d0                	mov    %edx,%eax
+    370d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    370f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3711:	c1 ea 03             	shr    $0x3,%edx
+    3714:	83 c2 30             	add    $0x30,%edx
+    3717:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    371a:	f7 e1                	mul    %ecx
+    371c:	89 f0                	mov    %esi,%eax
+    371e:	c1 ea 03             	shr    $0x3,%edx
+    3721:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3724:	01 d2                	add    %edx,%edx
+    3726:	29 d0                	sub    %edx,%eax
+    3728:	83 c0 30             	add    $0x30,%eax
+    372b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    372e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3731:	50                   	push   %eax
+    3732:	68 d5 50 00 00       	push   $0x50d5
+    3737:	6a 01                	push   $0x1
+    3739:	e8 12 06 00 00       	call   3d50 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    373e:	58                   	pop    %eax
+    373f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3742:	5a                   	pop    %edx
+    3743:	68 02 02 00 00       	push   $0x202
+    3748:	50                   	push   %eax
+    3749:	e8 a5 04 00 00       	call   3bf3 <open>
+    if(fd < 0){
+    374e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3751:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3753:	85 c0                	test   %eax,%eax
+    3755:	78 4f                	js     37a6 <fsfull+0x106>
+    int total = 0;
+    3757:	31 db                	xor    %ebx,%ebx
+    3759:	eb 07                	jmp    3762 <fsfull+0xc2>
+    375b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    375f:	90                   	nop
+      total += cc;
+    3760:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3762:	83 ec 04             	sub    $0x4,%esp
+    3765:	68 00 02 00 00       	push   $0x200
+    376a:	68 c0 89 00 00       	push   $0x89c0
+    376f:	57                   	push   %edi
+    3770:	e8 5e 04 00 00       	call   3bd3 <write>
+      if(cc < 512)
+    3775:	83 c4 10             	add    $0x10,%esp
+    3778:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    377d:	7f e1                	jg     3760 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    377f:	83 ec 04             	sub    $0x4,%esp
+    3782:	53                   	push   %ebx
+    3783:	68 f1 50 00 00       	push   $0x50f1
+    3788:	6a 01                	push   $0x1
+    378a:	e8 c1 05 00 00       	call   3d50 <printf>
+    close(fd);
+    378f:	89 3c 24             	mov    %edi,(%esp)
+    3792:	e8 44 04 00 00       	call   3bdb <close>
+    if(total == 0)
+    3797:	83 c4 10             	add    $0x10,%esp
+    379a:	85 db                	test   %ebx,%ebx
+    379c:	74 1e                	je     37bc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    379e:	83 c6 01             	add    $0x1,%esi
+    37a1:	e9 1a ff ff ff       	jmp    36c0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    37a6:	83 ec 04             	sub    $0x4,%esp
+    37a9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    37ac:	50                   	push   %eax
+    37ad:	68 e1 50 00 00       	push   $0x50e1
+    37b2:	6a 01                	push   $0x1
+    37b4:	e8 97 05 00 00       	call   3d50 <printf>
+      break;
+    37b9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    37bc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    37c1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    37c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37cd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    37d0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    37d2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    37d5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    37d9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    37db:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    37df:	c1 ea 06             	shr    $0x6,%edx
+    37e2:	8d 42 30             	lea    0x30(%edx),%eax
+    37e5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    37e8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    37ee:	89 f2                	mov    %esi,%edx
+    37f0:	29 c2                	sub    %eax,%edx
+    37f2:	89 d0                	mov    %edx,%eax
+    37f4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    37f6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    37f8:	c1 ea 05             	shr    $0x5,%edx
+    37fb:	83 c2 30             	add    $0x30,%edx
+    37fe:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3801:	f7 e3                	mul    %ebx
+    3803:	c1 ea 05             	shr    $0x5,%edx
+    3806:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3809:	89 f2                	mov    %esi,%edx
+    380b:	29 ca                	sub    %ecx,%edx
+    380d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3812:	89 d0                	mov    %edx,%eax
+    3814:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3816:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3818:	c1 ea 03             	shr    $0x3,%edx
+    381b:	83 c2 30             	add    $0x30,%edx
+    381e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3821:	f7 e1                	mul    %ecx
+    3823:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3825:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3828:	c1 ea 03             	shr    $0x3,%edx
+    382b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    382e:	01 d2                	add    %edx,%edx
+    3830:	29 d0                	sub    %edx,%eax
+    3832:	83 c0 30             	add    $0x30,%eax
+    3835:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3838:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    383b:	50                   	push   %eax
+    383c:	e8 c2 03 00 00       	call   3c03 <unlink>
+  while(nfiles >= 0){
+    3841:	83 c4 10             	add    $0x10,%esp
+    3844:	83 fe ff             	cmp    $0xffffffff,%esi
+    3847:	75 87                	jne    37d0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3849:	83 ec 08             	sub    $0x8,%esp
+    384c:	68 01 51 00 00       	push   $0x5101
+    3851:	6a 01                	push   $0x1
+    3853:	e8 f8 04 00 00       	call   3d50 <printf>
+}
+    3858:	83 c4 10             	add    $0x10,%esp
+    385b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    385e:	5b                   	pop    %ebx
+    385f:	5e                   	pop    %esi
+    3860:	5f                   	pop    %edi
+    3861:	5d                   	pop    %ebp
+    3862:	c3                   	ret
+    3863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    386a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003870 <uio>:
+{
+    3870:	55                   	push   %ebp
+    3871:	89 e5                	mov    %esp,%ebp
+    3873:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3876:	68 17 51 00 00       	push   $0x5117
+    387b:	6a 01                	push   $0x1
+    387d:	e8 ce 04 00 00       	call   3d50 <printf>
+  pid = fork();
+    3882:	e8 24 03 00 00       	call   3bab <fork>
+  if(pid == 0){
+    3887:	83 c4 10             	add    $0x10,%esp
+    388a:	85 c0                	test   %eax,%eax
+    388c:	74 1b                	je     38a9 <uio+0x39>
+  } else if(pid < 0){
+    388e:	78 3d                	js     38cd <uio+0x5d>
+  wait();
+    3890:	e8 26 03 00 00       	call   3bbb <wait>
+  printf(1, "uio test done\n");
+    3895:	83 ec 08             	sub    $0x8,%esp
+    3898:	68 21 51 00 00       	push   $0x5121
+    389d:	6a 01                	push   $0x1
+    389f:	e8 ac 04 00 00       	call   3d50 <printf>
+}
+    38a4:	83 c4 10             	add    $0x10,%esp
+    38a7:	c9                   	leave
+    38a8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    38a9:	b8 09 00 00 00       	mov    $0x9,%eax
+    38ae:	ba 70 00 00 00       	mov    $0x70,%edx
+    38b3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    38b4:	ba 71 00 00 00       	mov    $0x71,%edx
+    38b9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    38ba:	52                   	push   %edx
+    38bb:	52                   	push   %edx
+    38bc:	68 ac 58 00 00       	push   $0x58ac
+    38c1:	6a 01                	push   $0x1
+    38c3:	e8 88 04 00 00       	call   3d50 <printf>
+    exit();
+    38c8:	e8 e6 02 00 00       	call   3bb3 <exit>
+    printf (1, "fork failed\n");
+    38cd:	50                   	push   %eax
+    38ce:	50                   	push   %eax
+    38cf:	68 a6 50 00 00       	push   $0x50a6
+    38d4:	6a 01                	push   $0x1
+    38d6:	e8 75 04 00 00       	call   3d50 <printf>
+    exit();
+    38db:	e8 d3 02 00 00       	call   3bb3 <exit>
+
+000038e0 <argptest>:
+{
+    38e0:	55                   	push   %ebp
+    38e1:	89 e5                	mov    %esp,%ebp
+    38e3:	53                   	push   %ebx
+    38e4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    38e7:	6a 00                	push   $0x0
+    38e9:	68 30 51 00 00       	push   $0x5130
+    38ee:	e8 00 03 00 00       	call   3bf3 <open>
+  if (fd < 0) {
+    38f3:	83 c4 10             	add    $0x10,%esp
+    38f6:	85 c0                	test   %eax,%eax
+    38f8:	78 39                	js     3933 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    38fa:	83 ec 0c             	sub    $0xc,%esp
+    38fd:	89 c3                	mov    %eax,%ebx
+    38ff:	6a 00                	push   $0x0
+    3901:	e8 35 03 00 00       	call   3c3b <sbrk>
+    3906:	83 c4 0c             	add    $0xc,%esp
+    3909:	83 e8 01             	sub    $0x1,%eax
+    390c:	6a ff                	push   $0xffffffff
+    390e:	50                   	push   %eax
+    390f:	53                   	push   %ebx
+    3910:	e8 b6 02 00 00       	call   3bcb <read>
+  close(fd);
+    3915:	89 1c 24             	mov    %ebx,(%esp)
+    3918:	e8 be 02 00 00       	call   3bdb <close>
+  printf(1, "arg test passed\n");
+    391d:	58                   	pop    %eax
+    391e:	5a                   	pop    %edx
+    391f:	68 42 51 00 00       	push   $0x5142
+    3924:	6a 01                	push   $0x1
+    3926:	e8 25 04 00 00       	call   3d50 <printf>
+}
+    392b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    392e:	83 c4 10             	add    $0x10,%esp
+    3931:	c9                   	leave
+    3932:	c3                   	ret
+    printf(2, "open failed\n");
+    3933:	51                   	push   %ecx
+    3934:	51                   	push   %ecx
+    3935:	68 35 51 00 00       	push   $0x5135
+    393a:	6a 02                	push   $0x2
+    393c:	e8 0f 04 00 00       	call   3d50 <printf>
+    exit();
+    3941:	e8 6d 02 00 00       	call   3bb3 <exit>
+    3946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    394d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003950 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3950:	69 05 70 62 00 00 0d 	imul   $0x19660d,0x6270,%eax
+    3957:	66 19 00 
+    395a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    395f:	a3 70 62 00 00       	mov    %eax,0x6270
+}
+    3964:	c3                   	ret
+    3965:	66 90                	xchg   %ax,%ax
+    3967:	66 90                	xchg   %ax,%ax
+    3969:	66 90                	xchg   %ax,%ax
+    396b:	66 90                	xchg   %ax,%ax
+    396d:	66 90                	xchg   %ax,%ax
+    396f:	90                   	nop
+
+00003970 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    3970:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3971:	31 c0                	xor    %eax,%eax
+{
+    3973:	89 e5                	mov    %esp,%ebp
+    3975:	53                   	push   %ebx
+    3976:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3979:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    397c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3980:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3984:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3987:	83 c0 01             	add    $0x1,%eax
+    398a:	84 d2                	test   %dl,%dl
+    398c:	75 f2                	jne    3980 <strcpy+0x10>
+    ;
+  return os;
+}
+    398e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3991:	89 c8                	mov    %ecx,%eax
+    3993:	c9                   	leave
+    3994:	c3                   	ret
+    3995:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    399c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000039a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    39a0:	55                   	push   %ebp
+    39a1:	89 e5                	mov    %esp,%ebp
+    39a3:	53                   	push   %ebx
+    39a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    39a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    39aa:	0f b6 02             	movzbl (%edx),%eax
+    39ad:	84 c0                	test   %al,%al
+    39af:	75 17                	jne    39c8 <strcmp+0x28>
+    39b1:	eb 3a                	jmp    39ed <strcmp+0x4d>
+    39b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39b7:	90                   	nop
+    39b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    39bc:	83 c2 01             	add    $0x1,%edx
+    39bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    39c2:	84 c0                	test   %al,%al
+    39c4:	74 1a                	je     39e0 <strcmp+0x40>
+    p++, q++;
+    39c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    39c8:	0f b6 19             	movzbl (%ecx),%ebx
+    39cb:	38 c3                	cmp    %al,%bl
+    39cd:	74 e9                	je     39b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    39cf:	29 d8                	sub    %ebx,%eax
+}
+    39d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    39d4:	c9                   	leave
+    39d5:	c3                   	ret
+    39d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    39e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    39e4:	31 c0                	xor    %eax,%eax
+    39e6:	29 d8                	sub    %ebx,%eax
+}
+    39e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    39eb:	c9                   	leave
+    39ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    39ed:	0f b6 19             	movzbl (%ecx),%ebx
+    39f0:	31 c0                	xor    %eax,%eax
+    39f2:	eb db                	jmp    39cf <strcmp+0x2f>
+    39f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39ff:	90                   	nop
+
+00003a00 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    3a00:	55                   	push   %ebp
+    3a01:	89 e5                	mov    %esp,%ebp
+    3a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3a06:	80 3a 00             	cmpb   $0x0,(%edx)
+    3a09:	74 15                	je     3a20 <strlen+0x20>
+    3a0b:	31 c0                	xor    %eax,%eax
+    3a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    3a10:	83 c0 01             	add    $0x1,%eax
+    3a13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3a17:	89 c1                	mov    %eax,%ecx
+    3a19:	75 f5                	jne    3a10 <strlen+0x10>
+    ;
+  return n;
+}
+    3a1b:	89 c8                	mov    %ecx,%eax
+    3a1d:	5d                   	pop    %ebp
+    3a1e:	c3                   	ret
+    3a1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3a20:	31 c9                	xor    %ecx,%ecx
+}
+    3a22:	5d                   	pop    %ebp
+    3a23:	89 c8                	mov    %ecx,%eax
+    3a25:	c3                   	ret
+    3a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003a30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3a30:	55                   	push   %ebp
+    3a31:	89 e5                	mov    %esp,%ebp
+    3a33:	57                   	push   %edi
+    3a34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3a37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3a3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3a3d:	89 d7                	mov    %edx,%edi
+    3a3f:	fc                   	cld
+    3a40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3a42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3a45:	89 d0                	mov    %edx,%eax
+    3a47:	c9                   	leave
+    3a48:	c3                   	ret
+    3a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003a50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3a50:	55                   	push   %ebp
+    3a51:	89 e5                	mov    %esp,%ebp
+    3a53:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3a5a:	0f b6 10             	movzbl (%eax),%edx
+    3a5d:	84 d2                	test   %dl,%dl
+    3a5f:	75 12                	jne    3a73 <strchr+0x23>
+    3a61:	eb 1d                	jmp    3a80 <strchr+0x30>
+    3a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a67:	90                   	nop
+    3a68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3a6c:	83 c0 01             	add    $0x1,%eax
+    3a6f:	84 d2                	test   %dl,%dl
+    3a71:	74 0d                	je     3a80 <strchr+0x30>
+    if(*s == c)
+    3a73:	38 d1                	cmp    %dl,%cl
+    3a75:	75 f1                	jne    3a68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3a77:	5d                   	pop    %ebp
+    3a78:	c3                   	ret
+    3a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3a80:	31 c0                	xor    %eax,%eax
+}
+    3a82:	5d                   	pop    %ebp
+    3a83:	c3                   	ret
+    3a84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a8f:	90                   	nop
+
+00003a90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3a90:	55                   	push   %ebp
+    3a91:	89 e5                	mov    %esp,%ebp
+    3a93:	57                   	push   %edi
+    3a94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3a95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3a98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3a99:	31 db                	xor    %ebx,%ebx
+{
+    3a9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    3a9e:	eb 27                	jmp    3ac7 <gets+0x37>
+    cc = read(0, &c, 1);
+    3aa0:	83 ec 04             	sub    $0x4,%esp
+    3aa3:	6a 01                	push   $0x1
+    3aa5:	56                   	push   %esi
+    3aa6:	6a 00                	push   $0x0
+    3aa8:	e8 1e 01 00 00       	call   3bcb <read>
+    if(cc < 1)
+    3aad:	83 c4 10             	add    $0x10,%esp
+    3ab0:	85 c0                	test   %eax,%eax
+    3ab2:	7e 1d                	jle    3ad1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    3ab4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3abb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3abf:	3c 0a                	cmp    $0xa,%al
+    3ac1:	74 10                	je     3ad3 <gets+0x43>
+    3ac3:	3c 0d                	cmp    $0xd,%al
+    3ac5:	74 0c                	je     3ad3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    3ac7:	89 df                	mov    %ebx,%edi
+    3ac9:	83 c3 01             	add    $0x1,%ebx
+    3acc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3acf:	7c cf                	jl     3aa0 <gets+0x10>
+    3ad1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3ad6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3add:	5b                   	pop    %ebx
+    3ade:	5e                   	pop    %esi
+    3adf:	5f                   	pop    %edi
+    3ae0:	5d                   	pop    %ebp
+    3ae1:	c3                   	ret
+    3ae2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003af0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3af0:	55                   	push   %ebp
+    3af1:	89 e5                	mov    %esp,%ebp
+    3af3:	56                   	push   %esi
+    3af4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3af5:	83 ec 08             	sub    $0x8,%esp
+    3af8:	6a 00                	push   $0x0
+    3afa:	ff 75 08             	push   0x8(%ebp)
+    3afd:	e8 f1 00 00 00       	call   3bf3 <open>
+  if(fd < 0)
+    3b02:	83 c4 10             	add    $0x10,%esp
+    3b05:	85 c0                	test   %eax,%eax
+    3b07:	78 27                	js     3b30 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3b09:	83 ec 08             	sub    $0x8,%esp
+    3b0c:	ff 75 0c             	push   0xc(%ebp)
+    3b0f:	89 c3                	mov    %eax,%ebx
+    3b11:	50                   	push   %eax
+    3b12:	e8 f4 00 00 00       	call   3c0b <fstat>
+  close(fd);
+    3b17:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3b1a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3b1c:	e8 ba 00 00 00       	call   3bdb <close>
+  return r;
+    3b21:	83 c4 10             	add    $0x10,%esp
+}
+    3b24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b27:	89 f0                	mov    %esi,%eax
+    3b29:	5b                   	pop    %ebx
+    3b2a:	5e                   	pop    %esi
+    3b2b:	5d                   	pop    %ebp
+    3b2c:	c3                   	ret
+    3b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3b30:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3b35:	eb ed                	jmp    3b24 <stat+0x34>
+    3b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b3e:	66 90                	xchg   %ax,%ax
+
+00003b40 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3b40:	55                   	push   %ebp
+    3b41:	89 e5                	mov    %esp,%ebp
+    3b43:	53                   	push   %ebx
+    3b44:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3b47:	0f be 02             	movsbl (%edx),%eax
+    3b4a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3b4d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3b50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3b55:	77 1e                	ja     3b75 <atoi+0x35>
+    3b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b5e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3b60:	83 c2 01             	add    $0x1,%edx
+    3b63:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3b66:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3b6a:	0f be 02             	movsbl (%edx),%eax
+    3b6d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3b70:	80 fb 09             	cmp    $0x9,%bl
+    3b73:	76 eb                	jbe    3b60 <atoi+0x20>
+  return n;
+}
+    3b75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b78:	89 c8                	mov    %ecx,%eax
+    3b7a:	c9                   	leave
+    3b7b:	c3                   	ret
+    3b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003b80 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    3b80:	55                   	push   %ebp
+    3b81:	89 e5                	mov    %esp,%ebp
+    3b83:	57                   	push   %edi
+    3b84:	56                   	push   %esi
+    3b85:	8b 45 10             	mov    0x10(%ebp),%eax
+    3b88:	8b 55 08             	mov    0x8(%ebp),%edx
+    3b8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3b8e:	85 c0                	test   %eax,%eax
+    3b90:	7e 13                	jle    3ba5 <memmove+0x25>
+    3b92:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3b94:	89 d7                	mov    %edx,%edi
+    3b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b9d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3ba0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3ba1:	39 f8                	cmp    %edi,%eax
+    3ba3:	75 fb                	jne    3ba0 <memmove+0x20>
+  return vdst;
+}
+    3ba5:	5e                   	pop    %esi
+    3ba6:	89 d0                	mov    %edx,%eax
+    3ba8:	5f                   	pop    %edi
+    3ba9:	5d                   	pop    %ebp
+    3baa:	c3                   	ret
+
+00003bab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3bab:	b8 01 00 00 00       	mov    $0x1,%eax
+    3bb0:	cd 40                	int    $0x40
+    3bb2:	c3                   	ret
+
+00003bb3 <exit>:
+SYSCALL(exit)
+    3bb3:	b8 02 00 00 00       	mov    $0x2,%eax
+    3bb8:	cd 40                	int    $0x40
+    3bba:	c3                   	ret
+
+00003bbb <wait>:
+SYSCALL(wait)
+    3bbb:	b8 03 00 00 00       	mov    $0x3,%eax
+    3bc0:	cd 40                	int    $0x40
+    3bc2:	c3                   	ret
+
+00003bc3 <pipe>:
+SYSCALL(pipe)
+    3bc3:	b8 04 00 00 00       	mov    $0x4,%eax
+    3bc8:	cd 40                	int    $0x40
+    3bca:	c3                   	ret
+
+00003bcb <read>:
+SYSCALL(read)
+    3bcb:	b8 05 00 00 00       	mov    $0x5,%eax
+    3bd0:	cd 40                	int    $0x40
+    3bd2:	c3                   	ret
+
+00003bd3 <write>:
+SYSCALL(write)
+    3bd3:	b8 10 00 00 00       	mov    $0x10,%eax
+    3bd8:	cd 40                	int    $0x40
+    3bda:	c3                   	ret
+
+00003bdb <close>:
+SYSCALL(close)
+    3bdb:	b8 15 00 00 00       	mov    $0x15,%eax
+    3be0:	cd 40                	int    $0x40
+    3be2:	c3                   	ret
+
+00003be3 <kill>:
+SYSCALL(kill)
+    3be3:	b8 06 00 00 00       	mov    $0x6,%eax
+    3be8:	cd 40                	int    $0x40
+    3bea:	c3                   	ret
+
+00003beb <exec>:
+SYSCALL(exec)
+    3beb:	b8 07 00 00 00       	mov    $0x7,%eax
+    3bf0:	cd 40                	int    $0x40
+    3bf2:	c3                   	ret
+
+00003bf3 <open>:
+SYSCALL(open)
+    3bf3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3bf8:	cd 40                	int    $0x40
+    3bfa:	c3                   	ret
+
+00003bfb <mknod>:
+SYSCALL(mknod)
+    3bfb:	b8 11 00 00 00       	mov    $0x11,%eax
+    3c00:	cd 40                	int    $0x40
+    3c02:	c3                   	ret
+
+00003c03 <unlink>:
+SYSCALL(unlink)
+    3c03:	b8 12 00 00 00       	mov    $0x12,%eax
+    3c08:	cd 40                	int    $0x40
+    3c0a:	c3                   	ret
+
+00003c0b <fstat>:
+SYSCALL(fstat)
+    3c0b:	b8 08 00 00 00       	mov    $0x8,%eax
+    3c10:	cd 40                	int    $0x40
+    3c12:	c3                   	ret
+
+00003c13 <link>:
+SYSCALL(link)
+    3c13:	b8 13 00 00 00       	mov    $0x13,%eax
+    3c18:	cd 40                	int    $0x40
+    3c1a:	c3                   	ret
+
+00003c1b <mkdir>:
+SYSCALL(mkdir)
+    3c1b:	b8 14 00 00 00       	mov    $0x14,%eax
+    3c20:	cd 40                	int    $0x40
+    3c22:	c3                   	ret
+
+00003c23 <chdir>:
+SYSCALL(chdir)
+    3c23:	b8 09 00 00 00       	mov    $0x9,%eax
+    3c28:	cd 40                	int    $0x40
+    3c2a:	c3                   	ret
+
+00003c2b <dup>:
+SYSCALL(dup)
+    3c2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3c30:	cd 40                	int    $0x40
+    3c32:	c3                   	ret
+
+00003c33 <getpid>:
+SYSCALL(getpid)
+    3c33:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3c38:	cd 40                	int    $0x40
+    3c3a:	c3                   	ret
+
+00003c3b <sbrk>:
+SYSCALL(sbrk)
+    3c3b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3c40:	cd 40                	int    $0x40
+    3c42:	c3                   	ret
+
+00003c43 <sleep>:
+SYSCALL(sleep)
+    3c43:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3c48:	cd 40                	int    $0x40
+    3c4a:	c3                   	ret
+
+00003c4b <uptime>:
+SYSCALL(uptime)
+    3c4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3c50:	cd 40                	int    $0x40
+    3c52:	c3                   	ret
+
+00003c53 <getrss>:
+SYSCALL(getrss)
+    3c53:	b8 16 00 00 00       	mov    $0x16,%eax
+    3c58:	cd 40                	int    $0x40
+    3c5a:	c3                   	ret
+
+00003c5b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+    3c5b:	b8 17 00 00 00       	mov    $0x17,%eax
+    3c60:	cd 40                	int    $0x40
+    3c62:	c3                   	ret
+
+00003c63 <usleep>:
+SYSCALL(usleep)
+    3c63:	b8 18 00 00 00       	mov    $0x18,%eax
+    3c68:	cd 40                	int    $0x40
+    3c6a:	c3                   	ret
+
+00003c6b <lockstat>:
+SYSCALL(lockstat)
+    3c6b:	b8 19 00 00 00       	mov    $0x19,%eax
+    3c70:	cd 40                	int    $0x40
+    3c72:	c3                   	ret
+
+00003c73 <clone>:
+SYSCALL(clone)
+    3c73:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3c78:	cd 40                	int    $0x40
+    3c7a:	c3                   	ret
+
+00003c7b <join>:
+SYSCALL(join)
+    3c7b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3c80:	cd 40                	int    $0x40
+    3c82:	c3                   	ret
+
+00003c83 <futex>:
+SYSCALL(futex)
+    3c83:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3c88:	cd 40                	int    $0x40
+    3c8a:	c3                   	ret
+
+00003c8b <mmap>:
+SYSCALL(mmap)
+    3c8b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3c90:	cd 40                	int    $0x40
+    3c92:	c3                   	ret
+
+00003c93 <munmap>:
+SYSCALL(munmap)
+    3c93:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3c98:	cd 40                	int    $0x40
+    3c9a:	c3                   	ret
+
+00003c9b <sendfile>:
+SYSCALL(sendfile)
+    3c9b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3ca0:	cd 40                	int    $0x40
+    3ca2:	c3                   	ret
+
+00003ca3 <splice>:
+SYSCALL(splice)
+    3ca3:	b8 20 00 00 00       	mov    $0x20,%eax
+    3ca8:	cd 40                	int    $0x40
+    3caa:	c3                   	ret
+    3cab:	66 90                	xchg   %ax,%ax
+    3cad:	66 90                	xchg   %ax,%ax
+    3caf:	90                   	nop
+
+00003cb0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3cb0:	55                   	push   %ebp
+    3cb1:	89 e5                	mov    %esp,%ebp
+    3cb3:	57                   	push   %edi
+    3cb4:	56                   	push   %esi
+    3cb5:	53                   	push   %ebx
+    3cb6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3cb8:	89 d1                	mov    %edx,%ecx
+{
+    3cba:	83 ec 3c             	sub    $0x3c,%esp
+    3cbd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3cc0:	85 d2                	test   %edx,%edx
+    3cc2:	0f 89 80 00 00 00    	jns    3d48 <printint+0x98>
+    3cc8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3ccc:	74 7a                	je     3d48 <printint+0x98>
+    x = -xx;
+    3cce:	f7 d9                	neg    %ecx
+    neg = 1;
+    3cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3cd5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3cd8:	31 f6                	xor    %esi,%esi
+    3cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3ce0:	89 c8                	mov    %ecx,%eax
+    3ce2:	31 d2                	xor    %edx,%edx
+    3ce4:	89 f7                	mov    %esi,%edi
+    3ce6:	f7 f3                	div    %ebx
+    3ce8:	8d 76 01             	lea    0x1(%esi),%esi
+    3ceb:	0f b6 92 5c 59 00 00 	movzbl 0x595c(%edx),%edx
+    3cf2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3cf6:	89 ca                	mov    %ecx,%edx
+    3cf8:	89 c1                	mov    %eax,%ecx
+    3cfa:	39 da                	cmp    %ebx,%edx
+    3cfc:	73 e2                	jae    3ce0 <printint+0x30>
+  if(neg)
+    3cfe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3d01:	85 c0                	test   %eax,%eax
+    3d03:	74 07                	je     3d0c <printint+0x5c>
+    buf[i++] = '-';
+    3d05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3d0a:	89 f7                	mov    %esi,%edi
+    3d0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3d0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3d12:	01 df                	add    %ebx,%edi
+    3d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3d18:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3d1b:	83 ec 04             	sub    $0x4,%esp
+    3d1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3d21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3d24:	6a 01                	push   $0x1
+    3d26:	50                   	push   %eax
+    3d27:	56                   	push   %esi
+    3d28:	e8 a6 fe ff ff       	call   3bd3 <write>
+  while(--i >= 0)
+    3d2d:	89 f8                	mov    %edi,%eax
+    3d2f:	83 c4 10             	add    $0x10,%esp
+    3d32:	83 ef 01             	sub    $0x1,%edi
+    3d35:	39 d8                	cmp    %ebx,%eax
+    3d37:	75 df                	jne    3d18 <printint+0x68>
+}
+    3d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d3c:	5b                   	pop    %ebx
+    3d3d:	5e                   	pop    %esi
+    3d3e:	5f                   	pop    %edi
+    3d3f:	5d                   	pop    %ebp
+    3d40:	c3                   	ret
+    3d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3d48:	31 c0                	xor    %eax,%eax
+    3d4a:	eb 89                	jmp    3cd5 <printint+0x25>
+    3d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003d50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3d50:	55                   	push   %ebp
+    3d51:	89 e5                	mov    %esp,%ebp
+    3d53:	57                   	push   %edi
+    3d54:	56                   	push   %esi
+    3d55:	53                   	push   %ebx
+    3d56:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3d59:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3d5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3d5f:	0f b6 1e             	movzbl (%esi),%ebx
+    3d62:	83 c6 01             	add    $0x1,%esi
+    3d65:	84 db                	test   %bl,%bl
+    3d67:	74 67                	je     3dd0 <printf+0x80>
+    3d69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3d6c:	31 d2                	xor    %edx,%edx
+    3d6e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3d71:	eb 34                	jmp    3da7 <printf+0x57>
+    3d73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d77:	90                   	nop
+    3d78:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3d7b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3d80:	83 f8 25             	cmp    $0x25,%eax
+    3d83:	74 18                	je     3d9d <printf+0x4d>
+  write(fd, &c, 1);
+    3d85:	83 ec 04             	sub    $0x4,%esp
+    3d88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3d8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3d8e:	6a 01                	push   $0x1
+    3d90:	50                   	push   %eax
+    3d91:	57                   	push   %edi
+    3d92:	e8 3c fe ff ff       	call   3bd3 <write>
+    3d97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3d9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3d9d:	0f b6 1e             	movzbl (%esi),%ebx
+    3da0:	83 c6 01             	add    $0x1,%esi
+    3da3:	84 db                	test   %bl,%bl
+    3da5:	74 29                	je     3dd0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    3da7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3daa:	85 d2                	test   %edx,%edx
+    3dac:	74 ca                	je     3d78 <printf+0x28>
+      }
+    } else if(state == '%'){
+    3dae:	83 fa 25             	cmp    $0x25,%edx
+    3db1:	75 ea                	jne    3d9d <printf+0x4d>
+      if(c == 'd'){
+    3db3:	83 f8 25             	cmp    $0x25,%eax
+    3db6:	0f 84 24 01 00 00    	je     3ee0 <printf+0x190>
+    3dbc:	83 e8 63             	sub    $0x63,%eax
+    3dbf:	83 f8 15             	cmp    $0x15,%eax
+    3dc2:	77 1c                	ja     3de0 <printf+0x90>
+    3dc4:	ff 24 85 04 59 00 00 	jmp    *0x5904(,%eax,4)
+    3dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dcf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    3dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3dd3:	5b                   	pop    %ebx
+    3dd4:	5e                   	pop    %esi
+    3dd5:	5f                   	pop    %edi
+    3dd6:	5d                   	pop    %ebp
+    3dd7:	c3                   	ret
+    3dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ddf:	90                   	nop
+  write(fd, &c, 1);
+    3de0:	83 ec 04             	sub    $0x4,%esp
+    3de3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3de6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    3dea:	6a 01                	push   $0x1
+    3dec:	52                   	push   %edx
+    3ded:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3df0:	57                   	push   %edi
+    3df1:	e8 dd fd ff ff       	call   3bd3 <write>
+    3df6:	83 c4 0c             	add    $0xc,%esp
+    3df9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3dfc:	6a 01                	push   $0x1
+    3dfe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3e01:	52                   	push   %edx
+    3e02:	57                   	push   %edi
+    3e03:	e8 cb fd ff ff       	call   3bd3 <write>
+        putc(fd, c);
+    3e08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3e0b:	31 d2                	xor    %edx,%edx
+    3e0d:	eb 8e                	jmp    3d9d <printf+0x4d>
+    3e0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    3e10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3e13:	83 ec 0c             	sub    $0xc,%esp
+    3e16:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3e1b:	8b 13                	mov    (%ebx),%edx
+    3e1d:	6a 00                	push   $0x0
+    3e1f:	89 f8                	mov    %edi,%eax
+        ap++;
+    3e21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    3e24:	e8 87 fe ff ff       	call   3cb0 <printint>
+        ap++;
+    3e29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3e2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3e2f:	31 d2                	xor    %edx,%edx
+    3e31:	e9 67 ff ff ff       	jmp    3d9d <printf+0x4d>
+    3e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3e40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3e43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    3e45:	83 c0 04             	add    $0x4,%eax
+    3e48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    3e4b:	85 db                	test   %ebx,%ebx
+    3e4d:	0f 84 9d 00 00 00    	je     3ef0 <printf+0x1a0>
+        while(*s != 0){
+    3e53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    3e56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    3e58:	84 c0                	test   %al,%al
+    3e5a:	0f 84 3d ff ff ff    	je     3d9d <printf+0x4d>
+    3e60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3e63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    3e66:	89 de                	mov    %ebx,%esi
+    3e68:	89 d3                	mov    %edx,%ebx
+    3e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    3e70:	83 ec 04             	sub    $0x4,%esp
+    3e73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    3e76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    3e79:	6a 01                	push   $0x1
+    3e7b:	53                   	push   %ebx
+    3e7c:	57                   	push   %edi
+    3e7d:	e8 51 fd ff ff       	call   3bd3 <write>
+        while(*s != 0){
+    3e82:	0f b6 06             	movzbl (%esi),%eax
+    3e85:	83 c4 10             	add    $0x10,%esp
+    3e88:	84 c0                	test   %al,%al
+    3e8a:	75 e4                	jne    3e70 <printf+0x120>
+      state = 0;
+    3e8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    3e8f:	31 d2                	xor    %edx,%edx
+    3e91:	e9 07 ff ff ff       	jmp    3d9d <printf+0x4d>
+    3e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    3ea0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3ea3:	83 ec 0c             	sub    $0xc,%esp
+    3ea6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3eab:	8b 13                	mov    (%ebx),%edx
+    3ead:	6a 01                	push   $0x1
+    3eaf:	e9 6b ff ff ff       	jmp    3e1f <printf+0xcf>
+    3eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    3eb8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    3ebb:	83 ec 04             	sub    $0x4,%esp
+    3ebe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    3ec1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    3ec3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    3ec6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3ec9:	6a 01                	push   $0x1
+    3ecb:	52                   	push   %edx
+    3ecc:	57                   	push   %edi
+    3ecd:	e8 01 fd ff ff       	call   3bd3 <write>
+        ap++;
+    3ed2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3ed5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3ed8:	31 d2                	xor    %edx,%edx
+    3eda:	e9 be fe ff ff       	jmp    3d9d <printf+0x4d>
+    3edf:	90                   	nop
+  write(fd, &c, 1);
+    3ee0:	83 ec 04             	sub    $0x4,%esp
+    3ee3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3ee6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3ee9:	6a 01                	push   $0x1
+    3eeb:	e9 11 ff ff ff       	jmp    3e01 <printf+0xb1>
+    3ef0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    3ef5:	bb fa 58 00 00       	mov    $0x58fa,%ebx
+    3efa:	e9 61 ff ff ff       	jmp    3e60 <printf+0x110>
+    3eff:	90                   	nop
+
+00003f00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3f00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3f01:	a1 40 aa 00 00       	mov    0xaa40,%eax
+{
+    3f06:	89 e5                	mov    %esp,%ebp
+    3f08:	57                   	push   %edi
+    3f09:	56                   	push   %esi
+    3f0a:	53                   	push   %ebx
+    3f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    3f0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3f1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3f1c:	39 ca                	cmp    %ecx,%edx
+    3f1e:	73 30                	jae    3f50 <free+0x50>
+    3f20:	39 c1                	cmp    %eax,%ecx
+    3f22:	72 04                	jb     3f28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3f24:	39 c2                	cmp    %eax,%edx
+    3f26:	72 f0                	jb     3f18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3f28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3f2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3f2e:	39 f8                	cmp    %edi,%eax
+    3f30:	74 2e                	je     3f60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3f32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    3f35:	8b 42 04             	mov    0x4(%edx),%eax
+    3f38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    3f3b:	39 f1                	cmp    %esi,%ecx
+    3f3d:	74 38                	je     3f77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    3f3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    3f41:	5b                   	pop    %ebx
+  freep = p;
+    3f42:	89 15 40 aa 00 00    	mov    %edx,0xaa40
+}
+    3f48:	5e                   	pop    %esi
+    3f49:	5f                   	pop    %edi
+    3f4a:	5d                   	pop    %ebp
+    3f4b:	c3                   	ret
+    3f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3f50:	39 c1                	cmp    %eax,%ecx
+    3f52:	72 d0                	jb     3f24 <free+0x24>
+    3f54:	eb c2                	jmp    3f18 <free+0x18>
+    3f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    3f60:	03 70 04             	add    0x4(%eax),%esi
+    3f63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3f66:	8b 02                	mov    (%edx),%eax
+    3f68:	8b 00                	mov    (%eax),%eax
+    3f6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    3f6d:	8b 42 04             	mov    0x4(%edx),%eax
+    3f70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    3f73:	39 f1                	cmp    %esi,%ecx
+    3f75:	75 c8                	jne    3f3f <free+0x3f>
+    p->s.size += bp->s.size;
+    3f77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    3f7a:	89 15 40 aa 00 00    	mov    %edx,0xaa40
+    p->s.size += bp->s.size;
+    3f80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    3f83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    3f86:	89 0a                	mov    %ecx,(%edx)
+}
+    3f88:	5b                   	pop    %ebx
+    3f89:	5e                   	pop    %esi
+    3f8a:	5f                   	pop    %edi
+    3f8b:	5d                   	pop    %ebp
+    3f8c:	c3                   	ret
+    3f8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003f90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    3f90:	55                   	push   %ebp
+    3f91:	89 e5                	mov    %esp,%ebp
+    3f93:	57                   	push   %edi
+    3f94:	56                   	push   %esi
+    3f95:	53                   	push   %ebx
+    3f96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    3f9c:	8b 15 40 aa 00 00    	mov    0xaa40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3fa2:	8d 78 07             	lea    0x7(%eax),%edi
+    3fa5:	c1 ef 03             	shr    $0x3,%edi
+    3fa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    3fab:	85 d2                	test   %edx,%edx
+    3fad:	0f 84 8d 00 00 00    	je     4040 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3fb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3fb5:	8b 48 04             	mov    0x4(%eax),%ecx
+    3fb8:	39 f9                	cmp    %edi,%ecx
+    3fba:	73 64                	jae    4020 <malloc+0x90>
+  if(nu < 4096)
+    3fbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    3fc1:	39 df                	cmp    %ebx,%edi
+    3fc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3fc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    3fcd:	eb 0a                	jmp    3fd9 <malloc+0x49>
+    3fcf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3fd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3fd2:	8b 48 04             	mov    0x4(%eax),%ecx
+    3fd5:	39 f9                	cmp    %edi,%ecx
+    3fd7:	73 47                	jae    4020 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    3fd9:	89 c2                	mov    %eax,%edx
+    3fdb:	39 05 40 aa 00 00    	cmp    %eax,0xaa40
+    3fe1:	75 ed                	jne    3fd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    3fe3:	83 ec 0c             	sub    $0xc,%esp
+    3fe6:	56                   	push   %esi
+    3fe7:	e8 4f fc ff ff       	call   3c3b <sbrk>
+  if(p == (char*)-1)
+    3fec:	83 c4 10             	add    $0x10,%esp
+    3fef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ff2:	74 1c                	je     4010 <malloc+0x80>
+  hp->s.size = nu;
+    3ff4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    3ff7:	83 ec 0c             	sub    $0xc,%esp
+    3ffa:	83 c0 08             	add    $0x8,%eax
+    3ffd:	50                   	push   %eax
+    3ffe:	e8 fd fe ff ff       	call   3f00 <free>
+  return freep;
+    4003:	8b 15 40 aa 00 00    	mov    0xaa40,%edx
+      if((p = morecore(nunits)) == 0)
+    4009:	83 c4 10             	add    $0x10,%esp
+    400c:	85 d2                	test   %edx,%edx
+    400e:	75 c0                	jne    3fd0 <malloc+0x40>
+        return 0;
+  }
+}
+    4010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4013:	31 c0                	xor    %eax,%eax
+}
+    4015:	5b                   	pop    %ebx
+    4016:	5e                   	pop    %esi
+    4017:	5f                   	pop    %edi
+    4018:	5d                   	pop    %ebp
+    4019:	c3                   	ret
+    401a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4020:	39 cf                	cmp    %ecx,%edi
+    4022:	74 4c                	je     4070 <malloc+0xe0>
+        p->s.size -= nunits;
+    4024:	29 f9                	sub    %edi,%ecx
+    4026:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4029:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    402c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    402f:	89 15 40 aa 00 00    	mov    %edx,0xaa40
+}
+    4035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4038:	83 c0 08             	add    $0x8,%eax
+}
+    403b:	5b                   	pop    %ebx
+    403c:	5e                   	pop    %esi
+    403d:	5f                   	pop    %edi
+    403e:	5d                   	pop    %ebp
+    403f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4040:	c7 05 40 aa 00 00 44 	movl   $0xaa44,0xaa40
+    4047:	aa 00 00 
+    base.s.size = 0;
+    404a:	b8 44 aa 00 00       	mov    $0xaa44,%eax
+    base.s.ptr = freep = prevp = &base;
+    404f:	c7 05 44 aa 00 00 44 	movl   $0xaa44,0xaa44
+    4056:	aa 00 00 
+    base.s.size = 0;
+    4059:	c7 05 48 aa 00 00 00 	movl   $0x0,0xaa48
+    4060:	00 00 00 
+    if(p->s.size >= nunits){
+    4063:	e9 54 ff ff ff       	jmp    3fbc <malloc+0x2c>
+    4068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    406f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4070:	8b 08                	mov    (%eax),%ecx
+    4072:	89 0a                	mov    %ecx,(%edx)
+    4074:	eb b9                	jmp    402f <malloc+0x9f>
@@ -184,6 +184,10 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Blocks in the big file: well into the double-indirect range,
+// but MAXFILE blocks would not fit on fs.img.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 16*NINDIRECT)
+
 void
 writetest1(void)
 {
@@ -197,7 +201,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +221,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -354,6 +358,81 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// file to pipe with sendfile, pipe to file with splice
+void
+sendfiletest(void)
+{
+  int fd, out, fds[2], pid, i, j, n, total;
+
+  printf(1, "sendfile test\n");
+
+  fd = open("sendfile", O_CREATE | O_RDWR);
+  out = open("sendfile.out", O_CREATE | O_RDWR);
+  if(fd < 0 || out < 0){
+    printf(1, "cannot create sendfile\n");
+    exit();
+  }
+  for(i = 0; i < 5000; i++)
+    buf[i] = i % 251;
+  if(write(fd, buf, 5000) != 5000 || write(fd, buf, 5000) != 5000){
+    printf(1, "write sendfile failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("sendfile", O_RDONLY);
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    if((n = sendfile(fds[1], fd, -1, 20000)) != 10000){
+      printf(1, "sendfile to pipe returned %d\n", n);
+      exit();
+    }
+    exit();
+  }
+  close(fds[1]);
+  if((n = splice(fds[0], out, 20000)) != 10000){
+    printf(1, "splice from pipe returned %d\n", n);
+    exit();
+  }
+  close(fds[0]);
+  wait();
+  if(sendfile(out, fd, 9990, 100) != 10){
+    printf(1, "sendfile at offset failed\n");
+    exit();
+  }
+  close(fd);
+  close(out);
+
+  // the pipe carried the file, then 10 bytes from offset 9990
+  out = open("sendfile.out", O_RDONLY);
+  total = 0;
+  while((n = read(out, buf, sizeof(buf))) > 0){
+    for(i = 0; i < n; i++, total++){
+      j = total < 10000 ? total : total - 10;
+      if((buf[i] & 0xff) != j % 5000 % 251){
+        printf(1, "sendfile.out wrong at %d\n", total);
+        exit();
+      }
+    }
+  }
+  if(total != 10010){
+    printf(1, "sendfile.out has %d bytes\n", total);
+    exit();
+  }
+  close(out);
+  unlink("sendfile");
+  unlink("sendfile.out");
+  printf(1, "sendfile ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1781,6 +1860,7 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  sendfiletest();
   preempt();
   exitwait();
 
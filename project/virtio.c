@@ -0,0 +1,279 @@
+// Driver for a virtio block device on legacy virtio PCI, such as
+// qemu's -device virtio-blk-pci,disable-modern=on. It is built
+// instead of ide.c with make VIRTIO=1, and serves fs.img as disk 1.
+//
+// Unlike IDE, the device takes many requests at once. A request is
+// a chain of descriptors in the virtqueue: a header, one descriptor
+// per buf of a multi-block request, and a status byte. Requests
+// complete through the used ring, in any order. Those that do not
+// fit in the free descriptors wait in an ioq (see iosched.c).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define SECTOR_SIZE   512
+#define MAXQSIZE      256
+#define NQPAGE        3    // enough for a queue of MAXQSIZE
+#define MAXREQDESC    (MAXCLUSTER+2)
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  uint qsize;
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  uint freehead;   // Free descriptors, chained through next
+  uint nfree;
+  ushort usedidx;  // Used ring entries handled
+  // Per request, indexed by its first descriptor.
+  struct virtio_blk_req req[MAXQSIZE];
+  uchar status[MAXQSIZE];
+  struct buf *buf[MAXQSIZE];
+  struct ioq ioq;  // Requests waiting for descriptors
+} vdisk;
+
+static char vqmem[NQPAGE*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+int diskirq = -1;
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint n, i;
+
+  initlock(&vdisk.lock, "virtio");
+  if(!pcifind(VIRTIO_ID_BLK, PCI_ANY, &d) || !(d.bar[0] & 1))
+    panic("virtio: no block device");
+  pciwrite(&d, PCI_CMD, pciread(&d, PCI_CMD) | PCI_CMD_IO | PCI_CMD_MASTER);
+  vdisk.iobase = d.bar[0] & 0xfffc;
+
+  outb(vdisk.iobase + VIRTIO_STATUS, 0);  // reset
+  outb(vdisk.iobase + VIRTIO_STATUS, VIRTIO_ACK);
+  outb(vdisk.iobase + VIRTIO_STATUS, VIRTIO_ACK | VIRTIO_DRIVER);
+  inl(vdisk.iobase + VIRTIO_DEVFEATURES);
+  outl(vdisk.iobase + VIRTIO_GUESTFEATURES, 0);  // none needed
+
+  // Lay out queue 0 in vqmem, the used ring on a page boundary.
+  outw(vdisk.iobase + VIRTIO_QUEUESEL, 0);
+  n = inw(vdisk.iobase + VIRTIO_QUEUESIZE);
+  if(n < MAXREQDESC || n > MAXQSIZE)
+    panic("virtio: queue size");
+  memset(vqmem, 0, sizeof(vqmem));
+  vdisk.qsize = n;
+  vdisk.desc = (struct vring_desc*)vqmem;
+  vdisk.avail = (struct vring_avail*)(vqmem + n*sizeof(struct vring_desc));
+  vdisk.used = (struct vring_used*)PGROUNDUP((uint)&vdisk.avail->ring[n+1]);
+  for(i = 0; i < n; i++)
+    vdisk.desc[i].next = i+1;
+  vdisk.freehead = 0;
+  vdisk.nfree = n;
+  outl(vdisk.iobase + VIRTIO_QUEUEPFN, V2P(vqmem) / PGSIZE);
+
+  outb(vdisk.iobase + VIRTIO_STATUS,
+       VIRTIO_ACK | VIRTIO_DRIVER | VIRTIO_DRIVER_OK);
+
+  diskirq = d.irq;
+  ioapicenable(diskirq, ncpu - 1);
+}
+
+static uint
+valloc(void)
+{
+  uint i;
+
+  if(vdisk.nfree == 0)
+    panic("virtio: valloc");
+  i = vdisk.freehead;
+  vdisk.freehead = vdisk.desc[i].next;
+  vdisk.nfree--;
+  return i;
+}
+
+// Free the descriptor chain starting at i.
+static void
+vfree(uint i)
+{
+  uint next;
+
+  for(;;){
+    next = vdisk.desc[i].next;
+    vdisk.desc[i].next = vdisk.freehead;
+    vdisk.freehead = i;
+    vdisk.nfree++;
+    if(!(vdisk.desc[i].flags & VRING_DESC_F_NEXT))
+      break;
+    i = next;
+  }
+}
+
+// Give request b to the device, if there are descriptors for it.
+// Caller must hold vdisk.lock.
+static int
+vstart(struct buf *b)
+{
+  struct buf *c;
+  uint head, prev, i, n;
+
+  n = 2;
+  for(c = b; c; c = c->cnext)
+    n++;
+  if(n > MAXREQDESC || b->blockno + n - 2 > FSSIZE)
+    panic("virtio: incorrect blockno");
+  if(n > vdisk.nfree)
+    return 0;
+
+  head = valloc();
+  vdisk.req[head].type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  vdisk.req[head].reserved = 0;
+  vdisk.req[head].sector = b->blockno * (BSIZE/SECTOR_SIZE);
+  vdisk.desc[head].addr = V2P(&vdisk.req[head]);
+  vdisk.desc[head].len = sizeof(vdisk.req[head]);
+  vdisk.desc[head].flags = VRING_DESC_F_NEXT;
+  prev = head;
+  for(c = b; c; c = c->cnext){
+    i = valloc();
+    vdisk.desc[i].addr = V2P(c->data);
+    vdisk.desc[i].len = BSIZE;
+    vdisk.desc[i].flags = VRING_DESC_F_NEXT;
+    if(!(b->flags & B_DIRTY))
+      vdisk.desc[i].flags |= VRING_DESC_F_WRITE;
+    vdisk.desc[prev].next = i;
+    prev = i;
+  }
+  i = valloc();
+  vdisk.status[head] = 0xff;
+  vdisk.desc[i].addr = V2P(&vdisk.status[head]);
+  vdisk.desc[i].len = 1;
+  vdisk.desc[i].flags = VRING_DESC_F_WRITE;
+  vdisk.desc[prev].next = i;
+  vdisk.buf[head] = b;
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.qsize] = head;
+  __sync_synchronize();
+  vdisk.avail->idx++;
+  __sync_synchronize();
+  outw(vdisk.iobase + VIRTIO_QUEUENOTIFY, 0);
+  return 1;
+}
+
+// Start request b, or queue it. Caller must hold vdisk.lock.
+static void
+vqueue(struct buf *b)
+{
+  struct buf *c;
+
+  for(c = b; c; c = c->cnext)
+    if(c->dev != 1)
+      panic("virtio: request not for disk 1");
+  ioqcheck(b);
+  if(!ioqempty(&vdisk.ioq) || !vstart(b))
+    ioqadd(&vdisk.ioq, b);
+}
+
+// Mark b done and wake its waiter. Async bufs are put on the
+// list *async instead, to be released once vdisk.lock is.
+static void
+vdone(struct buf *b, struct buf **async)
+{
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC){
+    b->cnext = *async;
+    *async = b;
+  } else {
+    b->cnext = 0;
+    wakeup(b);
+  }
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b, *next, *async;
+  uint id;
+
+  acquire(&vdisk.lock);
+  inb(vdisk.iobase + VIRTIO_ISR);  // acknowledge
+
+  async = 0;
+  while(vdisk.usedidx != vdisk.used->idx){
+    __sync_synchronize();
+    id = vdisk.used->ring[vdisk.usedidx % vdisk.qsize].id;
+    vdisk.usedidx++;
+    if(vdisk.status[id] != VIRTIO_BLK_S_OK)
+      panic("virtio: disk error");
+    for(b = vdisk.buf[id]; b; b = next){
+      next = b->cnext;
+      vdone(b, &async);
+    }
+    vdisk.buf[id] = 0;
+    vfree(id);
+  }
+
+  // Start waiting requests; any of them fits in MAXREQDESC.
+  while(vdisk.nfree >= MAXREQDESC && (b = ioqnext(&vdisk.ioq)) != 0)
+    vstart(b);
+
+  release(&vdisk.lock);
+
+  while((b = async) != 0){
+    async = b->cnext;
+    b->cnext = 0;
+    bdone(b);
+  }
+}
+
+// Queue the request starting at b and return without waiting.
+// The bufs must be locked. Those with B_ASYNC set are released
+// with bdone() when done; wait for the others with iderwait().
+void
+ideasync(struct buf *b)
+{
+  acquire(&vdisk.lock);
+  vqueue(b);
+  release(&vdisk.lock);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+
+  acquire(&vdisk.lock);
+  b->cnext = 0;
+  vqueue(b);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vdisk.lock);
+  release(&vdisk.lock);
+}
+
+// Wait for a request queued with ideasync() to finish with b.
+void
+iderwait(struct buf *b)
+{
+  acquire(&vdisk.lock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vdisk.lock);
+  release(&vdisk.lock);
+}
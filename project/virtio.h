@@ -0,0 +1,60 @@
+// Legacy virtio over PCI, and the virtio block device.
+// See the virtio 0.9.5 specification.
+
+// Registers in the I/O space at BAR0.
+#define VIRTIO_DEVFEATURES  0x00  // 32 bits
+#define VIRTIO_GUESTFEATURES 0x04 // 32 bits
+#define VIRTIO_QUEUEPFN     0x08  // 32 bits, physical page of the queue
+#define VIRTIO_QUEUESIZE    0x0C  // 16 bits, read-only
+#define VIRTIO_QUEUESEL     0x0E  // 16 bits
+#define VIRTIO_QUEUENOTIFY  0x10  // 16 bits
+#define VIRTIO_STATUS       0x12  // 8 bits
+#define VIRTIO_ISR          0x13  // 8 bits, reading acknowledges
+
+// Device status bits.
+#define VIRTIO_ACK          1
+#define VIRTIO_DRIVER       2
+#define VIRTIO_DRIVER_OK    4
+#define VIRTIO_FAILED       128
+
+#define VIRTIO_ID_BLK       0x10011AF4  // Device ID << 16 | Vendor ID
+
+// A virtqueue: descriptor table, available ring and used ring,
+// the used ring starting on a page boundary.
+#define VRING_DESC_F_NEXT   1  // chained with another descriptor
+#define VRING_DESC_F_WRITE  2  // device writes (vs read)
+
+struct vring_desc {
+  uint64 addr;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+struct vring_avail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vring_used_elem {
+  uint id;   // head of the descriptor chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;
+  struct vring_used_elem ring[];
+};
+
+// A block request is a header, the data, and a status byte.
+#define VIRTIO_BLK_T_IN     0  // read
+#define VIRTIO_BLK_T_OUT    1  // write
+#define VIRTIO_BLK_S_OK     0
+
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint64 sector;
+};
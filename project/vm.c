@@ -6,6 +6,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "traps.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -16,17 +17,33 @@ void
 seginit(void)
 {
   struct cpu *c;
+  int apicid;
+
+  // mycpu() only works once %gs is loaded below,
+  // so find this cpu by its APIC ID.
+  apicid = lapicid();
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->apicid == apicid)
+      break;
+  if(c == cpus+ncpu)
+    panic("seginit: unknown apicid");
+  c->self = c;
+  c->id = c - cpus;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
-  c = &cpus[cpuid()];
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+
+  // Per-cpu segment covering this cpu's struct cpu.
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+
   lgdt(c->gdt, sizeof(c->gdt));
+  loadgs(SEG_KCPU << 3);
 }
 
 // Return the address of the PTE in page table pgdir
@@ -177,6 +194,76 @@ switchuvm(struct proc *p)
   popcli();
 }
 
+// TLB shootdown. Threads of one process share a page table and may
+// run on several cpus at once, and a COW or swapped page may be
+// mapped by processes running elsewhere, so changing a PTE only
+// takes effect everywhere once those cpus have flushed their TLBs.
+// A cpu asked to flush bumps its done count before reloading %cr3;
+// it does so with interrupts off and touches no user memory in
+// between, so the requester may proceed as soon as the count moves.
+struct tlbstate {
+  volatile int pending;  // Another cpu asked us to flush
+  volatile uint done;    // Requests served
+};
+DECLARE_PERCPU(struct tlbstate, tlbstate);
+DEFINE_PERCPU(tlbstate);
+
+// Serve a pending flush request. Interrupts must be off.
+static void
+tlbserve(void)
+{
+  struct tlbstate *t = &thiscpu(tlbstate);
+
+  if(t->pending){
+    t->pending = 0;
+    t->done++;
+    lcr3(rcr3());
+  }
+}
+
+// T_TLBFLUSH interrupt.
+void
+tlbintr(void)
+{
+  tlbserve();
+}
+
+// Flush stale translations from pgdir on every cpu that may be
+// using it, or on all cpus if pgdir is 0. Call after changing or
+// removing PTEs and before freeing the pages they mapped. Other cpus
+// may spin with interrupts off waiting for a spin lock, so the
+// caller must not hold one they could be waiting for.
+void
+tlbshootdown(pde_t *pgdir)
+{
+  struct proc *p;
+  uint snap[NCPU];
+  int i, me, sent[NCPU];
+
+  pushcli();
+  me = cpuid();
+  lcr3(rcr3());
+  for(i = 0; i < ncpu; i++){
+    sent[i] = 0;
+    p = cpus[i].proc;
+    if(i == me || p == 0 || (pgdir && p->pgdir != pgdir))
+      continue;
+    snap[i] = percpu(tlbstate, i).done;
+    percpu(tlbstate, i).pending = 1;
+    lapicipi(cpus[i].apicid, T_TLBFLUSH);
+    sent[i] = 1;
+  }
+  for(i = 0; i < ncpu; i++){
+    // Serve requests aimed at us too, in case the
+    // other cpu is shooting at us at the same time.
+    while(sent[i] && percpu(tlbstate, i).done == snap[i]){
+      tlbserve();
+      pause();
+    }
+  }
+  popcli();
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -269,7 +356,7 @@ int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
-  uint a, pa;
+  uint a;
 
   if(newsz >= oldsz)
     return oldsz;
@@ -279,22 +366,9 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == 0)
-        panic("kfree");
-      char *v = P2V(pa);
-      if(*pte & PTE_S){
-        int slot= (*pte) >> 12;
-        remove_swap(slot,pte);
-      }
-      else{
-        int left=share_remove(pa,pte);
-        if(left==0) kfree(v); 
-      }
-      
-      *pte = 0;
-      if(myproc()->rss>0) myproc()->rss-=PGSIZE;
+    else if((*pte & (PTE_P|PTE_S)) != 0){
+      // The page may be swapped out meanwhile.
+      if(unmap_page(pte) && myproc()->rss>0) myproc()->rss-=PGSIZE;
     }
   }
   return newsz;
@@ -305,11 +379,19 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 void
 freevm(pde_t *pgdir)
 {
-  uint i;
-
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
+  freepgdir(pgdir);
+}
+
+// Free a page table whose user memory has been released
+// with deallocuvm().
+void
+freepgdir(pde_t *pgdir)
+{
+  uint i;
+
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
@@ -345,8 +427,13 @@ copyuvm(pde_t *pgdir, uint sz, struct proc* p)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // Program pages not read in yet are read by the child itself.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(*pte == 0)
+      continue;
     if(!(*pte & PTE_P)) page_fault_swap(pte);
     pa = PTE_ADDR(*pte);
     *pte &= ~PTE_W;
@@ -375,7 +462,7 @@ copyuvm(pde_t *pgdir, uint sz, struct proc* p)
     // cprintf("share_add (copyuvm) %d is pa and %d is pte\n",pa, pte_child);
     share_add(pa,pte_child);
   }
-  lcr3(V2P(pgdir));
+  tlbshootdown(pgdir);  // parent's PTEs are now read-only
   return d;
 
 bad: